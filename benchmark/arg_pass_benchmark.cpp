@@ -0,0 +1,79 @@
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+#include "../include/callable_traits/arg_pass.hpp"
+#include "runtime_benchmark.hpp"
+
+// Calls a functor taking 1 to 8 longs by const reference through three layers called through function pointers, like
+// the thunks of wrappers. Forwarding the arguments with their own type passes a pointer to each through every layer,
+// so the caller spills the values to the stack and the functor loads them again. With arg_pass_t they are passed in
+// registers, and the functor inlined into the last layer reads them from there.
+
+constexpr std::size_t iterations = 10'000'000;
+
+template <std::size_t>
+using value = long;
+
+template <typename... T>
+struct sum {
+	long operator()(const T&... values) const { return (values + ...); }
+};
+
+template <typename Callable, typename Signature = callable_signature_t<Callable>>
+struct layers;
+
+template <typename Callable, typename R, typename... A>
+struct layers<Callable, R(A...)> {
+	using layer = R (*)(const Callable&, A...);
+
+	// Calls the next layer through a pointer the optimizer cannot see through, as wrappers call their thunks, so it
+	// cannot change the parameter types of the layers either.
+	static R call(layer next, const Callable& callable, A... args)
+	{
+		benchmark::do_not_optimize(next);
+		return next(callable, std::forward<A>(args)...);
+	}
+
+	static R third(const Callable& callable, A... args) { return callable(std::forward<A>(args)...); }
+	static R second(const Callable& callable, A... args) { return call(&third, callable, std::forward<A>(args)...); }
+	static R first(const Callable& callable, A... args) { return call(&second, callable, std::forward<A>(args)...); }
+};
+
+template <typename Callable, std::size_t... I>
+long call_layers(const Callable& callable, std::index_sequence<I...>)
+{
+	long result = 0;
+	for (std::size_t i = 0; i < iterations; ++i)
+		result += layers<Callable>::call(&layers<Callable>::first, callable, static_cast<long>(i + I)...);
+	return result;
+}
+
+template <std::size_t... I>
+void run(std::index_sequence<I...> indices)
+{
+	char name[64];
+	long result = 0;
+	const sum<value<I>...> target;
+	const invoke_adaptor adapted(target);
+
+	std::snprintf(name, sizeof(name), "%zu arguments, std::forward<A>", sizeof...(I));
+	benchmark::run(name, iterations, [&] { result += call_layers(target, indices); });
+	std::snprintf(name, sizeof(name), "%zu arguments, arg_pass_t", sizeof...(I));
+	benchmark::run(name, iterations, [&] { result += call_layers(adapted, indices); });
+	benchmark::do_not_optimize(result);
+}
+
+int main()
+{
+	benchmark::print_header("3 layers, arguments of const long&");
+	run(std::make_index_sequence<1>{});
+	run(std::make_index_sequence<2>{});
+	run(std::make_index_sequence<3>{});
+	run(std::make_index_sequence<4>{});
+	run(std::make_index_sequence<5>{});
+	run(std::make_index_sequence<6>{});
+	run(std::make_index_sequence<7>{});
+	run(std::make_index_sequence<8>{});
+	return 0;
+}
@@ -0,0 +1,76 @@
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+
+#include "../include/callable_traits/bind_front.hpp"
+#include "../include/callable_traits/method_ref.hpp"
+#include "runtime_benchmark.hpp"
+
+// Binds the first arguments of a free function, a member function and an empty functor with bind_front, curry and
+// std::bind, prints the size of the bound callables and calls them in a tight loop, directly and stored in a
+// std::function. Functions given as fn_ref and method_ref are not stored. The bound callables are hidden from the
+// optimizer, so only what is known from their type can be inlined. std::function stores callables larger than its
+// small buffer on the heap.
+
+constexpr std::size_t iterations = 10'000'000;
+
+struct widget {
+	int resize(int width, int height) noexcept { return area = width * height; }
+	int area = 0;
+};
+
+struct scale_by {
+	int operator()(int factor, int value) const noexcept { return factor * value; }
+};
+
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int clamp(int low, int high, int value) noexcept
+{
+	return value < low ? low : value > high ? high : value;
+}
+
+template <typename Callback>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int call_in_loop(Callback callback)
+{
+	benchmark::do_not_optimize(callback);
+	int result = 0;
+	for (std::size_t i = 0; i < iterations; ++i) {
+		result += callback(static_cast<int>(i));
+		benchmark::do_not_optimize(result);
+	}
+	return result;
+}
+
+template <typename Callback>
+void run(const char* name, Callback callback)
+{
+	char label[80];
+	int result = 0;
+	std::snprintf(label, sizeof(label), "%s, %zu bytes", name, sizeof(Callback));
+	benchmark::run(label, iterations, [&] { result += call_in_loop(callback); });
+	std::snprintf(label, sizeof(label), "%s in std::function", name);
+	benchmark::run(label, iterations, [&] { result += call_in_loop(std::function<int(int)>(callback)); });
+	benchmark::do_not_optimize(result);
+}
+
+int main()
+{
+	using namespace std::placeholders;
+	widget w;
+
+	benchmark::print_header("free function, 2 of 3 arguments bound");
+	run("bind_front", bind_front(&clamp, 0, 100));
+	run("bind_front, fn_ref", bind_front(fn_ref<&clamp>{}, 0, 100));
+	run("curry", curry(&clamp)(0)(100));
+	run("std::bind", std::bind(&clamp, 0, 100, _1));
+
+	benchmark::print_header("member function, object and 1 of 2 arguments bound");
+	run("bind_front", bind_front(&widget::resize, &w, 2));
+	run("bind_front, method_ref", bind_front(method_ref<&widget::resize>(&w), 2));
+	run("std::bind", std::bind(&widget::resize, &w, 2, _1));
+
+	benchmark::print_header("empty functor, 1 of 2 arguments bound");
+	run("bind_front", bind_front(scale_by{}, 3));
+	run("curry", curry(scale_by{})(3));
+	run("std::bind", std::bind(scale_by{}, 3, _1));
+	return 0;
+}
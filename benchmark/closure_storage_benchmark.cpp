@@ -0,0 +1,67 @@
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "../include/callable_traits/closure_traits.hpp"
+#include "../include/callable_traits/inplace_function.hpp"
+#include "runtime_benchmark.hpp"
+
+// Stores 1M stateless callbacks in containers of different wrappers, and prints the memory taken by each container and
+// the time to fill it and call every callback. Stateless closures need no storage, so an inplace_function with the
+// capacity of a function pointer holds them, and to_function_pointer drops the wrapper entirely.
+
+constexpr std::size_t callbacks = 1'000'000;
+
+using callback_signature = int(int);
+using small_function = inplace_function<callback_signature, sizeof(void*), alignof(void*)>;
+
+template <typename Callback, typename F>
+void store(std::vector<Callback>& container, F f)
+{
+	if constexpr (std::is_pointer_v<Callback>)
+		container.push_back(to_function_pointer(f));
+	else
+		container.emplace_back(f);
+}
+
+// Alternates between two closure types, so the calls are not all to the same target.
+template <typename Callback>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int fill_and_call()
+{
+	std::vector<Callback> container;
+	container.reserve(callbacks);
+	for (std::size_t i = 0; i < callbacks; ++i) {
+		if (i % 2 == 0)
+			store(container, [](int value) { return value + 1; });
+		else
+			store(container, [](int value) { return value - 1; });
+	}
+	benchmark::do_not_optimize(container);
+	int sum = 0;
+	for (auto& callback : container)
+		sum += callback(1);
+	return sum;
+}
+
+template <typename Callback>
+void run(const char* name)
+{
+	char label[80];
+	std::snprintf(label, sizeof(label), "%s, %.1f MiB", name,
+	              static_cast<double>(callbacks * sizeof(Callback)) / (1024.0 * 1024.0));
+	int sum = 0;
+	benchmark::run(label, callbacks, [&] { sum += fill_and_call<Callback>(); });
+	benchmark::do_not_optimize(sum);
+}
+
+int main()
+{
+	benchmark::print_header("1M stateless callbacks");
+	run<std::function<callback_signature>>("std::vector<std::function>");
+	run<unique_function<callback_signature>>("std::vector<unique_function>");
+	run<small_function>("std::vector<inplace_function<F, sizeof(void*)>>");
+	run<callback_signature*>("std::vector<F*>, to_function_pointer");
+	return 0;
+}
@@ -0,0 +1,708 @@
+#!/usr/bin/python3
+
+"""Compile-time benchmarks for callable_traits.
+
+Generates synthetic translation units that instantiate callable_traits for thousands of distinct callables,
+compiles each of them with the given compiler and reports wall time, peak compiler memory and the number of
+template instantiations the front end performed.
+"""
+
+import argparse
+import json
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+from dataclasses import dataclass, asdict
+from itertools import product
+from pathlib import Path
+from random import Random
+from typing import Callable, Optional
+
+
+PARAMETER_TYPES = ['int', 'float', 'bool', 'const char*', 'double&', 'const long&', 'short&&', 'void*']
+RETURN_TYPES = ['void', 'int', 'float', 'bool', 'const char*', 'double&']
+
+
+@dataclass
+class Signature:
+    return_type: str
+    parameters: list[str]
+
+    def format_parameter_list(self) -> str:
+        return ', '.join(self.parameters)
+
+
+@dataclass
+class Result:
+    case: str
+    count: int
+    wall_time: float
+    peak_memory_kb: int
+    instantiations: Optional[int]
+    template_depth: Optional[int] = None
+    code_size: Optional[int] = None
+
+
+def gen_signatures(count: int, min_arity: int = 0, max_arity: int = 4) -> list[Signature]:
+    """Generates `count` distinct signatures, so every callable yields its own trait instantiation."""
+    signatures = [Signature(r, list(p))
+                  for arity in range(min_arity, max_arity + 1)
+                  for p in product(PARAMETER_TYPES, repeat=arity)
+                  for r in RETURN_TYPES]
+    if count > len(signatures):
+        raise ValueError(f'Only {len(signatures)} distinct signatures with arity {min_arity} to {max_arity} exist')
+    # A fixed seed keeps the generated sources identical between runs.
+    Random(0).shuffle(signatures)
+    return signatures[:count]
+
+
+def gen_trait_queries(callable_type: str, signature: Signature) -> list[str]:
+    """Touches every trait of the callable_traits specialization of the callable."""
+    traits = f'callable_traits<{callable_type}>'
+    queries = [f'static_assert(std::is_same_v<{traits}::result_type, {signature.return_type}>);',
+               f'static_assert({traits}::arity == {len(signature.parameters)});',
+               f'static_assert(!{traits}::is_variadic);']
+    for idx, parameter in enumerate(signature.parameters):
+        queries += [f'static_assert(std::is_same_v<{traits}::arg_type<{idx}>, {parameter}>);']
+    return queries
+
+
+def gen_variable_template_queries(callable_type: str, signature: Signature) -> list[str]:
+    """Touches the same traits as gen_trait_queries through the standalone queries."""
+    queries = [f'static_assert(std::is_same_v<callable_result_t<{callable_type}>, {signature.return_type}>);',
+               f'static_assert(callable_arity_v<{callable_type}> == {len(signature.parameters)});',
+               f'static_assert(!callable_is_variadic_v<{callable_type}>);']
+    for idx, parameter in enumerate(signature.parameters):
+        queries += [f'static_assert(std::is_same_v<callable_arg_t<{callable_type}, {idx}>, {parameter}>);']
+    return queries
+
+
+def gen_trait_arity_query(callable_type: str, signature: Signature) -> list[str]:
+    return [f'static_assert(callable_traits<{callable_type}>::arity == {len(signature.parameters)});']
+
+
+def gen_variable_template_arity_query(callable_type: str, signature: Signature) -> list[str]:
+    return [f'static_assert(callable_arity_v<{callable_type}> == {len(signature.parameters)});']
+
+
+def declare_free_function(i: int, signature: Signature) -> tuple[str, str]:
+    return f'{signature.return_type} fn_{i}({signature.format_parameter_list()});', f'decltype(fn_{i})'
+
+
+def declare_member_function(i: int, signature: Signature) -> tuple[str, str]:
+    declaration = f'struct class_{i} {{ {signature.return_type} mem_fn({signature.format_parameter_list()}) const; }};'
+    return declaration, f'decltype(&class_{i}::mem_fn)'
+
+
+def declare_lambda(i: int, signature: Signature) -> tuple[str, str]:
+    declaration = (f'[[maybe_unused]] inline const auto lambda_{i} = []({signature.format_parameter_list()})'
+                   f' -> {signature.return_type} {{ throw 0; }};')
+    return declaration, f'decltype(lambda_{i})'
+
+
+def declare_std_function(i: int, signature: Signature) -> tuple[str, str]:
+    declaration = f'using function_{i} = std::function<{signature.return_type}({signature.format_parameter_list()})>;'
+    return declaration, f'function_{i}'
+
+
+def gen_handler_table(count: int, batched: bool) -> str:
+    """Declares `count` lambdas and builds constexpr arity and specifier tables over all of them."""
+    source = gen_prologue(['callable_traits.hpp', 'callable_traits/callable_traits_list.hpp'])
+    signatures = gen_signatures(count)
+    callable_types = []
+    for i, signature in enumerate(signatures):
+        declaration, callable_type = declare_lambda(i, signature)
+        source += declaration + '\n'
+        callable_types += [callable_type]
+    if batched:
+        source += f'using handlers = callable_traits_list<{", ".join(callable_types)}>;\n'
+        source += 'constexpr auto arity = handlers::arity;\n'
+        source += 'constexpr auto specifier_mask = handlers::specifier_mask;\n'
+    else:
+        source += f'constexpr std::size_t arity[] = {{{", ".join(f"callable_traits<{c}>::arity" for c in callable_types)}}};\n'
+        source += (f'constexpr unsigned specifier_mask[] = '
+                   f'{{{", ".join(f"callable_traits<{c}>::specifier_mask" for c in callable_types)}}};\n')
+    source += f'static_assert(arity[{count - 1}] == {len(signatures[-1].parameters)});\n'
+    source += f'static_assert(specifier_mask[{count - 1}] == callable_specifier::is_const);\n'
+    return source
+
+
+def gen_arity_sweep(arity: int, query_arg_types: bool) -> str:
+    """Declares 16 functions taking `arity` arguments and queries their arity or all of their argument types."""
+    source = gen_prologue()
+    for j in range(16):
+        signature = Signature(RETURN_TYPES[j % len(RETURN_TYPES)],
+                              [PARAMETER_TYPES[(i + j) % len(PARAMETER_TYPES)] for i in range(arity)])
+        declaration, callable_type = declare_free_function(j, signature)
+        source += declaration + '\n'
+        if query_arg_types:
+            for idx, parameter in enumerate(signature.parameters):
+                source += f'static_assert(std::is_same_v<callable_traits<{callable_type}>::arg_type<{idx}>, {parameter}>);\n'
+                source += f'static_assert(std::is_same_v<callable_arg_t<{callable_type}, {idx}>, {parameter}>);\n'
+        else:
+            source += f'static_assert(callable_traits<{callable_type}>::arity == {arity});\n'
+            source += f'static_assert(callable_arity_v<{callable_type}> == {arity});\n'
+    return source
+
+
+# Callback queues as found in event loops, instantiated per closure type or per signature of the closures. Only the
+# invocation and deletion thunks depend on the closure in the latter.
+CALLBACK_QUEUES = '''
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+
+void consume(int id, ...);
+
+inline void report_failure(const char* queue, std::size_t index) { std::fprintf(stderr, "%s: callback %zu failed\\n", queue, index); }
+
+template <typename Closure, typename Signature = callable_signature_t<Closure>>
+class closure_queue;
+
+template <typename Closure, typename R, typename... A>
+class closure_queue<Closure, R(A...)> {
+public:
+	~closure_queue() { clear(); }
+	void post(Closure closure)
+	{
+		if (size_ == capacity)
+			std::abort();
+		callbacks_[size_++] = new Closure(std::move(closure));
+	}
+	void run(A... args)
+	{
+		for (std::size_t i = 0; i < size_; ++i) {
+			try {
+				(*callbacks_[i])(std::forward<A>(args)...);
+			} catch (...) {
+				report_failure(__func__, i);
+			}
+		}
+		clear();
+	}
+	void clear()
+	{
+		for (std::size_t i = 0; i < size_; ++i)
+			delete callbacks_[i];
+		size_ = 0;
+	}
+
+private:
+	static constexpr std::size_t capacity = 16;
+	Closure* callbacks_[capacity] = {};
+	std::size_t size_ = 0;
+};
+
+template <typename Signature>
+class callback_queue;
+
+template <typename R, typename... A>
+class callback_queue<R(A...)> {
+public:
+	~callback_queue() { clear(); }
+	template <typename Closure>
+	void post(Closure closure)
+	{
+		if (size_ == capacity)
+			std::abort();
+		callbacks_[size_++] = {new Closure(std::move(closure)), &invoke<Closure>, &destroy<Closure>};
+	}
+	void run(A... args)
+	{
+		for (std::size_t i = 0; i < size_; ++i) {
+			try {
+				callbacks_[i].invoke(callbacks_[i].closure, std::forward<A>(args)...);
+			} catch (...) {
+				report_failure(__func__, i);
+			}
+		}
+		clear();
+	}
+	void clear()
+	{
+		for (std::size_t i = 0; i < size_; ++i)
+			callbacks_[i].destroy(callbacks_[i].closure);
+		size_ = 0;
+	}
+
+private:
+	template <typename Closure>
+	static void invoke(void* closure, A... args) { (*static_cast<Closure*>(closure))(std::forward<A>(args)...); }
+	template <typename Closure>
+	static void destroy(void* closure) { delete static_cast<Closure*>(closure); }
+
+	struct callback {
+		void* closure;
+		void (*invoke)(void*, A...);
+		void (*destroy)(void*);
+	};
+	static constexpr std::size_t capacity = 16;
+	callback callbacks_[capacity] = {};
+	std::size_t size_ = 0;
+};
+
+'''
+
+CALLBACK_PARAMETER_TYPES = ['int', 'double', 'bool', 'const char*']
+
+
+def gen_callback_queues(count: int, by_signature: bool) -> str:
+    """Posts `count` capturing lambdas sharing few signatures to callback queues, and runs every queue once.
+
+    Queues keyed on the closure type need one queue per lambda, queues keyed on the signature one per signature.
+    """
+    source = gen_prologue() + CALLBACK_QUEUES
+    signatures = [list(p) for arity in range(3) for p in product(CALLBACK_PARAMETER_TYPES, repeat=arity)]
+    queues = min(count, len(signatures)) if by_signature else count
+    for i in range(count):
+        parameters = signatures[i % len(signatures)]
+        parameter_list = ', '.join(f'{p} a{idx}' for idx, p in enumerate(parameters))
+        arguments = ', '.join(f'a{idx}' for idx in range(len(parameters)))
+        source += (f'[[maybe_unused]] inline const auto lambda_{i} = [id = {i}]({parameter_list})'
+                   f' {{ consume(id{", " if parameters else ""}{arguments}); }};\n')
+        if i < queues:
+            queue = (f'callback_queue<callable_signature_t<decltype(lambda_{i})>>' if by_signature
+                     else f'closure_queue<decltype(lambda_{i})>')
+            source += f'{queue} queue_{i};\n'
+            source += f'void run_{i}({parameter_list}) {{ queue_{i}.run({arguments}); }}\n'
+        source += f'void post_{i}() {{ queue_{i % queues}.post(lambda_{i}); }}\n'
+    return source
+
+
+# Hand written recursive counterparts of the algorithms in callable_traits/type_list.hpp, as typically built on top of
+# arg_type<I> and arity.
+RECURSIVE_TYPE_LIST_ALGORITHMS = '''
+#include <cstddef>
+#include <tuple>
+
+template <typename Traits, std::size_t Index = 0, typename Result = std::tuple<>, bool = Index == Traits::arity>
+struct recursive_decay_args { using type = Result; };
+template <typename Traits, std::size_t Index, typename... R>
+struct recursive_decay_args<Traits, Index, std::tuple<R...>, false>
+    : recursive_decay_args<Traits, Index + 1, std::tuple<R..., std::decay_t<typename Traits::template arg_type<Index>>>> {};
+
+template <typename Traits, std::size_t Index = 0, typename Result = std::tuple<>, bool = Index == Traits::arity>
+struct recursive_pointer_args { using type = Result; };
+template <typename Traits, std::size_t Index, typename... R>
+struct recursive_pointer_args<Traits, Index, std::tuple<R...>, false>
+    : recursive_pointer_args<Traits, Index + 1, std::conditional_t<std::is_pointer_v<typename Traits::template arg_type<Index>>,
+                                                                   std::tuple<R..., typename Traits::template arg_type<Index>>,
+                                                                   std::tuple<R...>>> {};
+
+template <typename Traits, std::size_t Index = 0, bool = Index == Traits::arity>
+struct recursive_find_non_const_reference : std::integral_constant<std::size_t, Index> {};
+template <typename Traits, std::size_t Index>
+struct recursive_find_non_const_reference<Traits, Index, false>
+    : std::conditional_t<is_non_const_lvalue_reference<typename Traits::template arg_type<Index>>::value,
+                         std::integral_constant<std::size_t, Index>, recursive_find_non_const_reference<Traits, Index + 1>> {};
+
+template <typename Traits, std::size_t Index = 0, bool = Index == Traits::arity>
+struct recursive_count_pointers : std::integral_constant<std::size_t, 0> {};
+template <typename Traits, std::size_t Index>
+struct recursive_count_pointers<Traits, Index, false>
+    : std::integral_constant<std::size_t, std::is_pointer_v<typename Traits::template arg_type<Index>>
+                                              + recursive_count_pointers<Traits, Index + 1>::value> {};
+
+template <typename T, typename Tuple, std::size_t Index = 0, bool = Index == std::tuple_size_v<Tuple>>
+struct recursive_index_of : std::integral_constant<std::size_t, Index> {};
+template <typename T, typename Tuple, std::size_t Index>
+struct recursive_index_of<T, Tuple, Index, false>
+    : std::conditional_t<std::is_same_v<T, std::tuple_element_t<Index, Tuple>>, std::integral_constant<std::size_t, Index>,
+                         recursive_index_of<T, Tuple, Index + 1>> {};
+
+template <typename Tuple, typename Result = std::tuple<>>
+struct recursive_unique { using type = Result; };
+template <typename T, typename... Rest, typename... R>
+struct recursive_unique<std::tuple<T, Rest...>, std::tuple<R...>>
+    : recursive_unique<std::tuple<Rest...>, std::conditional_t<recursive_index_of<T, std::tuple<R...>>::value == sizeof...(R),
+                                                              std::tuple<R..., T>, std::tuple<R...>>> {};
+'''
+
+
+def gen_type_list_algorithms(count: int, recursive: bool) -> str:
+    """Declares `count` functions taking 12 arguments and runs the same six type list algorithms on each of them."""
+    source = gen_prologue(['callable_traits/type_list.hpp'])
+    source += ('template <typename T>\nstruct is_non_const_lvalue_reference\n'
+               '    : std::bool_constant<std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>> {};\n')
+    if recursive:
+        source += RECURSIVE_TYPE_LIST_ALGORITHMS
+    random = Random(0)
+    for i in range(count):
+        signature = Signature('void', [random.choice(PARAMETER_TYPES) for _ in range(12)])
+        declaration, callable_type = declare_free_function(i, signature)
+        source += declaration + '\n'
+        if recursive:
+            traits = f'callable_traits<{callable_type}>'
+            source += f'using decayed_{i} = recursive_decay_args<{traits}>::type;\n'
+            source += f'using pointers_{i} = recursive_pointer_args<{traits}>::type;\n'
+            source += f'static_assert(recursive_find_non_const_reference<{traits}>::value <= 12);\n'
+            source += f'static_assert(recursive_count_pointers<{traits}>::value <= 12);\n'
+            source += f'static_assert(recursive_index_of<int, decayed_{i}>::value <= 12);\n'
+            source += f'static_assert(std::tuple_size_v<recursive_unique<decayed_{i}>::type> <= 12);\n'
+        else:
+            args = f'callable_args_t<{callable_type}>'
+            source += f'using decayed_{i} = type_list_transform_t<{args}, std::decay>;\n'
+            source += f'using pointers_{i} = type_list_filter_t<{args}, std::is_pointer>;\n'
+            source += f'static_assert(type_list_find_if_v<{args}, is_non_const_lvalue_reference> <= 12);\n'
+            source += f'static_assert(type_list_count_if_v<{args}, std::is_pointer> <= 12);\n'
+            source += f'static_assert(type_list_index_of_v<decayed_{i}, int> <= 12);\n'
+            source += f'static_assert(type_list_unique_t<decayed_{i}>::size <= 12);\n'
+    return source
+
+
+CallableDeclarator = Callable[[int, Signature], tuple[str, str]]
+
+
+# Signatures used over and over again across a code base, see the precompiled-signatures import mode.
+COMMON_SIGNATURES = gen_signatures(100, max_arity=2)
+
+
+def make_common_signatures_case(declare: CallableDeclarator) -> Callable[[int], str]:
+    """Makes a case declaring `count` callables, whose signatures are taken in turn from COMMON_SIGNATURES."""
+    def gen_case(count: int) -> str:
+        source = gen_prologue()
+        for i in range(count):
+            signature = COMMON_SIGNATURES[i % len(COMMON_SIGNATURES)]
+            declaration, callable_type = declare(i, signature)
+            source += declaration + '\n'
+            source += '\n'.join(gen_trait_queries(callable_type, signature)) + '\n'
+        return source
+    return gen_case
+
+
+def gen_precompiled_signatures() -> str:
+    """Instantiates the traits shared by all callables of each of COMMON_SIGNATURES, for precompiling them."""
+    source = '#include <callable_traits.hpp>\n\n'
+    for signature in COMMON_SIGNATURES:
+        function_type = f'{signature.return_type}({signature.format_parameter_list()})'
+        source += f'static_assert(sizeof(callable_traits<{function_type}>) > 0);\n'
+        source += f'static_assert(sizeof(detail::get_function_specifiers<{function_type} const>) > 0);\n'
+    return source
+
+
+QueryGenerator = Callable[[str, Signature], list[str]]
+
+
+def gen_prologue(headers: list[str] = ['callable_traits.hpp']) -> str:
+    return '#include <type_traits>\n\n' + ''.join(f'#include <{h}>\n' for h in headers) + '\n'
+
+
+def gen_include_only(count: int) -> str:
+    del count
+    return gen_prologue()
+
+
+def make_case(declare: CallableDeclarator, gen_queries: QueryGenerator,
+              headers: list[str] = ['callable_traits.hpp']) -> Callable[[int], str]:
+    """Makes a case declaring `count` callables and querying each of them right after its declaration."""
+    def gen_case(count: int) -> str:
+        source = gen_prologue(headers)
+        for i, signature in enumerate(gen_signatures(count)):
+            declaration, callable_type = declare(i, signature)
+            source += declaration + '\n'
+            source += '\n'.join(gen_queries(callable_type, signature)) + '\n'
+        return source
+    return gen_case
+
+
+CALLABLE_KINDS: dict[str, CallableDeclarator] = {
+    'free_functions': declare_free_function,
+    'member_functions': declare_member_function,
+    'lambdas': declare_lambda,
+}
+
+QUERY_STYLES: dict[str, QueryGenerator] = {
+    '': gen_trait_queries,
+    '_queries': gen_variable_template_queries,
+    '_arity_struct': gen_trait_arity_query,
+    '_arity_query': gen_variable_template_arity_query,
+}
+
+def gen_conformance_tests(count: int) -> str:
+    """All shards of the generated conformance test suite in one translation unit, independent of `count`."""
+    del count
+    test_dir = Path(__file__).resolve().parent.parent / 'test'
+    shards = sorted((test_dir / 'callable_traits_tests').glob('*.cpp'))
+    # Only the shards, main.cpp is empty apart from main().
+    shards = [s for s in shards if s.name != 'main.cpp']
+    source = '\n'.join(shard.read_text(encoding='utf-8') for shard in shards)
+    source = source.replace('#include "../../include/callable_traits.hpp"', '#include <callable_traits.hpp>')
+    return source.replace('#include "../callable_traits_test_helper.hpp"',
+                          f'#include "{(test_dir / "callable_traits_test_helper.hpp").as_posix()}"')
+
+
+CASES: dict[str, Callable[[int], str]] = {'include_only': gen_include_only, 'conformance_tests': gen_conformance_tests}
+CASES.update({f'{kind}{style}': make_case(declare, gen_queries)
+              for style, gen_queries in QUERY_STYLES.items()
+              for kind, declare in CALLABLE_KINDS.items()})
+# Metadata tables built per callable, and in one go through callable_traits_list.
+CASES['handler_table'] = lambda count: gen_handler_table(count, False)
+CASES['handler_table_list'] = lambda count: gen_handler_table(count, True)
+# The count is the arity of the declared functions for these, so they only run when selected explicitly.
+CASES['arity_sweep_arity'] = lambda count: gen_arity_sweep(count, False)
+CASES['arity_sweep_arg_type'] = lambda count: gen_arity_sweep(count, True)
+SWEEP_CASES = {'arity_sweep_arity', 'arity_sweep_arg_type'}
+# Code size of wrappers keyed on the closure type, and on the signature of the closure, see --measure-size.
+CASES['callback_queues_by_closure'] = lambda count: gen_callback_queues(count, False)
+CASES['callback_queues_by_signature'] = lambda count: gen_callback_queues(count, True)
+# Callables sharing the few signatures in COMMON_SIGNATURES.
+CASES['common_signatures_free_functions'] = make_common_signatures_case(declare_free_function)
+CASES['common_signatures_lambdas'] = make_common_signatures_case(declare_lambda)
+# Type list algorithms over the arguments, and their recursive counterparts.
+CASES['type_list_algorithms'] = lambda count: gen_type_list_algorithms(count, False)
+CASES['type_list_algorithms_recursive'] = lambda count: gen_type_list_algorithms(count, True)
+# std::function through the generic call operator lookup, and read directly from its signature.
+CASES['std_functions'] = make_case(declare_std_function, gen_trait_queries, ['functional', 'callable_traits.hpp'])
+CASES['std_functions_direct'] = make_case(declare_std_function, gen_trait_queries,
+                                          ['functional', 'callable_traits/std_call_wrappers.hpp'])
+
+
+def count_instantiations(compiler_id: str, dump_dir: Path, source: Path) -> Optional[int]:
+    """Counts template instantiations from the dump written by the front end, if the compiler supports one."""
+    if compiler_id == 'GNU':
+        class_dump = dump_dir / f'{source.stem}.class'
+        if not class_dump.exists():
+            return None
+        with open(class_dump, encoding='utf-8', errors='replace') as dump:
+            return sum(1 for line in dump if line.startswith('Class ') and '<' in line)
+    if compiler_id in ('Clang', 'AppleClang'):
+        trace = dump_dir / f'{source.stem}.json'
+        if not trace.exists():
+            return None
+        with open(trace, encoding='utf-8') as dump:
+            events = json.load(dump).get('traceEvents', [])
+        return sum(1 for e in events if e.get('name') in ('InstantiateClass', 'InstantiateFunction'))
+    return None
+
+
+def instantiation_flags(compiler_id: str, dump_dir: Path, source: Path) -> list[str]:
+    if compiler_id == 'GNU':
+        return [f'-fdump-lang-class={dump_dir / source.stem}.class']
+    if compiler_id in ('Clang', 'AppleClang'):
+        return ['-ftime-trace-granularity=0', f'-ftime-trace={dump_dir / source.stem}.json']
+    return []
+
+
+def run_compiler(command: list[str], cwd: Path) -> tuple[float, int]:
+    """Runs the compiler, returning wall time in seconds and peak resident memory in KiB."""
+    # Diagnostics go to a file, a pipe could fill up and block the compiler before it is waited on.
+    with tempfile.TemporaryFile() as output:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=output, stderr=subprocess.STDOUT, cwd=cwd)
+        _, status, usage = os.wait4(process.pid, 0)
+        wall_time = time.perf_counter() - start
+        if os.waitstatus_to_exitcode(status) != 0:
+            output.seek(0)
+            raise RuntimeError(f'Running {shlex.join(command)} failed:\n{output.read().decode(errors="replace")}')
+    # ru_maxrss is reported in bytes on macOS and in KiB everywhere else.
+    peak_memory_kb = usage.ru_maxrss // 1024 if sys.platform == 'darwin' else usage.ru_maxrss
+    return wall_time, peak_memory_kb
+
+
+@dataclass
+class ImportMode:
+    """Replaces `#include <callable_traits.hpp>` by an import of a precompiled header unit or module.
+
+    The precompile flags include the source to precompile, the import flags are added when compiling the cases. If
+    there is a header, it is written to the work directory as the source to precompile.
+    """
+    name: str
+    statement: str
+    precompile_flags: dict[str, list[str]]
+    import_flags: dict[str, list[str]]
+    header: Optional[tuple[str, Callable[[], str]]] = None
+
+
+def module_interface() -> Path:
+    return Path(__file__).resolve().parent.parent / 'modules' / 'callable_traits.cppm'
+
+
+IMPORT_MODES: dict[str, ImportMode] = {
+    'header-unit': ImportMode(
+        'header-unit', 'import <callable_traits.hpp>;',
+        {'GNU': ['-fmodules-ts', '-x', 'c++-system-header', 'callable_traits.hpp'],
+         'Clang': ['-x', 'c++-system-header', '--precompile', 'callable_traits.hpp', '-o', 'callable_traits.pcm']},
+        {'GNU': ['-fmodules-ts'],
+         'Clang': ['-fmodule-file=callable_traits.pcm']}),
+    'module': ImportMode(
+        'module', 'import callable_traits;',
+        {'GNU': ['-fmodules-ts', '-x', 'c++', '-c', str(module_interface()), '-o', 'callable_traits.o'],
+         'Clang': ['-x', 'c++-module', '--precompile', str(module_interface()), '-o', 'callable_traits_module.pcm']},
+        {'GNU': ['-fmodules-ts'],
+         'Clang': ['-fmodule-file=callable_traits=callable_traits_module.pcm']}),
+    # Precompiled header with the traits of COMMON_SIGNATURES already instantiated, which measures what sharing those
+    # instantiations between translation units saves.
+    'precompiled-signatures': ImportMode(
+        'precompiled-signatures', '#include "callable_traits_precompiled.hpp"',
+        {'GNU': ['-x', 'c++-header', 'callable_traits_precompiled.hpp'],
+         'Clang': ['-x', 'c++-header', 'callable_traits_precompiled.hpp', '-o', 'callable_traits_precompiled.hpp.pch']},
+        {'GNU': ['-Winvalid-pch'],
+         'Clang': ['-include-pch', 'callable_traits_precompiled.hpp.pch']},
+        ('callable_traits_precompiled.hpp', gen_precompiled_signatures)),
+}
+
+
+def compiler_family(compiler_id: str) -> str:
+    return 'Clang' if compiler_id in ('Clang', 'AppleClang') else compiler_id
+
+
+def common_flags(args: argparse.Namespace) -> list[str]:
+    return [f'-std={args.std}', f'-I{args.include_dir}'] + shlex.split(args.flags)
+
+
+def precompile(args: argparse.Namespace, mode: ImportMode, work_dir: Path) -> Result:
+    """Builds the header unit or module interface imported by the cases, which is reported as its own result."""
+    flags = mode.precompile_flags.get(compiler_family(args.compiler_id))
+    if flags is None:
+        raise RuntimeError(f'Importing a {mode.name} is not supported for {args.compiler_id}')
+    if mode.header:
+        name, gen_header = mode.header
+        (work_dir / name).write_text(gen_header(), encoding='utf-8')
+    wall_time, peak_memory_kb = run_compiler(shlex.split(args.compiler) + common_flags(args) + flags, work_dir)
+    return Result(f'[{mode.name}] precompile', 0, wall_time, peak_memory_kb, None)
+
+
+def run_case(args: argparse.Namespace, case: str, count: int, work_dir: Path,
+             mode: Optional[ImportMode] = None) -> Result:
+    name = f'{case} [{mode.name}]' if mode else case
+    source = work_dir / (f'{case}_{mode.name.replace("-", "_")}.cpp' if mode else f'{case}.cpp')
+    contents = CASES[case](count)
+    flags = common_flags(args) + ['-fsyntax-only']
+    if mode:
+        contents = contents.replace('#include <callable_traits.hpp>', mode.statement)
+        flags += mode.import_flags[compiler_family(args.compiler_id)]
+    source.write_text(contents, encoding='utf-8')
+
+    best_time, best_memory = None, None
+    for _ in range(args.repeat):
+        wall_time, peak_memory_kb = run_compiler(shlex.split(args.compiler) + flags + [str(source)], work_dir)
+        best_time = wall_time if best_time is None else min(best_time, wall_time)
+        best_memory = peak_memory_kb if best_memory is None else min(best_memory, peak_memory_kb)
+
+    # Instantiation counts come from a separate run, so the dump does not skew the measurements above.
+    instantiations = None
+    extra_flags = instantiation_flags(args.compiler_id, work_dir, source)
+    if extra_flags:
+        run_compiler(shlex.split(args.compiler) + flags + extra_flags + [str(source)], work_dir)
+        instantiations = count_instantiations(args.compiler_id, work_dir, source)
+
+    template_depth = measure_template_depth(args, flags, source, work_dir) if args.measure_depth else None
+    code_size = measure_code_size(args, flags, source, work_dir) if args.measure_size else None
+    return Result(name, count, best_time, best_memory, instantiations, template_depth, code_size)
+
+
+def measure_code_size(args: argparse.Namespace, flags: list[str], source: Path, work_dir: Path) -> int:
+    """Compiles the source to an optimized object file and sums up the size of its code sections."""
+    obj = work_dir / f'{source.stem}.o'
+    flags = [f for f in flags if f != '-fsyntax-only'] + ['-O2', '-c', '-o', str(obj)]
+    run_compiler(shlex.split(args.compiler) + flags + [str(source)], work_dir)
+    sections = subprocess.run(shlex.split(args.size_tool) + ['-A', str(obj)], check=True, capture_output=True,
+                              text=True).stdout
+    # The SysV format lists one section per line as name, size and address, code sections are named .text*.
+    return sum(int(line.split()[1]) for line in sections.splitlines() if line.startswith('.text'))
+
+
+def measure_template_depth(args: argparse.Namespace, flags: list[str], source: Path, work_dir: Path) -> int:
+    """Finds the smallest template instantiation depth limit the source compiles with, by bisection."""
+    def compiles(depth: int) -> bool:
+        try:
+            run_compiler(shlex.split(args.compiler) + flags + [f'-ftemplate-depth={depth}', str(source)], work_dir)
+            return True
+        except RuntimeError:
+            return False
+
+    low, high = 1, 1024
+    if not compiles(high):
+        raise RuntimeError(f'{source} needs a template depth of more than {high}')
+    while low < high:
+        middle = (low + high) // 2
+        if compiles(middle):
+            high = middle
+        else:
+            low = middle + 1
+    return low
+
+
+def format_change(value: Optional[float], baseline: Optional[float]) -> str:
+    if value is None or not baseline:
+        return ''
+    return f' ({(value - baseline) / baseline:+.1%})'
+
+
+def print_results(results: list[Result], baseline: dict[tuple[str, int], Result]):
+    show_depth = any(r.template_depth is not None for r in results)
+    show_size = any(r.code_size is not None for r in results)
+    print(f'{"case":<56} {"count":>7} {"wall time [s]":>24} {"peak memory [MiB]":>24} {"instantiations":>24}'
+          + (f' {"template depth":>24}' if show_depth else '') + (f' {"code size [KiB]":>24}' if show_size else ''))
+    for r in results:
+        b = baseline.get((r.case, r.count))
+        wall_time = f'{r.wall_time:.3f}' + format_change(r.wall_time, b.wall_time if b else None)
+        peak_memory = f'{r.peak_memory_kb / 1024:.1f}' + format_change(r.peak_memory_kb, b.peak_memory_kb if b else None)
+        instantiations = (str(r.instantiations) if r.instantiations is not None else 'n/a') + format_change(
+            r.instantiations, b.instantiations if b else None)
+        template_depth = (str(r.template_depth) if r.template_depth is not None else 'n/a') + format_change(
+            r.template_depth, b.template_depth if b else None)
+        code_size = (f'{r.code_size / 1024:.1f}' if r.code_size is not None else 'n/a') + format_change(
+            r.code_size, b.code_size if b else None)
+        print(f'{r.case:<56} {r.count:>7} {wall_time:>24} {peak_memory:>24} {instantiations:>24}'
+              + (f' {template_depth:>24}' if show_depth else '') + (f' {code_size:>24}' if show_size else ''))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--list', action='store_true', help='print the available cases and exit')
+    parser.add_argument('--compiler', default='c++', help='compiler command line used to compile each case')
+    parser.add_argument('--compiler-id', default='GNU', help='CMake compiler id, selects the instantiation dump')
+    parser.add_argument('--include-dir', default=str(Path(__file__).resolve().parent.parent / 'include'))
+    parser.add_argument('--std', default='c++17')
+    parser.add_argument('--flags', default='', help='additional compiler flags')
+    parser.add_argument('--case', action='append', dest='cases', choices=CASES.keys(),
+                        help='case to run, may be given multiple times (default: all but the arity sweeps)')
+    parser.add_argument('--count', type=int, nargs='+', default=[1000],
+                        help='number of callables generated per case, every case runs once per given count')
+    parser.add_argument('--repeat', type=int, default=3, help='number of runs, the best one is reported')
+    parser.add_argument('--measure-depth', action='store_true',
+                        help='also find the template instantiation depth every case needs (GCC and Clang only)')
+    parser.add_argument('--measure-size', action='store_true',
+                        help='also compile every case to an object file with -O2 and report the size of its code')
+    parser.add_argument('--size-tool', default='size', help='binutils or LLVM size command used by --measure-size')
+    parser.add_argument('--import', action='append', dest='imports', default=[], choices=IMPORT_MODES.keys(),
+                        help='additionally run every case importing callable_traits as a header unit or module '
+                             'instead of including it, which requires --std c++20 or newer, or including it through '
+                             'a precompiled header with the traits of common signatures instantiated')
+    parser.add_argument('--work-dir', help='directory for generated sources (default: temporary directory)')
+    parser.add_argument('--json', help='also write the results to this file')
+    parser.add_argument('--baseline', help='results previously written with --json to compare against')
+    args = parser.parse_args()
+
+    if args.list:
+        print(';'.join(case for case in CASES if case not in SWEEP_CASES))
+        return 0
+
+    cases = args.cases or [case for case in CASES if case not in SWEEP_CASES]
+    with tempfile.TemporaryDirectory() as temp_dir:
+        work_dir = Path(args.work_dir) if args.work_dir else Path(temp_dir)
+        work_dir.mkdir(parents=True, exist_ok=True)
+        results = [run_case(args, case, count, work_dir) for case in cases for count in args.count]
+        for mode in (IMPORT_MODES[i] for i in args.imports):
+            results += [precompile(args, mode, work_dir)]
+            results += [run_case(args, case, count, work_dir, mode) for case in cases for count in args.count]
+
+    baseline = {}
+    if args.baseline:
+        with open(args.baseline, encoding='utf-8') as baseline_file:
+            baseline = {(r['case'], r['count']): Result(**r) for r in json.load(baseline_file)}
+
+    print_results(results, baseline)
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as output:
+            json.dump([asdict(r) for r in results], output, indent=2)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
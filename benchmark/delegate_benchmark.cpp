@@ -0,0 +1,52 @@
+#include <cstddef>
+#include <functional>
+
+#include "../include/callable_traits/delegate.hpp"
+#include "runtime_benchmark.hpp"
+
+// Calls a member function bound to an object in a tight loop, through delegates, std::bind and a std::function
+// wrapping a lambda. The bound callables are hidden from the optimizer, so only what is known from their type can be
+// inlined, which for delegate<constant_arg_t<...>> is the member function.
+
+constexpr std::size_t iterations = 100'000'000;
+
+struct widget {
+	int add(int value) noexcept { return total += value; }
+	int total = 0;
+};
+
+template <typename Callback>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int call_in_loop(Callback callback)
+{
+	benchmark::do_not_optimize(callback);
+	int result = 0;
+	for (std::size_t i = 0; i < iterations; ++i) {
+		result = callback(1);
+		benchmark::do_not_optimize(result);
+	}
+	return result;
+}
+
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int call_in_loop_by_reference(const std::function<int(int)>& callback)
+{
+	return call_in_loop<const std::function<int(int)>&>(callback);
+}
+
+int main()
+{
+	widget w;
+	int result = 0;
+
+	benchmark::print_header("member function bound to an object");
+	benchmark::run("delegate<constant_arg_t<&widget::add>>", iterations,
+	               [&] { result += call_in_loop(delegate(constant_arg<&widget::add>, &w)); });
+	benchmark::run("delegate<int (widget::*)(int)>", iterations,
+	               [&] { result += call_in_loop(delegate(&w, &widget::add)); });
+	benchmark::run("std::bind", iterations,
+	               [&] { result += call_in_loop(std::bind(&widget::add, &w, std::placeholders::_1)); });
+	benchmark::run("std::function wrapping a lambda", iterations,
+	               [&] { result += call_in_loop_by_reference([&w](int value) { return w.add(value); }); });
+
+	benchmark::do_not_optimize(result);
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <functional>
+
+#include "../include/callable_traits/function_ref.hpp"
+#include "runtime_benchmark.hpp"
+
+// Calls a callback in a tight loop, passed as raw function pointer, std::function or function_ref. The callbacks are
+// hidden from the optimizer, so none of them can be inlined.
+
+constexpr std::size_t iterations = 100'000'000;
+
+int add_one(int value) { return value + 1; }
+
+template <typename Callback>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int call_in_loop(Callback callback)
+{
+	benchmark::do_not_optimize(callback);
+	int result = 0;
+	for (std::size_t i = 0; i < iterations; ++i) {
+		result = callback(result);
+		benchmark::do_not_optimize(result);
+	}
+	return result;
+}
+
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int call_in_loop_by_reference(const std::function<int(int)>& callback)
+{
+	return call_in_loop<const std::function<int(int)>&>(callback);
+}
+
+// Callbacks passed down to a function once per iteration, which constructs the wrapper every time.
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int invoke_once(const std::function<int(int)>& callback, int value)
+{
+	return callback(value);
+}
+
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int invoke_once(function_ref<int(int)> callback, int value)
+{
+	return callback(value);
+}
+
+template <typename Wrapper, typename Callback>
+int pass_in_loop(const Callback& callback)
+{
+	int result = 0;
+	for (std::size_t i = 0; i < iterations; ++i) {
+		result = invoke_once(Wrapper(callback), result);
+		benchmark::do_not_optimize(result);
+	}
+	return result;
+}
+
+int main()
+{
+	int step = 1;
+	int scale = 1;
+	int offset = 0;
+	benchmark::do_not_optimize(step);
+	auto add_step = [&step](int value) { return value + step; };
+	// Too large for the small buffer of std::function in common standard libraries.
+	auto add_scaled_step = [&step, &scale, &offset](int value) { return value + step * scale + offset; };
+	int result = 0;
+
+	benchmark::print_header("function called in a loop");
+	benchmark::run("function pointer", iterations, [&] { result += call_in_loop(&add_one); });
+	benchmark::run("std::function", iterations, [&] { result += call_in_loop_by_reference(add_one); });
+	benchmark::run("function_ref", iterations, [&] { result += call_in_loop(function_ref(add_one)); });
+	benchmark::run("function_ref to constant_arg", iterations,
+	               [&] { result += call_in_loop(function_ref(constant_arg<add_one>)); });
+
+	benchmark::print_header("capturing lambda called in a loop");
+	benchmark::run("std::function", iterations, [&] { result += call_in_loop_by_reference(add_step); });
+	benchmark::run("function_ref", iterations, [&] { result += call_in_loop(function_ref(add_step)); });
+
+	benchmark::print_header("capturing lambda passed per call");
+	benchmark::run("std::function", iterations,
+	               [&] { result += pass_in_loop<std::function<int(int)>>(add_scaled_step); });
+	benchmark::run("function_ref", iterations,
+	               [&] { result += pass_in_loop<function_ref<int(int)>>(add_scaled_step); });
+
+	benchmark::do_not_optimize(result);
+	return 0;
+}
@@ -0,0 +1,65 @@
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "../include/callable_traits/inplace_function.hpp"
+#include "runtime_benchmark.hpp"
+
+// Fills task queues and runs every task. The tasks capture three pointers, which exceeds the small buffer of
+// std::function in common standard libraries. The queues are filled with and without reserving their capacity up
+// front, the difference is the cost of moving the tasks while reallocating. Queues are kept small, so their memory is
+// reused between rounds instead of being faulted in again.
+
+constexpr std::size_t tasks_per_queue = 1000;
+constexpr std::size_t rounds = 1000;
+
+// Not trivially copyable, so moving it runs its copy constructor. std::function requires copyable targets.
+struct counter_ref {
+	counter_ref(int* counter) noexcept : counter(counter) {}
+	counter_ref(const counter_ref& other) noexcept : counter(other.counter) {}
+	~counter_ref() {}
+	int* counter;
+};
+
+template <typename Task, typename MakeTask>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE void fill_and_run(MakeTask make_task, bool reserve)
+{
+	for (std::size_t round = 0; round < rounds; ++round) {
+		std::vector<Task> tasks;
+		if (reserve)
+			tasks.reserve(tasks_per_queue);
+		for (std::size_t i = 0; i < tasks_per_queue; ++i)
+			tasks.emplace_back(make_task(i));
+		for (auto& task : tasks)
+			task();
+		benchmark::do_not_optimize(tasks);
+	}
+}
+
+template <typename MakeTask>
+void run_queues(const char* title, MakeTask make_task)
+{
+	constexpr std::size_t tasks = tasks_per_queue * rounds;
+	benchmark::print_header(title);
+	benchmark::run("std::vector<std::function>", tasks, [&] { fill_and_run<std::function<void()>>(make_task, false); });
+	benchmark::run("std::vector<std::function>, reserved", tasks,
+	               [&] { fill_and_run<std::function<void()>>(make_task, true); });
+	benchmark::run("std::vector<unique_function>", tasks,
+	               [&] { fill_and_run<unique_function<void()>>(make_task, false); });
+	benchmark::run("std::vector<unique_function>, reserved", tasks,
+	               [&] { fill_and_run<unique_function<void()>>(make_task, true); });
+}
+
+int main()
+{
+	int a = 0;
+	int b = 0;
+	int c = 0;
+	run_queues("trivially copyable task", [&](std::size_t i) { return [&a, &b, &c, i] { a += int(i) + b + c; }; });
+	run_queues("task with a copy constructor", [&](std::size_t i) {
+		return [counter = counter_ref(&a), &b, i] { *counter.counter += int(i) + b; };
+	});
+
+	benchmark::do_not_optimize(a);
+	return 0;
+}
@@ -0,0 +1,71 @@
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../include/callable_traits/member_function_thunk.hpp"
+#include "runtime_benchmark.hpp"
+
+// Dispatches through a table of member functions of a polymorphic class, once storing member function pointers and
+// once storing thunks from member_function_table.
+
+constexpr std::size_t iterations = 50'000'000;
+
+struct widget {
+	CALLABLE_TRAITS_BENCHMARK_NOINLINE int add(int value) { return total += value; }
+	CALLABLE_TRAITS_BENCHMARK_NOINLINE int subtract(int value) { return total -= value; }
+	CALLABLE_TRAITS_BENCHMARK_NOINLINE int multiply(int value) { return total *= value; }
+	CALLABLE_TRAITS_BENCHMARK_NOINLINE int assign(int value) { return total = value; }
+	virtual ~widget() = default;
+	int total = 0;
+};
+
+using thunk_table = member_function_table<&widget::add, &widget::subtract, &widget::multiply, &widget::assign>;
+using member_function_pointer = int (widget::*)(int);
+
+template <typename Table, typename Call>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE int dispatch(const Table& table, const std::vector<unsigned char>& indices,
+                                                Call call)
+{
+	widget w;
+	for (std::size_t i = 0; i < iterations; ++i)
+		call(table[indices[i % indices.size()]], w, 1);
+	return w.total;
+}
+
+int main()
+{
+	std::array<member_function_pointer, 4> member_function_pointers = {&widget::add, &widget::subtract,
+	                                                                    &widget::multiply, &widget::assign};
+	auto thunks = thunk_table::thunks;
+	benchmark::do_not_optimize(member_function_pointers);
+	benchmark::do_not_optimize(thunks);
+
+	// Cycling through the table is predicted perfectly, random indices show the cost of mispredicted calls.
+	std::vector<unsigned char> cyclic_indices(4096);
+	std::vector<unsigned char> random_indices(4096);
+	std::mt19937 random;
+	for (std::size_t i = 0; i < cyclic_indices.size(); ++i) {
+		cyclic_indices[i] = static_cast<unsigned char>(i % 4);
+		random_indices[i] = static_cast<unsigned char>(random() % 4);
+	}
+
+	int result = 0;
+	std::printf("bytes per entry: member function pointer %zu, thunk %zu\n", sizeof(member_function_pointer),
+	            sizeof(thunk_table::pointer));
+	for (const auto* indices : {&cyclic_indices, &random_indices}) {
+		benchmark::print_header(indices == &cyclic_indices ? "cyclic dispatch" : "random dispatch");
+		benchmark::run("member function pointers", iterations, [&] {
+			result += dispatch(member_function_pointers, *indices,
+			                   [](member_function_pointer f, widget& w, int value) { return (w.*f)(value); });
+		});
+		benchmark::run("member_function_table thunks", iterations, [&] {
+			result +=
+			    dispatch(thunks, *indices, [](thunk_table::pointer f, widget& w, int value) { return f(w, value); });
+		});
+	}
+
+	benchmark::do_not_optimize(result);
+	return 0;
+}
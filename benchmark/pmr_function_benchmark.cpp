@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "../include/callable_traits/pmr_function.hpp"
+#include "runtime_benchmark.hpp"
+
+// Handles requests which each queue a number of callbacks capturing more than std::function stores inline, and runs
+// them. The std::function loop allocates every callback and its queue with operator new, the pmr_function loop from a
+// monotonic arena on the stack, which is released at the end of each request. Prints the calls of operator new per
+// request and percentiles of the time per request.
+
+constexpr std::size_t requests = 100'000;
+constexpr std::size_t callbacks_per_request = 16;
+
+static std::size_t new_calls = 0;
+
+void* operator new(std::size_t size)
+{
+	++new_calls;
+	if (void* p = std::malloc(size != 0 ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+struct request_context {
+	std::array<int, 8> headers;
+	int* status;
+};
+
+template <typename HandleRequest>
+void run(const char* name, HandleRequest handle_request)
+{
+	std::vector<double> latencies(requests);
+	const std::size_t calls_before = new_calls;
+	int status = 0;
+	for (std::size_t i = 0; i < requests; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+		handle_request(request_context{{static_cast<int>(i)}, &status});
+		latencies[i] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	}
+	const double calls = static_cast<double>(new_calls - calls_before) / static_cast<double>(requests);
+	benchmark::do_not_optimize(status);
+
+	std::sort(latencies.begin(), latencies.end());
+	const auto percentile = [&](double p) { return latencies[static_cast<std::size_t>(p * (requests - 1))]; };
+	std::printf("%-32s %10.1f %9.0f %9.0f %9.0f %9.0f\n", name, calls, percentile(0.5), percentile(0.9),
+	            percentile(0.99), percentile(0.999));
+}
+
+// Queues the callbacks of a request and runs them, hidden from the optimizer so the callbacks are really stored.
+template <typename Queue>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE void handle(Queue& queue, const request_context& context)
+{
+	for (std::size_t i = 0; i < callbacks_per_request; ++i)
+		queue.emplace_back([context, i] { *context.status += context.headers[0] + static_cast<int>(i); });
+	benchmark::do_not_optimize(queue);
+	for (auto& callback : queue)
+		callback();
+}
+
+int main()
+{
+	std::printf("%-32s %10s %9s %9s %9s %9s\n", "request loop", "new/req", "p50 ns", "p90 ns", "p99 ns", "p99.9 ns");
+	run("std::vector<std::function>", [](const request_context& context) {
+		std::vector<std::function<void()>> queue;
+		queue.reserve(callbacks_per_request);
+		handle(queue, context);
+	});
+	run("std::pmr::vector<pmr_function>", [](const request_context& context) {
+		alignas(std::max_align_t) std::array<std::byte, 4096> buffer;
+		std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+		std::pmr::vector<pmr_function<void()>> queue(&arena);
+		queue.reserve(callbacks_per_request);
+		handle(queue, context);
+	});
+	return 0;
+}
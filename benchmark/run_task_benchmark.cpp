@@ -0,0 +1,111 @@
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/callable_traits/bind_front.hpp"
+#include "../include/callable_traits/inplace_function.hpp"
+#include "../include/callable_traits/run_task.hpp"
+#include "runtime_benchmark.hpp"
+
+// Runs queues of tasks through run_task, which calls noexcept tasks directly and all others in a try block, and
+// std::function tasks in a try block as executors do. Then fills vectors with tasks owning a string, wrapped by
+// bind_front, whose move constructor is noexcept as the one of the task is, and by a wrapper declaring its move
+// constructor without noexcept, so std::vector copies the tasks when it reallocates.
+
+constexpr std::size_t tasks_per_queue = 1000;
+constexpr std::size_t rounds = 1000;
+
+template <typename Task>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE std::size_t run_queue(std::vector<Task>& queue)
+{
+	std::size_t failures = 0;
+	for (std::size_t round = 0; round < rounds; ++round) {
+		for (auto& task : queue)
+			failures += run_task(task) != nullptr;
+	}
+	return failures;
+}
+
+CALLABLE_TRAITS_BENCHMARK_NOINLINE std::size_t run_std_function_queue(std::vector<std::function<void()>>& queue)
+{
+	std::size_t failures = 0;
+	for (std::size_t round = 0; round < rounds; ++round) {
+		for (auto& task : queue) {
+			try {
+				task();
+			} catch (...) {
+				++failures;
+			}
+		}
+	}
+	return failures;
+}
+
+template <typename Queue, typename Run>
+void run_tasks(const char* name, Queue queue, Run run)
+{
+	std::size_t failures = 0;
+	benchmark::run(name, tasks_per_queue * rounds, [&] { failures += run(queue); });
+	benchmark::do_not_optimize(failures);
+}
+
+template <typename Task>
+Task make_queue(int& counter)
+{
+	Task queue;
+	for (std::size_t i = 0; i < tasks_per_queue; ++i)
+		queue.emplace_back([&counter, i]() noexcept { counter += static_cast<int>(i); });
+	return queue;
+}
+
+// Wrapper as written without noexcept, which makes std::vector copy instead of move when it reallocates.
+template <typename F>
+struct legacy_wrapper {
+	explicit legacy_wrapper(F f) : f(std::move(f)) {}
+	legacy_wrapper(const legacy_wrapper&) = default;
+	legacy_wrapper(legacy_wrapper&& other) : f(std::move(other.f)) {}
+	void operator()() const noexcept { f(); }
+	F f;
+};
+
+constexpr std::size_t tasks_per_vector = 1000;
+
+template <typename Wrap>
+CALLABLE_TRAITS_BENCHMARK_NOINLINE void fill_vectors(Wrap wrap)
+{
+	const std::string name(64, 'x');
+	for (std::size_t round = 0; round < rounds; ++round) {
+		std::vector<decltype(wrap(name))> tasks;
+		for (std::size_t i = 0; i < tasks_per_vector; ++i)
+			tasks.push_back(wrap(name));
+		benchmark::do_not_optimize(tasks);
+	}
+}
+
+int main()
+{
+	int counter = 0;
+	benchmark::print_header("running tasks, 1000 per queue");
+	run_tasks("unique_function<void() noexcept>, run_task",
+	          make_queue<std::vector<unique_function<void() noexcept>>>(counter),
+	          [](auto& queue) { return run_queue(queue); });
+	run_tasks("unique_function<void()>, run_task", make_queue<std::vector<unique_function<void()>>>(counter),
+	          [](auto& queue) { return run_queue(queue); });
+	run_tasks("std::function<void()>, try block", make_queue<std::vector<std::function<void()>>>(counter),
+	          [](auto& queue) { return run_std_function_queue(queue); });
+	benchmark::do_not_optimize(counter);
+
+	const auto task = [](std::string name) {
+		return [name = std::move(name)]() noexcept { benchmark::do_not_optimize(name); };
+	};
+	benchmark::print_header("filling vectors of 1000 tasks owning a string");
+	benchmark::run("bind_front, noexcept move", tasks_per_vector * rounds,
+	               [&] { fill_vectors([&](const std::string& name) { return bind_front(task(name)); }); });
+	benchmark::run("wrapper without noexcept move", tasks_per_vector * rounds, [&] {
+		fill_vectors([&](const std::string& name) { return legacy_wrapper<decltype(task(name))>(task(name)); });
+	});
+	return 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define CALLABLE_TRAITS_BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define CALLABLE_TRAITS_BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+namespace benchmark {
+
+//////////////////////////////////////////////////////////////////////////
+// Minimal runtime benchmark harness, so the runtime benchmarks do not need
+// any dependency besides the standard library.
+
+// Makes the optimizer assume value is read and modified, e.g. so the target of a callback is not known at compile time.
+template <typename T>
+inline void do_not_optimize(T& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	static_cast<void>(static_cast<volatile T*>(&value));
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r"(&value) : "memory");
+#endif
+}
+
+// Runs body, which performs iterations operations, repeat times and prints the time per operation of the fastest run.
+template <typename Body>
+void run(const char* name, std::size_t iterations, Body&& body, int repeat = 5)
+{
+	auto best = std::chrono::steady_clock::duration::max();
+	for (int i = 0; i < repeat; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+		body();
+		best = std::min(best, std::chrono::steady_clock::now() - start);
+	}
+	const double ns = std::chrono::duration<double, std::nano>(best).count() / static_cast<double>(iterations);
+	std::printf("%-56s %12.3f ns\n", name, ns);
+}
+
+inline void print_header(const char* title) { std::printf("%-56s %15s\n", title, "time per op"); }
+
+} // namespace benchmark
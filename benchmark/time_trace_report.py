@@ -0,0 +1,160 @@
+#!/usr/bin/python3
+
+"""Attributes template instantiation time in Clang -ftime-trace output to the templates and callables involved.
+
+Reads the trace files written by Clang when compiling with -ftime-trace (see the CALLABLE_TRAITS_TIME_TRACE CMake
+option) and reports
+- per template, e.g. detail::get_function_specifiers, how often it got instantiated and how much time went into it,
+- the most expensive single instantiations of the matching templates, which names the callables or signatures that
+  are most expensive to analyze.
+"""
+
+import argparse
+import json
+import re
+import sys
+from collections import defaultdict
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Iterator
+
+
+INSTANTIATION_EVENTS = ('InstantiateClass', 'InstantiateFunction')
+
+# Templates of callable_traits and the standard library templates it used to, or still does, rely on.
+DEFAULT_FILTER = (r'^(callable_\w+|detail::\w+|std::(tuple_element|tuple|function|move_only_function|packaged_task'
+                  r'|reference_wrapper|integer_sequence|remove_\w+|is_same|void_t|__type_pack_element)\w*)$')
+
+
+@dataclass
+class Instantiation:
+    name: str
+    detail: str
+    file: Path
+    start: int
+    duration: int
+    self_duration: int = 0
+    children: list['Instantiation'] = field(default_factory=list)
+
+
+@dataclass
+class TemplateStats:
+    count: int = 0
+    total_us: int = 0
+    self_us: int = 0
+
+
+def template_name(detail: str) -> str:
+    """The name of the instantiated template without its arguments, e.g. detail::get_functor_traits."""
+    return detail.split('<', 1)[0].strip()
+
+
+def find_traces(paths: list[Path]) -> Iterator[Path]:
+    for path in paths:
+        if path.is_dir():
+            yield from sorted(path.rglob('*.json'))
+        else:
+            yield path
+
+
+def read_instantiations(trace: Path) -> list[Instantiation]:
+    """Reads the instantiation events of a trace file, with the self time of every instantiation filled in.
+
+    Returns an empty list for JSON files which are not Clang time traces.
+    """
+    try:
+        with open(trace, encoding='utf-8') as trace_file:
+            contents = json.load(trace_file)
+    except (OSError, UnicodeDecodeError, json.JSONDecodeError):
+        return []
+    if not isinstance(contents, dict) or 'traceEvents' not in contents:
+        return []
+
+    events = [Instantiation(e['name'], e.get('args', {}).get('detail', ''), trace, e['ts'], e['dur'])
+              for e in contents['traceEvents']
+              if e.get('ph') == 'X' and e.get('name') in INSTANTIATION_EVENTS and 'dur' in e]
+    # Nested instantiations lie within the time span of the one that triggered them, which is how the self time of
+    # every instantiation is derived.
+    events.sort(key=lambda e: (e.start, -e.duration))
+    stack: list[Instantiation] = []
+    for event in events:
+        while stack and event.start >= stack[-1].start + stack[-1].duration:
+            stack.pop()
+        if stack:
+            stack[-1].children.append(event)
+        stack.append(event)
+    for event in events:
+        event.self_duration = event.duration - sum(c.duration for c in event.children)
+    return events
+
+
+def collect_template_stats(instantiations: list[Instantiation]) -> dict[str, TemplateStats]:
+    stats: dict[str, TemplateStats] = defaultdict(TemplateStats)
+
+    # Inclusive time only counts the outermost instantiation of a template, so recursive templates are not counted
+    # once per level.
+    def visit(event: Instantiation, active: set[str]):
+        name = template_name(event.detail)
+        stats[name].count += 1
+        stats[name].self_us += event.self_duration
+        if name not in active:
+            stats[name].total_us += event.duration
+        for child in event.children:
+            visit(child, active | {name})
+
+    children = {id(c) for e in instantiations for c in e.children}
+    for event in instantiations:
+        if id(event) not in children:
+            visit(event, set())
+    return stats
+
+
+def format_ms(us: int) -> str:
+    return f'{us / 1000:.1f}'
+
+
+def print_report(instantiations: list[Instantiation], template_filter: re.Pattern, top: int):
+    total_us = sum(e.self_duration for e in instantiations)
+    print(f'{len(instantiations)} instantiations taking {format_ms(total_us)} ms in total\n')
+
+    stats = collect_template_stats(instantiations)
+    matching = sorted(((name, s) for name, s in stats.items() if template_filter.match(name)),
+                      key=lambda item: item[1].total_us, reverse=True)
+    print(f'{"template":<60} {"count":>8} {"total [ms]":>12} {"self [ms]":>12} {"self [%]":>9}')
+    for name, s in matching[:top]:
+        share = s.self_us / total_us if total_us else 0
+        print(f'{name[:60]:<60} {s.count:>8} {format_ms(s.total_us):>12} {format_ms(s.self_us):>12} {share:>9.1%}')
+
+    # Identical instantiations in different translation units are summed up, as each of them costs build time.
+    per_instantiation: dict[str, TemplateStats] = defaultdict(TemplateStats)
+    for event in instantiations:
+        if template_filter.match(template_name(event.detail)):
+            per_instantiation[event.detail].count += 1
+            per_instantiation[event.detail].total_us += event.duration
+            per_instantiation[event.detail].self_us += event.self_duration
+    expensive = sorted(per_instantiation.items(), key=lambda item: item[1].total_us, reverse=True)
+    print(f'\n{"most expensive instantiations":<100} {"count":>8} {"total [ms]":>12}')
+    for detail, s in expensive[:top]:
+        print(f'{detail[:100]:<100} {s.count:>8} {format_ms(s.total_us):>12}')
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('traces', nargs='+', type=Path,
+                        help='trace files, or directories which are searched for them recursively')
+    parser.add_argument('--filter', default=DEFAULT_FILTER,
+                        help='regular expression selecting the templates to report, matched against their names')
+    parser.add_argument('--top', type=int, default=20, help='number of templates and instantiations to report')
+    args = parser.parse_args()
+
+    instantiations = [i for trace in find_traces(args.traces) for i in read_instantiations(trace)]
+    if not instantiations:
+        print('No template instantiations found, were the sources compiled by Clang with -ftime-trace?',
+              file=sys.stderr)
+        return 1
+    print_report(instantiations, re.compile(args.filter), args.top)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
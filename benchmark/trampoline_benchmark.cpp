@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../include/callable_traits/trampoline.hpp"
+#include "runtime_benchmark.hpp"
+
+// Sorts integers with qsort_r, comparing through a trampoline calling a lambda and through a hand-written comparator
+// reading the same state from its user data. qsort with a plain comparator and std::sort are the baselines. qsort_r
+// is only available with glibc.
+
+constexpr std::size_t elements = 1'000'000;
+
+struct sort_order {
+	bool descending;
+};
+
+extern "C" int compare_ints(const void* a, const void* b)
+{
+	const int lhs = *static_cast<const int*>(a);
+	const int rhs = *static_cast<const int*>(b);
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+extern "C" int compare_ints_ordered(const void* a, const void* b, void* user_data)
+{
+	const int lhs = *static_cast<const int*>(a);
+	const int rhs = *static_cast<const int*>(b);
+	const int result = (lhs > rhs) - (lhs < rhs);
+	return static_cast<const sort_order*>(user_data)->descending ? -result : result;
+}
+
+template <typename Sort>
+void run_sort(const char* name, const std::vector<int>& input, Sort sort)
+{
+	std::vector<int> values;
+	benchmark::run(name, elements, [&] {
+		values = input;
+		sort(values);
+		benchmark::do_not_optimize(values);
+	});
+}
+
+int main()
+{
+	std::vector<int> input(elements);
+	std::mt19937 random;
+	for (auto& value : input)
+		value = static_cast<int>(random());
+
+	sort_order order{false};
+	benchmark::do_not_optimize(order);
+	auto compare = [&order](const void* a, const void* b) {
+		const int lhs = *static_cast<const int*>(a);
+		const int rhs = *static_cast<const int*>(b);
+		const int result = (lhs > rhs) - (lhs < rhs);
+		return order.descending ? -result : result;
+	};
+
+	benchmark::print_header("sorting 1M integers");
+	run_sort("qsort, plain comparator", input,
+	         [](std::vector<int>& values) { std::qsort(values.data(), values.size(), sizeof(int), compare_ints); });
+#if defined(__GLIBC__)
+	run_sort("qsort_r, hand-written comparator", input, [&](std::vector<int>& values) {
+		qsort_r(values.data(), values.size(), sizeof(int), compare_ints_ordered, &order);
+	});
+	run_sort("qsort_r, lambda through trampoline_last_v", input, [&](std::vector<int>& values) {
+		auto callback = make_trampoline_last(compare);
+		qsort_r(values.data(), values.size(), sizeof(int), callback.function, callback.user_data);
+	});
+#else
+	std::printf("qsort_r is not available, skipping the trampoline cases\n");
+#endif
+	run_sort("std::sort, lambda", input, [&](std::vector<int>& values) {
+		std::sort(values.begin(), values.end(),
+		          [&order](int lhs, int rhs) { return order.descending ? rhs < lhs : lhs < rhs; });
+	});
+	return 0;
+}
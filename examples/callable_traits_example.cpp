@@ -21,6 +21,7 @@ void inspect_callable(const std::string_view signature)
 	std::cout << "Callable is rvalue reference : " << traits::is_rvalue_reference << std::endl;
 	std::cout << "Callable is noexcept         : " << traits::is_noexcept << std::endl;
 	std::cout << "Callable is variadic         : " << traits::is_variadic << std::endl;
+	std::cout << "Callable has specifier mask  : " << traits::specifier_mask << std::endl;
 	std::cout << "Callable has result type     : " << utils::get_type_name<typename traits::result_type>() << std::endl;
 	std::cout << "Callable has arity           : " << traits::arity << std::endl;
 
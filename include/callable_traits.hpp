@@ -1,127 +1,263 @@
 #pragma once
 
 #include <cstddef>
-#include <tuple>
 #include <type_traits>
+#include <utility>
+
+// Deducing noexcept(N) in partial specializations is not reliably supported by MSVC, so it falls back to spelling
+// out every noexcept variant there.
+#if !defined(CALLABLE_TRAITS_DEDUCE_NOEXCEPT)
+#if defined(_MSC_VER) && !defined(__clang__)
+#define CALLABLE_TRAITS_DEDUCE_NOEXCEPT 0
+#else
+#define CALLABLE_TRAITS_DEDUCE_NOEXCEPT 1
+#endif
+#endif
+
+// With C++20, functors are detected through concepts instead of SFINAE, and the standalone queries which need the
+// function type of a callable are constrained on it, so misuse fails at the query with a short diagnostic.
+#if !defined(CALLABLE_TRAITS_USE_CONCEPTS)
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+#define CALLABLE_TRAITS_USE_CONCEPTS 1
+#else
+#define CALLABLE_TRAITS_USE_CONCEPTS 0
+#endif
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define CALLABLE_TRAITS_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Flags making up callable_traits<Callable>::specifier_mask.
+
+struct callable_specifier {
+	enum : unsigned {
+		none = 0,
+		is_const = 1u << 0,
+		is_volatile = 1u << 1,
+		is_lvalue_reference = 1u << 2,
+		is_rvalue_reference = 1u << 3,
+		is_noexcept = 1u << 4,
+		is_variadic = 1u << 5,
+	};
+};
+
+//////////////////////////////////////////////////////////////////////////
+// List of types, e.g. the argument types in callable_traits<Callable>::args.
+// Algorithms over it are in callable_traits/type_list.hpp.
+
+template <typename... T>
+struct type_list {
+	static constexpr std::size_t size = sizeof...(T);
+};
 
 namespace detail {
 
+//////////////////////////////////////////////////////////////////////////
+// Type pack indexing
+
+#if defined(CALLABLE_TRAITS_HAS_TYPE_PACK_ELEMENT)
+
+template <std::size_t Index, typename... T>
+using type_pack_element_t = __type_pack_element<Index, T...>;
+
+#else
+
+// Every type of the pack becomes a base tagged with its index, and the requested one is picked by overload
+// resolution. This does not recurse over the pack, so the depth is bounded by std::make_index_sequence, which is
+// a builtin in all major standard libraries.
+template <std::size_t Index, typename T>
+struct indexed_type {
+	using type = T;
+};
+
+template <typename Indices, typename... T>
+struct indexed_types;
+
+template <std::size_t... Indices, typename... T>
+struct indexed_types<std::index_sequence<Indices...>, T...> : indexed_type<Indices, T>... {};
+
+template <std::size_t Index, typename T>
+indexed_type<Index, T> select_indexed_type(const indexed_type<Index, T>&);
+
+template <std::size_t Index, typename... T>
+using type_pack_element_t =
+    typename decltype(select_indexed_type<Index>(indexed_types<std::index_sequence_for<T...>, T...>{}))::type;
+
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Helper traits
 
+// The specifiers are stripped from the function type before it gets here, so signature_type is the same for every
+// callable with the same result and argument types. Together with specifier_mask it describes the call operator.
+
 template <typename T>
 struct get_function_types {};
 
 template <typename R>
 struct get_function_types<R()> {
+	using signature_type = R();
 	using result_type = R;
+	using args = type_list<>;
 	static constexpr std::size_t arity = 0;
 };
 
 template <typename R, typename A0>
 struct get_function_types<R(A0)> {
+	using signature_type = R(A0);
 	using result_type = R;
+	using args = type_list<A0>;
 	using arg0_type = A0;
 	template <std::size_t Index>
-	using arg_type = typename std::tuple_element_t<Index, std::tuple<A0>>;
+	using arg_type = type_pack_element_t<Index, A0>;
 	static constexpr std::size_t arity = 1;
 };
 
 template <typename R, typename A0, typename A1>
 struct get_function_types<R(A0, A1)> {
+	using signature_type = R(A0, A1);
 	using result_type = R;
+	using args = type_list<A0, A1>;
 	using arg0_type = A0;
 	using arg1_type = A1;
 	template <std::size_t Index>
-	using arg_type = typename std::tuple_element_t<Index, std::tuple<A0, A1>>;
+	using arg_type = type_pack_element_t<Index, A0, A1>;
 	static constexpr std::size_t arity = 2;
 };
 
 template <typename R, typename A0, typename A1, typename A2>
 struct get_function_types<R(A0, A1, A2)> {
+	using signature_type = R(A0, A1, A2);
 	using result_type = R;
+	using args = type_list<A0, A1, A2>;
 	using arg0_type = A0;
 	using arg1_type = A1;
 	using arg2_type = A2;
 	template <std::size_t Index>
-	using arg_type = typename std::tuple_element_t<Index, std::tuple<A0, A1, A2>>;
+	using arg_type = type_pack_element_t<Index, A0, A1, A2>;
 	static constexpr std::size_t arity = 3;
 };
 
 template <typename R, typename A0, typename A1, typename A2, typename... A>
 struct get_function_types<R(A0, A1, A2, A...)> {
+	using signature_type = R(A0, A1, A2, A...);
 	using result_type = R;
+	using args = type_list<A0, A1, A2, A...>;
 	using arg0_type = A0;
 	using arg1_type = A1;
 	using arg2_type = A2;
 	template <std::size_t Index>
-	using arg_type = typename std::tuple_element_t<Index, std::tuple<A0, A1, A2, A...>>;
+	using arg_type = type_pack_element_t<Index, A0, A1, A2, A...>;
 	static constexpr std::size_t arity = 3 + sizeof...(A);
 };
 
-template <bool IsConst, bool IsVolatile, bool IsLvalueReference, bool IsRvalueReference, bool IsNoexcept,
-          bool IsVariadic>
+constexpr unsigned make_specifier_mask(bool is_const, bool is_volatile, bool is_lvalue_reference,
+                                      bool is_rvalue_reference, bool is_noexcept, bool is_variadic)
+{
+	return (is_const ? callable_specifier::is_const : 0u) | (is_volatile ? callable_specifier::is_volatile : 0u)
+	       | (is_lvalue_reference ? callable_specifier::is_lvalue_reference : 0u)
+	       | (is_rvalue_reference ? callable_specifier::is_rvalue_reference : 0u)
+	       | (is_noexcept ? callable_specifier::is_noexcept : 0u)
+	       | (is_variadic ? callable_specifier::is_variadic : 0u);
+}
+
+template <unsigned SpecifierMask>
 struct add_specifiers {
-	static constexpr bool is_const = IsConst;
-	static constexpr bool is_volatile = IsVolatile;
-	static constexpr bool is_lvalue_reference = IsLvalueReference;
-	static constexpr bool is_rvalue_reference = IsRvalueReference;
-	static constexpr bool is_noexcept = IsNoexcept;
-	static constexpr bool is_variadic = IsVariadic;
+	static constexpr unsigned specifier_mask = SpecifierMask;
+	static constexpr bool is_const = (SpecifierMask & callable_specifier::is_const) != 0;
+	static constexpr bool is_volatile = (SpecifierMask & callable_specifier::is_volatile) != 0;
+	static constexpr bool is_lvalue_reference = (SpecifierMask & callable_specifier::is_lvalue_reference) != 0;
+	static constexpr bool is_rvalue_reference = (SpecifierMask & callable_specifier::is_rvalue_reference) != 0;
+	static constexpr bool is_noexcept = (SpecifierMask & callable_specifier::is_noexcept) != 0;
+	static constexpr bool is_variadic = (SpecifierMask & callable_specifier::is_variadic) != 0;
 };
 
+// With CALLABLE_TRAITS_DEDUCE_NOEXCEPT the noexcept specifier is deduced, which halves the number of partial
+// specializations a function type is matched against.
 // clang-format off
-template <typename T>                struct get_function_specifiers                                                                                                         {};
-
-template <typename R, typename... A> struct get_function_specifiers<R(A...)>                                : add_specifiers<0, 0, 0, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const>                          : add_specifiers<1, 0, 0, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile>                       : add_specifiers<0, 1, 0, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile>                 : add_specifiers<1, 1, 0, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) &>                              : add_specifiers<0, 0, 1, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const&>                         : add_specifiers<1, 0, 1, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile&>                      : add_specifiers<0, 1, 1, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile&>                : add_specifiers<1, 1, 1, 0, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) &&>                             : add_specifiers<0, 0, 0, 1, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const&&>                        : add_specifiers<1, 0, 0, 1, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile&&>                     : add_specifiers<0, 1, 0, 1, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile&&>               : add_specifiers<1, 1, 0, 1, 0, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) noexcept>                       : add_specifiers<0, 0, 0, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const noexcept>                 : add_specifiers<1, 0, 0, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile noexcept>              : add_specifiers<0, 1, 0, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile noexcept>        : add_specifiers<1, 1, 0, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) & noexcept>                     : add_specifiers<0, 0, 1, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const& noexcept>                : add_specifiers<1, 0, 1, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile& noexcept>             : add_specifiers<0, 1, 1, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile& noexcept>       : add_specifiers<1, 1, 1, 0, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) && noexcept>                    : add_specifiers<0, 0, 0, 1, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const&& noexcept>               : add_specifiers<1, 0, 0, 1, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile&& noexcept>            : add_specifiers<0, 1, 0, 1, 1, 0>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile&& noexcept>      : add_specifiers<1, 1, 0, 1, 1, 0>, get_function_types<R(A...)> {};
-
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...)>                           : add_specifiers<0, 0, 0, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const>                     : add_specifiers<1, 0, 0, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile>                  : add_specifiers<0, 1, 0, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile>            : add_specifiers<1, 1, 0, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) &>                         : add_specifiers<0, 0, 1, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const&>                    : add_specifiers<1, 0, 1, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile&>                 : add_specifiers<0, 1, 1, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile&>           : add_specifiers<1, 1, 1, 0, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) &&>                        : add_specifiers<0, 0, 0, 1, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const&&>                   : add_specifiers<1, 0, 0, 1, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile&&>                : add_specifiers<0, 1, 0, 1, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile&&>          : add_specifiers<1, 1, 0, 1, 0, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) noexcept>                  : add_specifiers<0, 0, 0, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const noexcept>            : add_specifiers<1, 0, 0, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile noexcept>         : add_specifiers<0, 1, 0, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile noexcept>   : add_specifiers<1, 1, 0, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) & noexcept>                : add_specifiers<0, 0, 1, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const& noexcept>           : add_specifiers<1, 0, 1, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile& noexcept>        : add_specifiers<0, 1, 1, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile& noexcept>  : add_specifiers<1, 1, 1, 0, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) && noexcept>               : add_specifiers<0, 0, 0, 1, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const&& noexcept>          : add_specifiers<1, 0, 0, 1, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile&& noexcept>       : add_specifiers<0, 1, 0, 1, 1, 1>, get_function_types<R(A...)> {};
-template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile&& noexcept> : add_specifiers<1, 1, 0, 1, 1, 1>, get_function_types<R(A...)> {};
+template <typename T> struct get_function_specifiers {};
+
+#if CALLABLE_TRAITS_DEDUCE_NOEXCEPT
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) noexcept(N)>                       : add_specifiers<make_specifier_mask(0, 0, 0, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) const noexcept(N)>                 : add_specifiers<make_specifier_mask(1, 0, 0, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) volatile noexcept(N)>              : add_specifiers<make_specifier_mask(0, 1, 0, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) const volatile noexcept(N)>        : add_specifiers<make_specifier_mask(1, 1, 0, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) & noexcept(N)>                     : add_specifiers<make_specifier_mask(0, 0, 1, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) const& noexcept(N)>                : add_specifiers<make_specifier_mask(1, 0, 1, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) volatile& noexcept(N)>             : add_specifiers<make_specifier_mask(0, 1, 1, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) const volatile& noexcept(N)>       : add_specifiers<make_specifier_mask(1, 1, 1, 0, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) && noexcept(N)>                    : add_specifiers<make_specifier_mask(0, 0, 0, 1, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) const&& noexcept(N)>               : add_specifiers<make_specifier_mask(1, 0, 0, 1, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) volatile&& noexcept(N)>            : add_specifiers<make_specifier_mask(0, 1, 0, 1, N, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A...) const volatile&& noexcept(N)>      : add_specifiers<make_specifier_mask(1, 1, 0, 1, N, 0)>, get_function_types<R(A...)> {};
+
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) noexcept(N)>                  : add_specifiers<make_specifier_mask(0, 0, 0, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) const noexcept(N)>            : add_specifiers<make_specifier_mask(1, 0, 0, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) volatile noexcept(N)>         : add_specifiers<make_specifier_mask(0, 1, 0, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) const volatile noexcept(N)>   : add_specifiers<make_specifier_mask(1, 1, 0, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) & noexcept(N)>                : add_specifiers<make_specifier_mask(0, 0, 1, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) const& noexcept(N)>           : add_specifiers<make_specifier_mask(1, 0, 1, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) volatile& noexcept(N)>        : add_specifiers<make_specifier_mask(0, 1, 1, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) const volatile& noexcept(N)>  : add_specifiers<make_specifier_mask(1, 1, 1, 0, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) && noexcept(N)>               : add_specifiers<make_specifier_mask(0, 0, 0, 1, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) const&& noexcept(N)>          : add_specifiers<make_specifier_mask(1, 0, 0, 1, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) volatile&& noexcept(N)>       : add_specifiers<make_specifier_mask(0, 1, 0, 1, N, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A, bool N> struct get_function_specifiers<R(A..., ...) const volatile&& noexcept(N)> : add_specifiers<make_specifier_mask(1, 1, 0, 1, N, 1)>, get_function_types<R(A...)> {};
+#else
+template <typename R, typename... A> struct get_function_specifiers<R(A...)>                                : add_specifiers<make_specifier_mask(0, 0, 0, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const>                          : add_specifiers<make_specifier_mask(1, 0, 0, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile>                       : add_specifiers<make_specifier_mask(0, 1, 0, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile>                 : add_specifiers<make_specifier_mask(1, 1, 0, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) &>                              : add_specifiers<make_specifier_mask(0, 0, 1, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const&>                         : add_specifiers<make_specifier_mask(1, 0, 1, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile&>                      : add_specifiers<make_specifier_mask(0, 1, 1, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile&>                : add_specifiers<make_specifier_mask(1, 1, 1, 0, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) &&>                             : add_specifiers<make_specifier_mask(0, 0, 0, 1, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const&&>                        : add_specifiers<make_specifier_mask(1, 0, 0, 1, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile&&>                     : add_specifiers<make_specifier_mask(0, 1, 0, 1, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile&&>               : add_specifiers<make_specifier_mask(1, 1, 0, 1, 0, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) noexcept>                       : add_specifiers<make_specifier_mask(0, 0, 0, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const noexcept>                 : add_specifiers<make_specifier_mask(1, 0, 0, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile noexcept>              : add_specifiers<make_specifier_mask(0, 1, 0, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile noexcept>        : add_specifiers<make_specifier_mask(1, 1, 0, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) & noexcept>                     : add_specifiers<make_specifier_mask(0, 0, 1, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const& noexcept>                : add_specifiers<make_specifier_mask(1, 0, 1, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile& noexcept>             : add_specifiers<make_specifier_mask(0, 1, 1, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile& noexcept>       : add_specifiers<make_specifier_mask(1, 1, 1, 0, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) && noexcept>                    : add_specifiers<make_specifier_mask(0, 0, 0, 1, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const&& noexcept>               : add_specifiers<make_specifier_mask(1, 0, 0, 1, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) volatile&& noexcept>            : add_specifiers<make_specifier_mask(0, 1, 0, 1, 1, 0)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A...) const volatile&& noexcept>      : add_specifiers<make_specifier_mask(1, 1, 0, 1, 1, 0)>, get_function_types<R(A...)> {};
+
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...)>                           : add_specifiers<make_specifier_mask(0, 0, 0, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const>                     : add_specifiers<make_specifier_mask(1, 0, 0, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile>                  : add_specifiers<make_specifier_mask(0, 1, 0, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile>            : add_specifiers<make_specifier_mask(1, 1, 0, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) &>                         : add_specifiers<make_specifier_mask(0, 0, 1, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const&>                    : add_specifiers<make_specifier_mask(1, 0, 1, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile&>                 : add_specifiers<make_specifier_mask(0, 1, 1, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile&>           : add_specifiers<make_specifier_mask(1, 1, 1, 0, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) &&>                        : add_specifiers<make_specifier_mask(0, 0, 0, 1, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const&&>                   : add_specifiers<make_specifier_mask(1, 0, 0, 1, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile&&>                : add_specifiers<make_specifier_mask(0, 1, 0, 1, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile&&>          : add_specifiers<make_specifier_mask(1, 1, 0, 1, 0, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) noexcept>                  : add_specifiers<make_specifier_mask(0, 0, 0, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const noexcept>            : add_specifiers<make_specifier_mask(1, 0, 0, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile noexcept>         : add_specifiers<make_specifier_mask(0, 1, 0, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile noexcept>   : add_specifiers<make_specifier_mask(1, 1, 0, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) & noexcept>                : add_specifiers<make_specifier_mask(0, 0, 1, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const& noexcept>           : add_specifiers<make_specifier_mask(1, 0, 1, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile& noexcept>        : add_specifiers<make_specifier_mask(0, 1, 1, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile& noexcept>  : add_specifiers<make_specifier_mask(1, 1, 1, 0, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) && noexcept>               : add_specifiers<make_specifier_mask(0, 0, 0, 1, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const&& noexcept>          : add_specifiers<make_specifier_mask(1, 0, 0, 1, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) volatile&& noexcept>       : add_specifiers<make_specifier_mask(0, 1, 0, 1, 1, 1)>, get_function_types<R(A...)> {};
+template <typename R, typename... A> struct get_function_specifiers<R(A..., ...) const volatile&& noexcept> : add_specifiers<make_specifier_mask(1, 1, 0, 1, 1, 1)>, get_function_types<R(A...)> {};
+#endif
 // clang-format on
 
 template <typename T>
@@ -138,18 +274,102 @@ struct get_member_function_traits<F C::*> : get_function_traits<F> {
 	static constexpr bool is_member_function = true;
 };
 
+#if CALLABLE_TRAITS_USE_CONCEPTS
+// Functors with a single, non-template call operator. Member function pointers are told apart by pattern matching
+// and need no concept.
+template <typename T>
+concept callable_object = requires { &T::operator(); };
+
+// Function types, which is what every callable is reduced to before its signature is analyzed.
+template <typename T>
+concept free_function = std::is_function_v<T>;
+#endif
+
+template <typename T, typename = void>
+struct detect_call_operator {};
+
+#if CALLABLE_TRAITS_USE_CONCEPTS
+template <callable_object T>
+struct detect_call_operator<T, void> {
+#else
+template <typename T>
+struct detect_call_operator<T, std::void_t<decltype(&T::operator())>> {
+#endif
+	using type = decltype(&T::operator());
+};
+
+// Member function pointer type of the call operator of a functor. Call wrappers whose signature is known up front
+// specialize this (see callable_traits/std_call_wrappers.hpp), so the wrapper itself never gets instantiated.
+template <typename T>
+struct get_call_operator : detect_call_operator<T> {};
+
+#if CALLABLE_TRAITS_USE_CONCEPTS
+template <typename T>
+concept has_call_operator = requires { typename get_call_operator<T>::type; };
+#endif
+
 template <typename T, typename = void>
 struct get_functor_traits : get_member_function_traits<T> {
 	static constexpr bool is_functor = false;
 };
 
+#if CALLABLE_TRAITS_USE_CONCEPTS
+template <has_call_operator T>
+struct get_functor_traits<T, void>
+#else
 template <typename T>
-struct get_functor_traits<T, std::void_t<decltype(&T::operator())>>
-    : get_member_function_traits<decltype(&T::operator())> {
+struct get_functor_traits<T, std::void_t<typename get_call_operator<T>::type>>
+#endif
+    : get_member_function_traits<typename get_call_operator<T>::type> {
 	static constexpr bool is_functor = true;
 	static constexpr bool is_member_function = false;
 };
 
+// Locates the function type of a callable without instantiating the trait hierarchy above, for the standalone
+// queries.
+template <typename T, typename = void>
+struct get_function_type {
+	using type = std::remove_pointer_t<T>;
+	static constexpr bool is_member_function = false;
+	static constexpr bool is_functor = false;
+};
+
+template <typename C, typename F>
+struct get_function_type<F C::*, void> {
+	using type = F;
+	using class_type = C;
+	static constexpr bool is_member_function = true;
+	static constexpr bool is_functor = false;
+};
+
+#if CALLABLE_TRAITS_USE_CONCEPTS
+template <has_call_operator T>
+struct get_function_type<T, void>
+#else
+template <typename T>
+struct get_function_type<T, std::void_t<typename get_call_operator<T>::type>>
+#endif
+    : get_function_type<typename get_call_operator<T>::type> {
+	static constexpr bool is_member_function = false;
+	static constexpr bool is_functor = true;
+};
+
+template <typename Callable>
+using get_callable_function_type = get_function_type<std::remove_cv_t<std::remove_reference_t<Callable>>>;
+
+template <typename Callable>
+using get_callable_specifiers = get_function_specifiers<typename get_callable_function_type<Callable>::type>;
+
+#if CALLABLE_TRAITS_USE_CONCEPTS
+// Callables whose function type is known, whether they are functions, member functions or functors.
+template <typename Callable>
+concept function_type_known = free_function<typename get_callable_function_type<Callable>::type>;
+
+#define CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable) requires detail::function_type_known<Callable>
+#else
+#define CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+#endif
+
 } // namespace detail
 
 //////////////////////////////////////////////////////////////////////////
@@ -158,3 +378,42 @@ struct get_functor_traits<T, std::void_t<decltype(&T::operator())>>
 
 template <typename Callable>
 struct callable_traits : detail::get_functor_traits<std::remove_cv_t<std::remove_reference_t<Callable>>> {};
+
+//////////////////////////////////////////////////////////////////////////
+// Standalone queries for a single trait. These only instantiate what is
+// needed to answer the query, instead of the whole callable_traits.
+
+template <typename Callable>
+inline constexpr bool callable_is_member_function_v = detail::get_callable_function_type<Callable>::is_member_function;
+template <typename Callable>
+inline constexpr bool callable_is_functor_v = detail::get_callable_function_type<Callable>::is_functor;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr bool callable_is_const_v = detail::get_callable_specifiers<Callable>::is_const;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr bool callable_is_volatile_v = detail::get_callable_specifiers<Callable>::is_volatile;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr bool callable_is_lvalue_reference_v = detail::get_callable_specifiers<Callable>::is_lvalue_reference;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr bool callable_is_rvalue_reference_v = detail::get_callable_specifiers<Callable>::is_rvalue_reference;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr bool callable_is_noexcept_v = detail::get_callable_specifiers<Callable>::is_noexcept;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr bool callable_is_variadic_v = detail::get_callable_specifiers<Callable>::is_variadic;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr unsigned callable_specifier_mask_v = detail::get_callable_specifiers<Callable>::specifier_mask;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+inline constexpr std::size_t callable_arity_v = detail::get_callable_specifiers<Callable>::arity;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+using callable_signature_t = typename detail::get_callable_specifiers<Callable>::signature_type;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+using callable_result_t = typename detail::get_callable_specifiers<Callable>::result_type;
+template <typename Callable> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+using callable_args_t = typename detail::get_callable_specifiers<Callable>::args;
+template <typename Callable, std::size_t Index> CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE(Callable)
+using callable_arg_t = typename detail::get_callable_specifiers<Callable>::template arg_type<Index>;
+template <typename Callable>
+using callable_class_t = typename detail::get_callable_function_type<Callable>::class_type;
+
+// Internal helpers, which do not leak to includers.
+#undef CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE
+#undef CALLABLE_TRAITS_HAS_TYPE_PACK_ELEMENT
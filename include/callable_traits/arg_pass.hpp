@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+template <typename T, bool = std::is_scalar_v<T> && !std::is_volatile_v<T>>
+struct is_passed_by_value : std::false_type {};
+
+template <typename T>
+struct is_passed_by_value<T, true> : std::bool_constant<sizeof(T) <= 2 * sizeof(void*)> {};
+
+// Parameter type of a layer forwarding an argument of type A, which forwards it with std::forward<A>. Scalars taken by
+// const reference are passed by value instead, so they stay in registers instead of being spilled to the stack for
+// their address, and the callable gets a reference to the copy in the layer. Class types are kept, as they may still
+// be incomplete when a wrapper is instantiated.
+template <typename A>
+struct get_pass_type {
+	using type = A;
+};
+
+template <typename T>
+struct get_pass_type<const T&> {
+	using type = std::conditional_t<is_passed_by_value<T>::value, T, const T&>;
+};
+
+template <typename A>
+using pass_type_t = typename get_pass_type<A>::type;
+
+template <typename F, typename Signature = callable_signature_t<F>,
+          bool Const = !callable_is_functor_v<F> || callable_is_const_v<F>>
+class invoke_adaptor_base;
+
+template <typename F, typename R, typename... A>
+class invoke_adaptor_base<F, R(A...), true> {
+public:
+	constexpr explicit invoke_adaptor_base(F f) noexcept(std::is_nothrow_move_constructible_v<F>) : f_(std::move(f)) {}
+
+	R operator()(pass_type_t<A>... args) const noexcept(callable_is_noexcept_v<F>)
+	{
+		return detail::invoke_r<R>(f_, std::forward<A>(args)...);
+	}
+
+private:
+	F f_;
+};
+
+template <typename F, typename R, typename... A>
+class invoke_adaptor_base<F, R(A...), false> {
+public:
+	constexpr explicit invoke_adaptor_base(F f) noexcept(std::is_nothrow_move_constructible_v<F>) : f_(std::move(f)) {}
+
+	R operator()(pass_type_t<A>... args) noexcept(callable_is_noexcept_v<F>)
+	{
+		return detail::invoke_r<R>(f_, std::forward<A>(args)...);
+	}
+
+private:
+	F f_;
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Parameter types for forwarding arguments through layers of wrappers.
+// arg_pass_t<F, I> is the type of argument I of F, except that scalars
+// taken by const reference are taken by value, so every layer passes
+// them in registers and only the callable itself may need their address.
+// Class types are kept as they are, since they may still be incomplete
+// when a wrapper is instantiated. This is opt-in, as the callable gets a
+// reference to a copy: references it returns or stores dangle after the
+// call, and their address differs from that of the argument passed.
+
+template <typename Callable, std::size_t Index>
+using arg_pass_t = detail::pass_type_t<callable_arg_t<Callable, Index>>;
+
+// Callable calling F, with the parameters of F replaced by their arg_pass_t. Its call operator is const if the one of
+// F is, and noexcept if F is.
+template <typename F>
+class invoke_adaptor : public detail::invoke_adaptor_base<F> {
+	static_assert(!callable_is_member_function_v<F>, "member functions need an object, adapt a delegate instead");
+
+public:
+	using detail::invoke_adaptor_base<F>::invoke_adaptor_base;
+};
+
+template <typename F>
+invoke_adaptor(F) -> invoke_adaptor<F>;
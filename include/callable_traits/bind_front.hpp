@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+// Element of the storage of bound arguments, which derives from empty classes instead of storing them, so they take
+// no space. The index keeps elements of the same type apart.
+template <std::size_t Index, typename T, bool = std::is_empty_v<T> && !std::is_final_v<T>>
+class compressed_element {
+public:
+	template <typename U>
+	constexpr explicit compressed_element(U&& value) noexcept(std::is_nothrow_constructible_v<T, U>)
+	    : value_(std::forward<U>(value))
+	{
+	}
+
+	constexpr T& get() noexcept { return value_; }
+	constexpr const T& get() const noexcept { return value_; }
+
+private:
+	T value_;
+};
+
+template <std::size_t Index, typename T>
+class compressed_element<Index, T, true> : private T {
+public:
+	template <typename U>
+	constexpr explicit compressed_element(U&& value) noexcept(std::is_nothrow_constructible_v<T, U>)
+	    : T(std::forward<U>(value))
+	{
+	}
+
+	constexpr T& get() noexcept { return *this; }
+	constexpr const T& get() const noexcept { return *this; }
+};
+
+// Signature of F without the arguments which are bound. The object of a member function is bound first.
+template <typename F, std::size_t Bound, std::size_t Offset = Bound - callable_is_member_function_v<F>,
+          typename Indices = std::make_index_sequence<callable_arity_v<F> - Offset>>
+struct get_remaining_signature;
+
+template <typename F, std::size_t Bound, std::size_t Offset, std::size_t... I>
+struct get_remaining_signature<F, Bound, Offset, std::index_sequence<I...>> {
+	using type = callable_result_t<F>(callable_arg_t<F, Offset + I>...);
+};
+
+// Callable F with its first arguments bound, which are passed as lvalues. The call operator has the remaining
+// signature, it is const if F can be called as const with the bound arguments, e.g. not for a member function which
+// is not const and bound to an object stored by value.
+template <typename F, typename Signature, bool Const, typename Indices, typename... B>
+class bound_front;
+
+template <typename F, typename R, typename... A, std::size_t... I, typename... B>
+class bound_front<F, R(A...), true, std::index_sequence<I...>, B...>
+    : private compressed_element<0, F>, private compressed_element<I + 1, B>... {
+	static_assert(std::is_invocable_v<const F&, const B&..., A...>,
+	              "the bound arguments are passed to the callable as lvalues, so move-only types cannot be bound to "
+	              "parameters taken by value");
+
+public:
+	template <typename G, typename... C>
+	constexpr bound_front(std::in_place_t, G&& f, C&&... bound) noexcept(
+	    std::is_nothrow_constructible_v<F, G> && (std::is_nothrow_constructible_v<B, C> && ...))
+	    : compressed_element<0, F>(std::forward<G>(f)), compressed_element<I + 1, B>(std::forward<C>(bound))...
+	{
+	}
+
+	R operator()(A... args) const noexcept(std::is_nothrow_invocable_v<const F&, const B&..., A...>)
+	{
+		return detail::invoke_r<R>(compressed_element<0, F>::get(), compressed_element<I + 1, B>::get()...,
+		                           std::forward<A>(args)...);
+	}
+};
+
+template <typename F, typename R, typename... A, std::size_t... I, typename... B>
+class bound_front<F, R(A...), false, std::index_sequence<I...>, B...>
+    : private compressed_element<0, F>, private compressed_element<I + 1, B>... {
+	static_assert(std::is_invocable_v<F&, B&..., A...>,
+	              "the bound arguments are passed to the callable as lvalues, so move-only types cannot be bound to "
+	              "parameters taken by value");
+
+public:
+	template <typename G, typename... C>
+	constexpr bound_front(std::in_place_t, G&& f, C&&... bound) noexcept(
+	    std::is_nothrow_constructible_v<F, G> && (std::is_nothrow_constructible_v<B, C> && ...))
+	    : compressed_element<0, F>(std::forward<G>(f)), compressed_element<I + 1, B>(std::forward<C>(bound))...
+	{
+	}
+
+	R operator()(A... args) noexcept(std::is_nothrow_invocable_v<F&, B&..., A...>)
+	{
+		return detail::invoke_r<R>(compressed_element<0, F>::get(), compressed_element<I + 1, B>::get()...,
+		                           std::forward<A>(args)...);
+	}
+};
+
+template <typename F, typename Signature, typename... B>
+inline constexpr bool is_const_bound_front_v = false;
+
+template <typename F, typename R, typename... A, typename... B>
+inline constexpr bool is_const_bound_front_v<F, R(A...), B...> = std::is_invocable_v<const F&, const B&..., A...>;
+
+template <typename F, typename... B>
+struct get_bound_front {
+	using signature = typename get_remaining_signature<F, sizeof...(B)>::type;
+	using type =
+	    bound_front<F, signature, is_const_bound_front_v<F, signature, B...>, std::index_sequence_for<B...>, B...>;
+};
+
+template <typename F, typename... B>
+using bound_front_t = typename get_bound_front<F, B...>::type;
+
+// Arguments taken by non-const lvalue reference are stored as reference, all others as value, so a step keeps no
+// reference to a temporary passed to it.
+template <typename A, typename T = std::remove_reference_t<A>>
+using curried_argument_t = std::conditional_t<std::is_lvalue_reference_v<A> && !std::is_const_v<T>,
+                                              std::reference_wrapper<T>, std::decay_t<A>>;
+
+template <typename F, typename Indices, typename... B>
+class curried;
+
+// Result of passing one more argument to a curried callable, which is named lazily, so the last step does not name
+// the argument after the last one.
+template <bool IsLast, typename F, typename... B>
+struct get_curried_result {
+	using type = callable_result_t<F>;
+};
+
+template <typename F, typename... B>
+struct get_curried_result<false, F, B...> {
+	using type = curried<F, std::index_sequence_for<B...>, B...>;
+};
+
+// Callable F with its first arguments bound, which takes the next argument and returns the callable with that one
+// bound as well, or the result once all arguments are bound.
+template <typename F, std::size_t... I, typename... B>
+class curried<F, std::index_sequence<I...>, B...>
+    : private compressed_element<0, F>, private compressed_element<I + 1, B>... {
+	using next_argument = callable_arg_t<F, sizeof...(B)>;
+	using stored_argument = curried_argument_t<next_argument>;
+	static constexpr bool is_last = sizeof...(B) + 1 == callable_arity_v<F>;
+	using result_type = typename get_curried_result<is_last, F, B..., stored_argument>::type;
+
+public:
+	template <typename G, typename... C>
+	constexpr curried(std::in_place_t, G&& f, C&&... bound) noexcept(
+	    std::is_nothrow_constructible_v<F, G> && (std::is_nothrow_constructible_v<B, C> && ...))
+	    : compressed_element<0, F>(std::forward<G>(f)), compressed_element<I + 1, B>(std::forward<C>(bound))...
+	{
+	}
+
+	result_type operator()(next_argument arg) const
+	    noexcept(is_last ? std::is_nothrow_invocable_v<const F&, const B&..., next_argument>
+	                     : std::is_nothrow_copy_constructible_v<F> && (std::is_nothrow_copy_constructible_v<B> && ...)
+	                           && std::is_nothrow_constructible_v<stored_argument, next_argument>)
+	{
+		if constexpr (is_last)
+			return detail::invoke_r<result_type>(compressed_element<0, F>::get(),
+			                                     compressed_element<I + 1, B>::get()...,
+			                                     std::forward<next_argument>(arg));
+		else
+			return result_type(std::in_place, compressed_element<0, F>::get(), compressed_element<I + 1, B>::get()...,
+			                   std::forward<next_argument>(arg));
+	}
+};
+
+// Function objects instead of functions, so argument dependent lookup never finds std::bind_front instead.
+struct bind_front_fn {
+	template <typename F, typename... B>
+	constexpr auto operator()(F&& f, B&&... bound) const
+	{
+		using function = std::decay_t<F>;
+		static_assert(!callable_is_member_function_v<function> || sizeof...(B) > 0,
+		              "the object of a member function has to be bound first");
+		static_assert(sizeof...(B) <= callable_arity_v<function> + callable_is_member_function_v<function>,
+		              "more arguments are bound than the callable takes");
+		return bound_front_t<function, std::decay_t<B>...>(std::in_place, std::forward<F>(f),
+		                                                    std::forward<B>(bound)...);
+	}
+};
+
+struct curry_fn {
+	template <typename F>
+	constexpr curried<std::decay_t<F>, std::index_sequence<>> operator()(F&& f) const
+	{
+		using function = std::decay_t<F>;
+		static_assert(!callable_is_member_function_v<function>, "bind the object of a member function first");
+		static_assert(callable_arity_v<function> > 0, "only callables with arguments can be curried");
+		static_assert(!callable_is_functor_v<function> || callable_is_const_v<function>,
+		              "curried callables are called as const, as every step copies them");
+		return curried<function, std::index_sequence<>>(std::in_place, std::forward<F>(f));
+	}
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Partial application without allocation. bind_front(f, a, b) calls f
+// with a and b followed by its own arguments, curry(f) takes the
+// arguments of f one call at a time. Both store f and the bound arguments
+// by value, empty ones take no space, and their call operators have the
+// remaining signature of f, so they are callables for callable_traits,
+// and noexcept if calling f is.
+
+inline constexpr detail::bind_front_fn bind_front{};
+
+inline constexpr detail::curry_fn curry{};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "../callable_traits.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// Traits of a whole pack of callables at once, e.g. for building constexpr
+// metadata tables of handlers. Each callable only goes through the
+// minimal path of the standalone queries, so neither callable_traits nor
+// the query variable templates get instantiated per callable.
+
+template <typename... Callables>
+struct callable_traits_list {
+	static constexpr std::size_t size = sizeof...(Callables);
+
+	static constexpr std::array<bool, size> is_member_function = {
+	    detail::get_callable_function_type<Callables>::is_member_function...};
+	static constexpr std::array<bool, size> is_functor = {detail::get_callable_function_type<Callables>::is_functor...};
+	static constexpr std::array<unsigned, size> specifier_mask = {
+	    detail::get_callable_specifiers<Callables>::specifier_mask...};
+	static constexpr std::array<std::size_t, size> arity = {detail::get_callable_specifiers<Callables>::arity...};
+
+	template <std::size_t Index>
+	using callable_type = detail::type_pack_element_t<Index, Callables...>;
+	template <std::size_t Index>
+	using signature_type = callable_signature_t<callable_type<Index>>;
+	template <std::size_t Index>
+	using result_type = callable_result_t<callable_type<Index>>;
+	template <std::size_t Index, std::size_t ArgIndex>
+	using arg_type = callable_arg_t<callable_type<Index>, ArgIndex>;
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_wrappers.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// Customization point for types which can be moved by copying their bytes
+// and not destroying the source, e.g. closures owning a std::unique_ptr.
+// Trivially copyable types are trivially relocatable by default.
+
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail {
+
+// Whether a thunk with the signature of the function pointer can call F as an lvalue, which it is not for call
+// operators qualified with &&.
+template <typename F, typename Pointer>
+inline constexpr bool is_thunk_invocable_v = false;
+
+template <typename F, typename R, typename... A>
+inline constexpr bool is_thunk_invocable_v<F, R (*)(A...)> = std::is_invocable_r_v<R, F&, A...>;
+
+template <typename F, typename R, typename... A>
+inline constexpr bool is_thunk_invocable_v<F, R (*)(A...) noexcept> = std::is_nothrow_invocable_r_v<R, F&, A...>;
+
+template <typename F, typename = void>
+struct get_closure_traits {
+	static constexpr bool is_stateless = false;
+};
+
+// Functors without state, e.g. lambdas without captures, can be replaced by a function pointer. Lambdas convert to one,
+// other empty functors have to be trivial, so a thunk can construct them on each call without observable effects.
+template <typename F>
+struct get_closure_traits<F, std::void_t<wrapper_signature_t<F>>> {
+	using pointer = std::add_pointer_t<wrapper_signature_t<F>>;
+	static constexpr bool is_stateless =
+	    get_functor_traits<F>::is_functor && std::is_empty_v<F>
+	    && (std::is_convertible_v<const F&, pointer> || (std::is_trivial_v<F> && is_thunk_invocable_v<F, pointer>));
+};
+
+template <typename F, typename Signature = typename get_closure_traits<F>::pointer>
+struct stateless_thunk;
+
+// Spelled out for both noexcept variants instead of deducing noexcept, see CALLABLE_TRAITS_DEDUCE_NOEXCEPT.
+template <typename F, typename R, typename... A>
+struct stateless_thunk<F, R (*)(A...)> {
+	static R call(A... args)
+	{
+		F f{};
+		return detail::invoke_r<R>(f, std::forward<A>(args)...);
+	}
+};
+
+template <typename F, typename R, typename... A>
+struct stateless_thunk<F, R (*)(A...) noexcept> {
+	static R call(A... args) noexcept
+	{
+		F f{};
+		return detail::invoke_r<R>(f, std::forward<A>(args)...);
+	}
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Traits of closures, i.e. functor objects. Stateless closures carry no
+// data, so they can be stored as a plain function pointer, which is what
+// to_function_pointer returns for them, keeping noexcept.
+
+template <typename F>
+inline constexpr bool is_stateless_v =
+    detail::get_closure_traits<std::remove_cv_t<std::remove_reference_t<F>>>::is_stateless;
+
+// Number of bytes a closure needs to be stored, which is 0 for stateless ones.
+template <typename F>
+inline constexpr std::size_t closure_size_v = is_stateless_v<F> ? 0 : sizeof(std::remove_reference_t<F>);
+
+template <typename F>
+inline constexpr bool is_trivially_relocatable_closure_v =
+    detail::get_functor_traits<std::remove_cv_t<std::remove_reference_t<F>>>::is_functor
+    && is_trivially_relocatable_v<std::remove_cv_t<std::remove_reference_t<F>>>;
+
+template <typename F, std::enable_if_t<is_stateless_v<F>, int> = 0>
+constexpr auto to_function_pointer(const F& f) noexcept
+{
+	using closure = std::remove_cv_t<F>;
+	using pointer = typename detail::get_closure_traits<closure>::pointer;
+	if constexpr (std::is_convertible_v<const closure&, pointer>)
+		return static_cast<pointer>(f);
+	else
+		return static_cast<pointer>(&detail::stateless_thunk<closure>::call);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////
+// Tag passing a callable as template argument to a function wrapper, so it
+// is called directly instead of through a stored pointer.
+
+template <auto Callable>
+struct constant_arg_t {
+	explicit constant_arg_t() = default;
+};
+
+template <auto Callable>
+inline constexpr constant_arg_t<Callable> constant_arg{};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "constant_arg.hpp"
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+// Member function stored by a delegate, or known at compile time and not stored at all.
+template <typename MemberFunction>
+struct stored_member_function {
+	constexpr MemberFunction get() const noexcept { return function; }
+	MemberFunction function;
+};
+
+template <auto MemberFunction>
+struct constant_member_function {
+	static constexpr decltype(MemberFunction) get() noexcept { return MemberFunction; }
+};
+
+template <typename MemberFunction, typename Holder, typename Traits = get_member_function_traits<MemberFunction>,
+          typename Signature = typename Traits::signature_type>
+class delegate_base;
+
+template <typename MemberFunction, typename Holder, typename Traits, typename R, typename... A>
+class delegate_base<MemberFunction, Holder, Traits, R(A...)> : private Holder {
+	static_assert(Traits::is_member_function, "delegates bind member functions");
+	static_assert(!Traits::is_rvalue_reference,
+	              "delegates do not own the object, so they cannot call rvalue reference qualified member functions");
+
+public:
+	using class_type = typename Traits::class_type;
+	using object_type = member_object_t<Traits>;
+	using result_type = R;
+	using args = type_list<A...>;
+	static constexpr bool is_noexcept = Traits::is_noexcept;
+
+	constexpr delegate_base(object_type* object, Holder holder) noexcept : Holder(holder), object_(object) {}
+
+	R operator()(A... args) const noexcept(is_noexcept)
+	{
+		return (object_->*Holder::get())(std::forward<A>(args)...);
+	}
+
+	constexpr object_type* object() const noexcept { return object_; }
+
+private:
+	object_type* object_;
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Member function bound to an object, which it does not own. Calling it
+// calls the member function directly, without any virtual call or heap
+// allocation. Delegates of non-const member functions only bind to
+// non-const objects, the same applies to volatile.
+//
+// delegate<F C::*> stores the member function pointer alongside the
+// object pointer, delegate<constant_arg_t<&C::f>> only the object pointer,
+// and its calls can be inlined.
+
+template <typename MemberFunction>
+class delegate;
+
+template <typename C, typename F>
+class delegate<F C::*> : public detail::delegate_base<F C::*, detail::stored_member_function<F C::*>> {
+	using base = detail::delegate_base<F C::*, detail::stored_member_function<F C::*>>;
+
+public:
+	using typename base::object_type;
+
+	constexpr delegate(object_type* object, F C::*function) noexcept : base(object, {function}) {}
+};
+
+template <auto MemberFunction>
+class delegate<constant_arg_t<MemberFunction>>
+    : public detail::delegate_base<decltype(MemberFunction), detail::constant_member_function<MemberFunction>> {
+	using base = detail::delegate_base<decltype(MemberFunction), detail::constant_member_function<MemberFunction>>;
+
+public:
+	using typename base::object_type;
+
+	constexpr explicit delegate(object_type* object) noexcept : base(object, {}) {}
+	constexpr delegate(constant_arg_t<MemberFunction>, object_type* object) noexcept : base(object, {}) {}
+};
+
+template <typename T, typename C, typename F>
+delegate(T*, F C::*) -> delegate<F C::*>;
+
+template <auto MemberFunction, typename T>
+delegate(constant_arg_t<MemberFunction>, T*) -> delegate<constant_arg_t<MemberFunction>>;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "../../callable_traits.hpp"
+
+namespace detail {
+
+//////////////////////////////////////////////////////////////////////////
+// Helpers shared by the function wrappers.
+
+template <typename Signature>
+struct add_noexcept;
+
+template <typename R, typename... A>
+struct add_noexcept<R(A...)> {
+	using type = R(A...) noexcept;
+};
+
+// Signature of a callable as used by function wrappers, which is noexcept if the callable is. Substitution fails for
+// anything that is not a callable, so deduction guides using it drop out.
+template <typename Callable, typename Specifiers = get_callable_specifiers<Callable>>
+using wrapper_signature_t = std::conditional_t<Specifiers::is_noexcept,
+                                               typename add_noexcept<typename Specifiers::signature_type>::type,
+                                               typename Specifiers::signature_type>;
+
+// Object type a member function can be called on, e.g. const C for const member functions.
+template <typename Traits, typename C = typename Traits::class_type>
+using member_object_t = std::conditional_t<Traits::is_const,
+                                           std::conditional_t<Traits::is_volatile, const volatile C, const C>,
+                                           std::conditional_t<Traits::is_volatile, volatile C, C>>;
+
+template <bool Noexcept, typename R, typename F, typename... A>
+inline constexpr bool is_invocable_as_v =
+    Noexcept ? std::is_nothrow_invocable_r_v<R, F, A...> : std::is_invocable_r_v<R, F, A...>;
+
+template <typename R, typename F, typename... A>
+constexpr R invoke_r(F&& f, A&&... args) noexcept(std::is_nothrow_invocable_r_v<R, F, A...>)
+{
+	if constexpr (std::is_void_v<R>)
+		std::invoke(std::forward<F>(f), std::forward<A>(args)...);
+	else
+		return std::invoke(std::forward<F>(f), std::forward<A>(args)...);
+}
+
+} // namespace detail
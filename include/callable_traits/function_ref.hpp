@@ -0,0 +1,126 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "closure_traits.hpp"
+#include "constant_arg.hpp"
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+// Either the address of the referenced object or the referenced function.
+union function_ref_storage {
+	void* object;
+	const void* const_object;
+	void (*function)();
+};
+
+template <bool Noexcept, typename R, typename... A>
+class function_ref_base {
+	using storage = function_ref_storage;
+	using thunk_type = R (*)(storage, A...) noexcept(Noexcept);
+
+	template <typename F>
+	static R invoke_function(storage s, A... args) noexcept(Noexcept)
+	{
+		return detail::invoke_r<R>(reinterpret_cast<F*>(s.function), std::forward<A>(args)...);
+	}
+
+	template <typename T>
+	static R invoke_object(storage s, A... args) noexcept(Noexcept)
+	{
+		return detail::invoke_r<R>(*static_cast<T*>(const_cast<void*>(s.const_object)), std::forward<A>(args)...);
+	}
+
+	template <auto Callable>
+	static R invoke_constant(storage, A... args) noexcept(Noexcept)
+	{
+		return detail::invoke_r<R>(Callable, std::forward<A>(args)...);
+	}
+
+	template <auto Callable, typename T>
+	static R invoke_bound_constant(storage s, A... args) noexcept(Noexcept)
+	{
+		return detail::invoke_r<R>(Callable, *static_cast<T*>(const_cast<void*>(s.const_object)),
+		                           std::forward<A>(args)...);
+	}
+
+public:
+	template <typename F, std::enable_if_t<std::is_function_v<F> && is_invocable_as_v<Noexcept, R, F*, A...>, int> = 0>
+	function_ref_base(F* f) noexcept : thunk_(&invoke_function<F>)
+	{
+		storage_.function = reinterpret_cast<void (*)()>(f);
+	}
+
+	// Any other callable is referenced, so it has to outlive the function_ref. Stateless closures are the exception,
+	// they are replaced by a function pointer, so referencing a temporary one is fine.
+	template <typename F, typename T = std::remove_reference_t<F>,
+	          std::enable_if_t<!std::is_base_of_v<function_ref_base, std::remove_cv_t<T>> && !std::is_function_v<T>
+	                               && !std::is_pointer_v<T> && !std::is_member_pointer_v<T>
+	                               && is_invocable_as_v<Noexcept, R, T&, A...>,
+	                           int> = 0>
+	function_ref_base(F&& f) noexcept
+	{
+		if constexpr (is_stateless_v<T>) {
+			auto function = to_function_pointer(f);
+			storage_.function = reinterpret_cast<void (*)()>(function);
+			thunk_ = &invoke_function<std::remove_pointer_t<decltype(function)>>;
+		} else {
+			storage_.const_object = std::addressof(f);
+			thunk_ = &invoke_object<T>;
+		}
+	}
+
+	template <auto Callable, std::enable_if_t<is_invocable_as_v<Noexcept, R, decltype(Callable), A...>, int> = 0>
+	function_ref_base(constant_arg_t<Callable>) noexcept : thunk_(&invoke_constant<Callable>)
+	{
+		storage_.object = nullptr;
+	}
+
+	// Calls Callable with obj as first argument, e.g. a member function on obj.
+	template <auto Callable, typename T,
+	          std::enable_if_t<is_invocable_as_v<Noexcept, R, decltype(Callable), T&, A...>, int> = 0>
+	function_ref_base(constant_arg_t<Callable>, T& obj) noexcept : thunk_(&invoke_bound_constant<Callable, T>)
+	{
+		storage_.const_object = std::addressof(obj);
+	}
+
+	R operator()(A... args) const noexcept(Noexcept) { return thunk_(storage_, std::forward<A>(args)...); }
+
+private:
+	storage storage_;
+	thunk_type thunk_;
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Non-owning reference to a callable, which is as cheap to pass as two
+// pointers and calls through a single indirect call. The signature is
+// deduced from the referenced callable, including noexcept.
+
+template <typename Signature>
+class function_ref;
+
+template <typename R, typename... A>
+class function_ref<R(A...)> : public detail::function_ref_base<false, R, A...> {
+public:
+	using detail::function_ref_base<false, R, A...>::function_ref_base;
+};
+
+template <typename R, typename... A>
+class function_ref<R(A...) noexcept> : public detail::function_ref_base<true, R, A...> {
+public:
+	using detail::function_ref_base<true, R, A...>::function_ref_base;
+};
+
+template <typename F>
+function_ref(F&&) -> function_ref<detail::wrapper_signature_t<F>>;
+
+template <auto Callable>
+function_ref(constant_arg_t<Callable>) -> function_ref<detail::wrapper_signature_t<decltype(Callable)>>;
+
+template <auto Callable, typename T>
+function_ref(constant_arg_t<Callable>, T&) -> function_ref<detail::wrapper_signature_t<decltype(Callable)>>;
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "closure_traits.hpp"
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+// Operations on the callable stored by an inplace_function. Relocation and destruction are null for callables which
+// are trivially relocatable and trivially destructible respectively, so moving those copies the storage.
+template <bool Noexcept, typename R, typename... A>
+struct inplace_function_vtable {
+	R (*invoke)(void* storage, A... args) noexcept(Noexcept);
+	void (*relocate)(void* to, void* from) noexcept;
+	void (*destroy)(void* storage) noexcept;
+};
+
+template <typename T, bool Noexcept, typename R, typename... A>
+struct inplace_function_vtable_for {
+	static R invoke(void* storage, A... args) noexcept(Noexcept)
+	{
+		return detail::invoke_r<R>(*static_cast<T*>(storage), std::forward<A>(args)...);
+	}
+
+	static void relocate(void* to, void* from) noexcept
+	{
+		::new (to) T(std::move(*static_cast<T*>(from)));
+		static_cast<T*>(from)->~T();
+	}
+
+	static void destroy(void* storage) noexcept { static_cast<T*>(storage)->~T(); }
+
+	static constexpr inplace_function_vtable<Noexcept, R, A...> value = {
+	    &invoke, is_trivially_relocatable_v<T> ? nullptr : &relocate,
+	    std::is_trivially_destructible_v<T> ? nullptr : &destroy};
+};
+
+template <std::size_t Capacity, std::size_t Alignment, bool Noexcept, typename R, typename... A>
+class inplace_function_base {
+	using vtable = inplace_function_vtable<Noexcept, R, A...>;
+
+	template <typename F>
+	static constexpr bool is_storable_v =
+	    !std::is_base_of_v<inplace_function_base, std::decay_t<F>> && std::is_constructible_v<std::decay_t<F>, F>
+	    && is_invocable_as_v<Noexcept, R, std::decay_t<F>&, A...>;
+
+	// Stateless closures are stored as function pointer if one fits, otherwise as the empty closure itself.
+	template <typename F>
+	static constexpr bool is_stored_as_function_pointer_v =
+	    is_stateless_v<F> && sizeof(void (*)()) <= Capacity && Alignment % alignof(void (*)()) == 0;
+
+public:
+	inplace_function_base() noexcept = default;
+	inplace_function_base(std::nullptr_t) noexcept {}
+
+	// Stateless closures stored as function pointer share one vtable with all others of the same signature.
+	template <typename F, std::enable_if_t<is_storable_v<F> && is_stored_as_function_pointer_v<F>, int> = 0>
+	inplace_function_base(F&& f) noexcept : inplace_function_base(to_function_pointer(f))
+	{
+	}
+
+	template <typename F, std::enable_if_t<is_storable_v<F> && !is_stored_as_function_pointer_v<F>, int> = 0>
+	inplace_function_base(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+	{
+		using T = std::decay_t<F>;
+		static_assert(sizeof(T) <= Capacity, "The callable does not fit into the capacity of the inplace_function");
+		static_assert(Alignment % alignof(T) == 0, "The callable is aligned stricter than the inplace_function");
+		static_assert(std::is_nothrow_move_constructible_v<T>, "The callable must be nothrow move constructible");
+		if constexpr (std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<T>) {
+			if (f == nullptr)
+				return;
+		}
+		::new (static_cast<void*>(storage_)) T(std::forward<F>(f));
+		vtable_ = &inplace_function_vtable_for<T, Noexcept, R, A...>::value;
+	}
+
+	inplace_function_base(inplace_function_base&& other) noexcept : vtable_(other.vtable_) { relocate_from(other); }
+
+	inplace_function_base& operator=(inplace_function_base&& other) noexcept
+	{
+		if (this != &other) {
+			reset();
+			vtable_ = other.vtable_;
+			relocate_from(other);
+		}
+		return *this;
+	}
+
+	inplace_function_base& operator=(std::nullptr_t) noexcept
+	{
+		reset();
+		return *this;
+	}
+
+	~inplace_function_base() { reset(); }
+
+	explicit operator bool() const noexcept { return vtable_ != nullptr; }
+
+	// Must not be called on an empty inplace_function.
+	R operator()(A... args) noexcept(Noexcept) { return vtable_->invoke(storage_, std::forward<A>(args)...); }
+
+private:
+	void relocate_from(inplace_function_base& other) noexcept
+	{
+		if (vtable_ == nullptr)
+			return;
+		if (vtable_->relocate == nullptr)
+			std::memcpy(storage_, other.storage_, Capacity);
+		else
+			vtable_->relocate(storage_, other.storage_);
+		other.vtable_ = nullptr;
+	}
+
+	void reset() noexcept
+	{
+		if (vtable_ != nullptr && vtable_->destroy != nullptr)
+			vtable_->destroy(storage_);
+		vtable_ = nullptr;
+	}
+
+	const vtable* vtable_ = nullptr;
+	alignas(Alignment) unsigned char storage_[Capacity];
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Move-only function wrapper storing the callable inside itself, so it
+// never allocates. Callables larger than Capacity are rejected at compile
+// time. Moving one holding a trivially relocatable callable copies its
+// storage, so containers of them reallocate without calling any move
+// constructors of the callables.
+
+inline constexpr std::size_t inplace_function_default_capacity = 4 * sizeof(void*);
+
+template <typename Signature, std::size_t Capacity = inplace_function_default_capacity,
+          std::size_t Alignment = alignof(std::max_align_t)>
+class inplace_function;
+
+template <typename R, typename... A, std::size_t Capacity, std::size_t Alignment>
+class inplace_function<R(A...), Capacity, Alignment>
+    : public detail::inplace_function_base<Capacity, Alignment, false, R, A...> {
+public:
+	using detail::inplace_function_base<Capacity, Alignment, false, R, A...>::inplace_function_base;
+};
+
+template <typename R, typename... A, std::size_t Capacity, std::size_t Alignment>
+class inplace_function<R(A...) noexcept, Capacity, Alignment>
+    : public detail::inplace_function_base<Capacity, Alignment, true, R, A...> {
+public:
+	using detail::inplace_function_base<Capacity, Alignment, true, R, A...>::inplace_function_base;
+};
+
+template <typename F>
+inplace_function(F) -> inplace_function<detail::wrapper_signature_t<F>>;
+
+// inplace_function with the default capacity.
+template <typename Signature>
+using unique_function = inplace_function<Signature>;
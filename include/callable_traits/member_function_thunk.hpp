@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+template <typename Pointer>
+struct remove_noexcept {
+	using type = Pointer;
+};
+
+template <typename R, typename... A>
+struct remove_noexcept<R (*)(A...) noexcept> {
+	using type = R (*)(A...);
+};
+
+template <auto MemberFunction, typename Traits = get_member_function_traits<decltype(MemberFunction)>,
+          typename Signature = typename Traits::signature_type>
+struct member_function_thunk;
+
+template <auto MemberFunction, typename Traits, typename R, typename... A>
+struct member_function_thunk<MemberFunction, Traits, R(A...)> {
+	static_assert(Traits::is_member_function, "thunks are generated for member functions");
+
+	// Reference to the object with the cv and reference specifiers of the member function.
+	using object_parameter =
+	    std::conditional_t<Traits::is_rvalue_reference, member_object_t<Traits>&&, member_object_t<Traits>&>;
+	using pointer = R (*)(object_parameter, A...) noexcept(Traits::is_noexcept);
+
+	static R call(object_parameter object, A... args) noexcept(Traits::is_noexcept)
+	{
+		return (std::forward<object_parameter>(object).*MemberFunction)(std::forward<A>(args)...);
+	}
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Plain function pointers calling a member function, with the object as
+// first parameter. Unlike a member function pointer, which takes two
+// pointers on the Itanium ABI and adjusts the object and checks for a
+// virtual function on every call, they are a single pointer and call the
+// member function directly.
+
+template <auto MemberFunction>
+using member_function_thunk_t = typename detail::member_function_thunk<MemberFunction>::pointer;
+
+template <auto MemberFunction>
+inline constexpr member_function_thunk_t<MemberFunction> member_function_thunk_v =
+    &detail::member_function_thunk<MemberFunction>::call;
+
+// Flat dispatch table of member function thunks, one pointer per entry. All member functions must have the same class,
+// signature and specifiers, except for noexcept, which the table only keeps if all of them are noexcept.
+template <auto... MemberFunctions>
+struct member_function_table {
+	static_assert(sizeof...(MemberFunctions) > 0, "the table needs at least one member function");
+
+	using pointer = std::conditional_t<
+	    (std::is_same_v<member_function_thunk_t<MemberFunctions>,
+	                    detail::type_pack_element_t<0, member_function_thunk_t<MemberFunctions>...>>
+	     && ...),
+	    detail::type_pack_element_t<0, member_function_thunk_t<MemberFunctions>...>,
+	    typename detail::remove_noexcept<
+	        detail::type_pack_element_t<0, member_function_thunk_t<MemberFunctions>...>>::type>;
+	static_assert((std::is_convertible_v<member_function_thunk_t<MemberFunctions>, pointer> && ...),
+	              "all member functions of a table must have the same class, signature and specifiers");
+
+	static constexpr std::size_t size = sizeof...(MemberFunctions);
+	static constexpr std::array<pointer, size> thunks = {member_function_thunk_v<MemberFunctions>...};
+
+	template <typename... Args>
+	static decltype(auto) call(std::size_t index, Args&&... args)
+	{
+		return thunks[index](std::forward<Args>(args)...);
+	}
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "../callable_traits.hpp"
+#include "delegate.hpp"
+
+namespace detail {
+
+template <auto Function, typename Traits = get_member_function_traits<decltype(Function)>,
+          typename Signature = typename Traits::signature_type>
+struct fn_ref_base;
+
+template <auto Function, typename Traits, typename R, typename... A>
+struct fn_ref_base<Function, Traits, R(A...)> {
+	static_assert(!Traits::is_member_function, "fn_ref wraps free functions, method_ref member functions");
+
+	using result_type = R;
+	using args = type_list<A...>;
+	static constexpr bool is_noexcept = Traits::is_noexcept;
+
+	constexpr R operator()(A... args) const noexcept(is_noexcept) { return Function(std::forward<A>(args)...); }
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Callables fixed at compile time. method_ref<&C::f> is a member function
+// bound to an object and only holds the object pointer, fn_ref<&f> is an
+// empty type calling a free function, which takes up no space as a base
+// or [[no_unique_address]] member. Both call the function directly, so
+// the call can be inlined. The class, result, argument types and noexcept
+// are deduced from the function.
+
+template <auto MemberFunction>
+using method_ref = delegate<constant_arg_t<MemberFunction>>;
+
+template <auto Function>
+struct fn_ref : detail::fn_ref_base<Function> {};
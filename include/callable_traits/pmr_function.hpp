@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "closure_traits.hpp"
+#include "detail/function_wrappers.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// Callables up to this size are stored inside a pmr_function, larger ones
+// are allocated from its memory resource.
+
+inline constexpr std::size_t pmr_function_inline_capacity = 2 * sizeof(void*);
+
+namespace detail {
+
+// Operations on the callable stored by a pmr_function. The storage either holds the callable or a pointer to it.
+// Relocation is null for callables whose storage can be copied, which are those allocated from the memory resource and
+// trivially relocatable ones stored inline, and destruction is null for trivially destructible ones stored inline.
+template <bool Noexcept, typename R, typename... A>
+struct pmr_function_vtable {
+	R (*invoke)(void* storage, A... args) noexcept(Noexcept);
+	void (*relocate)(void* to, void* from) noexcept;
+	void (*move)(void* to, void* from, std::pmr::memory_resource* resource);
+	void (*destroy)(void* storage, std::pmr::memory_resource* resource) noexcept;
+};
+
+template <typename T>
+inline constexpr bool is_pmr_function_inline_v = sizeof(T) <= pmr_function_inline_capacity
+                                                 && alignof(void*) % alignof(T) == 0
+                                                 && std::is_nothrow_move_constructible_v<T>;
+
+template <typename T, bool Noexcept, typename R, typename... A>
+struct pmr_function_vtable_for {
+	static constexpr bool is_inline = is_pmr_function_inline_v<T>;
+
+	static T* object(void* storage) noexcept
+	{
+		if constexpr (is_inline)
+			return static_cast<T*>(storage);
+		else
+			return *static_cast<T**>(storage);
+	}
+
+	// Constructs the callable in storage, allocating it from resource if it is not stored inline.
+	template <typename... Args>
+	static void construct(void* storage, std::pmr::memory_resource* resource, Args&&... args)
+	{
+		if constexpr (is_inline) {
+			::new (storage) T(std::forward<Args>(args)...);
+		} else {
+			void* memory = resource->allocate(sizeof(T), alignof(T));
+			try {
+				*static_cast<T**>(storage) = ::new (memory) T(std::forward<Args>(args)...);
+			} catch (...) {
+				resource->deallocate(memory, sizeof(T), alignof(T));
+				throw;
+			}
+		}
+	}
+
+	static R invoke(void* storage, A... args) noexcept(Noexcept)
+	{
+		return detail::invoke_r<R>(*object(storage), std::forward<A>(args)...);
+	}
+
+	static void relocate(void* to, void* from) noexcept
+	{
+		::new (to) T(std::move(*object(from)));
+		object(from)->~T();
+	}
+
+	static void move(void* to, void* from, std::pmr::memory_resource* resource)
+	{
+		construct(to, resource, std::move(*object(from)));
+	}
+
+	static void destroy(void* storage, std::pmr::memory_resource* resource) noexcept
+	{
+		object(storage)->~T();
+		if constexpr (!is_inline)
+			resource->deallocate(object(storage), sizeof(T), alignof(T));
+	}
+
+	static constexpr pmr_function_vtable<Noexcept, R, A...> value = {
+	    &invoke, !is_inline || is_trivially_relocatable_v<T> ? nullptr : &relocate, &move,
+	    is_inline && std::is_trivially_destructible_v<T> ? nullptr : &destroy};
+};
+
+template <bool Noexcept, typename R, typename... A>
+class pmr_function_base {
+	using vtable = pmr_function_vtable<Noexcept, R, A...>;
+
+	template <typename F>
+	static constexpr bool is_storable_v =
+	    !std::is_base_of_v<pmr_function_base, std::decay_t<F>> && std::is_constructible_v<std::decay_t<F>, F>
+	    && std::is_move_constructible_v<std::decay_t<F>> && is_invocable_as_v<Noexcept, R, std::decay_t<F>&, A...>;
+
+public:
+	using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+	pmr_function_base() noexcept : resource_(std::pmr::get_default_resource()) {}
+	pmr_function_base(std::nullptr_t) noexcept : pmr_function_base() {}
+	explicit pmr_function_base(const allocator_type& allocator) noexcept : resource_(allocator.resource()) {}
+	pmr_function_base(std::nullptr_t, const allocator_type& allocator) noexcept : pmr_function_base(allocator) {}
+
+	// Stateless closures are stored as function pointer, so all of them with the same signature share one vtable.
+	template <typename F, std::enable_if_t<is_storable_v<F> && is_stateless_v<F>, int> = 0>
+	pmr_function_base(F&& f, const allocator_type& allocator = {}) noexcept
+	    : pmr_function_base(to_function_pointer(f), allocator)
+	{
+	}
+
+	// Only callables stored inline can be stored without allocating, which may throw.
+	template <typename F, std::enable_if_t<is_storable_v<F> && !is_stateless_v<F>, int> = 0>
+	pmr_function_base(F&& f, const allocator_type& allocator = {}) noexcept(
+	    is_pmr_function_inline_v<std::decay_t<F>> && std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+	    : resource_(allocator.resource())
+	{
+		using T = std::decay_t<F>;
+		if constexpr (std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<T>) {
+			if (f == nullptr)
+				return;
+		}
+		pmr_function_vtable_for<T, Noexcept, R, A...>::construct(storage_, resource_, std::forward<F>(f));
+		vtable_ = &pmr_function_vtable_for<T, Noexcept, R, A...>::value;
+	}
+
+	// Takes the memory resource of other along with its callable.
+	pmr_function_base(pmr_function_base&& other) noexcept : resource_(other.resource_) { relocate_from(other); }
+
+	// Moves the callable of other to allocator, unless it uses the same memory resource.
+	pmr_function_base(pmr_function_base&& other, const allocator_type& allocator) : resource_(allocator.resource())
+	{
+		move_from(other);
+	}
+
+	// Keeps the memory resource, as the containers using polymorphic_allocator do.
+	pmr_function_base& operator=(pmr_function_base&& other)
+	{
+		if (this != &other) {
+			reset();
+			move_from(other);
+		}
+		return *this;
+	}
+
+	pmr_function_base& operator=(std::nullptr_t) noexcept
+	{
+		reset();
+		return *this;
+	}
+
+	~pmr_function_base() { reset(); }
+
+	allocator_type get_allocator() const noexcept { return resource_; }
+
+	explicit operator bool() const noexcept { return vtable_ != nullptr; }
+
+	// Must not be called on an empty pmr_function.
+	R operator()(A... args) noexcept(Noexcept) { return vtable_->invoke(storage_, std::forward<A>(args)...); }
+
+private:
+	void relocate_from(pmr_function_base& other) noexcept
+	{
+		if (other.vtable_ == nullptr)
+			return;
+		if (other.vtable_->relocate == nullptr)
+			std::memcpy(storage_, other.storage_, sizeof(storage_));
+		else
+			other.vtable_->relocate(storage_, other.storage_);
+		vtable_ = std::exchange(other.vtable_, nullptr);
+	}
+
+	void move_from(pmr_function_base& other)
+	{
+		if (other.vtable_ == nullptr)
+			return;
+		if (resource_ == other.resource_ || resource_->is_equal(*other.resource_)) {
+			relocate_from(other);
+		} else {
+			other.vtable_->move(storage_, other.storage_, resource_);
+			vtable_ = other.vtable_;
+			other.reset();
+		}
+	}
+
+	void reset() noexcept
+	{
+		if (vtable_ != nullptr && vtable_->destroy != nullptr)
+			vtable_->destroy(storage_, resource_);
+		vtable_ = nullptr;
+	}
+
+	const vtable* vtable_ = nullptr;
+	std::pmr::memory_resource* resource_;
+	alignas(void*) unsigned char storage_[pmr_function_inline_capacity];
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Move-only function wrapper allocating callables larger than two pointers
+// from a std::pmr::memory_resource, e.g. a monotonic arena which releases
+// all of them at once. It is allocator aware: std::pmr containers pass
+// their memory resource to the functions they hold, and moving keeps it,
+// while move assignment moves the callable into the memory resource of
+// the assigned function. The signature is deduced from the callable.
+
+template <typename Signature>
+class pmr_function;
+
+template <typename R, typename... A>
+class pmr_function<R(A...)> : public detail::pmr_function_base<false, R, A...> {
+public:
+	using detail::pmr_function_base<false, R, A...>::pmr_function_base;
+};
+
+template <typename R, typename... A>
+class pmr_function<R(A...) noexcept> : public detail::pmr_function_base<true, R, A...> {
+public:
+	using detail::pmr_function_base<true, R, A...>::pmr_function_base;
+};
+
+template <typename F>
+pmr_function(F) -> pmr_function<detail::wrapper_signature_t<F>>;
+
+template <typename F>
+pmr_function(F, const std::pmr::polymorphic_allocator<std::byte>&) -> pmr_function<detail::wrapper_signature_t<F>>;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+// Tasks whose signature callable_traits cannot deduce, e.g. generic lambdas or the results of std::bind, are noexcept
+// if calling them without arguments is.
+template <typename Task, bool = std::is_function_v<typename get_callable_function_type<Task>::type>>
+struct is_noexcept_task : std::bool_constant<std::is_nothrow_invocable_v<Task&>> {};
+
+template <typename Task>
+struct is_noexcept_task<Task, true> : std::bool_constant<callable_is_noexcept_v<Task>> {};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Hook for executors running tasks. Tasks which cannot throw when called
+// with the given arguments are called directly, other tasks inside a try
+// block capturing what they throw. is_noexcept_task_v reads noexcept from
+// callable_traits where it can deduce the signature. The function wrappers
+// keep noexcept in their deduced signatures, e.g.
+// unique_function<void() noexcept>, so queues of them take the direct path
+// without inspecting each task.
+
+template <typename Task>
+inline constexpr bool is_noexcept_task_v = detail::is_noexcept_task<Task>::value;
+
+// Calls task with args and returns the exception it threw, or a null exception_ptr. The result of task is discarded.
+template <typename Task, typename... A>
+std::exception_ptr run_task(Task&& task, A&&... args) noexcept
+{
+	static_assert(std::is_invocable_v<Task, A...>, "the task cannot be called with these arguments");
+	if constexpr (std::is_nothrow_invocable_v<Task, A...>) {
+		detail::invoke_r<void>(std::forward<Task>(task), std::forward<A>(args)...);
+		return nullptr;
+	} else {
+		try {
+			detail::invoke_r<void>(std::forward<Task>(task), std::forward<A>(args)...);
+			return nullptr;
+		} catch (...) {
+			return std::current_exception();
+		}
+	}
+}
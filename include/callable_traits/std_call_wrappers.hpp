@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+#include <future>
+#include <type_traits>
+
+#include "../callable_traits.hpp"
+
+namespace detail {
+
+//////////////////////////////////////////////////////////////////////////
+// Standard call wrappers, whose call operator is read straight from their
+// signature instead of looking it up on the instantiated wrapper. The
+// results are the same as without this header, except that it adds traits
+// for std::reference_wrapper, which has none otherwise. Specializations
+// have to be visible wherever the traits of these types are instantiated,
+// so include this header in every translation unit using callable_traits
+// on them, or in none, otherwise the program is ill-formed (no diagnostic
+// required).
+
+// The MSVC standard library inherits the call operator of std::function from a base class, which is the class_type
+// on the generic path, so std::function is left to it there.
+#if !defined(_MSVC_STL_VERSION)
+template <typename R, typename... A>
+struct get_call_operator<std::function<R(A...)>> {
+	using type = R (std::function<R(A...)>::*)(A...) const;
+};
+#endif
+
+template <typename R, typename... A>
+struct get_call_operator<std::packaged_task<R(A...)>> {
+	using type = void (std::packaged_task<R(A...)>::*)(A...);
+};
+
+#if defined(__cpp_lib_move_only_function)
+// The call operator has exactly the specifiers of the signature.
+template <typename Signature>
+struct get_call_operator<std::move_only_function<Signature>> {
+	using type = Signature std::move_only_function<Signature>::*;
+};
+#endif
+
+// The call operator of std::reference_wrapper is a template, so it forwards to the traits of the wrapped callable.
+template <typename T>
+struct get_functor_traits<std::reference_wrapper<T>, void> : get_functor_traits<std::remove_cv_t<T>> {};
+
+template <typename T>
+struct get_function_type<std::reference_wrapper<T>, void> : get_function_type<std::remove_cv_t<T>> {};
+
+} // namespace detail
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "detail/function_wrappers.hpp"
+
+namespace detail {
+
+template <typename F, typename Signature = callable_signature_t<F>>
+struct trampoline;
+
+template <typename F, typename R, typename... A>
+struct trampoline<F, R(A...)> {
+	static constexpr bool is_noexcept = callable_is_noexcept_v<F>;
+
+	static R user_data_first(void* user_data, A... args) noexcept(is_noexcept)
+	{
+		return detail::invoke_r<R>(*static_cast<F*>(user_data), std::forward<A>(args)...);
+	}
+
+	static R user_data_last(A... args, void* user_data) noexcept(is_noexcept)
+	{
+		return detail::invoke_r<R>(*static_cast<F*>(user_data), std::forward<A>(args)...);
+	}
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Trampolines for passing callables to C libraries as a function pointer
+// plus a void* user data pointing to the callable. The signature is read
+// from callable_traits<F>, and the call of the callable is known to the
+// compiler, so it is inlined into the trampoline. The user data comes
+// first, R (*)(void*, A...), or last, R (*)(A..., void*), as in qsort_r.
+//
+// Trampolines have C++ language linkage, which every major compiler
+// treats as compatible with C. Exceptions must not escape into C code.
+
+template <typename F>
+inline constexpr auto trampoline_v = &detail::trampoline<F>::user_data_first;
+
+template <typename F>
+inline constexpr auto trampoline_last_v = &detail::trampoline<F>::user_data_last;
+
+template <typename Function>
+struct c_callback {
+	Function function;
+	void* user_data;
+};
+
+// Function pointer and user data for calling callable, which must outlive every call by the C library.
+template <typename F>
+c_callback<decltype(trampoline_v<F>)> make_trampoline(F& callable) noexcept
+{
+	return {trampoline_v<F>, const_cast<void*>(static_cast<const void*>(std::addressof(callable)))};
+}
+
+template <typename F>
+c_callback<decltype(trampoline_last_v<F>)> make_trampoline_last(F& callable) noexcept
+{
+	return {trampoline_last_v<F>, const_cast<void*>(static_cast<const void*>(std::addressof(callable)))};
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../callable_traits.hpp"
+
+namespace detail {
+
+//////////////////////////////////////////////////////////////////////////
+// Type list algorithms. These are built on fold expressions and constexpr
+// evaluation instead of recursion, so neither the number of instantiations
+// per element nor the template depth grows with the length of the list.
+
+// Only declared, for concatenating lists in unevaluated fold expressions.
+template <typename... A, typename... B>
+type_list<A..., B...> operator+(type_list<A...>, type_list<B...>);
+
+// Index of the first true value, or the number of values if there is none.
+template <bool... Values>
+constexpr std::size_t find_first()
+{
+	constexpr bool values[] = {Values..., true};
+	std::size_t index = 0;
+	while (!values[index])
+		++index;
+	return index;
+}
+
+template <typename U, typename... T>
+inline constexpr std::size_t index_of_v = find_first<std::is_same_v<U, T>...>();
+
+template <typename List, std::size_t Index>
+struct type_list_at;
+
+template <typename... T, std::size_t Index>
+struct type_list_at<type_list<T...>, Index> {
+	using type = type_pack_element_t<Index, T...>;
+};
+
+template <typename List, template <typename> class Transform>
+struct type_list_transform;
+
+template <typename... T, template <typename> class Transform>
+struct type_list_transform<type_list<T...>, Transform> {
+	using type = type_list<typename Transform<T>::type...>;
+};
+
+template <typename List, template <typename> class Predicate>
+struct type_list_filter;
+
+template <typename... T, template <typename> class Predicate>
+struct type_list_filter<type_list<T...>, Predicate> {
+	using type = decltype((type_list<>{} + ... + std::conditional_t<Predicate<T>::value, type_list<T>, type_list<>>{}));
+};
+
+template <typename List, template <typename> class Predicate>
+struct type_list_find_if;
+
+template <typename... T, template <typename> class Predicate>
+struct type_list_find_if<type_list<T...>, Predicate> {
+	static constexpr std::size_t value = find_first<bool(Predicate<T>::value)...>();
+};
+
+template <typename List, template <typename> class Predicate>
+struct type_list_count_if;
+
+template <typename... T, template <typename> class Predicate>
+struct type_list_count_if<type_list<T...>, Predicate> {
+	static constexpr std::size_t value = (std::size_t{0} + ... + std::size_t{bool(Predicate<T>::value)});
+};
+
+template <typename List, typename U>
+struct type_list_index_of;
+
+template <typename... T, typename U>
+struct type_list_index_of<type_list<T...>, U> {
+	static constexpr std::size_t value = index_of_v<U, T...>;
+};
+
+// Keeps every type whose first occurrence is at its own index.
+template <typename List, typename Indices>
+struct type_list_unique;
+
+template <typename... T, std::size_t... Indices>
+struct type_list_unique<type_list<T...>, std::index_sequence<Indices...>> {
+	using type = decltype((type_list<>{} + ...
+	                       + std::conditional_t<index_of_v<T, T...> == Indices, type_list<T>, type_list<>>{}));
+};
+
+} // namespace detail
+
+//////////////////////////////////////////////////////////////////////////
+// Algorithms over type_list, e.g. over callable_traits<Callable>::args.
+// Transforms take a trait with a nested type, like std::decay, predicates
+// one with a nested value, like std::is_pointer. Finding returns the size
+// of the list if no type matches.
+
+template <typename List, std::size_t Index>
+using type_list_at_t = typename detail::type_list_at<List, Index>::type;
+template <typename List, template <typename> class Transform>
+using type_list_transform_t = typename detail::type_list_transform<List, Transform>::type;
+template <typename List, template <typename> class Predicate>
+using type_list_filter_t = typename detail::type_list_filter<List, Predicate>::type;
+template <typename List, template <typename> class Predicate>
+inline constexpr std::size_t type_list_find_if_v = detail::type_list_find_if<List, Predicate>::value;
+template <typename List, template <typename> class Predicate>
+inline constexpr std::size_t type_list_count_if_v = detail::type_list_count_if<List, Predicate>::value;
+template <typename List, typename T>
+inline constexpr std::size_t type_list_index_of_v = detail::type_list_index_of<List, T>::value;
+template <typename List>
+using type_list_unique_t = typename detail::type_list_unique<List, std::make_index_sequence<List::size>>::type;
@@ -0,0 +1,28 @@
+module;
+
+#include <callable_traits.hpp>
+
+export module callable_traits;
+
+//////////////////////////////////////////////////////////////////////////
+// Module interface exporting the public API of callable_traits.hpp.
+
+export using ::callable_specifier;
+export using ::type_list;
+export using ::callable_traits;
+
+export using ::callable_is_member_function_v;
+export using ::callable_is_functor_v;
+export using ::callable_is_const_v;
+export using ::callable_is_volatile_v;
+export using ::callable_is_lvalue_reference_v;
+export using ::callable_is_rvalue_reference_v;
+export using ::callable_is_noexcept_v;
+export using ::callable_is_variadic_v;
+export using ::callable_specifier_mask_v;
+export using ::callable_arity_v;
+export using ::callable_signature_t;
+export using ::callable_result_t;
+export using ::callable_args_t;
+export using ::callable_arg_t;
+export using ::callable_class_t;
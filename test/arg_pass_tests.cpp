@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../include/callable_traits/arg_pass.hpp"
+#include "../include/callable_traits/function_ref.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct incomplete;
+
+enum class color { red, green };
+
+struct widget {
+	int id;
+};
+
+using layer =
+    void(const int&, const double&, const color&, const widget* const&, const widget&, const std::string&, int&,
+         const int&&, std::string, const volatile int&, const incomplete&);
+
+// Scalars taken by const reference are passed by value, everything else as it is.
+static_assert(std::is_same_v<arg_pass_t<layer, 0>, int>);
+static_assert(std::is_same_v<arg_pass_t<layer, 1>, double>);
+static_assert(std::is_same_v<arg_pass_t<layer, 2>, color>);
+static_assert(std::is_same_v<arg_pass_t<layer, 3>, const widget*>);
+static_assert(std::is_same_v<arg_pass_t<layer, 4>, const widget&>);
+static_assert(std::is_same_v<arg_pass_t<layer, 5>, const std::string&>);
+static_assert(std::is_same_v<arg_pass_t<layer, 6>, int&>);
+static_assert(std::is_same_v<arg_pass_t<layer, 7>, const int&&>);
+static_assert(std::is_same_v<arg_pass_t<layer, 8>, std::string>);
+static_assert(std::is_same_v<arg_pass_t<layer, 9>, const volatile int&>);
+static_assert(std::is_same_v<arg_pass_t<layer, 10>, const incomplete&>);
+
+int add(const int& a, const double& b) noexcept { return a + static_cast<int>(b); }
+void append(std::string& s, const char& c) { s += c; }
+
+[[maybe_unused]] const auto size = [](const std::string& s, const std::size_t& offset) { return s.size() + offset; };
+[[maybe_unused]] const auto take = [](std::unique_ptr<int> p, const int& value) { return *p + value; };
+
+// The adaptor has the signature of the callable with the parameters passed as arg_pass_t.
+static_assert(std::is_same_v<callable_signature_t<invoke_adaptor<decltype(&add)>>, int(int, double)>);
+static_assert(callable_is_noexcept_v<invoke_adaptor<decltype(&add)>>);
+static_assert(std::is_same_v<callable_signature_t<invoke_adaptor<decltype(&append)>>, void(std::string&, char)>);
+static_assert(!callable_is_noexcept_v<invoke_adaptor<decltype(&append)>>);
+static_assert(std::is_same_v<callable_signature_t<invoke_adaptor<decltype(size)>>,
+                             std::size_t(const std::string&, std::size_t)>);
+static_assert(callable_is_const_v<invoke_adaptor<decltype(size)>>);
+static_assert(std::is_same_v<decltype(invoke_adaptor(add)), invoke_adaptor<decltype(&add)>>);
+
+int main()
+{
+	helper::check(invoke_adaptor(add)(1, 2.5) == 3);
+
+	std::string text = "ab";
+	const invoke_adaptor append_char(append);
+	append_char(text, 'c');
+	helper::check(text == "abc");
+
+	helper::check(invoke_adaptor(size)(text, 2) == 5);
+	helper::check(invoke_adaptor(take)(std::make_unique<int>(2), 3) == 5);
+
+	invoke_adaptor counter([calls = 0](const int& step) mutable { return calls += step; });
+	static_assert(!callable_is_const_v<decltype(counter)>);
+	counter(2);
+	helper::check(counter(3) == 5);
+
+	// The adaptor passes scalars on as copies, while the wrappers keep the references of the caller.
+	int value = 1;
+	const auto is_value = [&value](const int& other) { return &other == &value; };
+	helper::check(!invoke_adaptor(is_value)(value));
+	helper::check(function_ref<bool(const int&)>(is_value)(value));
+	const auto is_text = [&text](const std::string& other) { return &other == &text; };
+	helper::check(invoke_adaptor(is_text)(text));
+
+	return helper::failures;
+}
@@ -0,0 +1,116 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../include/callable_traits/bind_front.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct widget {
+	int resize(int width, int height) noexcept { return area = width * height; }
+	std::string name(const std::string& prefix) const { return prefix + std::to_string(area); }
+	int area = 0;
+};
+
+struct empty_tag {};
+
+int add3(int a, int b, int c) { return a + b + c; }
+int scale(int factor, int value) noexcept { return factor * value; }
+void append(std::string& s, const std::string& suffix) { s += suffix; }
+std::string concat(const std::string& a, const std::string& b) { return a + b; }
+std::string repeat(const std::string& s, std::size_t count)
+{
+	std::string result;
+	while (count-- > 0)
+		result += s;
+	return result;
+}
+
+[[maybe_unused]] const auto tagged = [](empty_tag, int value) noexcept { return value; };
+
+// The result has the remaining signature, including noexcept.
+using add_one = decltype(bind_front(add3, 1));
+static_assert(std::is_same_v<callable_signature_t<add_one>, int(int, int)>);
+static_assert(!callable_is_noexcept_v<add_one>);
+static_assert(callable_is_const_v<add_one>);
+static_assert(std::is_same_v<callable_signature_t<decltype(bind_front(add3, 1, 2, 3))>, int()>);
+static_assert(callable_is_noexcept_v<decltype(bind_front(scale, 2))>);
+static_assert(std::is_nothrow_invocable_v<decltype(bind_front(scale, 2)), int>);
+static_assert(std::is_same_v<callable_signature_t<decltype(bind_front(&widget::resize, std::declval<widget*>()))>,
+                             int(int, int)>);
+static_assert(callable_is_noexcept_v<decltype(bind_front(&widget::resize, std::declval<widget*>(), 1))>);
+
+// Member functions bound to an object stored by value are called as const only if they are const.
+static_assert(callable_is_const_v<decltype(bind_front(&widget::resize, std::declval<widget*>()))>);
+static_assert(!callable_is_const_v<decltype(bind_front(&widget::resize, widget{}))>);
+static_assert(callable_is_const_v<decltype(bind_front(&widget::name, widget{}))>);
+
+// Empty callables and empty bound arguments take no space.
+static_assert(sizeof(decltype(bind_front(tagged, empty_tag{}))) == 1);
+static_assert(sizeof(decltype(bind_front(tagged, empty_tag{}, 1))) == sizeof(int));
+static_assert(sizeof(decltype(bind_front(&add3, 1))) == sizeof(std::pair<int (*)(int, int, int), int>));
+
+// Every step of a curried callable has the signature of the next argument.
+using curried_add = decltype(curry(add3));
+static_assert(std::is_same_v<callable_signature_t<curried_add>, std::invoke_result_t<curried_add, int>(int)>);
+static_assert(
+    std::is_same_v<callable_result_t<std::invoke_result_t<std::invoke_result_t<curried_add, int>, int>>, int>);
+static_assert(std::is_same_v<callable_arg_t<std::invoke_result_t<curried_add, int>, 0>, int>);
+static_assert(sizeof(decltype(curry(tagged))) == 1);
+static_assert(std::is_nothrow_invocable_v<std::invoke_result_t<decltype(curry(scale)), int>, int>);
+
+int main()
+{
+	const auto add_ten = bind_front(add3, 4, 6);
+	helper::check(add_ten(1) == 11);
+	helper::check(bind_front(add3)(1, 2, 3) == 6);
+	helper::check(bind_front(add3, 1, 2, 3)() == 6);
+
+	widget w;
+	auto resize = bind_front(&widget::resize, &w);
+	helper::check(resize(2, 3) == 6 && w.area == 6);
+	helper::check(bind_front(&widget::name, std::cref(w))("area ") == "area 6");
+	auto owned = bind_front(&widget::resize, widget{});
+	helper::check(owned(2, 4) == 8 && owned(1, 1) == 1 && w.area == 6);
+
+	// References are bound with std::ref, values are copied.
+	std::string text = "a";
+	bind_front(append, std::ref(text))("b");
+	std::string suffix = "c";
+	const auto append_c = bind_front(append, std::ref(text), suffix);
+	suffix = "d";
+	append_c();
+	helper::check(text == "abc");
+
+	// Callables with a non-const call operator are called through a non-const one.
+	auto counter = bind_front([calls = 0](int step) mutable { return calls += step; });
+	static_assert(!callable_is_const_v<decltype(counter)>);
+	counter(2);
+	helper::check(counter(3) == 5);
+
+	// Move-only bound arguments make the result move-only. They are passed as lvalues, so binding them to a parameter
+	// taken by value, e.g. bind_front([](std::unique_ptr<int>) {}, std::make_unique<int>(2)), does not compile.
+	auto owner =
+	    bind_front([](const std::unique_ptr<int>& p, int value) { return *p + value; }, std::make_unique<int>(2));
+	auto moved = std::move(owner);
+	helper::check(moved(3) == 5);
+
+	helper::check(curry(add3)(1)(2)(3) == 6);
+	const auto add_1 = curry(add3)(1);
+	const auto add_1_2 = add_1(2);
+	helper::check(add_1_2(3) == 6 && add_1_2(4) == 7 && add_1(5)(6) == 12);
+	helper::check(curry(repeat)("ab")(3) == "ababab");
+	helper::check(curry(bind_front(&widget::resize, &w))(4)(5) == 20 && w.area == 20);
+
+	// Arguments taken by non-const lvalue reference are stored as reference, all others are copied, so a step can be
+	// called after the temporaries passed to it are gone.
+	std::string target = "x";
+	const auto append_to_target = curry(append)(target);
+	append_to_target("y");
+	helper::check(target == "xy");
+	const auto prefix_x = curry(concat)(std::string("x"));
+	helper::check(prefix_x("z") == "xz");
+
+	return helper::failures;
+}
@@ -0,0 +1,45 @@
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/callable_traits_list.hpp"
+
+struct foo {
+	void mem_fn(int, float) const&&;
+	int operator()(std::string&) noexcept;
+};
+
+bool fn(const char*, ...);
+
+[[maybe_unused]] const auto lambda = [](int, int, int) mutable {};
+
+using list = callable_traits_list<decltype(fn), decltype(&foo::mem_fn), foo, decltype(lambda), bool (*const&)()>;
+
+static_assert(list::size == 5);
+static_assert(list::arity[0] == 1 && list::arity[1] == 2 && list::arity[2] == 1 && list::arity[3] == 3
+              && list::arity[4] == 0);
+static_assert(!list::is_member_function[0] && list::is_member_function[1] && !list::is_member_function[2]
+              && !list::is_member_function[3] && !list::is_member_function[4]);
+static_assert(!list::is_functor[0] && !list::is_functor[1] && list::is_functor[2] && list::is_functor[3]
+              && !list::is_functor[4]);
+static_assert(list::specifier_mask[0] == callable_specifier::is_variadic);
+static_assert(list::specifier_mask[1] == (callable_specifier::is_const | callable_specifier::is_rvalue_reference));
+static_assert(list::specifier_mask[2] == callable_specifier::is_noexcept);
+static_assert(list::specifier_mask[3] == callable_specifier::none);
+static_assert(list::specifier_mask[4] == callable_specifier::none);
+
+static_assert(std::is_same_v<list::callable_type<1>, decltype(&foo::mem_fn)>);
+static_assert(std::is_same_v<list::signature_type<0>, bool(const char*)>);
+static_assert(std::is_same_v<list::signature_type<1>, void(int, float)>);
+static_assert(std::is_same_v<list::signature_type<3>, void(int, int, int)>);
+static_assert(std::is_same_v<list::result_type<0>, bool>);
+static_assert(std::is_same_v<list::result_type<1>, void>);
+static_assert(std::is_same_v<list::result_type<2>, int>);
+static_assert(std::is_same_v<list::arg_type<0, 0>, const char*>);
+static_assert(std::is_same_v<list::arg_type<1, 1>, float>);
+static_assert(std::is_same_v<list::arg_type<2, 0>, std::string&>);
+static_assert(std::is_same_v<list::arg_type<3, 2>, int>);
+
+static_assert(callable_traits_list<>::size == 0);
+static_assert(callable_traits_list<>::arity.empty());
+
+int main() { return 0; }
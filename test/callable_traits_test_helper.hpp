@@ -40,4 +40,13 @@ struct has_class_type<T, std::void_t<typename T::class_type>> : std::true_type {
 template <typename T>
 inline constexpr auto has_class_type_v = has_class_type<T>::value;
 
+// Runtime checks count their failures, which main returns.
+inline int failures = 0;
+
+inline void check(bool condition)
+{
+	if (!condition)
+		++failures;
+}
+
 } // namespace helper
@@ -0,0 +1,7605 @@
+/* This file was auto-generated */
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "../../include/callable_traits.hpp"
+#include "../callable_traits_test_helper.hpp"
+
+[[maybe_unused]] const auto lambda_0 = []() -> void {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_0)>::signature_type, void()>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_0)>::result_type, void>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_0)>> == false);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_0)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_0)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_0)>> == false);
+static_assert(callable_traits<decltype(lambda_0)>::arity == 0);
+static_assert(callable_traits<decltype(lambda_0)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_0)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_0)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_0)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_0)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_0)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_0)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_0)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_0)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_0)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_0)>::class_type, std::remove_const_t<decltype(lambda_0)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_0)>, void()>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_0)>, void>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_0)>, type_list<>>);
+static_assert(callable_arity_v<decltype(lambda_0)> == 0);
+static_assert(callable_is_functor_v<decltype(lambda_0)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_0)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_0)> == callable_traits<decltype(lambda_0)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_0)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_0)>, std::remove_const_t<decltype(lambda_0)>>);
+[[maybe_unused]] const auto lambda_2 = [](const void *) noexcept -> const void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_2)>::signature_type, const void *(const void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_2)>::result_type, const void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_2)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_2)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_2)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_2)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_2)>::arg0_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_2)>::arg_type<0>, const void *>);
+static_assert(callable_traits<decltype(lambda_2)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_2)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_2)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_2)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_2)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_2)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_2)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_2)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_2)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_2)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_2)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_2)>::class_type, std::remove_const_t<decltype(lambda_2)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_2)>, const void *(const void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_2)>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_2), 0>, const void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_2)>, type_list<const void *>>);
+static_assert(callable_arity_v<decltype(lambda_2)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_2)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_2)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_2)> == callable_traits<decltype(lambda_2)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_2)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_2)>, std::remove_const_t<decltype(lambda_2)>>);
+[[maybe_unused]] const auto lambda_4 = [](const volatile void *) -> const volatile void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_4)>::signature_type, const volatile void *(const volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_4)>::result_type, const volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_4)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_4)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_4)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_4)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_4)>::arg0_type, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_4)>::arg_type<0>, const volatile void *>);
+static_assert(callable_traits<decltype(lambda_4)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_4)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_4)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_4)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_4)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_4)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_4)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_4)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_4)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_4)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_4)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_4)>::class_type, std::remove_const_t<decltype(lambda_4)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_4)>, const volatile void *(const volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_4)>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_4), 0>, const volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_4)>, type_list<const volatile void *>>);
+static_assert(callable_arity_v<decltype(lambda_4)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_4)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_4)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_4)> == callable_traits<decltype(lambda_4)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_4)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_4)>, std::remove_const_t<decltype(lambda_4)>>);
+[[maybe_unused]] const auto lambda_6 = [](const void * &) noexcept -> const void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_6)>::signature_type, const void * &(const void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_6)>::result_type, const void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_6)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_6)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_6)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_6)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_6)>::arg0_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_6)>::arg_type<0>, const void * &>);
+static_assert(callable_traits<decltype(lambda_6)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_6)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_6)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_6)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_6)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_6)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_6)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_6)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_6)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_6)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_6)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_6)>::class_type, std::remove_const_t<decltype(lambda_6)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_6)>, const void * &(const void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_6)>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_6), 0>, const void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_6)>, type_list<const void * &>>);
+static_assert(callable_arity_v<decltype(lambda_6)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_6)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_6)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_6)> == callable_traits<decltype(lambda_6)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_6)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_6)>, std::remove_const_t<decltype(lambda_6)>>);
+[[maybe_unused]] const auto lambda_8 = [](const volatile void * &) -> const volatile void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_8)>::signature_type, const volatile void * &(const volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_8)>::result_type, const volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_8)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_8)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_8)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_8)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_8)>::arg0_type, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_8)>::arg_type<0>, const volatile void * &>);
+static_assert(callable_traits<decltype(lambda_8)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_8)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_8)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_8)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_8)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_8)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_8)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_8)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_8)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_8)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_8)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_8)>::class_type, std::remove_const_t<decltype(lambda_8)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_8)>, const volatile void * &(const volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_8)>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_8), 0>, const volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_8)>, type_list<const volatile void * &>>);
+static_assert(callable_arity_v<decltype(lambda_8)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_8)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_8)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_8)> == callable_traits<decltype(lambda_8)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_8)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_8)>, std::remove_const_t<decltype(lambda_8)>>);
+[[maybe_unused]] const auto lambda_10 = [](const void * const &) noexcept -> const void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_10)>::signature_type, const void * const &(const void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_10)>::result_type, const void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_10)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_10)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_10)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_10)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_10)>::arg0_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_10)>::arg_type<0>, const void * const &>);
+static_assert(callable_traits<decltype(lambda_10)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_10)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_10)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_10)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_10)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_10)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_10)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_10)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_10)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_10)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_10)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_10)>::class_type, std::remove_const_t<decltype(lambda_10)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_10)>, const void * const &(const void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_10)>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_10), 0>, const void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_10)>, type_list<const void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_10)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_10)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_10)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_10)> == callable_traits<decltype(lambda_10)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_10)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_10)>, std::remove_const_t<decltype(lambda_10)>>);
+[[maybe_unused]] const auto lambda_12 = [](const volatile void * const &) -> const volatile void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_12)>::signature_type, const volatile void * const &(const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_12)>::result_type, const volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_12)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_12)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_12)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_12)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_12)>::arg0_type, const volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_12)>::arg_type<0>, const volatile void * const &>);
+static_assert(callable_traits<decltype(lambda_12)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_12)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_12)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_12)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_12)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_12)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_12)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_12)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_12)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_12)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_12)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_12)>::class_type, std::remove_const_t<decltype(lambda_12)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_12)>, const volatile void * const &(const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_12)>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_12), 0>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_12)>, type_list<const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_12)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_12)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_12)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_12)> == callable_traits<decltype(lambda_12)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_12)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_12)>, std::remove_const_t<decltype(lambda_12)>>);
+[[maybe_unused]] const auto lambda_14 = [](const void * volatile &) noexcept -> const void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_14)>::signature_type, const void * volatile &(const void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_14)>::result_type, const void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_14)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_14)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_14)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_14)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_14)>::arg0_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_14)>::arg_type<0>, const void * volatile &>);
+static_assert(callable_traits<decltype(lambda_14)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_14)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_14)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_14)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_14)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_14)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_14)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_14)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_14)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_14)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_14)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_14)>::class_type, std::remove_const_t<decltype(lambda_14)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_14)>, const void * volatile &(const void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_14)>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_14), 0>, const void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_14)>, type_list<const void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_14)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_14)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_14)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_14)> == callable_traits<decltype(lambda_14)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_14)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_14)>, std::remove_const_t<decltype(lambda_14)>>);
+[[maybe_unused]] const auto lambda_16 = [](const volatile void * volatile &) -> const volatile void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_16)>::signature_type, const volatile void * volatile &(const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_16)>::result_type, const volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_16)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_16)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_16)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_16)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_16)>::arg0_type, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_16)>::arg_type<0>, const volatile void * volatile &>);
+static_assert(callable_traits<decltype(lambda_16)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_16)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_16)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_16)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_16)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_16)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_16)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_16)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_16)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_16)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_16)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_16)>::class_type, std::remove_const_t<decltype(lambda_16)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_16)>, const volatile void * volatile &(const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_16)>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_16), 0>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_16)>, type_list<const volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_16)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_16)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_16)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_16)> == callable_traits<decltype(lambda_16)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_16)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_16)>, std::remove_const_t<decltype(lambda_16)>>);
+[[maybe_unused]] const auto lambda_18 = [](const void * const volatile &) noexcept -> const void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_18)>::signature_type, const void * const volatile &(const void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_18)>::result_type, const void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_18)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_18)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_18)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_18)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_18)>::arg0_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_18)>::arg_type<0>, const void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_18)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_18)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_18)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_18)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_18)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_18)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_18)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_18)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_18)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_18)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_18)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_18)>::class_type, std::remove_const_t<decltype(lambda_18)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_18)>, const void * const volatile &(const void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_18)>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_18), 0>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_18)>, type_list<const void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_18)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_18)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_18)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_18)> == callable_traits<decltype(lambda_18)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_18)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_18)>, std::remove_const_t<decltype(lambda_18)>>);
+[[maybe_unused]] const auto lambda_20 = [](const volatile void * const volatile &) -> const volatile void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_20)>::signature_type, const volatile void * const volatile &(const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_20)>::result_type, const volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_20)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_20)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_20)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_20)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_20)>::arg0_type, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_20)>::arg_type<0>, const volatile void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_20)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_20)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_20)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_20)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_20)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_20)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_20)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_20)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_20)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_20)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_20)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_20)>::class_type, std::remove_const_t<decltype(lambda_20)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_20)>, const volatile void * const volatile &(const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_20)>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_20), 0>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_20)>, type_list<const volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_20)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_20)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_20)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_20)> == callable_traits<decltype(lambda_20)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_20)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_20)>, std::remove_const_t<decltype(lambda_20)>>);
+[[maybe_unused]] const auto lambda_22 = [](const void * &&) noexcept -> const void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_22)>::signature_type, const void * &&(const void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_22)>::result_type, const void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_22)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_22)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_22)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_22)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_22)>::arg0_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_22)>::arg_type<0>, const void * &&>);
+static_assert(callable_traits<decltype(lambda_22)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_22)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_22)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_22)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_22)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_22)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_22)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_22)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_22)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_22)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_22)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_22)>::class_type, std::remove_const_t<decltype(lambda_22)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_22)>, const void * &&(const void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_22)>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_22), 0>, const void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_22)>, type_list<const void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_22)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_22)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_22)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_22)> == callable_traits<decltype(lambda_22)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_22)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_22)>, std::remove_const_t<decltype(lambda_22)>>);
+[[maybe_unused]] const auto lambda_24 = [](const volatile void * &&) -> const volatile void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_24)>::signature_type, const volatile void * &&(const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_24)>::result_type, const volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_24)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_24)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_24)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_24)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_24)>::arg0_type, const volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_24)>::arg_type<0>, const volatile void * &&>);
+static_assert(callable_traits<decltype(lambda_24)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_24)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_24)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_24)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_24)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_24)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_24)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_24)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_24)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_24)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_24)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_24)>::class_type, std::remove_const_t<decltype(lambda_24)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_24)>, const volatile void * &&(const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_24)>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_24), 0>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_24)>, type_list<const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_24)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_24)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_24)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_24)> == callable_traits<decltype(lambda_24)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_24)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_24)>, std::remove_const_t<decltype(lambda_24)>>);
+[[maybe_unused]] const auto lambda_26 = [](const void * const &&) noexcept -> const void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_26)>::signature_type, const void * const &&(const void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_26)>::result_type, const void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_26)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_26)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_26)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_26)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_26)>::arg0_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_26)>::arg_type<0>, const void * const &&>);
+static_assert(callable_traits<decltype(lambda_26)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_26)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_26)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_26)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_26)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_26)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_26)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_26)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_26)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_26)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_26)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_26)>::class_type, std::remove_const_t<decltype(lambda_26)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_26)>, const void * const &&(const void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_26)>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_26), 0>, const void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_26)>, type_list<const void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_26)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_26)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_26)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_26)> == callable_traits<decltype(lambda_26)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_26)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_26)>, std::remove_const_t<decltype(lambda_26)>>);
+[[maybe_unused]] const auto lambda_28 = [](const volatile void * const &&) -> const volatile void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_28)>::signature_type, const volatile void * const &&(const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_28)>::result_type, const volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_28)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_28)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_28)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_28)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_28)>::arg0_type, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_28)>::arg_type<0>, const volatile void * const &&>);
+static_assert(callable_traits<decltype(lambda_28)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_28)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_28)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_28)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_28)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_28)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_28)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_28)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_28)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_28)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_28)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_28)>::class_type, std::remove_const_t<decltype(lambda_28)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_28)>, const volatile void * const &&(const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_28)>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_28), 0>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_28)>, type_list<const volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_28)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_28)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_28)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_28)> == callable_traits<decltype(lambda_28)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_28)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_28)>, std::remove_const_t<decltype(lambda_28)>>);
+[[maybe_unused]] const auto lambda_30 = [](const void * volatile &&) noexcept -> const void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_30)>::signature_type, const void * volatile &&(const void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_30)>::result_type, const void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_30)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_30)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_30)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_30)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_30)>::arg0_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_30)>::arg_type<0>, const void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_30)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_30)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_30)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_30)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_30)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_30)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_30)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_30)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_30)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_30)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_30)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_30)>::class_type, std::remove_const_t<decltype(lambda_30)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_30)>, const void * volatile &&(const void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_30)>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_30), 0>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_30)>, type_list<const void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_30)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_30)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_30)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_30)> == callable_traits<decltype(lambda_30)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_30)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_30)>, std::remove_const_t<decltype(lambda_30)>>);
+[[maybe_unused]] const auto lambda_32 = [](const volatile void * volatile &&) -> const volatile void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_32)>::signature_type, const volatile void * volatile &&(const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_32)>::result_type, const volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_32)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_32)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_32)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_32)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_32)>::arg0_type, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_32)>::arg_type<0>, const volatile void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_32)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_32)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_32)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_32)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_32)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_32)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_32)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_32)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_32)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_32)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_32)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_32)>::class_type, std::remove_const_t<decltype(lambda_32)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_32)>, const volatile void * volatile &&(const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_32)>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_32), 0>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_32)>, type_list<const volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_32)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_32)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_32)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_32)> == callable_traits<decltype(lambda_32)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_32)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_32)>, std::remove_const_t<decltype(lambda_32)>>);
+[[maybe_unused]] const auto lambda_34 = [](const void * const volatile &&) noexcept -> const void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_34)>::signature_type, const void * const volatile &&(const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_34)>::result_type, const void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_34)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_34)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_34)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_34)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_34)>::arg0_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_34)>::arg_type<0>, const void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_34)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_34)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_34)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_34)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_34)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_34)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_34)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_34)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_34)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_34)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_34)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_34)>::class_type, std::remove_const_t<decltype(lambda_34)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_34)>, const void * const volatile &&(const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_34)>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_34), 0>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_34)>, type_list<const void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_34)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_34)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_34)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_34)> == callable_traits<decltype(lambda_34)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_34)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_34)>, std::remove_const_t<decltype(lambda_34)>>);
+[[maybe_unused]] const auto lambda_36 = [](const volatile void * const volatile &&) -> const volatile void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_36)>::signature_type, const volatile void * const volatile &&(const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_36)>::result_type, const volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_36)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_36)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_36)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_36)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_36)>::arg0_type, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_36)>::arg_type<0>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_36)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_36)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_36)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_36)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_36)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_36)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_36)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_36)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_36)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_36)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_36)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_36)>::class_type, std::remove_const_t<decltype(lambda_36)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_36)>, const volatile void * const volatile &&(const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_36)>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_36), 0>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_36)>, type_list<const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_36)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_36)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_36)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_36)> == callable_traits<decltype(lambda_36)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_36)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_36)>, std::remove_const_t<decltype(lambda_36)>>);
+[[maybe_unused]] const auto lambda_38 = [](bool *) noexcept -> bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_38)>::signature_type, bool *(bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_38)>::result_type, bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_38)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_38)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_38)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_38)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_38)>::arg0_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_38)>::arg_type<0>, bool *>);
+static_assert(callable_traits<decltype(lambda_38)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_38)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_38)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_38)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_38)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_38)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_38)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_38)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_38)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_38)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_38)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_38)>::class_type, std::remove_const_t<decltype(lambda_38)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_38)>, bool *(bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_38)>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_38), 0>, bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_38)>, type_list<bool *>>);
+static_assert(callable_arity_v<decltype(lambda_38)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_38)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_38)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_38)> == callable_traits<decltype(lambda_38)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_38)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_38)>, std::remove_const_t<decltype(lambda_38)>>);
+[[maybe_unused]] const auto lambda_40 = [](volatile bool *) -> volatile bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_40)>::signature_type, volatile bool *(volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_40)>::result_type, volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_40)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_40)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_40)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_40)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_40)>::arg0_type, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_40)>::arg_type<0>, volatile bool *>);
+static_assert(callable_traits<decltype(lambda_40)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_40)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_40)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_40)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_40)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_40)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_40)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_40)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_40)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_40)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_40)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_40)>::class_type, std::remove_const_t<decltype(lambda_40)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_40)>, volatile bool *(volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_40)>, volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_40), 0>, volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_40)>, type_list<volatile bool *>>);
+static_assert(callable_arity_v<decltype(lambda_40)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_40)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_40)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_40)> == callable_traits<decltype(lambda_40)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_40)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_40)>, std::remove_const_t<decltype(lambda_40)>>);
+[[maybe_unused]] const auto lambda_42 = [](bool &) noexcept -> bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_42)>::signature_type, bool &(bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_42)>::result_type, bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_42)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_42)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_42)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_42)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_42)>::arg0_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_42)>::arg_type<0>, bool &>);
+static_assert(callable_traits<decltype(lambda_42)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_42)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_42)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_42)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_42)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_42)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_42)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_42)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_42)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_42)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_42)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_42)>::class_type, std::remove_const_t<decltype(lambda_42)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_42)>, bool &(bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_42)>, bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_42), 0>, bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_42)>, type_list<bool &>>);
+static_assert(callable_arity_v<decltype(lambda_42)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_42)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_42)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_42)> == callable_traits<decltype(lambda_42)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_42)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_42)>, std::remove_const_t<decltype(lambda_42)>>);
+[[maybe_unused]] const auto lambda_44 = [](volatile bool &) -> volatile bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_44)>::signature_type, volatile bool &(volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_44)>::result_type, volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_44)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_44)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_44)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_44)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_44)>::arg0_type, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_44)>::arg_type<0>, volatile bool &>);
+static_assert(callable_traits<decltype(lambda_44)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_44)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_44)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_44)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_44)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_44)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_44)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_44)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_44)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_44)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_44)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_44)>::class_type, std::remove_const_t<decltype(lambda_44)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_44)>, volatile bool &(volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_44)>, volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_44), 0>, volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_44)>, type_list<volatile bool &>>);
+static_assert(callable_arity_v<decltype(lambda_44)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_44)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_44)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_44)> == callable_traits<decltype(lambda_44)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_44)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_44)>, std::remove_const_t<decltype(lambda_44)>>);
+[[maybe_unused]] const auto lambda_46 = [](bool * &) noexcept -> bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_46)>::signature_type, bool * &(bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_46)>::result_type, bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_46)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_46)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_46)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_46)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_46)>::arg0_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_46)>::arg_type<0>, bool * &>);
+static_assert(callable_traits<decltype(lambda_46)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_46)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_46)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_46)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_46)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_46)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_46)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_46)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_46)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_46)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_46)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_46)>::class_type, std::remove_const_t<decltype(lambda_46)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_46)>, bool * &(bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_46)>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_46), 0>, bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_46)>, type_list<bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_46)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_46)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_46)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_46)> == callable_traits<decltype(lambda_46)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_46)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_46)>, std::remove_const_t<decltype(lambda_46)>>);
+[[maybe_unused]] const auto lambda_48 = [](volatile bool * &) -> volatile bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_48)>::signature_type, volatile bool * &(volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_48)>::result_type, volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_48)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_48)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_48)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_48)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_48)>::arg0_type, volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_48)>::arg_type<0>, volatile bool * &>);
+static_assert(callable_traits<decltype(lambda_48)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_48)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_48)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_48)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_48)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_48)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_48)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_48)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_48)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_48)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_48)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_48)>::class_type, std::remove_const_t<decltype(lambda_48)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_48)>, volatile bool * &(volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_48)>, volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_48), 0>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_48)>, type_list<volatile bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_48)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_48)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_48)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_48)> == callable_traits<decltype(lambda_48)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_48)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_48)>, std::remove_const_t<decltype(lambda_48)>>);
+[[maybe_unused]] const auto lambda_50 = [](bool * const &) noexcept -> bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_50)>::signature_type, bool * const &(bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_50)>::result_type, bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_50)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_50)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_50)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_50)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_50)>::arg0_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_50)>::arg_type<0>, bool * const &>);
+static_assert(callable_traits<decltype(lambda_50)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_50)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_50)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_50)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_50)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_50)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_50)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_50)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_50)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_50)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_50)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_50)>::class_type, std::remove_const_t<decltype(lambda_50)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_50)>, bool * const &(bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_50)>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_50), 0>, bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_50)>, type_list<bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_50)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_50)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_50)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_50)> == callable_traits<decltype(lambda_50)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_50)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_50)>, std::remove_const_t<decltype(lambda_50)>>);
+[[maybe_unused]] const auto lambda_52 = [](volatile bool * const &) -> volatile bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_52)>::signature_type, volatile bool * const &(volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_52)>::result_type, volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_52)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_52)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_52)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_52)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_52)>::arg0_type, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_52)>::arg_type<0>, volatile bool * const &>);
+static_assert(callable_traits<decltype(lambda_52)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_52)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_52)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_52)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_52)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_52)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_52)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_52)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_52)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_52)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_52)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_52)>::class_type, std::remove_const_t<decltype(lambda_52)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_52)>, volatile bool * const &(volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_52)>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_52), 0>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_52)>, type_list<volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_52)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_52)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_52)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_52)> == callable_traits<decltype(lambda_52)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_52)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_52)>, std::remove_const_t<decltype(lambda_52)>>);
+[[maybe_unused]] const auto lambda_54 = [](bool * volatile &) noexcept -> bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_54)>::signature_type, bool * volatile &(bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_54)>::result_type, bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_54)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_54)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_54)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_54)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_54)>::arg0_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_54)>::arg_type<0>, bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_54)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_54)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_54)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_54)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_54)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_54)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_54)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_54)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_54)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_54)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_54)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_54)>::class_type, std::remove_const_t<decltype(lambda_54)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_54)>, bool * volatile &(bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_54)>, bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_54), 0>, bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_54)>, type_list<bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_54)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_54)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_54)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_54)> == callable_traits<decltype(lambda_54)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_54)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_54)>, std::remove_const_t<decltype(lambda_54)>>);
+[[maybe_unused]] const auto lambda_56 = [](volatile bool * volatile &) -> volatile bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_56)>::signature_type, volatile bool * volatile &(volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_56)>::result_type, volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_56)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_56)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_56)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_56)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_56)>::arg0_type, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_56)>::arg_type<0>, volatile bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_56)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_56)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_56)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_56)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_56)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_56)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_56)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_56)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_56)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_56)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_56)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_56)>::class_type, std::remove_const_t<decltype(lambda_56)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_56)>, volatile bool * volatile &(volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_56)>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_56), 0>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_56)>, type_list<volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_56)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_56)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_56)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_56)> == callable_traits<decltype(lambda_56)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_56)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_56)>, std::remove_const_t<decltype(lambda_56)>>);
+[[maybe_unused]] const auto lambda_58 = [](bool * const volatile &) noexcept -> bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_58)>::signature_type, bool * const volatile &(bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_58)>::result_type, bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_58)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_58)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_58)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_58)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_58)>::arg0_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_58)>::arg_type<0>, bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_58)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_58)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_58)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_58)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_58)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_58)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_58)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_58)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_58)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_58)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_58)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_58)>::class_type, std::remove_const_t<decltype(lambda_58)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_58)>, bool * const volatile &(bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_58)>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_58), 0>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_58)>, type_list<bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_58)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_58)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_58)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_58)> == callable_traits<decltype(lambda_58)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_58)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_58)>, std::remove_const_t<decltype(lambda_58)>>);
+[[maybe_unused]] const auto lambda_60 = [](volatile bool * const volatile &) -> volatile bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_60)>::signature_type, volatile bool * const volatile &(volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_60)>::result_type, volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_60)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_60)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_60)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_60)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_60)>::arg0_type, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_60)>::arg_type<0>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_60)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_60)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_60)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_60)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_60)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_60)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_60)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_60)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_60)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_60)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_60)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_60)>::class_type, std::remove_const_t<decltype(lambda_60)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_60)>, volatile bool * const volatile &(volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_60)>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_60), 0>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_60)>, type_list<volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_60)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_60)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_60)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_60)> == callable_traits<decltype(lambda_60)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_60)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_60)>, std::remove_const_t<decltype(lambda_60)>>);
+[[maybe_unused]] const auto lambda_62 = [](bool &&) noexcept -> bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_62)>::signature_type, bool &&(bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_62)>::result_type, bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_62)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_62)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_62)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_62)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_62)>::arg0_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_62)>::arg_type<0>, bool &&>);
+static_assert(callable_traits<decltype(lambda_62)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_62)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_62)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_62)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_62)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_62)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_62)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_62)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_62)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_62)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_62)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_62)>::class_type, std::remove_const_t<decltype(lambda_62)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_62)>, bool &&(bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_62)>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_62), 0>, bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_62)>, type_list<bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_62)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_62)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_62)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_62)> == callable_traits<decltype(lambda_62)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_62)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_62)>, std::remove_const_t<decltype(lambda_62)>>);
+[[maybe_unused]] const auto lambda_64 = [](volatile bool &&) -> volatile bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_64)>::signature_type, volatile bool &&(volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_64)>::result_type, volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_64)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_64)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_64)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_64)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_64)>::arg0_type, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_64)>::arg_type<0>, volatile bool &&>);
+static_assert(callable_traits<decltype(lambda_64)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_64)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_64)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_64)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_64)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_64)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_64)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_64)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_64)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_64)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_64)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_64)>::class_type, std::remove_const_t<decltype(lambda_64)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_64)>, volatile bool &&(volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_64)>, volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_64), 0>, volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_64)>, type_list<volatile bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_64)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_64)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_64)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_64)> == callable_traits<decltype(lambda_64)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_64)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_64)>, std::remove_const_t<decltype(lambda_64)>>);
+[[maybe_unused]] const auto lambda_66 = [](bool * &&) noexcept -> bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_66)>::signature_type, bool * &&(bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_66)>::result_type, bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_66)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_66)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_66)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_66)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_66)>::arg0_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_66)>::arg_type<0>, bool * &&>);
+static_assert(callable_traits<decltype(lambda_66)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_66)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_66)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_66)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_66)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_66)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_66)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_66)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_66)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_66)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_66)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_66)>::class_type, std::remove_const_t<decltype(lambda_66)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_66)>, bool * &&(bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_66)>, bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_66), 0>, bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_66)>, type_list<bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_66)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_66)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_66)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_66)> == callable_traits<decltype(lambda_66)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_66)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_66)>, std::remove_const_t<decltype(lambda_66)>>);
+[[maybe_unused]] const auto lambda_68 = [](volatile bool * &&) -> volatile bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_68)>::signature_type, volatile bool * &&(volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_68)>::result_type, volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_68)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_68)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_68)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_68)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_68)>::arg0_type, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_68)>::arg_type<0>, volatile bool * &&>);
+static_assert(callable_traits<decltype(lambda_68)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_68)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_68)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_68)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_68)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_68)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_68)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_68)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_68)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_68)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_68)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_68)>::class_type, std::remove_const_t<decltype(lambda_68)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_68)>, volatile bool * &&(volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_68)>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_68), 0>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_68)>, type_list<volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_68)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_68)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_68)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_68)> == callable_traits<decltype(lambda_68)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_68)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_68)>, std::remove_const_t<decltype(lambda_68)>>);
+[[maybe_unused]] const auto lambda_70 = [](bool * const &&) noexcept -> bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_70)>::signature_type, bool * const &&(bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_70)>::result_type, bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_70)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_70)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_70)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_70)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_70)>::arg0_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_70)>::arg_type<0>, bool * const &&>);
+static_assert(callable_traits<decltype(lambda_70)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_70)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_70)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_70)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_70)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_70)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_70)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_70)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_70)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_70)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_70)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_70)>::class_type, std::remove_const_t<decltype(lambda_70)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_70)>, bool * const &&(bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_70)>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_70), 0>, bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_70)>, type_list<bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_70)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_70)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_70)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_70)> == callable_traits<decltype(lambda_70)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_70)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_70)>, std::remove_const_t<decltype(lambda_70)>>);
+[[maybe_unused]] const auto lambda_72 = [](volatile bool * const &&) -> volatile bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_72)>::signature_type, volatile bool * const &&(volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_72)>::result_type, volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_72)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_72)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_72)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_72)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_72)>::arg0_type, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_72)>::arg_type<0>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(lambda_72)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_72)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_72)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_72)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_72)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_72)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_72)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_72)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_72)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_72)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_72)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_72)>::class_type, std::remove_const_t<decltype(lambda_72)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_72)>, volatile bool * const &&(volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_72)>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_72), 0>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_72)>, type_list<volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_72)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_72)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_72)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_72)> == callable_traits<decltype(lambda_72)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_72)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_72)>, std::remove_const_t<decltype(lambda_72)>>);
+[[maybe_unused]] const auto lambda_74 = [](bool * volatile &&) noexcept -> bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_74)>::signature_type, bool * volatile &&(bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_74)>::result_type, bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_74)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_74)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_74)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_74)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_74)>::arg0_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_74)>::arg_type<0>, bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_74)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_74)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_74)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_74)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_74)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_74)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_74)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_74)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_74)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_74)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_74)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_74)>::class_type, std::remove_const_t<decltype(lambda_74)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_74)>, bool * volatile &&(bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_74)>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_74), 0>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_74)>, type_list<bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_74)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_74)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_74)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_74)> == callable_traits<decltype(lambda_74)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_74)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_74)>, std::remove_const_t<decltype(lambda_74)>>);
+[[maybe_unused]] const auto lambda_76 = [](volatile bool * volatile &&) -> volatile bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_76)>::signature_type, volatile bool * volatile &&(volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_76)>::result_type, volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_76)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_76)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_76)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_76)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_76)>::arg0_type, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_76)>::arg_type<0>, volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_76)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_76)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_76)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_76)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_76)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_76)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_76)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_76)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_76)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_76)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_76)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_76)>::class_type, std::remove_const_t<decltype(lambda_76)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_76)>, volatile bool * volatile &&(volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_76)>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_76), 0>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_76)>, type_list<volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_76)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_76)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_76)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_76)> == callable_traits<decltype(lambda_76)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_76)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_76)>, std::remove_const_t<decltype(lambda_76)>>);
+[[maybe_unused]] const auto lambda_78 = [](bool * const volatile &&) noexcept -> bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_78)>::signature_type, bool * const volatile &&(bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_78)>::result_type, bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_78)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_78)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_78)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_78)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_78)>::arg0_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_78)>::arg_type<0>, bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_78)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_78)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_78)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_78)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_78)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_78)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_78)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_78)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_78)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_78)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_78)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_78)>::class_type, std::remove_const_t<decltype(lambda_78)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_78)>, bool * const volatile &&(bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_78)>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_78), 0>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_78)>, type_list<bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_78)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_78)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_78)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_78)> == callable_traits<decltype(lambda_78)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_78)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_78)>, std::remove_const_t<decltype(lambda_78)>>);
+[[maybe_unused]] const auto lambda_80 = [](volatile bool * const volatile &&) -> volatile bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_80)>::signature_type, volatile bool * const volatile &&(volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_80)>::result_type, volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_80)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_80)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_80)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_80)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_80)>::arg0_type, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_80)>::arg_type<0>, volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_80)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_80)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_80)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_80)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_80)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_80)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_80)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_80)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_80)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_80)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_80)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_80)>::class_type, std::remove_const_t<decltype(lambda_80)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_80)>, volatile bool * const volatile &&(volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_80)>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_80), 0>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_80)>, type_list<volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_80)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_80)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_80)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_80)> == callable_traits<decltype(lambda_80)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_80)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_80)>, std::remove_const_t<decltype(lambda_80)>>);
+[[maybe_unused]] const auto lambda_82 = [](int) noexcept -> int {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_82)>::signature_type, int(int)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_82)>::result_type, int>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_82)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_82)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_82)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_82)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_82)>::arg0_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_82)>::arg_type<0>, int>);
+static_assert(callable_traits<decltype(lambda_82)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_82)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_82)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_82)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_82)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_82)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_82)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_82)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_82)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_82)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_82)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_82)>::class_type, std::remove_const_t<decltype(lambda_82)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_82)>, int(int)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_82)>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_82), 0>, int>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_82)>, type_list<int>>);
+static_assert(callable_arity_v<decltype(lambda_82)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_82)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_82)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_82)> == callable_traits<decltype(lambda_82)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_82)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_82)>, std::remove_const_t<decltype(lambda_82)>>);
+[[maybe_unused]] const auto lambda_84 = [](const int *) -> const int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_84)>::signature_type, const int *(const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_84)>::result_type, const int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_84)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_84)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_84)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_84)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_84)>::arg0_type, const int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_84)>::arg_type<0>, const int *>);
+static_assert(callable_traits<decltype(lambda_84)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_84)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_84)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_84)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_84)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_84)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_84)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_84)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_84)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_84)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_84)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_84)>::class_type, std::remove_const_t<decltype(lambda_84)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_84)>, const int *(const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_84)>, const int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_84), 0>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_84)>, type_list<const int *>>);
+static_assert(callable_arity_v<decltype(lambda_84)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_84)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_84)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_84)> == callable_traits<decltype(lambda_84)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_84)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_84)>, std::remove_const_t<decltype(lambda_84)>>);
+[[maybe_unused]] const auto lambda_86 = [](const volatile int *) noexcept -> const volatile int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_86)>::signature_type, const volatile int *(const volatile int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_86)>::result_type, const volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_86)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_86)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_86)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_86)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_86)>::arg0_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_86)>::arg_type<0>, const volatile int *>);
+static_assert(callable_traits<decltype(lambda_86)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_86)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_86)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_86)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_86)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_86)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_86)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_86)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_86)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_86)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_86)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_86)>::class_type, std::remove_const_t<decltype(lambda_86)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_86)>, const volatile int *(const volatile int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_86)>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_86), 0>, const volatile int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_86)>, type_list<const volatile int *>>);
+static_assert(callable_arity_v<decltype(lambda_86)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_86)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_86)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_86)> == callable_traits<decltype(lambda_86)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_86)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_86)>, std::remove_const_t<decltype(lambda_86)>>);
+[[maybe_unused]] const auto lambda_88 = [](const int &) -> const int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_88)>::signature_type, const int &(const int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_88)>::result_type, const int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_88)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_88)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_88)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_88)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_88)>::arg0_type, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_88)>::arg_type<0>, const int &>);
+static_assert(callable_traits<decltype(lambda_88)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_88)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_88)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_88)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_88)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_88)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_88)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_88)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_88)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_88)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_88)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_88)>::class_type, std::remove_const_t<decltype(lambda_88)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_88)>, const int &(const int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_88)>, const int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_88), 0>, const int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_88)>, type_list<const int &>>);
+static_assert(callable_arity_v<decltype(lambda_88)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_88)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_88)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_88)> == callable_traits<decltype(lambda_88)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_88)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_88)>, std::remove_const_t<decltype(lambda_88)>>);
+[[maybe_unused]] const auto lambda_90 = [](const volatile int &) noexcept -> const volatile int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_90)>::signature_type, const volatile int &(const volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_90)>::result_type, const volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_90)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_90)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_90)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_90)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_90)>::arg0_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_90)>::arg_type<0>, const volatile int &>);
+static_assert(callable_traits<decltype(lambda_90)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_90)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_90)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_90)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_90)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_90)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_90)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_90)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_90)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_90)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_90)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_90)>::class_type, std::remove_const_t<decltype(lambda_90)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_90)>, const volatile int &(const volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_90)>, const volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_90), 0>, const volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_90)>, type_list<const volatile int &>>);
+static_assert(callable_arity_v<decltype(lambda_90)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_90)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_90)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_90)> == callable_traits<decltype(lambda_90)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_90)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_90)>, std::remove_const_t<decltype(lambda_90)>>);
+[[maybe_unused]] const auto lambda_92 = [](const int * &) -> const int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_92)>::signature_type, const int * &(const int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_92)>::result_type, const int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_92)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_92)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_92)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_92)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_92)>::arg0_type, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_92)>::arg_type<0>, const int * &>);
+static_assert(callable_traits<decltype(lambda_92)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_92)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_92)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_92)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_92)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_92)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_92)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_92)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_92)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_92)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_92)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_92)>::class_type, std::remove_const_t<decltype(lambda_92)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_92)>, const int * &(const int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_92)>, const int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_92), 0>, const int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_92)>, type_list<const int * &>>);
+static_assert(callable_arity_v<decltype(lambda_92)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_92)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_92)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_92)> == callable_traits<decltype(lambda_92)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_92)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_92)>, std::remove_const_t<decltype(lambda_92)>>);
+[[maybe_unused]] const auto lambda_94 = [](const volatile int * &) noexcept -> const volatile int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_94)>::signature_type, const volatile int * &(const volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_94)>::result_type, const volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_94)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_94)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_94)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_94)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_94)>::arg0_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_94)>::arg_type<0>, const volatile int * &>);
+static_assert(callable_traits<decltype(lambda_94)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_94)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_94)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_94)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_94)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_94)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_94)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_94)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_94)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_94)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_94)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_94)>::class_type, std::remove_const_t<decltype(lambda_94)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_94)>, const volatile int * &(const volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_94)>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_94), 0>, const volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_94)>, type_list<const volatile int * &>>);
+static_assert(callable_arity_v<decltype(lambda_94)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_94)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_94)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_94)> == callable_traits<decltype(lambda_94)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_94)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_94)>, std::remove_const_t<decltype(lambda_94)>>);
+[[maybe_unused]] const auto lambda_96 = [](const int * const &) -> const int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_96)>::signature_type, const int * const &(const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_96)>::result_type, const int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_96)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_96)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_96)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_96)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_96)>::arg0_type, const int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_96)>::arg_type<0>, const int * const &>);
+static_assert(callable_traits<decltype(lambda_96)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_96)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_96)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_96)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_96)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_96)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_96)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_96)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_96)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_96)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_96)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_96)>::class_type, std::remove_const_t<decltype(lambda_96)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_96)>, const int * const &(const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_96)>, const int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_96), 0>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_96)>, type_list<const int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_96)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_96)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_96)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_96)> == callable_traits<decltype(lambda_96)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_96)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_96)>, std::remove_const_t<decltype(lambda_96)>>);
+[[maybe_unused]] const auto lambda_98 = [](const volatile int * const &) noexcept -> const volatile int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_98)>::signature_type, const volatile int * const &(const volatile int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_98)>::result_type, const volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_98)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_98)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_98)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_98)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_98)>::arg0_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_98)>::arg_type<0>, const volatile int * const &>);
+static_assert(callable_traits<decltype(lambda_98)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_98)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_98)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_98)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_98)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_98)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_98)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_98)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_98)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_98)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_98)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_98)>::class_type, std::remove_const_t<decltype(lambda_98)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_98)>, const volatile int * const &(const volatile int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_98)>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_98), 0>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_98)>, type_list<const volatile int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_98)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_98)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_98)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_98)> == callable_traits<decltype(lambda_98)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_98)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_98)>, std::remove_const_t<decltype(lambda_98)>>);
+[[maybe_unused]] const auto lambda_100 = [](const int * volatile &) -> const int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_100)>::signature_type, const int * volatile &(const int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_100)>::result_type, const int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_100)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_100)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_100)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_100)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_100)>::arg0_type, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_100)>::arg_type<0>, const int * volatile &>);
+static_assert(callable_traits<decltype(lambda_100)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_100)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_100)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_100)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_100)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_100)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_100)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_100)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_100)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_100)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_100)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_100)>::class_type, std::remove_const_t<decltype(lambda_100)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_100)>, const int * volatile &(const int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_100)>, const int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_100), 0>, const int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_100)>, type_list<const int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_100)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_100)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_100)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_100)> == callable_traits<decltype(lambda_100)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_100)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_100)>, std::remove_const_t<decltype(lambda_100)>>);
+[[maybe_unused]] const auto lambda_102 = [](const volatile int * volatile &) noexcept -> const volatile int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_102)>::signature_type, const volatile int * volatile &(const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_102)>::result_type, const volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_102)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_102)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_102)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_102)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_102)>::arg0_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_102)>::arg_type<0>, const volatile int * volatile &>);
+static_assert(callable_traits<decltype(lambda_102)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_102)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_102)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_102)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_102)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_102)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_102)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_102)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_102)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_102)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_102)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_102)>::class_type, std::remove_const_t<decltype(lambda_102)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_102)>, const volatile int * volatile &(const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_102)>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_102), 0>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_102)>, type_list<const volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_102)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_102)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_102)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_102)> == callable_traits<decltype(lambda_102)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_102)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_102)>, std::remove_const_t<decltype(lambda_102)>>);
+[[maybe_unused]] const auto lambda_104 = [](const int * const volatile &) -> const int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_104)>::signature_type, const int * const volatile &(const int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_104)>::result_type, const int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_104)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_104)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_104)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_104)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_104)>::arg0_type, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_104)>::arg_type<0>, const int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_104)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_104)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_104)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_104)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_104)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_104)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_104)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_104)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_104)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_104)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_104)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_104)>::class_type, std::remove_const_t<decltype(lambda_104)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_104)>, const int * const volatile &(const int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_104)>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_104), 0>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_104)>, type_list<const int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_104)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_104)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_104)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_104)> == callable_traits<decltype(lambda_104)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_104)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_104)>, std::remove_const_t<decltype(lambda_104)>>);
+[[maybe_unused]] const auto lambda_106 = [](const volatile int * const volatile &) noexcept -> const volatile int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_106)>::signature_type, const volatile int * const volatile &(const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_106)>::result_type, const volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_106)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_106)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_106)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_106)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_106)>::arg0_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_106)>::arg_type<0>, const volatile int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_106)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_106)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_106)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_106)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_106)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_106)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_106)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_106)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_106)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_106)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_106)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_106)>::class_type, std::remove_const_t<decltype(lambda_106)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_106)>, const volatile int * const volatile &(const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_106)>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_106), 0>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_106)>, type_list<const volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_106)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_106)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_106)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_106)> == callable_traits<decltype(lambda_106)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_106)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_106)>, std::remove_const_t<decltype(lambda_106)>>);
+[[maybe_unused]] const auto lambda_108 = [](const int &&) -> const int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_108)>::signature_type, const int &&(const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_108)>::result_type, const int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_108)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_108)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_108)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_108)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_108)>::arg0_type, const int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_108)>::arg_type<0>, const int &&>);
+static_assert(callable_traits<decltype(lambda_108)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_108)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_108)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_108)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_108)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_108)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_108)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_108)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_108)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_108)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_108)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_108)>::class_type, std::remove_const_t<decltype(lambda_108)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_108)>, const int &&(const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_108)>, const int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_108), 0>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_108)>, type_list<const int &&>>);
+static_assert(callable_arity_v<decltype(lambda_108)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_108)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_108)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_108)> == callable_traits<decltype(lambda_108)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_108)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_108)>, std::remove_const_t<decltype(lambda_108)>>);
+[[maybe_unused]] const auto lambda_110 = [](const volatile int &&) noexcept -> const volatile int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_110)>::signature_type, const volatile int &&(const volatile int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_110)>::result_type, const volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_110)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_110)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_110)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_110)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_110)>::arg0_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_110)>::arg_type<0>, const volatile int &&>);
+static_assert(callable_traits<decltype(lambda_110)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_110)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_110)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_110)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_110)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_110)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_110)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_110)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_110)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_110)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_110)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_110)>::class_type, std::remove_const_t<decltype(lambda_110)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_110)>, const volatile int &&(const volatile int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_110)>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_110), 0>, const volatile int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_110)>, type_list<const volatile int &&>>);
+static_assert(callable_arity_v<decltype(lambda_110)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_110)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_110)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_110)> == callable_traits<decltype(lambda_110)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_110)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_110)>, std::remove_const_t<decltype(lambda_110)>>);
+[[maybe_unused]] const auto lambda_112 = [](const int * &&) -> const int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_112)>::signature_type, const int * &&(const int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_112)>::result_type, const int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_112)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_112)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_112)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_112)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_112)>::arg0_type, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_112)>::arg_type<0>, const int * &&>);
+static_assert(callable_traits<decltype(lambda_112)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_112)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_112)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_112)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_112)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_112)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_112)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_112)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_112)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_112)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_112)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_112)>::class_type, std::remove_const_t<decltype(lambda_112)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_112)>, const int * &&(const int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_112)>, const int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_112), 0>, const int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_112)>, type_list<const int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_112)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_112)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_112)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_112)> == callable_traits<decltype(lambda_112)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_112)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_112)>, std::remove_const_t<decltype(lambda_112)>>);
+[[maybe_unused]] const auto lambda_114 = [](const volatile int * &&) noexcept -> const volatile int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_114)>::signature_type, const volatile int * &&(const volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_114)>::result_type, const volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_114)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_114)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_114)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_114)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_114)>::arg0_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_114)>::arg_type<0>, const volatile int * &&>);
+static_assert(callable_traits<decltype(lambda_114)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_114)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_114)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_114)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_114)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_114)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_114)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_114)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_114)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_114)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_114)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_114)>::class_type, std::remove_const_t<decltype(lambda_114)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_114)>, const volatile int * &&(const volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_114)>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_114), 0>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_114)>, type_list<const volatile int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_114)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_114)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_114)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_114)> == callable_traits<decltype(lambda_114)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_114)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_114)>, std::remove_const_t<decltype(lambda_114)>>);
+[[maybe_unused]] const auto lambda_116 = [](const int * const &&) -> const int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_116)>::signature_type, const int * const &&(const int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_116)>::result_type, const int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_116)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_116)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_116)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_116)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_116)>::arg0_type, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_116)>::arg_type<0>, const int * const &&>);
+static_assert(callable_traits<decltype(lambda_116)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_116)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_116)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_116)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_116)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_116)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_116)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_116)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_116)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_116)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_116)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_116)>::class_type, std::remove_const_t<decltype(lambda_116)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_116)>, const int * const &&(const int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_116)>, const int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_116), 0>, const int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_116)>, type_list<const int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_116)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_116)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_116)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_116)> == callable_traits<decltype(lambda_116)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_116)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_116)>, std::remove_const_t<decltype(lambda_116)>>);
+[[maybe_unused]] const auto lambda_118 = [](const volatile int * const &&) noexcept -> const volatile int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_118)>::signature_type, const volatile int * const &&(const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_118)>::result_type, const volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_118)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_118)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_118)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_118)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_118)>::arg0_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_118)>::arg_type<0>, const volatile int * const &&>);
+static_assert(callable_traits<decltype(lambda_118)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_118)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_118)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_118)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_118)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_118)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_118)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_118)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_118)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_118)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_118)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_118)>::class_type, std::remove_const_t<decltype(lambda_118)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_118)>, const volatile int * const &&(const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_118)>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_118), 0>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_118)>, type_list<const volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_118)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_118)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_118)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_118)> == callable_traits<decltype(lambda_118)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_118)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_118)>, std::remove_const_t<decltype(lambda_118)>>);
+[[maybe_unused]] const auto lambda_120 = [](const int * volatile &&) -> const int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_120)>::signature_type, const int * volatile &&(const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_120)>::result_type, const int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_120)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_120)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_120)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_120)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_120)>::arg0_type, const int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_120)>::arg_type<0>, const int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_120)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_120)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_120)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_120)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_120)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_120)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_120)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_120)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_120)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_120)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_120)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_120)>::class_type, std::remove_const_t<decltype(lambda_120)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_120)>, const int * volatile &&(const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_120)>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_120), 0>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_120)>, type_list<const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_120)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_120)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_120)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_120)> == callable_traits<decltype(lambda_120)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_120)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_120)>, std::remove_const_t<decltype(lambda_120)>>);
+[[maybe_unused]] const auto lambda_122 = [](const volatile int * volatile &&) noexcept -> const volatile int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_122)>::signature_type, const volatile int * volatile &&(const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_122)>::result_type, const volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_122)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_122)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_122)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_122)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_122)>::arg0_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_122)>::arg_type<0>, const volatile int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_122)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_122)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_122)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_122)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_122)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_122)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_122)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_122)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_122)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_122)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_122)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_122)>::class_type, std::remove_const_t<decltype(lambda_122)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_122)>, const volatile int * volatile &&(const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_122)>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_122), 0>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_122)>, type_list<const volatile int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_122)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_122)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_122)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_122)> == callable_traits<decltype(lambda_122)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_122)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_122)>, std::remove_const_t<decltype(lambda_122)>>);
+[[maybe_unused]] const auto lambda_124 = [](const int * const volatile &&) -> const int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_124)>::signature_type, const int * const volatile &&(const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_124)>::result_type, const int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_124)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_124)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_124)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_124)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_124)>::arg0_type, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_124)>::arg_type<0>, const int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_124)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_124)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_124)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_124)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_124)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_124)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_124)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_124)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_124)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_124)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_124)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_124)>::class_type, std::remove_const_t<decltype(lambda_124)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_124)>, const int * const volatile &&(const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_124)>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_124), 0>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_124)>, type_list<const int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_124)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_124)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_124)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_124)> == callable_traits<decltype(lambda_124)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_124)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_124)>, std::remove_const_t<decltype(lambda_124)>>);
+[[maybe_unused]] const auto lambda_126 = [](const volatile int * const volatile &&) noexcept -> const volatile int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_126)>::signature_type, const volatile int * const volatile &&(const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_126)>::result_type, const volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_126)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_126)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_126)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_126)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_126)>::arg0_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_126)>::arg_type<0>, const volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_126)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_126)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_126)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_126)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_126)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_126)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_126)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_126)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_126)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_126)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_126)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_126)>::class_type, std::remove_const_t<decltype(lambda_126)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_126)>, const volatile int * const volatile &&(const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_126)>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_126), 0>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_126)>, type_list<const volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_126)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_126)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_126)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_126)> == callable_traits<decltype(lambda_126)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_126)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_126)>, std::remove_const_t<decltype(lambda_126)>>);
+[[maybe_unused]] const auto lambda_128 = [](float *) -> float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_128)>::signature_type, float *(float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_128)>::result_type, float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_128)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_128)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_128)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_128)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_128)>::arg0_type, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_128)>::arg_type<0>, float *>);
+static_assert(callable_traits<decltype(lambda_128)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_128)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_128)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_128)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_128)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_128)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_128)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_128)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_128)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_128)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_128)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_128)>::class_type, std::remove_const_t<decltype(lambda_128)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_128)>, float *(float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_128)>, float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_128), 0>, float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_128)>, type_list<float *>>);
+static_assert(callable_arity_v<decltype(lambda_128)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_128)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_128)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_128)> == callable_traits<decltype(lambda_128)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_128)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_128)>, std::remove_const_t<decltype(lambda_128)>>);
+[[maybe_unused]] const auto lambda_130 = [](volatile float *) noexcept -> volatile float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_130)>::signature_type, volatile float *(volatile float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_130)>::result_type, volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_130)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_130)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_130)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_130)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_130)>::arg0_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_130)>::arg_type<0>, volatile float *>);
+static_assert(callable_traits<decltype(lambda_130)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_130)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_130)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_130)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_130)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_130)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_130)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_130)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_130)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_130)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_130)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_130)>::class_type, std::remove_const_t<decltype(lambda_130)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_130)>, volatile float *(volatile float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_130)>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_130), 0>, volatile float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_130)>, type_list<volatile float *>>);
+static_assert(callable_arity_v<decltype(lambda_130)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_130)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_130)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_130)> == callable_traits<decltype(lambda_130)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_130)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_130)>, std::remove_const_t<decltype(lambda_130)>>);
+[[maybe_unused]] const auto lambda_132 = [](float &) -> float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_132)>::signature_type, float &(float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_132)>::result_type, float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_132)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_132)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_132)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_132)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_132)>::arg0_type, float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_132)>::arg_type<0>, float &>);
+static_assert(callable_traits<decltype(lambda_132)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_132)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_132)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_132)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_132)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_132)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_132)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_132)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_132)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_132)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_132)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_132)>::class_type, std::remove_const_t<decltype(lambda_132)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_132)>, float &(float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_132)>, float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_132), 0>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_132)>, type_list<float &>>);
+static_assert(callable_arity_v<decltype(lambda_132)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_132)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_132)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_132)> == callable_traits<decltype(lambda_132)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_132)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_132)>, std::remove_const_t<decltype(lambda_132)>>);
+[[maybe_unused]] const auto lambda_134 = [](volatile float &) noexcept -> volatile float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_134)>::signature_type, volatile float &(volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_134)>::result_type, volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_134)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_134)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_134)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_134)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_134)>::arg0_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_134)>::arg_type<0>, volatile float &>);
+static_assert(callable_traits<decltype(lambda_134)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_134)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_134)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_134)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_134)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_134)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_134)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_134)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_134)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_134)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_134)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_134)>::class_type, std::remove_const_t<decltype(lambda_134)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_134)>, volatile float &(volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_134)>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_134), 0>, volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_134)>, type_list<volatile float &>>);
+static_assert(callable_arity_v<decltype(lambda_134)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_134)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_134)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_134)> == callable_traits<decltype(lambda_134)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_134)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_134)>, std::remove_const_t<decltype(lambda_134)>>);
+[[maybe_unused]] const auto lambda_136 = [](float * &) -> float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_136)>::signature_type, float * &(float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_136)>::result_type, float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_136)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_136)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_136)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_136)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_136)>::arg0_type, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_136)>::arg_type<0>, float * &>);
+static_assert(callable_traits<decltype(lambda_136)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_136)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_136)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_136)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_136)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_136)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_136)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_136)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_136)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_136)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_136)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_136)>::class_type, std::remove_const_t<decltype(lambda_136)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_136)>, float * &(float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_136)>, float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_136), 0>, float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_136)>, type_list<float * &>>);
+static_assert(callable_arity_v<decltype(lambda_136)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_136)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_136)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_136)> == callable_traits<decltype(lambda_136)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_136)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_136)>, std::remove_const_t<decltype(lambda_136)>>);
+[[maybe_unused]] const auto lambda_138 = [](volatile float * &) noexcept -> volatile float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_138)>::signature_type, volatile float * &(volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_138)>::result_type, volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_138)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_138)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_138)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_138)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_138)>::arg0_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_138)>::arg_type<0>, volatile float * &>);
+static_assert(callable_traits<decltype(lambda_138)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_138)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_138)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_138)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_138)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_138)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_138)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_138)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_138)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_138)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_138)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_138)>::class_type, std::remove_const_t<decltype(lambda_138)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_138)>, volatile float * &(volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_138)>, volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_138), 0>, volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_138)>, type_list<volatile float * &>>);
+static_assert(callable_arity_v<decltype(lambda_138)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_138)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_138)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_138)> == callable_traits<decltype(lambda_138)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_138)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_138)>, std::remove_const_t<decltype(lambda_138)>>);
+[[maybe_unused]] const auto lambda_140 = [](float * const &) -> float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_140)>::signature_type, float * const &(float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_140)>::result_type, float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_140)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_140)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_140)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_140)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_140)>::arg0_type, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_140)>::arg_type<0>, float * const &>);
+static_assert(callable_traits<decltype(lambda_140)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_140)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_140)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_140)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_140)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_140)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_140)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_140)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_140)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_140)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_140)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_140)>::class_type, std::remove_const_t<decltype(lambda_140)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_140)>, float * const &(float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_140)>, float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_140), 0>, float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_140)>, type_list<float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_140)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_140)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_140)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_140)> == callable_traits<decltype(lambda_140)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_140)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_140)>, std::remove_const_t<decltype(lambda_140)>>);
+[[maybe_unused]] const auto lambda_142 = [](volatile float * const &) noexcept -> volatile float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_142)>::signature_type, volatile float * const &(volatile float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_142)>::result_type, volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_142)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_142)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_142)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_142)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_142)>::arg0_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_142)>::arg_type<0>, volatile float * const &>);
+static_assert(callable_traits<decltype(lambda_142)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_142)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_142)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_142)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_142)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_142)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_142)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_142)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_142)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_142)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_142)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_142)>::class_type, std::remove_const_t<decltype(lambda_142)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_142)>, volatile float * const &(volatile float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_142)>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_142), 0>, volatile float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_142)>, type_list<volatile float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_142)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_142)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_142)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_142)> == callable_traits<decltype(lambda_142)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_142)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_142)>, std::remove_const_t<decltype(lambda_142)>>);
+[[maybe_unused]] const auto lambda_144 = [](float * volatile &) -> float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_144)>::signature_type, float * volatile &(float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_144)>::result_type, float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_144)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_144)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_144)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_144)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_144)>::arg0_type, float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_144)>::arg_type<0>, float * volatile &>);
+static_assert(callable_traits<decltype(lambda_144)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_144)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_144)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_144)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_144)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_144)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_144)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_144)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_144)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_144)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_144)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_144)>::class_type, std::remove_const_t<decltype(lambda_144)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_144)>, float * volatile &(float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_144)>, float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_144), 0>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_144)>, type_list<float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_144)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_144)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_144)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_144)> == callable_traits<decltype(lambda_144)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_144)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_144)>, std::remove_const_t<decltype(lambda_144)>>);
+[[maybe_unused]] const auto lambda_146 = [](volatile float * volatile &) noexcept -> volatile float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_146)>::signature_type, volatile float * volatile &(volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_146)>::result_type, volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_146)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_146)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_146)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_146)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_146)>::arg0_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_146)>::arg_type<0>, volatile float * volatile &>);
+static_assert(callable_traits<decltype(lambda_146)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_146)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_146)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_146)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_146)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_146)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_146)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_146)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_146)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_146)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_146)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_146)>::class_type, std::remove_const_t<decltype(lambda_146)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_146)>, volatile float * volatile &(volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_146)>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_146), 0>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_146)>, type_list<volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_146)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_146)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_146)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_146)> == callable_traits<decltype(lambda_146)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_146)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_146)>, std::remove_const_t<decltype(lambda_146)>>);
+[[maybe_unused]] const auto lambda_148 = [](float * const volatile &) -> float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_148)>::signature_type, float * const volatile &(float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_148)>::result_type, float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_148)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_148)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_148)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_148)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_148)>::arg0_type, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_148)>::arg_type<0>, float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_148)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_148)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_148)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_148)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_148)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_148)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_148)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_148)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_148)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_148)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_148)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_148)>::class_type, std::remove_const_t<decltype(lambda_148)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_148)>, float * const volatile &(float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_148)>, float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_148), 0>, float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_148)>, type_list<float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_148)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_148)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_148)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_148)> == callable_traits<decltype(lambda_148)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_148)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_148)>, std::remove_const_t<decltype(lambda_148)>>);
+[[maybe_unused]] const auto lambda_150 = [](volatile float * const volatile &) noexcept -> volatile float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_150)>::signature_type, volatile float * const volatile &(volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_150)>::result_type, volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_150)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_150)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_150)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_150)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_150)>::arg0_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_150)>::arg_type<0>, volatile float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_150)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_150)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_150)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_150)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_150)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_150)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_150)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_150)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_150)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_150)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_150)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_150)>::class_type, std::remove_const_t<decltype(lambda_150)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_150)>, volatile float * const volatile &(volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_150)>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_150), 0>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_150)>, type_list<volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_150)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_150)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_150)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_150)> == callable_traits<decltype(lambda_150)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_150)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_150)>, std::remove_const_t<decltype(lambda_150)>>);
+[[maybe_unused]] const auto lambda_152 = [](float &&) -> float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_152)>::signature_type, float &&(float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_152)>::result_type, float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_152)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_152)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_152)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_152)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_152)>::arg0_type, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_152)>::arg_type<0>, float &&>);
+static_assert(callable_traits<decltype(lambda_152)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_152)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_152)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_152)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_152)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_152)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_152)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_152)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_152)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_152)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_152)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_152)>::class_type, std::remove_const_t<decltype(lambda_152)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_152)>, float &&(float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_152)>, float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_152), 0>, float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_152)>, type_list<float &&>>);
+static_assert(callable_arity_v<decltype(lambda_152)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_152)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_152)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_152)> == callable_traits<decltype(lambda_152)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_152)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_152)>, std::remove_const_t<decltype(lambda_152)>>);
+[[maybe_unused]] const auto lambda_154 = [](volatile float &&) noexcept -> volatile float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_154)>::signature_type, volatile float &&(volatile float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_154)>::result_type, volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_154)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_154)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_154)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_154)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_154)>::arg0_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_154)>::arg_type<0>, volatile float &&>);
+static_assert(callable_traits<decltype(lambda_154)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_154)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_154)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_154)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_154)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_154)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_154)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_154)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_154)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_154)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_154)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_154)>::class_type, std::remove_const_t<decltype(lambda_154)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_154)>, volatile float &&(volatile float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_154)>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_154), 0>, volatile float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_154)>, type_list<volatile float &&>>);
+static_assert(callable_arity_v<decltype(lambda_154)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_154)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_154)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_154)> == callable_traits<decltype(lambda_154)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_154)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_154)>, std::remove_const_t<decltype(lambda_154)>>);
+[[maybe_unused]] const auto lambda_156 = [](float * &&) -> float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_156)>::signature_type, float * &&(float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_156)>::result_type, float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_156)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_156)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_156)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_156)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_156)>::arg0_type, float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_156)>::arg_type<0>, float * &&>);
+static_assert(callable_traits<decltype(lambda_156)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_156)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_156)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_156)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_156)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_156)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_156)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_156)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_156)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_156)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_156)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_156)>::class_type, std::remove_const_t<decltype(lambda_156)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_156)>, float * &&(float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_156)>, float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_156), 0>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_156)>, type_list<float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_156)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_156)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_156)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_156)> == callable_traits<decltype(lambda_156)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_156)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_156)>, std::remove_const_t<decltype(lambda_156)>>);
+[[maybe_unused]] const auto lambda_158 = [](volatile float * &&) noexcept -> volatile float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_158)>::signature_type, volatile float * &&(volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_158)>::result_type, volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_158)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_158)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_158)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_158)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_158)>::arg0_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_158)>::arg_type<0>, volatile float * &&>);
+static_assert(callable_traits<decltype(lambda_158)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_158)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_158)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_158)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_158)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_158)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_158)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_158)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_158)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_158)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_158)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_158)>::class_type, std::remove_const_t<decltype(lambda_158)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_158)>, volatile float * &&(volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_158)>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_158), 0>, volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_158)>, type_list<volatile float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_158)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_158)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_158)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_158)> == callable_traits<decltype(lambda_158)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_158)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_158)>, std::remove_const_t<decltype(lambda_158)>>);
+[[maybe_unused]] const auto lambda_160 = [](float * const &&) -> float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_160)>::signature_type, float * const &&(float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_160)>::result_type, float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_160)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_160)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_160)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_160)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_160)>::arg0_type, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_160)>::arg_type<0>, float * const &&>);
+static_assert(callable_traits<decltype(lambda_160)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_160)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_160)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_160)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_160)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_160)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_160)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_160)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_160)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_160)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_160)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_160)>::class_type, std::remove_const_t<decltype(lambda_160)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_160)>, float * const &&(float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_160)>, float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_160), 0>, float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_160)>, type_list<float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_160)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_160)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_160)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_160)> == callable_traits<decltype(lambda_160)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_160)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_160)>, std::remove_const_t<decltype(lambda_160)>>);
+[[maybe_unused]] const auto lambda_162 = [](volatile float * const &&) noexcept -> volatile float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_162)>::signature_type, volatile float * const &&(volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_162)>::result_type, volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_162)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_162)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_162)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_162)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_162)>::arg0_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_162)>::arg_type<0>, volatile float * const &&>);
+static_assert(callable_traits<decltype(lambda_162)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_162)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_162)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_162)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_162)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_162)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_162)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_162)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_162)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_162)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_162)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_162)>::class_type, std::remove_const_t<decltype(lambda_162)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_162)>, volatile float * const &&(volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_162)>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_162), 0>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_162)>, type_list<volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_162)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_162)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_162)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_162)> == callable_traits<decltype(lambda_162)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_162)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_162)>, std::remove_const_t<decltype(lambda_162)>>);
+[[maybe_unused]] const auto lambda_164 = [](float * volatile &&) -> float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_164)>::signature_type, float * volatile &&(float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_164)>::result_type, float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_164)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_164)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_164)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_164)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_164)>::arg0_type, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_164)>::arg_type<0>, float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_164)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_164)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_164)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_164)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_164)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_164)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_164)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_164)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_164)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_164)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_164)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_164)>::class_type, std::remove_const_t<decltype(lambda_164)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_164)>, float * volatile &&(float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_164)>, float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_164), 0>, float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_164)>, type_list<float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_164)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_164)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_164)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_164)> == callable_traits<decltype(lambda_164)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_164)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_164)>, std::remove_const_t<decltype(lambda_164)>>);
+[[maybe_unused]] const auto lambda_166 = [](volatile float * volatile &&) noexcept -> volatile float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_166)>::signature_type, volatile float * volatile &&(volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_166)>::result_type, volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_166)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_166)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_166)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_166)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_166)>::arg0_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_166)>::arg_type<0>, volatile float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_166)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_166)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_166)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_166)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_166)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_166)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_166)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_166)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_166)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_166)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_166)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_166)>::class_type, std::remove_const_t<decltype(lambda_166)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_166)>, volatile float * volatile &&(volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_166)>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_166), 0>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_166)>, type_list<volatile float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_166)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_166)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_166)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_166)> == callable_traits<decltype(lambda_166)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_166)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_166)>, std::remove_const_t<decltype(lambda_166)>>);
+[[maybe_unused]] const auto lambda_168 = [](float * const volatile &&) -> float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_168)>::signature_type, float * const volatile &&(float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_168)>::result_type, float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_168)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_168)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_168)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_168)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_168)>::arg0_type, float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_168)>::arg_type<0>, float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_168)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_168)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_168)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_168)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_168)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_168)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_168)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_168)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_168)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_168)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_168)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_168)>::class_type, std::remove_const_t<decltype(lambda_168)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_168)>, float * const volatile &&(float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_168)>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_168), 0>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_168)>, type_list<float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_168)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_168)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_168)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_168)> == callable_traits<decltype(lambda_168)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_168)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_168)>, std::remove_const_t<decltype(lambda_168)>>);
+[[maybe_unused]] const auto lambda_170 = [](volatile float * const volatile &&) noexcept -> volatile float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_170)>::signature_type, volatile float * const volatile &&(volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_170)>::result_type, volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_170)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_170)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_170)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_170)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_170)>::arg0_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_170)>::arg_type<0>, volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_170)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_170)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_170)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_170)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_170)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_170)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_170)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_170)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_170)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_170)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_170)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_170)>::class_type, std::remove_const_t<decltype(lambda_170)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_170)>, volatile float * const volatile &&(volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_170)>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_170), 0>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_170)>, type_list<volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_170)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_170)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_170)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_170)> == callable_traits<decltype(lambda_170)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_170)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_170)>, std::remove_const_t<decltype(lambda_170)>>);
+[[maybe_unused]] const auto lambda_172 = [](std::string) -> std::string {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_172)>::signature_type, std::string(std::string)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_172)>::result_type, std::string>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_172)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_172)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_172)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_172)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_172)>::arg0_type, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_172)>::arg_type<0>, std::string>);
+static_assert(callable_traits<decltype(lambda_172)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_172)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_172)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_172)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_172)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_172)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_172)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_172)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_172)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_172)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_172)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_172)>::class_type, std::remove_const_t<decltype(lambda_172)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_172)>, std::string(std::string)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_172)>, std::string>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_172), 0>, std::string>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_172)>, type_list<std::string>>);
+static_assert(callable_arity_v<decltype(lambda_172)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_172)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_172)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_172)> == callable_traits<decltype(lambda_172)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_172)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_172)>, std::remove_const_t<decltype(lambda_172)>>);
+[[maybe_unused]] const auto lambda_174 = [](const std::string *) noexcept -> const std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_174)>::signature_type, const std::string *(const std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_174)>::result_type, const std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_174)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_174)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_174)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_174)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_174)>::arg0_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_174)>::arg_type<0>, const std::string *>);
+static_assert(callable_traits<decltype(lambda_174)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_174)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_174)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_174)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_174)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_174)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_174)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_174)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_174)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_174)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_174)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_174)>::class_type, std::remove_const_t<decltype(lambda_174)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_174)>, const std::string *(const std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_174)>, const std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_174), 0>, const std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_174)>, type_list<const std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_174)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_174)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_174)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_174)> == callable_traits<decltype(lambda_174)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_174)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_174)>, std::remove_const_t<decltype(lambda_174)>>);
+[[maybe_unused]] const auto lambda_176 = [](const volatile std::string *) -> const volatile std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_176)>::signature_type, const volatile std::string *(const volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_176)>::result_type, const volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_176)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_176)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_176)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_176)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_176)>::arg0_type, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_176)>::arg_type<0>, const volatile std::string *>);
+static_assert(callable_traits<decltype(lambda_176)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_176)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_176)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_176)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_176)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_176)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_176)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_176)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_176)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_176)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_176)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_176)>::class_type, std::remove_const_t<decltype(lambda_176)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_176)>, const volatile std::string *(const volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_176)>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_176), 0>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_176)>, type_list<const volatile std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_176)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_176)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_176)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_176)> == callable_traits<decltype(lambda_176)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_176)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_176)>, std::remove_const_t<decltype(lambda_176)>>);
+[[maybe_unused]] const auto lambda_178 = [](const std::string &) noexcept -> const std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_178)>::signature_type, const std::string &(const std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_178)>::result_type, const std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_178)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_178)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_178)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_178)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_178)>::arg0_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_178)>::arg_type<0>, const std::string &>);
+static_assert(callable_traits<decltype(lambda_178)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_178)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_178)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_178)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_178)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_178)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_178)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_178)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_178)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_178)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_178)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_178)>::class_type, std::remove_const_t<decltype(lambda_178)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_178)>, const std::string &(const std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_178)>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_178), 0>, const std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_178)>, type_list<const std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_178)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_178)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_178)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_178)> == callable_traits<decltype(lambda_178)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_178)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_178)>, std::remove_const_t<decltype(lambda_178)>>);
+[[maybe_unused]] const auto lambda_180 = [](const volatile std::string &) -> const volatile std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_180)>::signature_type, const volatile std::string &(const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_180)>::result_type, const volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_180)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_180)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_180)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_180)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_180)>::arg0_type, const volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_180)>::arg_type<0>, const volatile std::string &>);
+static_assert(callable_traits<decltype(lambda_180)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_180)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_180)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_180)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_180)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_180)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_180)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_180)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_180)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_180)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_180)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_180)>::class_type, std::remove_const_t<decltype(lambda_180)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_180)>, const volatile std::string &(const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_180)>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_180), 0>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_180)>, type_list<const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_180)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_180)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_180)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_180)> == callable_traits<decltype(lambda_180)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_180)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_180)>, std::remove_const_t<decltype(lambda_180)>>);
+[[maybe_unused]] const auto lambda_182 = [](const std::string * &) noexcept -> const std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_182)>::signature_type, const std::string * &(const std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_182)>::result_type, const std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_182)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_182)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_182)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_182)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_182)>::arg0_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_182)>::arg_type<0>, const std::string * &>);
+static_assert(callable_traits<decltype(lambda_182)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_182)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_182)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_182)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_182)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_182)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_182)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_182)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_182)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_182)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_182)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_182)>::class_type, std::remove_const_t<decltype(lambda_182)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_182)>, const std::string * &(const std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_182)>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_182), 0>, const std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_182)>, type_list<const std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_182)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_182)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_182)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_182)> == callable_traits<decltype(lambda_182)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_182)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_182)>, std::remove_const_t<decltype(lambda_182)>>);
+[[maybe_unused]] const auto lambda_184 = [](const volatile std::string * &) -> const volatile std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_184)>::signature_type, const volatile std::string * &(const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_184)>::result_type, const volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_184)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_184)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_184)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_184)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_184)>::arg0_type, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_184)>::arg_type<0>, const volatile std::string * &>);
+static_assert(callable_traits<decltype(lambda_184)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_184)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_184)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_184)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_184)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_184)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_184)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_184)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_184)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_184)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_184)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_184)>::class_type, std::remove_const_t<decltype(lambda_184)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_184)>, const volatile std::string * &(const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_184)>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_184), 0>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_184)>, type_list<const volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_184)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_184)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_184)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_184)> == callable_traits<decltype(lambda_184)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_184)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_184)>, std::remove_const_t<decltype(lambda_184)>>);
+[[maybe_unused]] const auto lambda_186 = [](const std::string * const &) noexcept -> const std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_186)>::signature_type, const std::string * const &(const std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_186)>::result_type, const std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_186)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_186)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_186)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_186)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_186)>::arg0_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_186)>::arg_type<0>, const std::string * const &>);
+static_assert(callable_traits<decltype(lambda_186)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_186)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_186)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_186)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_186)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_186)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_186)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_186)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_186)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_186)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_186)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_186)>::class_type, std::remove_const_t<decltype(lambda_186)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_186)>, const std::string * const &(const std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_186)>, const std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_186), 0>, const std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_186)>, type_list<const std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_186)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_186)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_186)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_186)> == callable_traits<decltype(lambda_186)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_186)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_186)>, std::remove_const_t<decltype(lambda_186)>>);
+[[maybe_unused]] const auto lambda_188 = [](const volatile std::string * const &) -> const volatile std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_188)>::signature_type, const volatile std::string * const &(const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_188)>::result_type, const volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_188)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_188)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_188)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_188)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_188)>::arg0_type, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_188)>::arg_type<0>, const volatile std::string * const &>);
+static_assert(callable_traits<decltype(lambda_188)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_188)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_188)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_188)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_188)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_188)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_188)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_188)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_188)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_188)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_188)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_188)>::class_type, std::remove_const_t<decltype(lambda_188)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_188)>, const volatile std::string * const &(const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_188)>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_188), 0>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_188)>, type_list<const volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_188)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_188)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_188)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_188)> == callable_traits<decltype(lambda_188)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_188)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_188)>, std::remove_const_t<decltype(lambda_188)>>);
+[[maybe_unused]] const auto lambda_190 = [](const std::string * volatile &) noexcept -> const std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_190)>::signature_type, const std::string * volatile &(const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_190)>::result_type, const std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_190)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_190)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_190)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_190)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_190)>::arg0_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_190)>::arg_type<0>, const std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_190)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_190)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_190)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_190)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_190)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_190)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_190)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_190)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_190)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_190)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_190)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_190)>::class_type, std::remove_const_t<decltype(lambda_190)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_190)>, const std::string * volatile &(const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_190)>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_190), 0>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_190)>, type_list<const std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_190)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_190)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_190)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_190)> == callable_traits<decltype(lambda_190)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_190)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_190)>, std::remove_const_t<decltype(lambda_190)>>);
+[[maybe_unused]] const auto lambda_192 = [](const volatile std::string * volatile &) -> const volatile std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_192)>::signature_type, const volatile std::string * volatile &(const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_192)>::result_type, const volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_192)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_192)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_192)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_192)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_192)>::arg0_type, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_192)>::arg_type<0>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_192)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_192)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_192)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_192)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_192)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_192)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_192)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_192)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_192)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_192)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_192)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_192)>::class_type, std::remove_const_t<decltype(lambda_192)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_192)>, const volatile std::string * volatile &(const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_192)>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_192), 0>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_192)>, type_list<const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_192)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_192)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_192)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_192)> == callable_traits<decltype(lambda_192)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_192)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_192)>, std::remove_const_t<decltype(lambda_192)>>);
+[[maybe_unused]] const auto lambda_194 = [](const std::string * const volatile &) noexcept -> const std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_194)>::signature_type, const std::string * const volatile &(const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_194)>::result_type, const std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_194)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_194)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_194)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_194)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_194)>::arg0_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_194)>::arg_type<0>, const std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_194)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_194)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_194)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_194)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_194)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_194)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_194)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_194)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_194)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_194)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_194)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_194)>::class_type, std::remove_const_t<decltype(lambda_194)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_194)>, const std::string * const volatile &(const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_194)>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_194), 0>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_194)>, type_list<const std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_194)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_194)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_194)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_194)> == callable_traits<decltype(lambda_194)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_194)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_194)>, std::remove_const_t<decltype(lambda_194)>>);
+[[maybe_unused]] const auto lambda_196 = [](const volatile std::string * const volatile &) -> const volatile std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_196)>::signature_type, const volatile std::string * const volatile &(const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_196)>::result_type, const volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_196)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_196)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_196)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_196)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_196)>::arg0_type, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_196)>::arg_type<0>, const volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_196)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_196)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_196)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_196)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_196)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_196)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_196)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_196)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_196)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_196)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_196)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_196)>::class_type, std::remove_const_t<decltype(lambda_196)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_196)>, const volatile std::string * const volatile &(const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_196)>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_196), 0>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_196)>, type_list<const volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_196)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_196)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_196)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_196)> == callable_traits<decltype(lambda_196)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_196)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_196)>, std::remove_const_t<decltype(lambda_196)>>);
+[[maybe_unused]] const auto lambda_198 = [](const std::string &&) noexcept -> const std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_198)>::signature_type, const std::string &&(const std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_198)>::result_type, const std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_198)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_198)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_198)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_198)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_198)>::arg0_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_198)>::arg_type<0>, const std::string &&>);
+static_assert(callable_traits<decltype(lambda_198)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_198)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_198)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_198)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_198)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_198)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_198)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_198)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_198)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_198)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_198)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_198)>::class_type, std::remove_const_t<decltype(lambda_198)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_198)>, const std::string &&(const std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_198)>, const std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_198), 0>, const std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_198)>, type_list<const std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_198)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_198)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_198)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_198)> == callable_traits<decltype(lambda_198)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_198)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_198)>, std::remove_const_t<decltype(lambda_198)>>);
+[[maybe_unused]] const auto lambda_200 = [](const volatile std::string &&) -> const volatile std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_200)>::signature_type, const volatile std::string &&(const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_200)>::result_type, const volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_200)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_200)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_200)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_200)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_200)>::arg0_type, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_200)>::arg_type<0>, const volatile std::string &&>);
+static_assert(callable_traits<decltype(lambda_200)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_200)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_200)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_200)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_200)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_200)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_200)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_200)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_200)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_200)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_200)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_200)>::class_type, std::remove_const_t<decltype(lambda_200)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_200)>, const volatile std::string &&(const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_200)>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_200), 0>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_200)>, type_list<const volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_200)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_200)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_200)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_200)> == callable_traits<decltype(lambda_200)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_200)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_200)>, std::remove_const_t<decltype(lambda_200)>>);
+[[maybe_unused]] const auto lambda_202 = [](const std::string * &&) noexcept -> const std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_202)>::signature_type, const std::string * &&(const std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_202)>::result_type, const std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_202)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_202)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_202)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_202)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_202)>::arg0_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_202)>::arg_type<0>, const std::string * &&>);
+static_assert(callable_traits<decltype(lambda_202)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_202)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_202)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_202)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_202)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_202)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_202)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_202)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_202)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_202)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_202)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_202)>::class_type, std::remove_const_t<decltype(lambda_202)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_202)>, const std::string * &&(const std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_202)>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_202), 0>, const std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_202)>, type_list<const std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_202)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_202)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_202)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_202)> == callable_traits<decltype(lambda_202)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_202)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_202)>, std::remove_const_t<decltype(lambda_202)>>);
+[[maybe_unused]] const auto lambda_204 = [](const volatile std::string * &&) -> const volatile std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_204)>::signature_type, const volatile std::string * &&(const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_204)>::result_type, const volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_204)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_204)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_204)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_204)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_204)>::arg0_type, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_204)>::arg_type<0>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(lambda_204)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_204)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_204)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_204)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_204)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_204)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_204)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_204)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_204)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_204)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_204)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_204)>::class_type, std::remove_const_t<decltype(lambda_204)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_204)>, const volatile std::string * &&(const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_204)>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_204), 0>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_204)>, type_list<const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_204)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_204)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_204)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_204)> == callable_traits<decltype(lambda_204)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_204)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_204)>, std::remove_const_t<decltype(lambda_204)>>);
+[[maybe_unused]] const auto lambda_206 = [](const std::string * const &&) noexcept -> const std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_206)>::signature_type, const std::string * const &&(const std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_206)>::result_type, const std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_206)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_206)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_206)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_206)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_206)>::arg0_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_206)>::arg_type<0>, const std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_206)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_206)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_206)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_206)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_206)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_206)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_206)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_206)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_206)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_206)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_206)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_206)>::class_type, std::remove_const_t<decltype(lambda_206)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_206)>, const std::string * const &&(const std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_206)>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_206), 0>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_206)>, type_list<const std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_206)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_206)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_206)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_206)> == callable_traits<decltype(lambda_206)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_206)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_206)>, std::remove_const_t<decltype(lambda_206)>>);
+[[maybe_unused]] const auto lambda_208 = [](const volatile std::string * const &&) -> const volatile std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_208)>::signature_type, const volatile std::string * const &&(const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_208)>::result_type, const volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_208)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_208)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_208)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_208)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_208)>::arg0_type, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_208)>::arg_type<0>, const volatile std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_208)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_208)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_208)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_208)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_208)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_208)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_208)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_208)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_208)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_208)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_208)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_208)>::class_type, std::remove_const_t<decltype(lambda_208)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_208)>, const volatile std::string * const &&(const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_208)>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_208), 0>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_208)>, type_list<const volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_208)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_208)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_208)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_208)> == callable_traits<decltype(lambda_208)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_208)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_208)>, std::remove_const_t<decltype(lambda_208)>>);
+[[maybe_unused]] const auto lambda_210 = [](const std::string * volatile &&) noexcept -> const std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_210)>::signature_type, const std::string * volatile &&(const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_210)>::result_type, const std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_210)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_210)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_210)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_210)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_210)>::arg0_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_210)>::arg_type<0>, const std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_210)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_210)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_210)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_210)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_210)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_210)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_210)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_210)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_210)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_210)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_210)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_210)>::class_type, std::remove_const_t<decltype(lambda_210)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_210)>, const std::string * volatile &&(const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_210)>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_210), 0>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_210)>, type_list<const std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_210)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_210)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_210)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_210)> == callable_traits<decltype(lambda_210)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_210)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_210)>, std::remove_const_t<decltype(lambda_210)>>);
+[[maybe_unused]] const auto lambda_212 = [](const volatile std::string * volatile &&) -> const volatile std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_212)>::signature_type, const volatile std::string * volatile &&(const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_212)>::result_type, const volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_212)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_212)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_212)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_212)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_212)>::arg0_type, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_212)>::arg_type<0>, const volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_212)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_212)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_212)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_212)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_212)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_212)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_212)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_212)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_212)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_212)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_212)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_212)>::class_type, std::remove_const_t<decltype(lambda_212)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_212)>, const volatile std::string * volatile &&(const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_212)>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_212), 0>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_212)>, type_list<const volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_212)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_212)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_212)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_212)> == callable_traits<decltype(lambda_212)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_212)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_212)>, std::remove_const_t<decltype(lambda_212)>>);
+[[maybe_unused]] const auto lambda_214 = [](const std::string * const volatile &&) noexcept -> const std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_214)>::signature_type, const std::string * const volatile &&(const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_214)>::result_type, const std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_214)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_214)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_214)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_214)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_214)>::arg0_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_214)>::arg_type<0>, const std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_214)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_214)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_214)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_214)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_214)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_214)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_214)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_214)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_214)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_214)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_214)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_214)>::class_type, std::remove_const_t<decltype(lambda_214)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_214)>, const std::string * const volatile &&(const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_214)>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_214), 0>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_214)>, type_list<const std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_214)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_214)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_214)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_214)> == callable_traits<decltype(lambda_214)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_214)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_214)>, std::remove_const_t<decltype(lambda_214)>>);
+[[maybe_unused]] const auto lambda_216 = [](const volatile std::string * const volatile &&) -> const volatile std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_216)>::signature_type, const volatile std::string * const volatile &&(const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_216)>::result_type, const volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_216)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_216)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_216)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_216)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_216)>::arg0_type, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_216)>::arg_type<0>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_216)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_216)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_216)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_216)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_216)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_216)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_216)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_216)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_216)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_216)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_216)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_216)>::class_type, std::remove_const_t<decltype(lambda_216)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_216)>, const volatile std::string * const volatile &&(const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_216)>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_216), 0>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_216)>, type_list<const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_216)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_216)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_216)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_216)> == callable_traits<decltype(lambda_216)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_216)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_216)>, std::remove_const_t<decltype(lambda_216)>>);
+[[maybe_unused]] const auto lambda_218 = [](volatile void *, const volatile void *) noexcept -> void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::signature_type, void *(volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::result_type, void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_218)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_218)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_218)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_218)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::arg0_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::arg_type<0>, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::arg1_type, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::arg_type<1>, const volatile void *>);
+static_assert(callable_traits<decltype(lambda_218)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_218)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_218)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_218)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_218)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_218)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_218)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_218)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_218)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_218)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_218)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_218)>::class_type, std::remove_const_t<decltype(lambda_218)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_218)>, void *(volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_218)>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_218), 0>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_218), 1>, const volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_218)>, type_list<volatile void *, const volatile void *>>);
+static_assert(callable_arity_v<decltype(lambda_218)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_218)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_218)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_218)> == callable_traits<decltype(lambda_218)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_218)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_218)>, std::remove_const_t<decltype(lambda_218)>>);
+[[maybe_unused]] const auto lambda_220 = [](volatile void * &, const volatile void * &) -> volatile void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::signature_type, volatile void *(volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::result_type, volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_220)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_220)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_220)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_220)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::arg0_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::arg_type<0>, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::arg1_type, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::arg_type<1>, const volatile void * &>);
+static_assert(callable_traits<decltype(lambda_220)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_220)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_220)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_220)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_220)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_220)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_220)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_220)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_220)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_220)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_220)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_220)>::class_type, std::remove_const_t<decltype(lambda_220)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_220)>, volatile void *(volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_220)>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_220), 0>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_220), 1>, const volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_220)>, type_list<volatile void * &, const volatile void * &>>);
+static_assert(callable_arity_v<decltype(lambda_220)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_220)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_220)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_220)> == callable_traits<decltype(lambda_220)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_220)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_220)>, std::remove_const_t<decltype(lambda_220)>>);
+[[maybe_unused]] const auto lambda_222 = [](volatile void * const &, const volatile void * const &) noexcept -> void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::signature_type, void * &(volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::result_type, void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_222)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_222)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_222)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_222)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::arg0_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::arg_type<0>, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::arg1_type, const volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::arg_type<1>, const volatile void * const &>);
+static_assert(callable_traits<decltype(lambda_222)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_222)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_222)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_222)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_222)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_222)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_222)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_222)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_222)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_222)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_222)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_222)>::class_type, std::remove_const_t<decltype(lambda_222)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_222)>, void * &(volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_222)>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_222), 0>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_222), 1>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_222)>, type_list<volatile void * const &, const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_222)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_222)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_222)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_222)> == callable_traits<decltype(lambda_222)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_222)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_222)>, std::remove_const_t<decltype(lambda_222)>>);
+[[maybe_unused]] const auto lambda_224 = [](volatile void * volatile &, const volatile void * volatile &) -> volatile void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::signature_type, volatile void * &(volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::result_type, volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_224)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_224)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_224)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_224)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::arg0_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::arg_type<0>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::arg1_type, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::arg_type<1>, const volatile void * volatile &>);
+static_assert(callable_traits<decltype(lambda_224)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_224)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_224)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_224)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_224)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_224)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_224)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_224)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_224)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_224)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_224)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_224)>::class_type, std::remove_const_t<decltype(lambda_224)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_224)>, volatile void * &(volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_224)>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_224), 0>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_224), 1>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_224)>, type_list<volatile void * volatile &, const volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_224)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_224)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_224)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_224)> == callable_traits<decltype(lambda_224)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_224)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_224)>, std::remove_const_t<decltype(lambda_224)>>);
+[[maybe_unused]] const auto lambda_226 = [](volatile void * const volatile &, const volatile void * const volatile &) noexcept -> void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::signature_type, void * const &(volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::result_type, void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_226)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_226)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_226)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_226)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::arg0_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::arg_type<0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::arg1_type, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::arg_type<1>, const volatile void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_226)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_226)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_226)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_226)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_226)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_226)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_226)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_226)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_226)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_226)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_226)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_226)>::class_type, std::remove_const_t<decltype(lambda_226)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_226)>, void * const &(volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_226)>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_226), 0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_226), 1>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_226)>, type_list<volatile void * const volatile &, const volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_226)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_226)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_226)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_226)> == callable_traits<decltype(lambda_226)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_226)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_226)>, std::remove_const_t<decltype(lambda_226)>>);
+[[maybe_unused]] const auto lambda_228 = [](volatile void * &&, const volatile void * &&) -> volatile void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::signature_type, volatile void * const &(volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::result_type, volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_228)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_228)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_228)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_228)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::arg0_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::arg_type<0>, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::arg1_type, const volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::arg_type<1>, const volatile void * &&>);
+static_assert(callable_traits<decltype(lambda_228)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_228)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_228)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_228)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_228)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_228)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_228)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_228)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_228)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_228)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_228)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_228)>::class_type, std::remove_const_t<decltype(lambda_228)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_228)>, volatile void * const &(volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_228)>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_228), 0>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_228), 1>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_228)>, type_list<volatile void * &&, const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_228)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_228)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_228)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_228)> == callable_traits<decltype(lambda_228)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_228)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_228)>, std::remove_const_t<decltype(lambda_228)>>);
+[[maybe_unused]] const auto lambda_230 = [](volatile void * const &&, const volatile void * const &&) noexcept -> void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::signature_type, void * volatile &(volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::result_type, void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_230)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_230)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_230)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_230)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::arg0_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::arg_type<0>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::arg1_type, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::arg_type<1>, const volatile void * const &&>);
+static_assert(callable_traits<decltype(lambda_230)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_230)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_230)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_230)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_230)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_230)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_230)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_230)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_230)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_230)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_230)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_230)>::class_type, std::remove_const_t<decltype(lambda_230)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_230)>, void * volatile &(volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_230)>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_230), 0>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_230), 1>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_230)>, type_list<volatile void * const &&, const volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_230)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_230)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_230)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_230)> == callable_traits<decltype(lambda_230)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_230)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_230)>, std::remove_const_t<decltype(lambda_230)>>);
+[[maybe_unused]] const auto lambda_232 = [](volatile void * volatile &&, const volatile void * volatile &&) -> volatile void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::signature_type, volatile void * volatile &(volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::result_type, volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_232)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_232)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_232)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_232)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::arg0_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::arg_type<0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::arg1_type, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::arg_type<1>, const volatile void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_232)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_232)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_232)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_232)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_232)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_232)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_232)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_232)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_232)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_232)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_232)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_232)>::class_type, std::remove_const_t<decltype(lambda_232)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_232)>, volatile void * volatile &(volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_232)>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_232), 0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_232), 1>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_232)>, type_list<volatile void * volatile &&, const volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_232)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_232)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_232)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_232)> == callable_traits<decltype(lambda_232)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_232)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_232)>, std::remove_const_t<decltype(lambda_232)>>);
+[[maybe_unused]] const auto lambda_234 = [](volatile void * const volatile &&, const volatile void * const volatile &&) noexcept -> void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::signature_type, void * const volatile &(volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::result_type, void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_234)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_234)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_234)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_234)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::arg0_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::arg_type<0>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::arg1_type, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::arg_type<1>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_234)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_234)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_234)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_234)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_234)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_234)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_234)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_234)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_234)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_234)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_234)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_234)>::class_type, std::remove_const_t<decltype(lambda_234)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_234)>, void * const volatile &(volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_234)>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_234), 0>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_234), 1>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_234)>, type_list<volatile void * const volatile &&, const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_234)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_234)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_234)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_234)> == callable_traits<decltype(lambda_234)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_234)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_234)>, std::remove_const_t<decltype(lambda_234)>>);
+[[maybe_unused]] const auto lambda_236 = [](const bool *, volatile bool *) -> volatile void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::signature_type, volatile void * const volatile &(const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::result_type, volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_236)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_236)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_236)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_236)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::arg0_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::arg_type<0>, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::arg1_type, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::arg_type<1>, volatile bool *>);
+static_assert(callable_traits<decltype(lambda_236)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_236)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_236)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_236)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_236)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_236)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_236)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_236)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_236)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_236)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_236)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_236)>::class_type, std::remove_const_t<decltype(lambda_236)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_236)>, volatile void * const volatile &(const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_236)>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_236), 0>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_236), 1>, volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_236)>, type_list<const bool *, volatile bool *>>);
+static_assert(callable_arity_v<decltype(lambda_236)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_236)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_236)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_236)> == callable_traits<decltype(lambda_236)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_236)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_236)>, std::remove_const_t<decltype(lambda_236)>>);
+[[maybe_unused]] const auto lambda_238 = [](const bool &, volatile bool &) noexcept -> void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::signature_type, void * &&(const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::result_type, void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_238)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_238)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_238)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_238)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::arg0_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::arg_type<0>, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::arg1_type, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::arg_type<1>, volatile bool &>);
+static_assert(callable_traits<decltype(lambda_238)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_238)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_238)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_238)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_238)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_238)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_238)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_238)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_238)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_238)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_238)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_238)>::class_type, std::remove_const_t<decltype(lambda_238)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_238)>, void * &&(const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_238)>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_238), 0>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_238), 1>, volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_238)>, type_list<const bool &, volatile bool &>>);
+static_assert(callable_arity_v<decltype(lambda_238)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_238)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_238)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_238)> == callable_traits<decltype(lambda_238)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_238)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_238)>, std::remove_const_t<decltype(lambda_238)>>);
+[[maybe_unused]] const auto lambda_240 = [](const bool * &, volatile bool * &) -> volatile void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::signature_type, volatile void * &&(const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::result_type, volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_240)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_240)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_240)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_240)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::arg0_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::arg_type<0>, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::arg1_type, volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::arg_type<1>, volatile bool * &>);
+static_assert(callable_traits<decltype(lambda_240)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_240)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_240)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_240)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_240)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_240)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_240)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_240)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_240)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_240)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_240)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_240)>::class_type, std::remove_const_t<decltype(lambda_240)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_240)>, volatile void * &&(const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_240)>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_240), 0>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_240), 1>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_240)>, type_list<const bool * &, volatile bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_240)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_240)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_240)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_240)> == callable_traits<decltype(lambda_240)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_240)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_240)>, std::remove_const_t<decltype(lambda_240)>>);
+[[maybe_unused]] const auto lambda_242 = [](const bool * const &, volatile bool * const &) noexcept -> void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::signature_type, void * const &&(const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::result_type, void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_242)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_242)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_242)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_242)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::arg0_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::arg_type<0>, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::arg1_type, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::arg_type<1>, volatile bool * const &>);
+static_assert(callable_traits<decltype(lambda_242)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_242)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_242)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_242)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_242)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_242)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_242)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_242)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_242)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_242)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_242)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_242)>::class_type, std::remove_const_t<decltype(lambda_242)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_242)>, void * const &&(const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_242)>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_242), 0>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_242), 1>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_242)>, type_list<const bool * const &, volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_242)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_242)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_242)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_242)> == callable_traits<decltype(lambda_242)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_242)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_242)>, std::remove_const_t<decltype(lambda_242)>>);
+[[maybe_unused]] const auto lambda_244 = [](const bool * volatile &, volatile bool * volatile &) -> volatile void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::signature_type, volatile void * const &&(const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::result_type, volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_244)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_244)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_244)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_244)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::arg0_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::arg_type<0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::arg1_type, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::arg_type<1>, volatile bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_244)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_244)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_244)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_244)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_244)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_244)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_244)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_244)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_244)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_244)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_244)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_244)>::class_type, std::remove_const_t<decltype(lambda_244)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_244)>, volatile void * const &&(const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_244)>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_244), 0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_244), 1>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_244)>, type_list<const bool * volatile &, volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_244)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_244)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_244)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_244)> == callable_traits<decltype(lambda_244)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_244)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_244)>, std::remove_const_t<decltype(lambda_244)>>);
+[[maybe_unused]] const auto lambda_246 = [](const bool * const volatile &, volatile bool * const volatile &) noexcept -> void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::signature_type, void * volatile &&(const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::result_type, void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_246)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_246)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_246)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_246)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::arg0_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::arg_type<0>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::arg1_type, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::arg_type<1>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_246)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_246)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_246)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_246)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_246)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_246)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_246)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_246)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_246)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_246)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_246)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_246)>::class_type, std::remove_const_t<decltype(lambda_246)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_246)>, void * volatile &&(const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_246)>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_246), 0>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_246), 1>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_246)>, type_list<const bool * const volatile &, volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_246)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_246)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_246)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_246)> == callable_traits<decltype(lambda_246)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_246)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_246)>, std::remove_const_t<decltype(lambda_246)>>);
+[[maybe_unused]] const auto lambda_248 = [](const bool &&, volatile bool &&) -> volatile void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::signature_type, volatile void * volatile &&(const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::result_type, volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_248)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_248)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_248)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_248)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::arg0_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::arg_type<0>, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::arg1_type, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::arg_type<1>, volatile bool &&>);
+static_assert(callable_traits<decltype(lambda_248)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_248)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_248)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_248)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_248)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_248)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_248)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_248)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_248)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_248)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_248)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_248)>::class_type, std::remove_const_t<decltype(lambda_248)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_248)>, volatile void * volatile &&(const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_248)>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_248), 0>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_248), 1>, volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_248)>, type_list<const bool &&, volatile bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_248)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_248)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_248)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_248)> == callable_traits<decltype(lambda_248)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_248)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_248)>, std::remove_const_t<decltype(lambda_248)>>);
+[[maybe_unused]] const auto lambda_250 = [](const bool * &&, volatile bool * &&) noexcept -> void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::signature_type, void * const volatile &&(const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::result_type, void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_250)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_250)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_250)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_250)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::arg0_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::arg_type<0>, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::arg1_type, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::arg_type<1>, volatile bool * &&>);
+static_assert(callable_traits<decltype(lambda_250)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_250)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_250)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_250)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_250)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_250)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_250)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_250)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_250)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_250)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_250)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_250)>::class_type, std::remove_const_t<decltype(lambda_250)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_250)>, void * const volatile &&(const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_250)>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_250), 0>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_250), 1>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_250)>, type_list<const bool * &&, volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_250)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_250)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_250)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_250)> == callable_traits<decltype(lambda_250)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_250)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_250)>, std::remove_const_t<decltype(lambda_250)>>);
+[[maybe_unused]] const auto lambda_252 = [](const bool * const &&, volatile bool * const &&) -> volatile void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::signature_type, volatile void * const volatile &&(const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::result_type, volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_252)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_252)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_252)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_252)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::arg0_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::arg_type<0>, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::arg1_type, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::arg_type<1>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(lambda_252)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_252)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_252)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_252)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_252)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_252)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_252)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_252)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_252)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_252)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_252)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_252)>::class_type, std::remove_const_t<decltype(lambda_252)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_252)>, volatile void * const volatile &&(const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_252)>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_252), 0>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_252), 1>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_252)>, type_list<const bool * const &&, volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_252)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_252)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_252)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_252)> == callable_traits<decltype(lambda_252)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_252)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_252)>, std::remove_const_t<decltype(lambda_252)>>);
+[[maybe_unused]] const auto lambda_254 = [](const bool * volatile &&, volatile bool * volatile &&) noexcept -> bool {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::signature_type, bool(const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::result_type, bool>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_254)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_254)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_254)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_254)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::arg0_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::arg_type<0>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::arg1_type, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::arg_type<1>, volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_254)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_254)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_254)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_254)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_254)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_254)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_254)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_254)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_254)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_254)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_254)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_254)>::class_type, std::remove_const_t<decltype(lambda_254)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_254)>, bool(const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_254)>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_254), 0>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_254), 1>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_254)>, type_list<const bool * volatile &&, volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_254)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_254)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_254)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_254)> == callable_traits<decltype(lambda_254)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_254)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_254)>, std::remove_const_t<decltype(lambda_254)>>);
+[[maybe_unused]] const auto lambda_256 = [](const bool * const volatile &&, volatile bool * const volatile &&) -> const bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::signature_type, const bool *(const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::result_type, const bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_256)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_256)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_256)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_256)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::arg0_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::arg_type<0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::arg1_type, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::arg_type<1>, volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_256)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_256)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_256)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_256)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_256)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_256)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_256)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_256)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_256)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_256)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_256)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_256)>::class_type, std::remove_const_t<decltype(lambda_256)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_256)>, const bool *(const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_256)>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_256), 0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_256), 1>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_256)>, type_list<const bool * const volatile &&, volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_256)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_256)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_256)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_256)> == callable_traits<decltype(lambda_256)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_256)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_256)>, std::remove_const_t<decltype(lambda_256)>>);
+[[maybe_unused]] const auto lambda_258 = [](int *, const int *) noexcept -> const volatile bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::signature_type, const volatile bool *(int *, const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::result_type, const volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_258)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_258)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_258)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_258)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::arg0_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::arg_type<0>, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::arg1_type, const int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::arg_type<1>, const int *>);
+static_assert(callable_traits<decltype(lambda_258)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_258)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_258)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_258)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_258)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_258)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_258)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_258)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_258)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_258)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_258)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_258)>::class_type, std::remove_const_t<decltype(lambda_258)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_258)>, const volatile bool *(int *, const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_258)>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_258), 0>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_258), 1>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_258)>, type_list<int *, const int *>>);
+static_assert(callable_arity_v<decltype(lambda_258)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_258)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_258)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_258)> == callable_traits<decltype(lambda_258)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_258)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_258)>, std::remove_const_t<decltype(lambda_258)>>);
+[[maybe_unused]] const auto lambda_260 = [](int &, const int &) -> const bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::signature_type, const bool &(int &, const int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::result_type, const bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_260)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_260)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_260)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_260)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::arg0_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::arg_type<0>, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::arg1_type, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::arg_type<1>, const int &>);
+static_assert(callable_traits<decltype(lambda_260)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_260)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_260)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_260)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_260)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_260)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_260)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_260)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_260)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_260)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_260)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_260)>::class_type, std::remove_const_t<decltype(lambda_260)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_260)>, const bool &(int &, const int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_260)>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_260), 0>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_260), 1>, const int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_260)>, type_list<int &, const int &>>);
+static_assert(callable_arity_v<decltype(lambda_260)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_260)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_260)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_260)> == callable_traits<decltype(lambda_260)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_260)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_260)>, std::remove_const_t<decltype(lambda_260)>>);
+[[maybe_unused]] const auto lambda_262 = [](int * &, const int * &) noexcept -> const volatile bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::signature_type, const volatile bool &(int * &, const int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::result_type, const volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_262)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_262)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_262)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_262)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::arg0_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::arg_type<0>, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::arg1_type, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::arg_type<1>, const int * &>);
+static_assert(callable_traits<decltype(lambda_262)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_262)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_262)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_262)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_262)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_262)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_262)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_262)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_262)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_262)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_262)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_262)>::class_type, std::remove_const_t<decltype(lambda_262)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_262)>, const volatile bool &(int * &, const int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_262)>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_262), 0>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_262), 1>, const int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_262)>, type_list<int * &, const int * &>>);
+static_assert(callable_arity_v<decltype(lambda_262)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_262)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_262)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_262)> == callable_traits<decltype(lambda_262)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_262)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_262)>, std::remove_const_t<decltype(lambda_262)>>);
+[[maybe_unused]] const auto lambda_264 = [](int * const &, const int * const &) -> const bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::signature_type, const bool * &(int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::result_type, const bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_264)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_264)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_264)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_264)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::arg0_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::arg_type<0>, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::arg1_type, const int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::arg_type<1>, const int * const &>);
+static_assert(callable_traits<decltype(lambda_264)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_264)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_264)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_264)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_264)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_264)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_264)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_264)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_264)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_264)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_264)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_264)>::class_type, std::remove_const_t<decltype(lambda_264)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_264)>, const bool * &(int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_264)>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_264), 0>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_264), 1>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_264)>, type_list<int * const &, const int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_264)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_264)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_264)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_264)> == callable_traits<decltype(lambda_264)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_264)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_264)>, std::remove_const_t<decltype(lambda_264)>>);
+[[maybe_unused]] const auto lambda_266 = [](int * volatile &, const int * volatile &) noexcept -> const volatile bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::signature_type, const volatile bool * &(int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::result_type, const volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_266)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_266)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_266)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_266)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::arg0_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::arg_type<0>, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::arg1_type, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::arg_type<1>, const int * volatile &>);
+static_assert(callable_traits<decltype(lambda_266)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_266)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_266)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_266)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_266)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_266)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_266)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_266)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_266)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_266)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_266)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_266)>::class_type, std::remove_const_t<decltype(lambda_266)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_266)>, const volatile bool * &(int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_266)>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_266), 0>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_266), 1>, const int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_266)>, type_list<int * volatile &, const int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_266)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_266)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_266)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_266)> == callable_traits<decltype(lambda_266)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_266)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_266)>, std::remove_const_t<decltype(lambda_266)>>);
+[[maybe_unused]] const auto lambda_268 = [](int * const volatile &, const int * const volatile &) -> const bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::signature_type, const bool * const &(int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::result_type, const bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_268)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_268)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_268)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_268)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::arg0_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::arg_type<0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::arg1_type, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::arg_type<1>, const int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_268)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_268)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_268)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_268)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_268)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_268)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_268)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_268)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_268)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_268)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_268)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_268)>::class_type, std::remove_const_t<decltype(lambda_268)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_268)>, const bool * const &(int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_268)>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_268), 0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_268), 1>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_268)>, type_list<int * const volatile &, const int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_268)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_268)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_268)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_268)> == callable_traits<decltype(lambda_268)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_268)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_268)>, std::remove_const_t<decltype(lambda_268)>>);
+[[maybe_unused]] const auto lambda_270 = [](int &&, const int &&) noexcept -> const volatile bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::signature_type, const volatile bool * const &(int &&, const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::result_type, const volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_270)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_270)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_270)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_270)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::arg0_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::arg_type<0>, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::arg1_type, const int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::arg_type<1>, const int &&>);
+static_assert(callable_traits<decltype(lambda_270)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_270)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_270)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_270)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_270)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_270)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_270)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_270)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_270)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_270)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_270)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_270)>::class_type, std::remove_const_t<decltype(lambda_270)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_270)>, const volatile bool * const &(int &&, const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_270)>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_270), 0>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_270), 1>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_270)>, type_list<int &&, const int &&>>);
+static_assert(callable_arity_v<decltype(lambda_270)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_270)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_270)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_270)> == callable_traits<decltype(lambda_270)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_270)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_270)>, std::remove_const_t<decltype(lambda_270)>>);
+[[maybe_unused]] const auto lambda_272 = [](int * &&, const int * &&) -> const bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::signature_type, const bool * volatile &(int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::result_type, const bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_272)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_272)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_272)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_272)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::arg0_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::arg_type<0>, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::arg1_type, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::arg_type<1>, const int * &&>);
+static_assert(callable_traits<decltype(lambda_272)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_272)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_272)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_272)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_272)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_272)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_272)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_272)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_272)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_272)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_272)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_272)>::class_type, std::remove_const_t<decltype(lambda_272)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_272)>, const bool * volatile &(int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_272)>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_272), 0>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_272), 1>, const int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_272)>, type_list<int * &&, const int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_272)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_272)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_272)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_272)> == callable_traits<decltype(lambda_272)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_272)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_272)>, std::remove_const_t<decltype(lambda_272)>>);
+[[maybe_unused]] const auto lambda_274 = [](int * const &&, const int * const &&) noexcept -> const volatile bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::signature_type, const volatile bool * volatile &(int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::result_type, const volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_274)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_274)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_274)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_274)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::arg0_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::arg_type<0>, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::arg1_type, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::arg_type<1>, const int * const &&>);
+static_assert(callable_traits<decltype(lambda_274)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_274)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_274)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_274)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_274)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_274)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_274)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_274)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_274)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_274)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_274)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_274)>::class_type, std::remove_const_t<decltype(lambda_274)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_274)>, const volatile bool * volatile &(int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_274)>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_274), 0>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_274), 1>, const int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_274)>, type_list<int * const &&, const int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_274)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_274)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_274)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_274)> == callable_traits<decltype(lambda_274)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_274)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_274)>, std::remove_const_t<decltype(lambda_274)>>);
+[[maybe_unused]] const auto lambda_276 = [](int * volatile &&, const int * volatile &&) -> const bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::signature_type, const bool * const volatile &(int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::result_type, const bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_276)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_276)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_276)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_276)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::arg0_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::arg_type<0>, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::arg1_type, const int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::arg_type<1>, const int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_276)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_276)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_276)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_276)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_276)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_276)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_276)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_276)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_276)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_276)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_276)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_276)>::class_type, std::remove_const_t<decltype(lambda_276)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_276)>, const bool * const volatile &(int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_276)>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_276), 0>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_276), 1>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_276)>, type_list<int * volatile &&, const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_276)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_276)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_276)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_276)> == callable_traits<decltype(lambda_276)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_276)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_276)>, std::remove_const_t<decltype(lambda_276)>>);
+[[maybe_unused]] const auto lambda_278 = [](int * const volatile &&, const int * const volatile &&) noexcept -> const volatile bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::signature_type, const volatile bool * const volatile &(int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::result_type, const volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_278)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_278)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_278)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_278)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::arg0_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::arg_type<0>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::arg1_type, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::arg_type<1>, const int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_278)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_278)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_278)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_278)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_278)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_278)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_278)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_278)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_278)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_278)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_278)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_278)>::class_type, std::remove_const_t<decltype(lambda_278)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_278)>, const volatile bool * const volatile &(int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_278)>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_278), 0>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_278), 1>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_278)>, type_list<int * const volatile &&, const int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_278)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_278)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_278)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_278)> == callable_traits<decltype(lambda_278)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_278)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_278)>, std::remove_const_t<decltype(lambda_278)>>);
+[[maybe_unused]] const auto lambda_280 = [](float, float *) -> const bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::signature_type, const bool &&(float, float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::result_type, const bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_280)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_280)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_280)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_280)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::arg0_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::arg_type<0>, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::arg1_type, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::arg_type<1>, float *>);
+static_assert(callable_traits<decltype(lambda_280)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_280)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_280)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_280)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_280)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_280)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_280)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_280)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_280)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_280)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_280)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_280)>::class_type, std::remove_const_t<decltype(lambda_280)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_280)>, const bool &&(float, float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_280)>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_280), 0>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_280), 1>, float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_280)>, type_list<float, float *>>);
+static_assert(callable_arity_v<decltype(lambda_280)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_280)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_280)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_280)> == callable_traits<decltype(lambda_280)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_280)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_280)>, std::remove_const_t<decltype(lambda_280)>>);
+[[maybe_unused]] const auto lambda_282 = [](const volatile float *, float &) noexcept -> const volatile bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::signature_type, const volatile bool &&(const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::result_type, const volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_282)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_282)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_282)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_282)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::arg0_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::arg_type<0>, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::arg1_type, float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::arg_type<1>, float &>);
+static_assert(callable_traits<decltype(lambda_282)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_282)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_282)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_282)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_282)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_282)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_282)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_282)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_282)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_282)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_282)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_282)>::class_type, std::remove_const_t<decltype(lambda_282)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_282)>, const volatile bool &&(const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_282)>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_282), 0>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_282), 1>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_282)>, type_list<const volatile float *, float &>>);
+static_assert(callable_arity_v<decltype(lambda_282)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_282)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_282)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_282)> == callable_traits<decltype(lambda_282)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_282)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_282)>, std::remove_const_t<decltype(lambda_282)>>);
+[[maybe_unused]] const auto lambda_284 = [](const volatile float &, float * &) -> const bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::signature_type, const bool * &&(const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::result_type, const bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_284)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_284)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_284)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_284)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::arg0_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::arg_type<0>, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::arg1_type, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::arg_type<1>, float * &>);
+static_assert(callable_traits<decltype(lambda_284)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_284)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_284)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_284)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_284)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_284)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_284)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_284)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_284)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_284)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_284)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_284)>::class_type, std::remove_const_t<decltype(lambda_284)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_284)>, const bool * &&(const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_284)>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_284), 0>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_284), 1>, float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_284)>, type_list<const volatile float &, float * &>>);
+static_assert(callable_arity_v<decltype(lambda_284)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_284)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_284)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_284)> == callable_traits<decltype(lambda_284)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_284)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_284)>, std::remove_const_t<decltype(lambda_284)>>);
+[[maybe_unused]] const auto lambda_286 = [](const volatile float * &, float * const &) noexcept -> const volatile bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::signature_type, const volatile bool * &&(const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::result_type, const volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_286)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_286)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_286)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_286)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::arg0_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::arg_type<0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::arg1_type, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::arg_type<1>, float * const &>);
+static_assert(callable_traits<decltype(lambda_286)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_286)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_286)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_286)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_286)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_286)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_286)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_286)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_286)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_286)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_286)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_286)>::class_type, std::remove_const_t<decltype(lambda_286)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_286)>, const volatile bool * &&(const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_286)>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_286), 0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_286), 1>, float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_286)>, type_list<const volatile float * &, float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_286)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_286)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_286)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_286)> == callable_traits<decltype(lambda_286)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_286)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_286)>, std::remove_const_t<decltype(lambda_286)>>);
+[[maybe_unused]] const auto lambda_288 = [](const volatile float * const &, float * volatile &) -> const bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::signature_type, const bool * const &&(const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::result_type, const bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_288)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_288)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_288)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_288)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::arg0_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::arg_type<0>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::arg1_type, float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::arg_type<1>, float * volatile &>);
+static_assert(callable_traits<decltype(lambda_288)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_288)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_288)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_288)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_288)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_288)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_288)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_288)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_288)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_288)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_288)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_288)>::class_type, std::remove_const_t<decltype(lambda_288)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_288)>, const bool * const &&(const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_288)>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_288), 0>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_288), 1>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_288)>, type_list<const volatile float * const &, float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_288)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_288)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_288)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_288)> == callable_traits<decltype(lambda_288)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_288)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_288)>, std::remove_const_t<decltype(lambda_288)>>);
+[[maybe_unused]] const auto lambda_290 = [](const volatile float * volatile &, float * const volatile &) noexcept -> const volatile bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::signature_type, const volatile bool * const &&(const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::result_type, const volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_290)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_290)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_290)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_290)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::arg0_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::arg_type<0>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::arg1_type, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::arg_type<1>, float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_290)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_290)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_290)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_290)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_290)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_290)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_290)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_290)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_290)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_290)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_290)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_290)>::class_type, std::remove_const_t<decltype(lambda_290)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_290)>, const volatile bool * const &&(const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_290)>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_290), 0>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_290), 1>, float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_290)>, type_list<const volatile float * volatile &, float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_290)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_290)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_290)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_290)> == callable_traits<decltype(lambda_290)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_290)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_290)>, std::remove_const_t<decltype(lambda_290)>>);
+[[maybe_unused]] const auto lambda_292 = [](const volatile float * const volatile &, float &&) -> const bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::signature_type, const bool * volatile &&(const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::result_type, const bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_292)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_292)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_292)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_292)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::arg0_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::arg_type<0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::arg1_type, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::arg_type<1>, float &&>);
+static_assert(callable_traits<decltype(lambda_292)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_292)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_292)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_292)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_292)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_292)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_292)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_292)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_292)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_292)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_292)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_292)>::class_type, std::remove_const_t<decltype(lambda_292)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_292)>, const bool * volatile &&(const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_292)>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_292), 0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_292), 1>, float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_292)>, type_list<const volatile float * const volatile &, float &&>>);
+static_assert(callable_arity_v<decltype(lambda_292)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_292)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_292)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_292)> == callable_traits<decltype(lambda_292)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_292)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_292)>, std::remove_const_t<decltype(lambda_292)>>);
+[[maybe_unused]] const auto lambda_294 = [](const volatile float &&, float * &&) noexcept -> const volatile bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::signature_type, const volatile bool * volatile &&(const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::result_type, const volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_294)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_294)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_294)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_294)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::arg0_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::arg_type<0>, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::arg1_type, float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::arg_type<1>, float * &&>);
+static_assert(callable_traits<decltype(lambda_294)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_294)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_294)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_294)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_294)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_294)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_294)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_294)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_294)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_294)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_294)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_294)>::class_type, std::remove_const_t<decltype(lambda_294)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_294)>, const volatile bool * volatile &&(const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_294)>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_294), 0>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_294), 1>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_294)>, type_list<const volatile float &&, float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_294)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_294)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_294)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_294)> == callable_traits<decltype(lambda_294)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_294)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_294)>, std::remove_const_t<decltype(lambda_294)>>);
+[[maybe_unused]] const auto lambda_296 = [](const volatile float * &&, float * const &&) -> const bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::signature_type, const bool * const volatile &&(const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::result_type, const bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_296)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_296)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_296)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_296)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::arg0_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::arg_type<0>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::arg1_type, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::arg_type<1>, float * const &&>);
+static_assert(callable_traits<decltype(lambda_296)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_296)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_296)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_296)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_296)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_296)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_296)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_296)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_296)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_296)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_296)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_296)>::class_type, std::remove_const_t<decltype(lambda_296)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_296)>, const bool * const volatile &&(const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_296)>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_296), 0>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_296), 1>, float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_296)>, type_list<const volatile float * &&, float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_296)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_296)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_296)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_296)> == callable_traits<decltype(lambda_296)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_296)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_296)>, std::remove_const_t<decltype(lambda_296)>>);
+[[maybe_unused]] const auto lambda_298 = [](const volatile float * const &&, float * volatile &&) noexcept -> const volatile bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::signature_type, const volatile bool * const volatile &&(const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::result_type, const volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_298)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_298)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_298)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_298)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::arg0_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::arg_type<0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::arg1_type, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::arg_type<1>, float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_298)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_298)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_298)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_298)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_298)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_298)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_298)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_298)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_298)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_298)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_298)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_298)>::class_type, std::remove_const_t<decltype(lambda_298)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_298)>, const volatile bool * const volatile &&(const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_298)>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_298), 0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_298), 1>, float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_298)>, type_list<const volatile float * const &&, float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_298)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_298)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_298)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_298)> == callable_traits<decltype(lambda_298)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_298)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_298)>, std::remove_const_t<decltype(lambda_298)>>);
+[[maybe_unused]] const auto lambda_300 = [](const volatile float * volatile &&, float * const volatile &&) -> int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::signature_type, int *(const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::result_type, int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_300)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_300)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_300)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_300)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::arg0_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::arg_type<0>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::arg1_type, float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::arg_type<1>, float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_300)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_300)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_300)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_300)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_300)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_300)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_300)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_300)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_300)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_300)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_300)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_300)>::class_type, std::remove_const_t<decltype(lambda_300)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_300)>, int *(const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_300)>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_300), 0>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_300), 1>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_300)>, type_list<const volatile float * volatile &&, float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_300)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_300)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_300)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_300)> == callable_traits<decltype(lambda_300)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_300)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_300)>, std::remove_const_t<decltype(lambda_300)>>);
+[[maybe_unused]] const auto lambda_302 = [](const volatile float * const volatile &&, std::string) noexcept -> volatile int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::signature_type, volatile int *(const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::result_type, volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_302)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_302)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_302)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_302)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::arg0_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::arg_type<0>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::arg1_type, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::arg_type<1>, std::string>);
+static_assert(callable_traits<decltype(lambda_302)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_302)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_302)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_302)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_302)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_302)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_302)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_302)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_302)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_302)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_302)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_302)>::class_type, std::remove_const_t<decltype(lambda_302)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_302)>, volatile int *(const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_302)>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_302), 0>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_302), 1>, std::string>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_302)>, type_list<const volatile float * const volatile &&, std::string>>);
+static_assert(callable_arity_v<decltype(lambda_302)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_302)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_302)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_302)> == callable_traits<decltype(lambda_302)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_302)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_302)>, std::remove_const_t<decltype(lambda_302)>>);
+[[maybe_unused]] const auto lambda_304 = [](volatile std::string *, const volatile std::string *) -> int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::signature_type, int &(volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::result_type, int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_304)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_304)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_304)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_304)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::arg0_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::arg_type<0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::arg1_type, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::arg_type<1>, const volatile std::string *>);
+static_assert(callable_traits<decltype(lambda_304)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_304)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_304)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_304)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_304)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_304)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_304)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_304)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_304)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_304)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_304)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_304)>::class_type, std::remove_const_t<decltype(lambda_304)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_304)>, int &(volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_304)>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_304), 0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_304), 1>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_304)>, type_list<volatile std::string *, const volatile std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_304)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_304)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_304)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_304)> == callable_traits<decltype(lambda_304)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_304)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_304)>, std::remove_const_t<decltype(lambda_304)>>);
+[[maybe_unused]] const auto lambda_306 = [](volatile std::string &, const volatile std::string &) noexcept -> volatile int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::signature_type, volatile int &(volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::result_type, volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_306)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_306)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_306)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_306)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::arg0_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::arg_type<0>, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::arg1_type, const volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::arg_type<1>, const volatile std::string &>);
+static_assert(callable_traits<decltype(lambda_306)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_306)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_306)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_306)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_306)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_306)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_306)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_306)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_306)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_306)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_306)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_306)>::class_type, std::remove_const_t<decltype(lambda_306)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_306)>, volatile int &(volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_306)>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_306), 0>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_306), 1>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_306)>, type_list<volatile std::string &, const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_306)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_306)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_306)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_306)> == callable_traits<decltype(lambda_306)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_306)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_306)>, std::remove_const_t<decltype(lambda_306)>>);
+[[maybe_unused]] const auto lambda_308 = [](volatile std::string * &, const volatile std::string * &) -> int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::signature_type, int * &(volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::result_type, int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_308)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_308)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_308)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_308)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::arg0_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::arg_type<0>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::arg1_type, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::arg_type<1>, const volatile std::string * &>);
+static_assert(callable_traits<decltype(lambda_308)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_308)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_308)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_308)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_308)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_308)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_308)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_308)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_308)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_308)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_308)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_308)>::class_type, std::remove_const_t<decltype(lambda_308)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_308)>, int * &(volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_308)>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_308), 0>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_308), 1>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_308)>, type_list<volatile std::string * &, const volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_308)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_308)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_308)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_308)> == callable_traits<decltype(lambda_308)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_308)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_308)>, std::remove_const_t<decltype(lambda_308)>>);
+[[maybe_unused]] const auto lambda_310 = [](volatile std::string * const &, const volatile std::string * const &) noexcept -> volatile int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::signature_type, volatile int * &(volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::result_type, volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_310)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_310)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_310)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_310)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::arg0_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::arg_type<0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::arg1_type, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::arg_type<1>, const volatile std::string * const &>);
+static_assert(callable_traits<decltype(lambda_310)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_310)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_310)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_310)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_310)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_310)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_310)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_310)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_310)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_310)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_310)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_310)>::class_type, std::remove_const_t<decltype(lambda_310)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_310)>, volatile int * &(volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_310)>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_310), 0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_310), 1>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_310)>, type_list<volatile std::string * const &, const volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_310)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_310)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_310)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_310)> == callable_traits<decltype(lambda_310)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_310)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_310)>, std::remove_const_t<decltype(lambda_310)>>);
+[[maybe_unused]] const auto lambda_312 = [](volatile std::string * volatile &, const volatile std::string * volatile &) -> int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::signature_type, int * const &(volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::result_type, int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_312)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_312)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_312)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_312)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::arg0_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::arg_type<0>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::arg1_type, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::arg_type<1>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_312)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_312)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_312)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_312)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_312)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_312)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_312)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_312)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_312)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_312)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_312)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_312)>::class_type, std::remove_const_t<decltype(lambda_312)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_312)>, int * const &(volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_312)>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_312), 0>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_312), 1>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_312)>, type_list<volatile std::string * volatile &, const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_312)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_312)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_312)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_312)> == callable_traits<decltype(lambda_312)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_312)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_312)>, std::remove_const_t<decltype(lambda_312)>>);
+[[maybe_unused]] const auto lambda_314 = [](volatile std::string * const volatile &, const volatile std::string * const volatile &) noexcept -> volatile int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::signature_type, volatile int * const &(volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::result_type, volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_314)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_314)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_314)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_314)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::arg0_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::arg_type<0>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::arg1_type, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::arg_type<1>, const volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_314)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_314)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_314)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_314)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_314)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_314)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_314)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_314)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_314)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_314)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_314)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_314)>::class_type, std::remove_const_t<decltype(lambda_314)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_314)>, volatile int * const &(volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_314)>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_314), 0>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_314), 1>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_314)>, type_list<volatile std::string * const volatile &, const volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_314)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_314)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_314)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_314)> == callable_traits<decltype(lambda_314)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_314)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_314)>, std::remove_const_t<decltype(lambda_314)>>);
+[[maybe_unused]] const auto lambda_316 = [](volatile std::string &&, const volatile std::string &&) -> int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::signature_type, int * volatile &(volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::result_type, int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_316)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_316)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_316)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_316)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::arg0_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::arg_type<0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::arg1_type, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::arg_type<1>, const volatile std::string &&>);
+static_assert(callable_traits<decltype(lambda_316)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_316)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_316)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_316)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_316)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_316)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_316)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_316)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_316)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_316)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_316)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_316)>::class_type, std::remove_const_t<decltype(lambda_316)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_316)>, int * volatile &(volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_316)>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_316), 0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_316), 1>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_316)>, type_list<volatile std::string &&, const volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_316)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_316)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_316)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_316)> == callable_traits<decltype(lambda_316)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_316)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_316)>, std::remove_const_t<decltype(lambda_316)>>);
+[[maybe_unused]] const auto lambda_318 = [](volatile std::string * &&, const volatile std::string * &&) noexcept -> volatile int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::signature_type, volatile int * volatile &(volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::result_type, volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_318)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_318)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_318)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_318)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::arg0_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::arg_type<0>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::arg1_type, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::arg_type<1>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(lambda_318)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_318)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_318)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_318)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_318)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_318)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_318)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_318)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_318)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_318)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_318)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_318)>::class_type, std::remove_const_t<decltype(lambda_318)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_318)>, volatile int * volatile &(volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_318)>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_318), 0>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_318), 1>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_318)>, type_list<volatile std::string * &&, const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_318)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_318)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_318)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_318)> == callable_traits<decltype(lambda_318)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_318)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_318)>, std::remove_const_t<decltype(lambda_318)>>);
+[[maybe_unused]] const auto lambda_320 = [](volatile std::string * const &&, const volatile std::string * const &&) -> int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::signature_type, int * const volatile &(volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::result_type, int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_320)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_320)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_320)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_320)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::arg0_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::arg_type<0>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::arg1_type, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::arg_type<1>, const volatile std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_320)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_320)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_320)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_320)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_320)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_320)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_320)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_320)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_320)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_320)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_320)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_320)>::class_type, std::remove_const_t<decltype(lambda_320)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_320)>, int * const volatile &(volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_320)>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_320), 0>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_320), 1>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_320)>, type_list<volatile std::string * const &&, const volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_320)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_320)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_320)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_320)> == callable_traits<decltype(lambda_320)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_320)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_320)>, std::remove_const_t<decltype(lambda_320)>>);
+[[maybe_unused]] const auto lambda_322 = [](volatile std::string * volatile &&, const volatile std::string * volatile &&) noexcept -> volatile int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::signature_type, volatile int * const volatile &(volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::result_type, volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_322)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_322)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_322)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_322)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::arg0_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::arg_type<0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::arg1_type, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::arg_type<1>, const volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_322)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_322)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_322)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_322)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_322)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_322)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_322)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_322)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_322)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_322)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_322)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_322)>::class_type, std::remove_const_t<decltype(lambda_322)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_322)>, volatile int * const volatile &(volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_322)>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_322), 0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_322), 1>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_322)>, type_list<volatile std::string * volatile &&, const volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_322)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_322)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_322)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_322)> == callable_traits<decltype(lambda_322)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_322)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_322)>, std::remove_const_t<decltype(lambda_322)>>);
+[[maybe_unused]] const auto lambda_324 = [](volatile std::string * const volatile &&, const volatile std::string * const volatile &&) -> int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::signature_type, int &&(volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::result_type, int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_324)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_324)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_324)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_324)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::arg0_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::arg_type<0>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::arg1_type, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::arg_type<1>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_324)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_324)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_324)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_324)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_324)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_324)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_324)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_324)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_324)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_324)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_324)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_324)>::class_type, std::remove_const_t<decltype(lambda_324)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_324)>, int &&(volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_324)>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_324), 0>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_324), 1>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_324)>, type_list<volatile std::string * const volatile &&, const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_324)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_324)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_324)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_324)> == callable_traits<decltype(lambda_324)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_324)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_324)>, std::remove_const_t<decltype(lambda_324)>>);
+[[maybe_unused]] const auto lambda_326 = [](const volatile void *, void * &, const void * &) noexcept -> volatile int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::signature_type, volatile int &&(const volatile void *, void * &, const void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::result_type, volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_326)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_326)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_326)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_326)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::arg0_type, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::arg_type<0>, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::arg1_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::arg_type<1>, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::arg2_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::arg_type<2>, const void * &>);
+static_assert(callable_traits<decltype(lambda_326)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_326)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_326)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_326)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_326)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_326)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_326)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_326)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_326)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_326)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_326)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_326)>::class_type, std::remove_const_t<decltype(lambda_326)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_326)>, volatile int &&(const volatile void *, void * &, const void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_326)>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_326), 0>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_326), 1>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_326), 2>, const void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_326)>, type_list<const volatile void *, void * &, const void * &>>);
+static_assert(callable_arity_v<decltype(lambda_326)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_326)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_326)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_326)> == callable_traits<decltype(lambda_326)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_326)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_326)>, std::remove_const_t<decltype(lambda_326)>>);
+[[maybe_unused]] const auto lambda_328 = [](const void * const &, volatile void * const &, const volatile void * const &) -> int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::signature_type, int * &&(const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::result_type, int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_328)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_328)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_328)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_328)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::arg0_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::arg_type<0>, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::arg1_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::arg_type<1>, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::arg2_type, const volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::arg_type<2>, const volatile void * const &>);
+static_assert(callable_traits<decltype(lambda_328)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_328)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_328)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_328)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_328)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_328)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_328)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_328)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_328)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_328)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_328)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_328)>::class_type, std::remove_const_t<decltype(lambda_328)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_328)>, int * &&(const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_328)>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_328), 0>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_328), 1>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_328), 2>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_328)>, type_list<const void * const &, volatile void * const &, const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_328)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_328)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_328)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_328)> == callable_traits<decltype(lambda_328)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_328)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_328)>, std::remove_const_t<decltype(lambda_328)>>);
+[[maybe_unused]] const auto lambda_330 = [](const volatile void * volatile &, void * const volatile &, const void * const volatile &) noexcept -> volatile int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::signature_type, volatile int * &&(const volatile void * volatile &, void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::result_type, volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_330)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_330)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_330)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_330)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::arg0_type, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::arg_type<0>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::arg1_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::arg_type<1>, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::arg2_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::arg_type<2>, const void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_330)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_330)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_330)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_330)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_330)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_330)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_330)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_330)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_330)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_330)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_330)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_330)>::class_type, std::remove_const_t<decltype(lambda_330)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_330)>, volatile int * &&(const volatile void * volatile &, void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_330)>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_330), 0>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_330), 1>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_330), 2>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_330)>, type_list<const volatile void * volatile &, void * const volatile &, const void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_330)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_330)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_330)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_330)> == callable_traits<decltype(lambda_330)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_330)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_330)>, std::remove_const_t<decltype(lambda_330)>>);
+[[maybe_unused]] const auto lambda_332 = [](const void * &&, volatile void * &&, const volatile void * &&) -> int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::signature_type, int * const &&(const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::result_type, int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_332)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_332)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_332)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_332)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::arg0_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::arg_type<0>, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::arg1_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::arg_type<1>, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::arg2_type, const volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::arg_type<2>, const volatile void * &&>);
+static_assert(callable_traits<decltype(lambda_332)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_332)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_332)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_332)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_332)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_332)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_332)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_332)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_332)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_332)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_332)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_332)>::class_type, std::remove_const_t<decltype(lambda_332)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_332)>, int * const &&(const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_332)>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_332), 0>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_332), 1>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_332), 2>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_332)>, type_list<const void * &&, volatile void * &&, const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_332)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_332)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_332)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_332)> == callable_traits<decltype(lambda_332)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_332)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_332)>, std::remove_const_t<decltype(lambda_332)>>);
+[[maybe_unused]] const auto lambda_334 = [](const volatile void * const &&, void * volatile &&, const void * volatile &&) noexcept -> volatile int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::signature_type, volatile int * const &&(const volatile void * const &&, void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::result_type, volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_334)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_334)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_334)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_334)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::arg0_type, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::arg_type<0>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::arg1_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::arg_type<1>, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::arg2_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::arg_type<2>, const void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_334)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_334)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_334)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_334)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_334)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_334)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_334)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_334)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_334)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_334)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_334)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_334)>::class_type, std::remove_const_t<decltype(lambda_334)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_334)>, volatile int * const &&(const volatile void * const &&, void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_334)>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_334), 0>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_334), 1>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_334), 2>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_334)>, type_list<const volatile void * const &&, void * volatile &&, const void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_334)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_334)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_334)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_334)> == callable_traits<decltype(lambda_334)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_334)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_334)>, std::remove_const_t<decltype(lambda_334)>>);
+[[maybe_unused]] const auto lambda_336 = [](const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&) -> int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::signature_type, int * volatile &&(const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::result_type, int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_336)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_336)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_336)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_336)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::arg0_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::arg_type<0>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::arg1_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::arg_type<1>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::arg2_type, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::arg_type<2>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_336)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_336)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_336)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_336)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_336)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_336)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_336)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_336)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_336)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_336)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_336)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_336)>::class_type, std::remove_const_t<decltype(lambda_336)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_336)>, int * volatile &&(const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_336)>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_336), 0>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_336), 1>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_336), 2>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_336)>, type_list<const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_336)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_336)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_336)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_336)> == callable_traits<decltype(lambda_336)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_336)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_336)>, std::remove_const_t<decltype(lambda_336)>>);
+[[maybe_unused]] const auto lambda_338 = [](volatile bool *, const volatile bool *, bool &) noexcept -> volatile int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::signature_type, volatile int * volatile &&(volatile bool *, const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::result_type, volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_338)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_338)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_338)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_338)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::arg0_type, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::arg_type<0>, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::arg1_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::arg_type<1>, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::arg2_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::arg_type<2>, bool &>);
+static_assert(callable_traits<decltype(lambda_338)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_338)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_338)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_338)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_338)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_338)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_338)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_338)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_338)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_338)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_338)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_338)>::class_type, std::remove_const_t<decltype(lambda_338)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_338)>, volatile int * volatile &&(volatile bool *, const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_338)>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_338), 0>, volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_338), 1>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_338), 2>, bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_338)>, type_list<volatile bool *, const volatile bool *, bool &>>);
+static_assert(callable_arity_v<decltype(lambda_338)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_338)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_338)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_338)> == callable_traits<decltype(lambda_338)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_338)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_338)>, std::remove_const_t<decltype(lambda_338)>>);
+[[maybe_unused]] const auto lambda_340 = [](bool * &, const bool * &, volatile bool * &) -> int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::signature_type, int * const volatile &&(bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::result_type, int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_340)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_340)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_340)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_340)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::arg0_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::arg_type<0>, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::arg1_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::arg_type<1>, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::arg2_type, volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::arg_type<2>, volatile bool * &>);
+static_assert(callable_traits<decltype(lambda_340)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_340)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_340)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_340)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_340)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_340)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_340)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_340)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_340)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_340)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_340)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_340)>::class_type, std::remove_const_t<decltype(lambda_340)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_340)>, int * const volatile &&(bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_340)>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_340), 0>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_340), 1>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_340), 2>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_340)>, type_list<bool * &, const bool * &, volatile bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_340)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_340)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_340)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_340)> == callable_traits<decltype(lambda_340)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_340)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_340)>, std::remove_const_t<decltype(lambda_340)>>);
+[[maybe_unused]] const auto lambda_342 = [](volatile bool * const &, const volatile bool * const &, bool * volatile &) noexcept -> volatile int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::signature_type, volatile int * const volatile &&(volatile bool * const &, const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::result_type, volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_342)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_342)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_342)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_342)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::arg0_type, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::arg_type<0>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::arg1_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::arg_type<1>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::arg2_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::arg_type<2>, bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_342)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_342)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_342)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_342)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_342)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_342)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_342)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_342)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_342)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_342)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_342)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_342)>::class_type, std::remove_const_t<decltype(lambda_342)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_342)>, volatile int * const volatile &&(volatile bool * const &, const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_342)>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_342), 0>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_342), 1>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_342), 2>, bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_342)>, type_list<volatile bool * const &, const volatile bool * const &, bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_342)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_342)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_342)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_342)> == callable_traits<decltype(lambda_342)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_342)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_342)>, std::remove_const_t<decltype(lambda_342)>>);
+[[maybe_unused]] const auto lambda_344 = [](bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &) -> float {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::signature_type, float(bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::result_type, float>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_344)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_344)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_344)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_344)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::arg0_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::arg_type<0>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::arg1_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::arg_type<1>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::arg2_type, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::arg_type<2>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_344)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_344)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_344)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_344)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_344)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_344)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_344)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_344)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_344)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_344)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_344)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_344)>::class_type, std::remove_const_t<decltype(lambda_344)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_344)>, float(bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_344)>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_344), 0>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_344), 1>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_344), 2>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_344)>, type_list<bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_344)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_344)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_344)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_344)> == callable_traits<decltype(lambda_344)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_344)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_344)>, std::remove_const_t<decltype(lambda_344)>>);
+[[maybe_unused]] const auto lambda_346 = [](volatile bool &&, const volatile bool &&, bool * &&) noexcept -> const float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::signature_type, const float *(volatile bool &&, const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::result_type, const float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_346)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_346)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_346)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_346)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::arg0_type, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::arg_type<0>, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::arg1_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::arg_type<1>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::arg2_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::arg_type<2>, bool * &&>);
+static_assert(callable_traits<decltype(lambda_346)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_346)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_346)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_346)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_346)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_346)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_346)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_346)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_346)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_346)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_346)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_346)>::class_type, std::remove_const_t<decltype(lambda_346)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_346)>, const float *(volatile bool &&, const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_346)>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_346), 0>, volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_346), 1>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_346), 2>, bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_346)>, type_list<volatile bool &&, const volatile bool &&, bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_346)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_346)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_346)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_346)> == callable_traits<decltype(lambda_346)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_346)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_346)>, std::remove_const_t<decltype(lambda_346)>>);
+[[maybe_unused]] const auto lambda_348 = [](bool * const &&, const bool * const &&, volatile bool * const &&) -> const volatile float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::signature_type, const volatile float *(bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::result_type, const volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_348)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_348)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_348)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_348)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::arg0_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::arg_type<0>, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::arg1_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::arg_type<1>, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::arg2_type, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::arg_type<2>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(lambda_348)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_348)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_348)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_348)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_348)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_348)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_348)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_348)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_348)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_348)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_348)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_348)>::class_type, std::remove_const_t<decltype(lambda_348)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_348)>, const volatile float *(bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_348)>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_348), 0>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_348), 1>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_348), 2>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_348)>, type_list<bool * const &&, const bool * const &&, volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_348)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_348)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_348)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_348)> == callable_traits<decltype(lambda_348)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_348)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_348)>, std::remove_const_t<decltype(lambda_348)>>);
+[[maybe_unused]] const auto lambda_350 = [](volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&) noexcept -> const float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::signature_type, const float &(volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::result_type, const float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_350)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_350)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_350)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_350)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::arg0_type, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::arg_type<0>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::arg1_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::arg_type<1>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::arg2_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::arg_type<2>, bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_350)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_350)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_350)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_350)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_350)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_350)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_350)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_350)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_350)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_350)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_350)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_350)>::class_type, std::remove_const_t<decltype(lambda_350)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_350)>, const float &(volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_350)>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_350), 0>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_350), 1>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_350), 2>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_350)>, type_list<volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_350)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_350)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_350)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_350)> == callable_traits<decltype(lambda_350)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_350)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_350)>, std::remove_const_t<decltype(lambda_350)>>);
+[[maybe_unused]] const auto lambda_352 = [](int, int *, const int *) -> const volatile float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::signature_type, const volatile float &(int, int *, const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::result_type, const volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_352)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_352)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_352)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_352)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::arg0_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::arg_type<0>, int>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::arg1_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::arg_type<1>, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::arg2_type, const int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::arg_type<2>, const int *>);
+static_assert(callable_traits<decltype(lambda_352)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_352)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_352)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_352)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_352)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_352)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_352)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_352)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_352)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_352)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_352)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_352)>::class_type, std::remove_const_t<decltype(lambda_352)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_352)>, const volatile float &(int, int *, const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_352)>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_352), 0>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_352), 1>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_352), 2>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_352)>, type_list<int, int *, const int *>>);
+static_assert(callable_arity_v<decltype(lambda_352)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_352)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_352)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_352)> == callable_traits<decltype(lambda_352)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_352)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_352)>, std::remove_const_t<decltype(lambda_352)>>);
+[[maybe_unused]] const auto lambda_354 = [](const int &, volatile int &, const volatile int &) noexcept -> const float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::signature_type, const float * &(const int &, volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::result_type, const float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_354)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_354)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_354)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_354)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::arg0_type, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::arg_type<0>, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::arg1_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::arg_type<1>, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::arg2_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::arg_type<2>, const volatile int &>);
+static_assert(callable_traits<decltype(lambda_354)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_354)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_354)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_354)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_354)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_354)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_354)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_354)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_354)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_354)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_354)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_354)>::class_type, std::remove_const_t<decltype(lambda_354)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_354)>, const float * &(const int &, volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_354)>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_354), 0>, const int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_354), 1>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_354), 2>, const volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_354)>, type_list<const int &, volatile int &, const volatile int &>>);
+static_assert(callable_arity_v<decltype(lambda_354)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_354)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_354)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_354)> == callable_traits<decltype(lambda_354)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_354)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_354)>, std::remove_const_t<decltype(lambda_354)>>);
+[[maybe_unused]] const auto lambda_356 = [](const volatile int * &, int * const &, const int * const &) -> const volatile float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::signature_type, const volatile float * &(const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::result_type, const volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_356)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_356)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_356)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_356)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::arg0_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::arg_type<0>, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::arg1_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::arg_type<1>, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::arg2_type, const int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::arg_type<2>, const int * const &>);
+static_assert(callable_traits<decltype(lambda_356)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_356)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_356)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_356)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_356)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_356)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_356)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_356)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_356)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_356)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_356)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_356)>::class_type, std::remove_const_t<decltype(lambda_356)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_356)>, const volatile float * &(const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_356)>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_356), 0>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_356), 1>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_356), 2>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_356)>, type_list<const volatile int * &, int * const &, const int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_356)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_356)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_356)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_356)> == callable_traits<decltype(lambda_356)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_356)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_356)>, std::remove_const_t<decltype(lambda_356)>>);
+[[maybe_unused]] const auto lambda_358 = [](const int * volatile &, volatile int * volatile &, const volatile int * volatile &) noexcept -> const float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::signature_type, const float * const &(const int * volatile &, volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::result_type, const float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_358)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_358)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_358)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_358)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::arg0_type, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::arg_type<0>, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::arg1_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::arg_type<1>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::arg2_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::arg_type<2>, const volatile int * volatile &>);
+static_assert(callable_traits<decltype(lambda_358)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_358)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_358)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_358)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_358)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_358)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_358)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_358)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_358)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_358)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_358)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_358)>::class_type, std::remove_const_t<decltype(lambda_358)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_358)>, const float * const &(const int * volatile &, volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_358)>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_358), 0>, const int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_358), 1>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_358), 2>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_358)>, type_list<const int * volatile &, volatile int * volatile &, const volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_358)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_358)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_358)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_358)> == callable_traits<decltype(lambda_358)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_358)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_358)>, std::remove_const_t<decltype(lambda_358)>>);
+[[maybe_unused]] const auto lambda_360 = [](const volatile int * const volatile &, int &&, const int &&) -> const volatile float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::signature_type, const volatile float * const &(const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::result_type, const volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_360)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_360)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_360)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_360)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::arg0_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::arg_type<0>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::arg1_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::arg_type<1>, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::arg2_type, const int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::arg_type<2>, const int &&>);
+static_assert(callable_traits<decltype(lambda_360)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_360)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_360)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_360)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_360)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_360)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_360)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_360)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_360)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_360)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_360)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_360)>::class_type, std::remove_const_t<decltype(lambda_360)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_360)>, const volatile float * const &(const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_360)>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_360), 0>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_360), 1>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_360), 2>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_360)>, type_list<const volatile int * const volatile &, int &&, const int &&>>);
+static_assert(callable_arity_v<decltype(lambda_360)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_360)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_360)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_360)> == callable_traits<decltype(lambda_360)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_360)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_360)>, std::remove_const_t<decltype(lambda_360)>>);
+[[maybe_unused]] const auto lambda_362 = [](const int * &&, volatile int * &&, const volatile int * &&) noexcept -> const float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::signature_type, const float * volatile &(const int * &&, volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::result_type, const float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_362)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_362)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_362)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_362)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::arg0_type, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::arg_type<0>, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::arg1_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::arg_type<1>, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::arg2_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::arg_type<2>, const volatile int * &&>);
+static_assert(callable_traits<decltype(lambda_362)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_362)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_362)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_362)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_362)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_362)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_362)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_362)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_362)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_362)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_362)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_362)>::class_type, std::remove_const_t<decltype(lambda_362)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_362)>, const float * volatile &(const int * &&, volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_362)>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_362), 0>, const int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_362), 1>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_362), 2>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_362)>, type_list<const int * &&, volatile int * &&, const volatile int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_362)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_362)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_362)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_362)> == callable_traits<decltype(lambda_362)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_362)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_362)>, std::remove_const_t<decltype(lambda_362)>>);
+[[maybe_unused]] const auto lambda_364 = [](const volatile int * const &&, int * volatile &&, const int * volatile &&) -> const volatile float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::signature_type, const volatile float * volatile &(const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::result_type, const volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_364)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_364)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_364)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_364)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::arg0_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::arg_type<0>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::arg1_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::arg_type<1>, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::arg2_type, const int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::arg_type<2>, const int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_364)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_364)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_364)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_364)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_364)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_364)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_364)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_364)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_364)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_364)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_364)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_364)>::class_type, std::remove_const_t<decltype(lambda_364)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_364)>, const volatile float * volatile &(const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_364)>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_364), 0>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_364), 1>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_364), 2>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_364)>, type_list<const volatile int * const &&, int * volatile &&, const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_364)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_364)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_364)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_364)> == callable_traits<decltype(lambda_364)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_364)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_364)>, std::remove_const_t<decltype(lambda_364)>>);
+[[maybe_unused]] const auto lambda_366 = [](const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&) noexcept -> const float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::signature_type, const float * const volatile &(const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::result_type, const float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_366)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_366)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_366)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_366)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::arg0_type, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::arg_type<0>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::arg1_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::arg_type<1>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::arg2_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::arg_type<2>, const volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_366)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_366)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_366)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_366)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_366)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_366)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_366)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_366)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_366)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_366)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_366)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_366)>::class_type, std::remove_const_t<decltype(lambda_366)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_366)>, const float * const volatile &(const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_366)>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_366), 0>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_366), 1>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_366), 2>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_366)>, type_list<const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_366)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_366)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_366)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_366)> == callable_traits<decltype(lambda_366)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_366)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_366)>, std::remove_const_t<decltype(lambda_366)>>);
+[[maybe_unused]] const auto lambda_368 = [](volatile float *, const volatile float *, float &) -> const volatile float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::signature_type, const volatile float * const volatile &(volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::result_type, const volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_368)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_368)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_368)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_368)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::arg0_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::arg_type<0>, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::arg1_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::arg_type<1>, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::arg2_type, float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::arg_type<2>, float &>);
+static_assert(callable_traits<decltype(lambda_368)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_368)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_368)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_368)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_368)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_368)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_368)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_368)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_368)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_368)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_368)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_368)>::class_type, std::remove_const_t<decltype(lambda_368)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_368)>, const volatile float * const volatile &(volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_368)>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_368), 0>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_368), 1>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_368), 2>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_368)>, type_list<volatile float *, const volatile float *, float &>>);
+static_assert(callable_arity_v<decltype(lambda_368)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_368)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_368)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_368)> == callable_traits<decltype(lambda_368)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_368)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_368)>, std::remove_const_t<decltype(lambda_368)>>);
+[[maybe_unused]] const auto lambda_370 = [](float * &, const float * &, volatile float * &) noexcept -> const float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::signature_type, const float &&(float * &, const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::result_type, const float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_370)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_370)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_370)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_370)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::arg0_type, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::arg_type<0>, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::arg1_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::arg_type<1>, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::arg2_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::arg_type<2>, volatile float * &>);
+static_assert(callable_traits<decltype(lambda_370)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_370)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_370)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_370)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_370)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_370)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_370)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_370)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_370)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_370)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_370)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_370)>::class_type, std::remove_const_t<decltype(lambda_370)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_370)>, const float &&(float * &, const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_370)>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_370), 0>, float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_370), 1>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_370), 2>, volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_370)>, type_list<float * &, const float * &, volatile float * &>>);
+static_assert(callable_arity_v<decltype(lambda_370)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_370)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_370)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_370)> == callable_traits<decltype(lambda_370)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_370)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_370)>, std::remove_const_t<decltype(lambda_370)>>);
+[[maybe_unused]] const auto lambda_372 = [](volatile float * const &, const volatile float * const &, float * volatile &) -> const volatile float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::signature_type, const volatile float &&(volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::result_type, const volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_372)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_372)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_372)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_372)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::arg0_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::arg_type<0>, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::arg1_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::arg_type<1>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::arg2_type, float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::arg_type<2>, float * volatile &>);
+static_assert(callable_traits<decltype(lambda_372)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_372)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_372)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_372)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_372)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_372)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_372)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_372)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_372)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_372)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_372)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_372)>::class_type, std::remove_const_t<decltype(lambda_372)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_372)>, const volatile float &&(volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_372)>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_372), 0>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_372), 1>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_372), 2>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_372)>, type_list<volatile float * const &, const volatile float * const &, float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_372)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_372)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_372)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_372)> == callable_traits<decltype(lambda_372)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_372)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_372)>, std::remove_const_t<decltype(lambda_372)>>);
+[[maybe_unused]] const auto lambda_374 = [](float * const volatile &, const float * const volatile &, volatile float * const volatile &) noexcept -> const float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::signature_type, const float * &&(float * const volatile &, const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::result_type, const float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_374)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_374)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_374)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_374)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::arg0_type, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::arg_type<0>, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::arg1_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::arg_type<1>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::arg2_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::arg_type<2>, volatile float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_374)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_374)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_374)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_374)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_374)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_374)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_374)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_374)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_374)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_374)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_374)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_374)>::class_type, std::remove_const_t<decltype(lambda_374)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_374)>, const float * &&(float * const volatile &, const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_374)>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_374), 0>, float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_374), 1>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_374), 2>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_374)>, type_list<float * const volatile &, const float * const volatile &, volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_374)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_374)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_374)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_374)> == callable_traits<decltype(lambda_374)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_374)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_374)>, std::remove_const_t<decltype(lambda_374)>>);
+[[maybe_unused]] const auto lambda_376 = [](volatile float &&, const volatile float &&, float * &&) -> const volatile float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::signature_type, const volatile float * &&(volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::result_type, const volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_376)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_376)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_376)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_376)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::arg0_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::arg_type<0>, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::arg1_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::arg_type<1>, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::arg2_type, float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::arg_type<2>, float * &&>);
+static_assert(callable_traits<decltype(lambda_376)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_376)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_376)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_376)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_376)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_376)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_376)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_376)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_376)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_376)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_376)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_376)>::class_type, std::remove_const_t<decltype(lambda_376)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_376)>, const volatile float * &&(volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_376)>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_376), 0>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_376), 1>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_376), 2>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_376)>, type_list<volatile float &&, const volatile float &&, float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_376)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_376)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_376)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_376)> == callable_traits<decltype(lambda_376)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_376)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_376)>, std::remove_const_t<decltype(lambda_376)>>);
+[[maybe_unused]] const auto lambda_378 = [](float * const &&, const float * const &&, volatile float * const &&) noexcept -> const float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::signature_type, const float * const &&(float * const &&, const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::result_type, const float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_378)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_378)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_378)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_378)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::arg0_type, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::arg_type<0>, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::arg1_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::arg_type<1>, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::arg2_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::arg_type<2>, volatile float * const &&>);
+static_assert(callable_traits<decltype(lambda_378)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_378)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_378)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_378)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_378)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_378)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_378)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_378)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_378)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_378)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_378)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_378)>::class_type, std::remove_const_t<decltype(lambda_378)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_378)>, const float * const &&(float * const &&, const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_378)>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_378), 0>, float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_378), 1>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_378), 2>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_378)>, type_list<float * const &&, const float * const &&, volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_378)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_378)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_378)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_378)> == callable_traits<decltype(lambda_378)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_378)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_378)>, std::remove_const_t<decltype(lambda_378)>>);
+[[maybe_unused]] const auto lambda_380 = [](volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&) -> const volatile float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::signature_type, const volatile float * const &&(volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::result_type, const volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_380)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_380)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_380)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_380)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::arg0_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::arg_type<0>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::arg1_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::arg_type<1>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::arg2_type, float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::arg_type<2>, float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_380)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_380)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_380)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_380)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_380)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_380)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_380)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_380)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_380)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_380)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_380)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_380)>::class_type, std::remove_const_t<decltype(lambda_380)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_380)>, const volatile float * const &&(volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_380)>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_380), 0>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_380), 1>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_380), 2>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_380)>, type_list<volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_380)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_380)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_380)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_380)> == callable_traits<decltype(lambda_380)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_380)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_380)>, std::remove_const_t<decltype(lambda_380)>>);
+[[maybe_unused]] const auto lambda_382 = [](std::string, std::string *, const std::string *) noexcept -> const float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::signature_type, const float * volatile &&(std::string, std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::result_type, const float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_382)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_382)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_382)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_382)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::arg0_type, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::arg_type<0>, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::arg1_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::arg_type<1>, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::arg2_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::arg_type<2>, const std::string *>);
+static_assert(callable_traits<decltype(lambda_382)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_382)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_382)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_382)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_382)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_382)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_382)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_382)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_382)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_382)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_382)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_382)>::class_type, std::remove_const_t<decltype(lambda_382)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_382)>, const float * volatile &&(std::string, std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_382)>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_382), 0>, std::string>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_382), 1>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_382), 2>, const std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_382)>, type_list<std::string, std::string *, const std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_382)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_382)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_382)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_382)> == callable_traits<decltype(lambda_382)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_382)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_382)>, std::remove_const_t<decltype(lambda_382)>>);
+[[maybe_unused]] const auto lambda_384 = [](const std::string &, volatile std::string &, const volatile std::string &) -> const volatile float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::signature_type, const volatile float * volatile &&(const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::result_type, const volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_384)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_384)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_384)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_384)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::arg0_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::arg_type<0>, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::arg1_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::arg_type<1>, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::arg2_type, const volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::arg_type<2>, const volatile std::string &>);
+static_assert(callable_traits<decltype(lambda_384)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_384)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_384)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_384)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_384)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_384)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_384)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_384)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_384)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_384)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_384)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_384)>::class_type, std::remove_const_t<decltype(lambda_384)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_384)>, const volatile float * volatile &&(const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_384)>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_384), 0>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_384), 1>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_384), 2>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_384)>, type_list<const std::string &, volatile std::string &, const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_384)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_384)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_384)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_384)> == callable_traits<decltype(lambda_384)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_384)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_384)>, std::remove_const_t<decltype(lambda_384)>>);
+[[maybe_unused]] const auto lambda_386 = [](const volatile std::string * &, std::string * const &, const std::string * const &) noexcept -> const float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::signature_type, const float * const volatile &&(const volatile std::string * &, std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::result_type, const float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_386)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_386)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_386)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_386)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::arg0_type, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::arg_type<0>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::arg1_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::arg_type<1>, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::arg2_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::arg_type<2>, const std::string * const &>);
+static_assert(callable_traits<decltype(lambda_386)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_386)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_386)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_386)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_386)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_386)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_386)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_386)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_386)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_386)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_386)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_386)>::class_type, std::remove_const_t<decltype(lambda_386)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_386)>, const float * const volatile &&(const volatile std::string * &, std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_386)>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_386), 0>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_386), 1>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_386), 2>, const std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_386)>, type_list<const volatile std::string * &, std::string * const &, const std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_386)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_386)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_386)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_386)> == callable_traits<decltype(lambda_386)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_386)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_386)>, std::remove_const_t<decltype(lambda_386)>>);
+[[maybe_unused]] const auto lambda_388 = [](const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &) -> const volatile float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::signature_type, const volatile float * const volatile &&(const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::result_type, const volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_388)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_388)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_388)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_388)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::arg0_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::arg_type<0>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::arg1_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::arg_type<1>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::arg2_type, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::arg_type<2>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_388)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_388)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_388)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_388)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_388)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_388)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_388)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_388)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_388)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_388)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_388)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_388)>::class_type, std::remove_const_t<decltype(lambda_388)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_388)>, const volatile float * const volatile &&(const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_388)>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_388), 0>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_388), 1>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_388), 2>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_388)>, type_list<const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_388)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_388)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_388)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_388)> == callable_traits<decltype(lambda_388)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_388)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_388)>, std::remove_const_t<decltype(lambda_388)>>);
+[[maybe_unused]] const auto lambda_390 = [](const volatile std::string * const volatile &, std::string &&, const std::string &&) noexcept -> std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::signature_type, std::string *(const volatile std::string * const volatile &, std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::result_type, std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_390)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_390)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_390)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_390)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::arg0_type, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::arg_type<0>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::arg1_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::arg_type<1>, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::arg2_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::arg_type<2>, const std::string &&>);
+static_assert(callable_traits<decltype(lambda_390)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_390)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_390)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_390)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_390)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_390)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_390)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_390)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_390)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_390)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_390)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_390)>::class_type, std::remove_const_t<decltype(lambda_390)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_390)>, std::string *(const volatile std::string * const volatile &, std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_390)>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_390), 0>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_390), 1>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_390), 2>, const std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_390)>, type_list<const volatile std::string * const volatile &, std::string &&, const std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_390)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_390)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_390)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_390)> == callable_traits<decltype(lambda_390)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_390)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_390)>, std::remove_const_t<decltype(lambda_390)>>);
+[[maybe_unused]] const auto lambda_392 = [](const std::string * &&, volatile std::string * &&, const volatile std::string * &&) -> volatile std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::signature_type, volatile std::string *(const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::result_type, volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_392)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_392)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_392)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_392)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::arg0_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::arg_type<0>, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::arg1_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::arg_type<1>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::arg2_type, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::arg_type<2>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(lambda_392)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_392)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_392)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_392)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_392)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_392)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_392)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_392)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_392)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_392)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_392)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_392)>::class_type, std::remove_const_t<decltype(lambda_392)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_392)>, volatile std::string *(const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_392)>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_392), 0>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_392), 1>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_392), 2>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_392)>, type_list<const std::string * &&, volatile std::string * &&, const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_392)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_392)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_392)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_392)> == callable_traits<decltype(lambda_392)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_392)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_392)>, std::remove_const_t<decltype(lambda_392)>>);
+[[maybe_unused]] const auto lambda_394 = [](const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&) noexcept -> std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::signature_type, std::string &(const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::result_type, std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_394)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_394)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_394)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_394)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::arg0_type, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::arg_type<0>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::arg1_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::arg_type<1>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::arg2_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::arg_type<2>, const std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_394)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_394)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_394)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_394)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_394)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_394)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_394)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_394)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_394)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_394)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_394)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_394)>::class_type, std::remove_const_t<decltype(lambda_394)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_394)>, std::string &(const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_394)>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_394), 0>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_394), 1>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_394), 2>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_394)>, type_list<const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_394)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_394)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_394)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_394)> == callable_traits<decltype(lambda_394)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_394)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_394)>, std::remove_const_t<decltype(lambda_394)>>);
+[[maybe_unused]] const auto lambda_396 = [](const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&) -> volatile std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::signature_type, volatile std::string &(const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::result_type, volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_396)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_396)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_396)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_396)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::arg0_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::arg_type<0>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::arg1_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::arg_type<1>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::arg2_type, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::arg_type<2>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_396)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_396)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_396)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_396)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_396)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_396)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_396)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_396)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_396)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_396)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_396)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_396)>::class_type, std::remove_const_t<decltype(lambda_396)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_396)>, volatile std::string &(const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_396)>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_396), 0>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_396), 1>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_396), 2>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_396)>, type_list<const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_396)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_396)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_396)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_396)> == callable_traits<decltype(lambda_396)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_396)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_396)>, std::remove_const_t<decltype(lambda_396)>>);
+[[maybe_unused]] const auto lambda_398 = [](void * &, const void * &, volatile void * &, const volatile void * &) noexcept -> std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::signature_type, std::string * &(void * &, const void * &, volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::result_type, std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_398)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_398)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_398)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_398)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg0_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg_type<0>, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg1_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg_type<1>, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg2_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg_type<2>, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::arg_type<3>, const volatile void * &>);
+static_assert(callable_traits<decltype(lambda_398)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_398)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_398)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_398)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_398)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_398)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_398)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_398)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_398)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_398)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_398)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_398)>::class_type, std::remove_const_t<decltype(lambda_398)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_398)>, std::string * &(void * &, const void * &, volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_398)>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_398), 0>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_398), 1>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_398), 2>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_398), 3>, const volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_398)>, type_list<void * &, const void * &, volatile void * &, const volatile void * &>>);
+static_assert(callable_arity_v<decltype(lambda_398)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_398)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_398)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_398)> == callable_traits<decltype(lambda_398)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_398)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_398)>, std::remove_const_t<decltype(lambda_398)>>);
+[[maybe_unused]] const auto lambda_400 = [](void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &) -> volatile std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::signature_type, volatile std::string * &(void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::result_type, volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_400)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_400)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_400)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_400)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg_type<0>, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg1_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg_type<1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg2_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg_type<2>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::arg_type<3>, const volatile void * volatile &>);
+static_assert(callable_traits<decltype(lambda_400)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_400)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_400)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_400)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_400)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_400)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_400)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_400)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_400)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_400)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_400)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_400)>::class_type, std::remove_const_t<decltype(lambda_400)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_400)>, volatile std::string * &(void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_400)>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_400), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_400), 1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_400), 2>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_400), 3>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_400)>, type_list<void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_400)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_400)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_400)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_400)> == callable_traits<decltype(lambda_400)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_400)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_400)>, std::remove_const_t<decltype(lambda_400)>>);
+[[maybe_unused]] const auto lambda_402 = [](void * &&, const void * &&, volatile void * &&, const volatile void * &&) noexcept -> std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::signature_type, std::string * const &(void * &&, const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::result_type, std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_402)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_402)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_402)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_402)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg0_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg_type<0>, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg1_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg_type<1>, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg2_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg_type<2>, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::arg_type<3>, const volatile void * &&>);
+static_assert(callable_traits<decltype(lambda_402)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_402)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_402)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_402)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_402)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_402)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_402)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_402)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_402)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_402)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_402)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_402)>::class_type, std::remove_const_t<decltype(lambda_402)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_402)>, std::string * const &(void * &&, const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_402)>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_402), 0>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_402), 1>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_402), 2>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_402), 3>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_402)>, type_list<void * &&, const void * &&, volatile void * &&, const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_402)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_402)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_402)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_402)> == callable_traits<decltype(lambda_402)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_402)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_402)>, std::remove_const_t<decltype(lambda_402)>>);
+[[maybe_unused]] const auto lambda_404 = [](void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&) -> volatile std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::signature_type, volatile std::string * const &(void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::result_type, volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_404)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_404)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_404)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_404)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg0_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg_type<0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg1_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg_type<1>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg2_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg_type<2>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::arg_type<3>, const volatile void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_404)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_404)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_404)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_404)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_404)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_404)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_404)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_404)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_404)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_404)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_404)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_404)>::class_type, std::remove_const_t<decltype(lambda_404)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_404)>, volatile std::string * const &(void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_404)>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_404), 0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_404), 1>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_404), 2>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_404), 3>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_404)>, type_list<void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_404)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_404)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_404)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_404)> == callable_traits<decltype(lambda_404)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_404)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_404)>, std::remove_const_t<decltype(lambda_404)>>);
+[[maybe_unused]] const auto lambda_406 = [](bool, bool *, const bool *, volatile bool *) noexcept -> std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::signature_type, std::string * volatile &(bool, bool *, const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::result_type, std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_406)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_406)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_406)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_406)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg_type<0>, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg1_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg_type<1>, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg2_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg_type<2>, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::arg_type<3>, volatile bool *>);
+static_assert(callable_traits<decltype(lambda_406)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_406)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_406)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_406)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_406)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_406)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_406)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_406)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_406)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_406)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_406)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_406)>::class_type, std::remove_const_t<decltype(lambda_406)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_406)>, std::string * volatile &(bool, bool *, const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_406)>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_406), 0>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_406), 1>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_406), 2>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_406), 3>, volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_406)>, type_list<bool, bool *, const bool *, volatile bool *>>);
+static_assert(callable_arity_v<decltype(lambda_406)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_406)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_406)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_406)> == callable_traits<decltype(lambda_406)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_406)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_406)>, std::remove_const_t<decltype(lambda_406)>>);
+[[maybe_unused]] const auto lambda_408 = [](const volatile bool &, bool * &, const bool * &, volatile bool * &) -> volatile std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::signature_type, volatile std::string * volatile &(const volatile bool &, bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::result_type, volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_408)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_408)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_408)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_408)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg0_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg_type<0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg1_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg_type<1>, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg2_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg_type<2>, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::arg_type<3>, volatile bool * &>);
+static_assert(callable_traits<decltype(lambda_408)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_408)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_408)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_408)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_408)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_408)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_408)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_408)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_408)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_408)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_408)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_408)>::class_type, std::remove_const_t<decltype(lambda_408)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_408)>, volatile std::string * volatile &(const volatile bool &, bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_408)>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_408), 0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_408), 1>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_408), 2>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_408), 3>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_408)>, type_list<const volatile bool &, bool * &, const bool * &, volatile bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_408)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_408)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_408)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_408)> == callable_traits<decltype(lambda_408)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_408)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_408)>, std::remove_const_t<decltype(lambda_408)>>);
+[[maybe_unused]] const auto lambda_410 = [](const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &) noexcept -> std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::signature_type, std::string * const volatile &(const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::result_type, std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_410)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_410)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_410)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_410)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg0_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg_type<0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg1_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg_type<1>, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg2_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg_type<2>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::arg_type<3>, volatile bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_410)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_410)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_410)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_410)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_410)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_410)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_410)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_410)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_410)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_410)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_410)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_410)>::class_type, std::remove_const_t<decltype(lambda_410)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_410)>, std::string * const volatile &(const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_410)>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_410), 0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_410), 1>, bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_410), 2>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_410), 3>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_410)>, type_list<const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_410)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_410)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_410)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_410)> == callable_traits<decltype(lambda_410)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_410)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_410)>, std::remove_const_t<decltype(lambda_410)>>);
+[[maybe_unused]] const auto lambda_412 = [](const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&) -> volatile std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::signature_type, volatile std::string * const volatile &(const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::result_type, volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_412)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_412)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_412)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_412)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg1_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg_type<1>, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg2_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg_type<2>, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::arg_type<3>, volatile bool &&>);
+static_assert(callable_traits<decltype(lambda_412)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_412)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_412)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_412)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_412)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_412)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_412)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_412)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_412)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_412)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_412)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_412)>::class_type, std::remove_const_t<decltype(lambda_412)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_412)>, volatile std::string * const volatile &(const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_412)>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_412), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_412), 1>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_412), 2>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_412), 3>, volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_412)>, type_list<const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_412)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_412)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_412)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_412)> == callable_traits<decltype(lambda_412)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_412)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_412)>, std::remove_const_t<decltype(lambda_412)>>);
+[[maybe_unused]] const auto lambda_414 = [](const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&) noexcept -> std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::signature_type, std::string &&(const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::result_type, std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_414)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_414)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_414)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_414)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg0_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg_type<0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg1_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg_type<1>, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg2_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg_type<2>, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::arg_type<3>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(lambda_414)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_414)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_414)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_414)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_414)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_414)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_414)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_414)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_414)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_414)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_414)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_414)>::class_type, std::remove_const_t<decltype(lambda_414)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_414)>, std::string &&(const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_414)>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_414), 0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_414), 1>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_414), 2>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_414), 3>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_414)>, type_list<const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_414)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_414)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_414)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_414)> == callable_traits<decltype(lambda_414)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_414)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_414)>, std::remove_const_t<decltype(lambda_414)>>);
+[[maybe_unused]] const auto lambda_416 = [](const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&) -> volatile std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::signature_type, volatile std::string &&(const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::result_type, volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_416)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_416)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_416)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_416)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg0_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg_type<0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg1_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg_type<1>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg2_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg_type<2>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::arg_type<3>, volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_416)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_416)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_416)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_416)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_416)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_416)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_416)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_416)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_416)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_416)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_416)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_416)>::class_type, std::remove_const_t<decltype(lambda_416)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_416)>, volatile std::string &&(const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_416)>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_416), 0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_416), 1>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_416), 2>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_416), 3>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_416)>, type_list<const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_416)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_416)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_416)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_416)> == callable_traits<decltype(lambda_416)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_416)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_416)>, std::remove_const_t<decltype(lambda_416)>>);
+[[maybe_unused]] const auto lambda_418 = [](volatile int *, const volatile int *, int &, const int &) noexcept -> std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::signature_type, std::string * &&(volatile int *, const volatile int *, int &, const int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::result_type, std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_418)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_418)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_418)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_418)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg_type<0>, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg1_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg_type<1>, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg2_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg_type<2>, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::arg_type<3>, const int &>);
+static_assert(callable_traits<decltype(lambda_418)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_418)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_418)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_418)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_418)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_418)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_418)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_418)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_418)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_418)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_418)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_418)>::class_type, std::remove_const_t<decltype(lambda_418)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_418)>, std::string * &&(volatile int *, const volatile int *, int &, const int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_418)>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_418), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_418), 1>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_418), 2>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_418), 3>, const int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_418)>, type_list<volatile int *, const volatile int *, int &, const int &>>);
+static_assert(callable_arity_v<decltype(lambda_418)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_418)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_418)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_418)> == callable_traits<decltype(lambda_418)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_418)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_418)>, std::remove_const_t<decltype(lambda_418)>>);
+[[maybe_unused]] const auto lambda_420 = [](volatile int * &, const volatile int * &, int * const &, const int * const &) -> volatile std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::signature_type, volatile std::string * &&(volatile int * &, const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::result_type, volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_420)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_420)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_420)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_420)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg0_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg_type<0>, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg1_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg_type<1>, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg2_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg_type<2>, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::arg_type<3>, const int * const &>);
+static_assert(callable_traits<decltype(lambda_420)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_420)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_420)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_420)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_420)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_420)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_420)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_420)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_420)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_420)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_420)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_420)>::class_type, std::remove_const_t<decltype(lambda_420)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_420)>, volatile std::string * &&(volatile int * &, const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_420)>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_420), 0>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_420), 1>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_420), 2>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_420), 3>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_420)>, type_list<volatile int * &, const volatile int * &, int * const &, const int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_420)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_420)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_420)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_420)> == callable_traits<decltype(lambda_420)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_420)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_420)>, std::remove_const_t<decltype(lambda_420)>>);
+[[maybe_unused]] const auto lambda_422 = [](volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &) noexcept -> std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::signature_type, std::string * const &&(volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::result_type, std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_422)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_422)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_422)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_422)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg0_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg_type<0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg1_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg_type<1>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg2_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg_type<2>, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::arg_type<3>, const int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_422)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_422)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_422)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_422)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_422)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_422)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_422)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_422)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_422)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_422)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_422)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_422)>::class_type, std::remove_const_t<decltype(lambda_422)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_422)>, std::string * const &&(volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_422)>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_422), 0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_422), 1>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_422), 2>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_422), 3>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_422)>, type_list<volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_422)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_422)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_422)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_422)> == callable_traits<decltype(lambda_422)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_422)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_422)>, std::remove_const_t<decltype(lambda_422)>>);
+[[maybe_unused]] const auto lambda_424 = [](volatile int &&, const volatile int &&, int * &&, const int * &&) -> volatile std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::signature_type, volatile std::string * const &&(volatile int &&, const volatile int &&, int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::result_type, volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_424)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_424)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_424)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_424)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg_type<0>, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg1_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg_type<1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg2_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg_type<2>, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::arg_type<3>, const int * &&>);
+static_assert(callable_traits<decltype(lambda_424)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_424)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_424)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_424)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_424)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_424)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_424)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_424)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_424)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_424)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_424)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_424)>::class_type, std::remove_const_t<decltype(lambda_424)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_424)>, volatile std::string * const &&(volatile int &&, const volatile int &&, int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_424)>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_424), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_424), 1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_424), 2>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_424), 3>, const int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_424)>, type_list<volatile int &&, const volatile int &&, int * &&, const int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_424)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_424)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_424)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_424)> == callable_traits<decltype(lambda_424)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_424)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_424)>, std::remove_const_t<decltype(lambda_424)>>);
+[[maybe_unused]] const auto lambda_426 = [](volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&) noexcept -> std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::signature_type, std::string * volatile &&(volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::result_type, std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_426)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_426)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_426)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_426)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg0_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg_type<0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg1_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg_type<1>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg2_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg_type<2>, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::arg_type<3>, const int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_426)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_426)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_426)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_426)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_426)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_426)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_426)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_426)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_426)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_426)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_426)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_426)>::class_type, std::remove_const_t<decltype(lambda_426)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_426)>, std::string * volatile &&(volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_426)>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_426), 0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_426), 1>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_426), 2>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_426), 3>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_426)>, type_list<volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_426)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_426)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_426)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_426)> == callable_traits<decltype(lambda_426)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_426)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_426)>, std::remove_const_t<decltype(lambda_426)>>);
+[[maybe_unused]] const auto lambda_428 = [](volatile int * const volatile &&, const volatile int * const volatile &&, float, float *) -> volatile std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::signature_type, volatile std::string * volatile &&(volatile int * const volatile &&, const volatile int * const volatile &&, float, float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::result_type, volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_428)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_428)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_428)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_428)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg0_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg_type<0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg1_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg_type<1>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg2_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg_type<2>, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::arg_type<3>, float *>);
+static_assert(callable_traits<decltype(lambda_428)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_428)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_428)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_428)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_428)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_428)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_428)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_428)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_428)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_428)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_428)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_428)>::class_type, std::remove_const_t<decltype(lambda_428)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_428)>, volatile std::string * volatile &&(volatile int * const volatile &&, const volatile int * const volatile &&, float, float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_428)>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_428), 0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_428), 1>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_428), 2>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_428), 3>, float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_428)>, type_list<volatile int * const volatile &&, const volatile int * const volatile &&, float, float *>>);
+static_assert(callable_arity_v<decltype(lambda_428)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_428)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_428)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_428)> == callable_traits<decltype(lambda_428)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_428)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_428)>, std::remove_const_t<decltype(lambda_428)>>);
+[[maybe_unused]] const auto lambda_430 = [](const float &, volatile float &, const volatile float &, float * &) noexcept -> std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::signature_type, std::string * const volatile &&(const float &, volatile float &, const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::result_type, std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_430)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_430)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_430)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_430)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg_type<0>, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg1_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg_type<1>, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg2_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg_type<2>, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::arg_type<3>, float * &>);
+static_assert(callable_traits<decltype(lambda_430)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_430)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_430)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_430)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_430)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_430)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_430)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_430)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_430)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_430)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_430)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_430)>::class_type, std::remove_const_t<decltype(lambda_430)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_430)>, std::string * const volatile &&(const float &, volatile float &, const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_430)>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_430), 0>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_430), 1>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_430), 2>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_430), 3>, float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_430)>, type_list<const float &, volatile float &, const volatile float &, float * &>>);
+static_assert(callable_arity_v<decltype(lambda_430)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_430)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_430)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_430)> == callable_traits<decltype(lambda_430)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_430)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_430)>, std::remove_const_t<decltype(lambda_430)>>);
+[[maybe_unused]] const auto lambda_432 = [](const float * const &, volatile float * const &, const volatile float * const &, float * volatile &) -> volatile std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::signature_type, volatile std::string * const volatile &&(const float * const &, volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::result_type, volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_432)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_432)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_432)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_432)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg0_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg_type<0>, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg1_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg_type<1>, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg2_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg_type<2>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::arg_type<3>, float * volatile &>);
+static_assert(callable_traits<decltype(lambda_432)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_432)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_432)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_432)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_432)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_432)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_432)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_432)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_432)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_432)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_432)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_432)>::class_type, std::remove_const_t<decltype(lambda_432)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_432)>, volatile std::string * const volatile &&(const float * const &, volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_432)>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_432), 0>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_432), 1>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_432), 2>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_432), 3>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_432)>, type_list<const float * const &, volatile float * const &, const volatile float * const &, float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_432)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_432)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_432)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_432)> == callable_traits<decltype(lambda_432)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_432)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_432)>, std::remove_const_t<decltype(lambda_432)>>);
+[[maybe_unused]] const auto lambda_434 = [](const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&) noexcept -> void {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::signature_type, void(const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::result_type, void>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_434)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_434)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_434)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_434)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg0_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg_type<0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg1_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg_type<1>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg2_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg_type<2>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::arg_type<3>, float &&>);
+static_assert(callable_traits<decltype(lambda_434)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_434)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_434)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_434)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_434)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_434)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_434)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_434)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_434)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_434)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_434)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_434)>::class_type, std::remove_const_t<decltype(lambda_434)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_434)>, void(const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_434)>, void>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_434), 0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_434), 1>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_434), 2>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_434), 3>, float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_434)>, type_list<const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&>>);
+static_assert(callable_arity_v<decltype(lambda_434)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_434)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_434)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_434)> == callable_traits<decltype(lambda_434)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_434)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_434)>, std::remove_const_t<decltype(lambda_434)>>);
+[[maybe_unused]] const auto lambda_436 = [](const float * &&, volatile float * &&, const volatile float * &&, float * const &&) -> const void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::signature_type, const void *(const float * &&, volatile float * &&, const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::result_type, const void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_436)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_436)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_436)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_436)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg_type<0>, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg1_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg_type<1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg2_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg_type<2>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::arg_type<3>, float * const &&>);
+static_assert(callable_traits<decltype(lambda_436)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_436)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_436)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_436)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_436)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_436)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_436)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_436)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_436)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_436)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_436)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_436)>::class_type, std::remove_const_t<decltype(lambda_436)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_436)>, const void *(const float * &&, volatile float * &&, const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_436)>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_436), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_436), 1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_436), 2>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_436), 3>, float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_436)>, type_list<const float * &&, volatile float * &&, const volatile float * &&, float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_436)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_436)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_436)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_436)> == callable_traits<decltype(lambda_436)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_436)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_436)>, std::remove_const_t<decltype(lambda_436)>>);
+[[maybe_unused]] const auto lambda_438 = [](const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&) noexcept -> const volatile void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::signature_type, const volatile void *(const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::result_type, const volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_438)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_438)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_438)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_438)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg0_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg_type<0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg1_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg_type<1>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg2_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg_type<2>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::arg_type<3>, float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_438)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_438)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_438)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_438)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_438)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_438)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_438)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_438)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_438)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_438)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_438)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_438)>::class_type, std::remove_const_t<decltype(lambda_438)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_438)>, const volatile void *(const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_438)>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_438), 0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_438), 1>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_438), 2>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_438), 3>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_438)>, type_list<const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_438)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_438)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_438)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_438)> == callable_traits<decltype(lambda_438)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_438)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_438)>, std::remove_const_t<decltype(lambda_438)>>);
+[[maybe_unused]] const auto lambda_440 = [](std::string *, const std::string *, volatile std::string *, const volatile std::string *) -> const void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::signature_type, const void * &(std::string *, const std::string *, volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::result_type, const void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_440)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_440)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_440)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_440)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg0_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg_type<0>, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg1_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg_type<1>, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg2_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg_type<2>, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::arg_type<3>, const volatile std::string *>);
+static_assert(callable_traits<decltype(lambda_440)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_440)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_440)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_440)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_440)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_440)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_440)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_440)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_440)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_440)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_440)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_440)>::class_type, std::remove_const_t<decltype(lambda_440)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_440)>, const void * &(std::string *, const std::string *, volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_440)>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_440), 0>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_440), 1>, const std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_440), 2>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_440), 3>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_440)>, type_list<std::string *, const std::string *, volatile std::string *, const volatile std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_440)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_440)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_440)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_440)> == callable_traits<decltype(lambda_440)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_440)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_440)>, std::remove_const_t<decltype(lambda_440)>>);
+[[maybe_unused]] const auto lambda_442 = [](std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &) noexcept -> const volatile void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::signature_type, const volatile void * &(std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::result_type, const volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_442)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_442)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_442)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_442)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg_type<0>, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg1_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg_type<1>, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg2_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg_type<2>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::arg_type<3>, const volatile std::string * &>);
+static_assert(callable_traits<decltype(lambda_442)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_442)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_442)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_442)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_442)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_442)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_442)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_442)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_442)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_442)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_442)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_442)>::class_type, std::remove_const_t<decltype(lambda_442)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_442)>, const volatile void * &(std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_442)>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_442), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_442), 1>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_442), 2>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_442), 3>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_442)>, type_list<std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_442)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_442)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_442)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_442)> == callable_traits<decltype(lambda_442)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_442)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_442)>, std::remove_const_t<decltype(lambda_442)>>);
+[[maybe_unused]] const auto lambda_444 = [](std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &) -> const void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::signature_type, const void * const &(std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::result_type, const void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_444)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_444)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_444)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_444)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg0_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg_type<0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg1_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg_type<1>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg2_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg_type<2>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::arg_type<3>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_444)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_444)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_444)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_444)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_444)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_444)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_444)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_444)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_444)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_444)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_444)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_444)>::class_type, std::remove_const_t<decltype(lambda_444)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_444)>, const void * const &(std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_444)>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_444), 0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_444), 1>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_444), 2>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_444), 3>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_444)>, type_list<std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_444)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_444)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_444)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_444)> == callable_traits<decltype(lambda_444)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_444)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_444)>, std::remove_const_t<decltype(lambda_444)>>);
+[[maybe_unused]] const auto lambda_446 = [](std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&) noexcept -> const volatile void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::signature_type, const volatile void * const &(std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::result_type, const volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_446)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_446)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_446)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_446)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg0_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg_type<0>, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg1_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg_type<1>, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg2_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg_type<2>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::arg_type<3>, const volatile std::string &&>);
+static_assert(callable_traits<decltype(lambda_446)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_446)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_446)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_446)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_446)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_446)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_446)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_446)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_446)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_446)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_446)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_446)>::class_type, std::remove_const_t<decltype(lambda_446)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_446)>, const volatile void * const &(std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_446)>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_446), 0>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_446), 1>, const std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_446), 2>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_446), 3>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_446)>, type_list<std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_446)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_446)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_446)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_446)> == callable_traits<decltype(lambda_446)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_446)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_446)>, std::remove_const_t<decltype(lambda_446)>>);
+[[maybe_unused]] const auto lambda_448 = [](std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&) -> const void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::signature_type, const void * volatile &(std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::result_type, const void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_448)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_448)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_448)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_448)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg_type<0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg1_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg_type<1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg2_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg_type<2>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::arg_type<3>, const volatile std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_448)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_448)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_448)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_448)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_448)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_448)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_448)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_448)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_448)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_448)>::specifier_mask == (callable_specifier::is_const));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_448)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_448)>::class_type, std::remove_const_t<decltype(lambda_448)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_448)>, const void * volatile &(std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_448)>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_448), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_448), 1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_448), 2>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_448), 3>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_448)>, type_list<std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_448)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_448)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_448)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_448)> == callable_traits<decltype(lambda_448)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_448)> == (callable_specifier::is_const));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_448)>, std::remove_const_t<decltype(lambda_448)>>);
+[[maybe_unused]] const auto lambda_450 = [](std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&) noexcept -> const volatile void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::signature_type, const volatile void * volatile &(std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::result_type, const volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_450)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_450)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_450)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_450)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg0_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg_type<0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg1_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg_type<1>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg2_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg_type<2>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::arg_type<3>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_450)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_450)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_450)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_450)>::is_variadic == false);
+static_assert(callable_traits<decltype(lambda_450)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_450)>::is_const == true);
+static_assert(callable_traits<decltype(lambda_450)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_450)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_450)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_450)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_450)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_450)>::class_type, std::remove_const_t<decltype(lambda_450)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_450)>, const volatile void * volatile &(std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_450)>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_450), 0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_450), 1>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_450), 2>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_450), 3>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_450)>, type_list<std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_450)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_450)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_450)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_450)> == callable_traits<decltype(lambda_450)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_450)> == (callable_specifier::is_const | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_450)>, std::remove_const_t<decltype(lambda_450)>>);
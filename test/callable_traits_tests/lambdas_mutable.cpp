@@ -0,0 +1,7577 @@
+/* This file was auto-generated */
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "../../include/callable_traits.hpp"
+#include "../callable_traits_test_helper.hpp"
+
+[[maybe_unused]] const auto lambda_1 = [](void *, ...) mutable -> void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_1)>::signature_type, void *(void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_1)>::result_type, void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_1)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_1)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_1)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_1)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_1)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_1)>::arg_type<0>, void *>);
+static_assert(callable_traits<decltype(lambda_1)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_1)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_1)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_1)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_1)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_1)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_1)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_1)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_1)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_1)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_1)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_1)>::class_type, std::remove_const_t<decltype(lambda_1)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_1)>, void *(void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_1)>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_1), 0>, void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_1)>, type_list<void *>>);
+static_assert(callable_arity_v<decltype(lambda_1)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_1)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_1)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_1)> == callable_traits<decltype(lambda_1)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_1)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_1)>, std::remove_const_t<decltype(lambda_1)>>);
+[[maybe_unused]] const auto lambda_3 = [](volatile void *, ...) mutable noexcept -> volatile void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_3)>::signature_type, volatile void *(volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_3)>::result_type, volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_3)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_3)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_3)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_3)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_3)>::arg0_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_3)>::arg_type<0>, volatile void *>);
+static_assert(callable_traits<decltype(lambda_3)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_3)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_3)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_3)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_3)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_3)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_3)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_3)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_3)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_3)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_3)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_3)>::class_type, std::remove_const_t<decltype(lambda_3)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_3)>, volatile void *(volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_3)>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_3), 0>, volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_3)>, type_list<volatile void *>>);
+static_assert(callable_arity_v<decltype(lambda_3)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_3)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_3)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_3)> == callable_traits<decltype(lambda_3)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_3)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_3)>, std::remove_const_t<decltype(lambda_3)>>);
+[[maybe_unused]] const auto lambda_5 = [](void * &, ...) mutable -> void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_5)>::signature_type, void * &(void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_5)>::result_type, void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_5)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_5)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_5)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_5)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_5)>::arg0_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_5)>::arg_type<0>, void * &>);
+static_assert(callable_traits<decltype(lambda_5)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_5)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_5)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_5)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_5)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_5)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_5)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_5)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_5)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_5)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_5)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_5)>::class_type, std::remove_const_t<decltype(lambda_5)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_5)>, void * &(void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_5)>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_5), 0>, void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_5)>, type_list<void * &>>);
+static_assert(callable_arity_v<decltype(lambda_5)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_5)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_5)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_5)> == callable_traits<decltype(lambda_5)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_5)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_5)>, std::remove_const_t<decltype(lambda_5)>>);
+[[maybe_unused]] const auto lambda_7 = [](volatile void * &, ...) mutable noexcept -> volatile void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_7)>::signature_type, volatile void * &(volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_7)>::result_type, volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_7)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_7)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_7)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_7)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_7)>::arg0_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_7)>::arg_type<0>, volatile void * &>);
+static_assert(callable_traits<decltype(lambda_7)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_7)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_7)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_7)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_7)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_7)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_7)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_7)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_7)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_7)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_7)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_7)>::class_type, std::remove_const_t<decltype(lambda_7)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_7)>, volatile void * &(volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_7)>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_7), 0>, volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_7)>, type_list<volatile void * &>>);
+static_assert(callable_arity_v<decltype(lambda_7)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_7)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_7)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_7)> == callable_traits<decltype(lambda_7)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_7)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_7)>, std::remove_const_t<decltype(lambda_7)>>);
+[[maybe_unused]] const auto lambda_9 = [](void * const &, ...) mutable -> void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_9)>::signature_type, void * const &(void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_9)>::result_type, void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_9)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_9)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_9)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_9)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_9)>::arg0_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_9)>::arg_type<0>, void * const &>);
+static_assert(callable_traits<decltype(lambda_9)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_9)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_9)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_9)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_9)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_9)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_9)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_9)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_9)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_9)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_9)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_9)>::class_type, std::remove_const_t<decltype(lambda_9)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_9)>, void * const &(void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_9)>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_9), 0>, void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_9)>, type_list<void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_9)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_9)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_9)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_9)> == callable_traits<decltype(lambda_9)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_9)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_9)>, std::remove_const_t<decltype(lambda_9)>>);
+[[maybe_unused]] const auto lambda_11 = [](volatile void * const &, ...) mutable noexcept -> volatile void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_11)>::signature_type, volatile void * const &(volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_11)>::result_type, volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_11)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_11)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_11)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_11)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_11)>::arg0_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_11)>::arg_type<0>, volatile void * const &>);
+static_assert(callable_traits<decltype(lambda_11)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_11)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_11)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_11)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_11)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_11)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_11)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_11)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_11)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_11)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_11)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_11)>::class_type, std::remove_const_t<decltype(lambda_11)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_11)>, volatile void * const &(volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_11)>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_11), 0>, volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_11)>, type_list<volatile void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_11)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_11)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_11)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_11)> == callable_traits<decltype(lambda_11)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_11)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_11)>, std::remove_const_t<decltype(lambda_11)>>);
+[[maybe_unused]] const auto lambda_13 = [](void * volatile &, ...) mutable -> void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_13)>::signature_type, void * volatile &(void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_13)>::result_type, void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_13)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_13)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_13)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_13)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_13)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_13)>::arg_type<0>, void * volatile &>);
+static_assert(callable_traits<decltype(lambda_13)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_13)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_13)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_13)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_13)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_13)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_13)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_13)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_13)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_13)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_13)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_13)>::class_type, std::remove_const_t<decltype(lambda_13)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_13)>, void * volatile &(void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_13)>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_13), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_13)>, type_list<void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_13)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_13)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_13)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_13)> == callable_traits<decltype(lambda_13)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_13)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_13)>, std::remove_const_t<decltype(lambda_13)>>);
+[[maybe_unused]] const auto lambda_15 = [](volatile void * volatile &, ...) mutable noexcept -> volatile void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_15)>::signature_type, volatile void * volatile &(volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_15)>::result_type, volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_15)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_15)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_15)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_15)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_15)>::arg0_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_15)>::arg_type<0>, volatile void * volatile &>);
+static_assert(callable_traits<decltype(lambda_15)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_15)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_15)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_15)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_15)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_15)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_15)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_15)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_15)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_15)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_15)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_15)>::class_type, std::remove_const_t<decltype(lambda_15)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_15)>, volatile void * volatile &(volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_15)>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_15), 0>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_15)>, type_list<volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_15)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_15)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_15)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_15)> == callable_traits<decltype(lambda_15)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_15)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_15)>, std::remove_const_t<decltype(lambda_15)>>);
+[[maybe_unused]] const auto lambda_17 = [](void * const volatile &, ...) mutable -> void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_17)>::signature_type, void * const volatile &(void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_17)>::result_type, void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_17)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_17)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_17)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_17)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_17)>::arg0_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_17)>::arg_type<0>, void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_17)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_17)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_17)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_17)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_17)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_17)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_17)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_17)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_17)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_17)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_17)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_17)>::class_type, std::remove_const_t<decltype(lambda_17)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_17)>, void * const volatile &(void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_17)>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_17), 0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_17)>, type_list<void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_17)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_17)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_17)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_17)> == callable_traits<decltype(lambda_17)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_17)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_17)>, std::remove_const_t<decltype(lambda_17)>>);
+[[maybe_unused]] const auto lambda_19 = [](volatile void * const volatile &, ...) mutable noexcept -> volatile void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_19)>::signature_type, volatile void * const volatile &(volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_19)>::result_type, volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_19)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_19)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_19)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_19)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_19)>::arg0_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_19)>::arg_type<0>, volatile void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_19)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_19)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_19)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_19)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_19)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_19)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_19)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_19)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_19)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_19)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_19)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_19)>::class_type, std::remove_const_t<decltype(lambda_19)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_19)>, volatile void * const volatile &(volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_19)>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_19), 0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_19)>, type_list<volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_19)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_19)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_19)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_19)> == callable_traits<decltype(lambda_19)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_19)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_19)>, std::remove_const_t<decltype(lambda_19)>>);
+[[maybe_unused]] const auto lambda_21 = [](void * &&, ...) mutable -> void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_21)>::signature_type, void * &&(void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_21)>::result_type, void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_21)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_21)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_21)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_21)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_21)>::arg0_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_21)>::arg_type<0>, void * &&>);
+static_assert(callable_traits<decltype(lambda_21)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_21)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_21)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_21)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_21)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_21)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_21)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_21)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_21)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_21)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_21)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_21)>::class_type, std::remove_const_t<decltype(lambda_21)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_21)>, void * &&(void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_21)>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_21), 0>, void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_21)>, type_list<void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_21)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_21)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_21)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_21)> == callable_traits<decltype(lambda_21)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_21)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_21)>, std::remove_const_t<decltype(lambda_21)>>);
+[[maybe_unused]] const auto lambda_23 = [](volatile void * &&, ...) mutable noexcept -> volatile void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_23)>::signature_type, volatile void * &&(volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_23)>::result_type, volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_23)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_23)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_23)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_23)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_23)>::arg0_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_23)>::arg_type<0>, volatile void * &&>);
+static_assert(callable_traits<decltype(lambda_23)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_23)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_23)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_23)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_23)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_23)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_23)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_23)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_23)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_23)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_23)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_23)>::class_type, std::remove_const_t<decltype(lambda_23)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_23)>, volatile void * &&(volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_23)>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_23), 0>, volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_23)>, type_list<volatile void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_23)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_23)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_23)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_23)> == callable_traits<decltype(lambda_23)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_23)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_23)>, std::remove_const_t<decltype(lambda_23)>>);
+[[maybe_unused]] const auto lambda_25 = [](void * const &&, ...) mutable -> void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_25)>::signature_type, void * const &&(void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_25)>::result_type, void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_25)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_25)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_25)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_25)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_25)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_25)>::arg_type<0>, void * const &&>);
+static_assert(callable_traits<decltype(lambda_25)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_25)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_25)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_25)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_25)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_25)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_25)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_25)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_25)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_25)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_25)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_25)>::class_type, std::remove_const_t<decltype(lambda_25)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_25)>, void * const &&(void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_25)>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_25), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_25)>, type_list<void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_25)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_25)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_25)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_25)> == callable_traits<decltype(lambda_25)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_25)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_25)>, std::remove_const_t<decltype(lambda_25)>>);
+[[maybe_unused]] const auto lambda_27 = [](volatile void * const &&, ...) mutable noexcept -> volatile void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_27)>::signature_type, volatile void * const &&(volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_27)>::result_type, volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_27)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_27)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_27)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_27)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_27)>::arg0_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_27)>::arg_type<0>, volatile void * const &&>);
+static_assert(callable_traits<decltype(lambda_27)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_27)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_27)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_27)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_27)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_27)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_27)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_27)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_27)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_27)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_27)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_27)>::class_type, std::remove_const_t<decltype(lambda_27)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_27)>, volatile void * const &&(volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_27)>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_27), 0>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_27)>, type_list<volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_27)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_27)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_27)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_27)> == callable_traits<decltype(lambda_27)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_27)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_27)>, std::remove_const_t<decltype(lambda_27)>>);
+[[maybe_unused]] const auto lambda_29 = [](void * volatile &&, ...) mutable -> void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_29)>::signature_type, void * volatile &&(void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_29)>::result_type, void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_29)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_29)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_29)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_29)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_29)>::arg0_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_29)>::arg_type<0>, void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_29)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_29)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_29)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_29)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_29)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_29)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_29)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_29)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_29)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_29)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_29)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_29)>::class_type, std::remove_const_t<decltype(lambda_29)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_29)>, void * volatile &&(void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_29)>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_29), 0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_29)>, type_list<void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_29)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_29)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_29)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_29)> == callable_traits<decltype(lambda_29)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_29)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_29)>, std::remove_const_t<decltype(lambda_29)>>);
+[[maybe_unused]] const auto lambda_31 = [](volatile void * volatile &&, ...) mutable noexcept -> volatile void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_31)>::signature_type, volatile void * volatile &&(volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_31)>::result_type, volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_31)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_31)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_31)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_31)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_31)>::arg0_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_31)>::arg_type<0>, volatile void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_31)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_31)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_31)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_31)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_31)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_31)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_31)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_31)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_31)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_31)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_31)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_31)>::class_type, std::remove_const_t<decltype(lambda_31)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_31)>, volatile void * volatile &&(volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_31)>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_31), 0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_31)>, type_list<volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_31)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_31)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_31)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_31)> == callable_traits<decltype(lambda_31)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_31)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_31)>, std::remove_const_t<decltype(lambda_31)>>);
+[[maybe_unused]] const auto lambda_33 = [](void * const volatile &&, ...) mutable -> void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_33)>::signature_type, void * const volatile &&(void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_33)>::result_type, void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_33)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_33)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_33)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_33)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_33)>::arg0_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_33)>::arg_type<0>, void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_33)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_33)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_33)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_33)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_33)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_33)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_33)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_33)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_33)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_33)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_33)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_33)>::class_type, std::remove_const_t<decltype(lambda_33)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_33)>, void * const volatile &&(void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_33)>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_33), 0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_33)>, type_list<void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_33)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_33)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_33)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_33)> == callable_traits<decltype(lambda_33)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_33)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_33)>, std::remove_const_t<decltype(lambda_33)>>);
+[[maybe_unused]] const auto lambda_35 = [](volatile void * const volatile &&, ...) mutable noexcept -> volatile void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_35)>::signature_type, volatile void * const volatile &&(volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_35)>::result_type, volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_35)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_35)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_35)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_35)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_35)>::arg0_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_35)>::arg_type<0>, volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_35)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_35)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_35)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_35)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_35)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_35)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_35)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_35)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_35)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_35)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_35)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_35)>::class_type, std::remove_const_t<decltype(lambda_35)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_35)>, volatile void * const volatile &&(volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_35)>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_35), 0>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_35)>, type_list<volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_35)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_35)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_35)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_35)> == callable_traits<decltype(lambda_35)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_35)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_35)>, std::remove_const_t<decltype(lambda_35)>>);
+[[maybe_unused]] const auto lambda_37 = [](bool, ...) mutable -> bool {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_37)>::signature_type, bool(bool)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_37)>::result_type, bool>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_37)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_37)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_37)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_37)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_37)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_37)>::arg_type<0>, bool>);
+static_assert(callable_traits<decltype(lambda_37)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_37)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_37)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_37)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_37)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_37)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_37)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_37)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_37)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_37)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_37)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_37)>::class_type, std::remove_const_t<decltype(lambda_37)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_37)>, bool(bool)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_37)>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_37), 0>, bool>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_37)>, type_list<bool>>);
+static_assert(callable_arity_v<decltype(lambda_37)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_37)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_37)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_37)> == callable_traits<decltype(lambda_37)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_37)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_37)>, std::remove_const_t<decltype(lambda_37)>>);
+[[maybe_unused]] const auto lambda_39 = [](const bool *, ...) mutable noexcept -> const bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_39)>::signature_type, const bool *(const bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_39)>::result_type, const bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_39)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_39)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_39)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_39)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_39)>::arg0_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_39)>::arg_type<0>, const bool *>);
+static_assert(callable_traits<decltype(lambda_39)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_39)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_39)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_39)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_39)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_39)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_39)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_39)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_39)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_39)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_39)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_39)>::class_type, std::remove_const_t<decltype(lambda_39)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_39)>, const bool *(const bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_39)>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_39), 0>, const bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_39)>, type_list<const bool *>>);
+static_assert(callable_arity_v<decltype(lambda_39)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_39)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_39)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_39)> == callable_traits<decltype(lambda_39)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_39)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_39)>, std::remove_const_t<decltype(lambda_39)>>);
+[[maybe_unused]] const auto lambda_41 = [](const volatile bool *, ...) mutable -> const volatile bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_41)>::signature_type, const volatile bool *(const volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_41)>::result_type, const volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_41)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_41)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_41)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_41)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_41)>::arg0_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_41)>::arg_type<0>, const volatile bool *>);
+static_assert(callable_traits<decltype(lambda_41)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_41)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_41)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_41)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_41)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_41)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_41)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_41)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_41)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_41)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_41)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_41)>::class_type, std::remove_const_t<decltype(lambda_41)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_41)>, const volatile bool *(const volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_41)>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_41), 0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_41)>, type_list<const volatile bool *>>);
+static_assert(callable_arity_v<decltype(lambda_41)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_41)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_41)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_41)> == callable_traits<decltype(lambda_41)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_41)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_41)>, std::remove_const_t<decltype(lambda_41)>>);
+[[maybe_unused]] const auto lambda_43 = [](const bool &, ...) mutable noexcept -> const bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_43)>::signature_type, const bool &(const bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_43)>::result_type, const bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_43)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_43)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_43)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_43)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_43)>::arg0_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_43)>::arg_type<0>, const bool &>);
+static_assert(callable_traits<decltype(lambda_43)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_43)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_43)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_43)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_43)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_43)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_43)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_43)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_43)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_43)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_43)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_43)>::class_type, std::remove_const_t<decltype(lambda_43)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_43)>, const bool &(const bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_43)>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_43), 0>, const bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_43)>, type_list<const bool &>>);
+static_assert(callable_arity_v<decltype(lambda_43)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_43)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_43)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_43)> == callable_traits<decltype(lambda_43)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_43)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_43)>, std::remove_const_t<decltype(lambda_43)>>);
+[[maybe_unused]] const auto lambda_45 = [](const volatile bool &, ...) mutable -> const volatile bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_45)>::signature_type, const volatile bool &(const volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_45)>::result_type, const volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_45)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_45)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_45)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_45)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_45)>::arg0_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_45)>::arg_type<0>, const volatile bool &>);
+static_assert(callable_traits<decltype(lambda_45)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_45)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_45)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_45)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_45)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_45)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_45)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_45)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_45)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_45)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_45)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_45)>::class_type, std::remove_const_t<decltype(lambda_45)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_45)>, const volatile bool &(const volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_45)>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_45), 0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_45)>, type_list<const volatile bool &>>);
+static_assert(callable_arity_v<decltype(lambda_45)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_45)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_45)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_45)> == callable_traits<decltype(lambda_45)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_45)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_45)>, std::remove_const_t<decltype(lambda_45)>>);
+[[maybe_unused]] const auto lambda_47 = [](const bool * &, ...) mutable noexcept -> const bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_47)>::signature_type, const bool * &(const bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_47)>::result_type, const bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_47)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_47)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_47)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_47)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_47)>::arg0_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_47)>::arg_type<0>, const bool * &>);
+static_assert(callable_traits<decltype(lambda_47)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_47)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_47)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_47)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_47)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_47)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_47)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_47)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_47)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_47)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_47)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_47)>::class_type, std::remove_const_t<decltype(lambda_47)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_47)>, const bool * &(const bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_47)>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_47), 0>, const bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_47)>, type_list<const bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_47)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_47)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_47)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_47)> == callable_traits<decltype(lambda_47)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_47)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_47)>, std::remove_const_t<decltype(lambda_47)>>);
+[[maybe_unused]] const auto lambda_49 = [](const volatile bool * &, ...) mutable -> const volatile bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_49)>::signature_type, const volatile bool * &(const volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_49)>::result_type, const volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_49)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_49)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_49)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_49)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_49)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_49)>::arg_type<0>, const volatile bool * &>);
+static_assert(callable_traits<decltype(lambda_49)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_49)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_49)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_49)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_49)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_49)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_49)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_49)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_49)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_49)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_49)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_49)>::class_type, std::remove_const_t<decltype(lambda_49)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_49)>, const volatile bool * &(const volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_49)>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_49), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_49)>, type_list<const volatile bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_49)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_49)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_49)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_49)> == callable_traits<decltype(lambda_49)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_49)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_49)>, std::remove_const_t<decltype(lambda_49)>>);
+[[maybe_unused]] const auto lambda_51 = [](const bool * const &, ...) mutable noexcept -> const bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_51)>::signature_type, const bool * const &(const bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_51)>::result_type, const bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_51)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_51)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_51)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_51)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_51)>::arg0_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_51)>::arg_type<0>, const bool * const &>);
+static_assert(callable_traits<decltype(lambda_51)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_51)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_51)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_51)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_51)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_51)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_51)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_51)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_51)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_51)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_51)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_51)>::class_type, std::remove_const_t<decltype(lambda_51)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_51)>, const bool * const &(const bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_51)>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_51), 0>, const bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_51)>, type_list<const bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_51)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_51)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_51)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_51)> == callable_traits<decltype(lambda_51)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_51)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_51)>, std::remove_const_t<decltype(lambda_51)>>);
+[[maybe_unused]] const auto lambda_53 = [](const volatile bool * const &, ...) mutable -> const volatile bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_53)>::signature_type, const volatile bool * const &(const volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_53)>::result_type, const volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_53)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_53)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_53)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_53)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_53)>::arg0_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_53)>::arg_type<0>, const volatile bool * const &>);
+static_assert(callable_traits<decltype(lambda_53)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_53)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_53)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_53)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_53)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_53)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_53)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_53)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_53)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_53)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_53)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_53)>::class_type, std::remove_const_t<decltype(lambda_53)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_53)>, const volatile bool * const &(const volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_53)>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_53), 0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_53)>, type_list<const volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_53)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_53)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_53)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_53)> == callable_traits<decltype(lambda_53)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_53)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_53)>, std::remove_const_t<decltype(lambda_53)>>);
+[[maybe_unused]] const auto lambda_55 = [](const bool * volatile &, ...) mutable noexcept -> const bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_55)>::signature_type, const bool * volatile &(const bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_55)>::result_type, const bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_55)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_55)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_55)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_55)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_55)>::arg0_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_55)>::arg_type<0>, const bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_55)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_55)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_55)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_55)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_55)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_55)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_55)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_55)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_55)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_55)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_55)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_55)>::class_type, std::remove_const_t<decltype(lambda_55)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_55)>, const bool * volatile &(const bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_55)>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_55), 0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_55)>, type_list<const bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_55)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_55)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_55)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_55)> == callable_traits<decltype(lambda_55)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_55)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_55)>, std::remove_const_t<decltype(lambda_55)>>);
+[[maybe_unused]] const auto lambda_57 = [](const volatile bool * volatile &, ...) mutable -> const volatile bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_57)>::signature_type, const volatile bool * volatile &(const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_57)>::result_type, const volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_57)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_57)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_57)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_57)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_57)>::arg0_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_57)>::arg_type<0>, const volatile bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_57)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_57)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_57)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_57)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_57)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_57)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_57)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_57)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_57)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_57)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_57)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_57)>::class_type, std::remove_const_t<decltype(lambda_57)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_57)>, const volatile bool * volatile &(const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_57)>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_57), 0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_57)>, type_list<const volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_57)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_57)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_57)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_57)> == callable_traits<decltype(lambda_57)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_57)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_57)>, std::remove_const_t<decltype(lambda_57)>>);
+[[maybe_unused]] const auto lambda_59 = [](const bool * const volatile &, ...) mutable noexcept -> const bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_59)>::signature_type, const bool * const volatile &(const bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_59)>::result_type, const bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_59)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_59)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_59)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_59)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_59)>::arg0_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_59)>::arg_type<0>, const bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_59)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_59)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_59)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_59)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_59)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_59)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_59)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_59)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_59)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_59)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_59)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_59)>::class_type, std::remove_const_t<decltype(lambda_59)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_59)>, const bool * const volatile &(const bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_59)>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_59), 0>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_59)>, type_list<const bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_59)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_59)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_59)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_59)> == callable_traits<decltype(lambda_59)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_59)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_59)>, std::remove_const_t<decltype(lambda_59)>>);
+[[maybe_unused]] const auto lambda_61 = [](const volatile bool * const volatile &, ...) mutable -> const volatile bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_61)>::signature_type, const volatile bool * const volatile &(const volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_61)>::result_type, const volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_61)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_61)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_61)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_61)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_61)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_61)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_61)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_61)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_61)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_61)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_61)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_61)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_61)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_61)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_61)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_61)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_61)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_61)>::class_type, std::remove_const_t<decltype(lambda_61)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_61)>, const volatile bool * const volatile &(const volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_61)>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_61), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_61)>, type_list<const volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_61)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_61)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_61)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_61)> == callable_traits<decltype(lambda_61)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_61)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_61)>, std::remove_const_t<decltype(lambda_61)>>);
+[[maybe_unused]] const auto lambda_63 = [](const bool &&, ...) mutable noexcept -> const bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_63)>::signature_type, const bool &&(const bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_63)>::result_type, const bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_63)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_63)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_63)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_63)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_63)>::arg0_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_63)>::arg_type<0>, const bool &&>);
+static_assert(callable_traits<decltype(lambda_63)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_63)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_63)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_63)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_63)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_63)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_63)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_63)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_63)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_63)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_63)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_63)>::class_type, std::remove_const_t<decltype(lambda_63)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_63)>, const bool &&(const bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_63)>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_63), 0>, const bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_63)>, type_list<const bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_63)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_63)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_63)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_63)> == callable_traits<decltype(lambda_63)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_63)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_63)>, std::remove_const_t<decltype(lambda_63)>>);
+[[maybe_unused]] const auto lambda_65 = [](const volatile bool &&, ...) mutable -> const volatile bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_65)>::signature_type, const volatile bool &&(const volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_65)>::result_type, const volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_65)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_65)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_65)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_65)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_65)>::arg0_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_65)>::arg_type<0>, const volatile bool &&>);
+static_assert(callable_traits<decltype(lambda_65)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_65)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_65)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_65)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_65)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_65)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_65)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_65)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_65)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_65)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_65)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_65)>::class_type, std::remove_const_t<decltype(lambda_65)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_65)>, const volatile bool &&(const volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_65)>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_65), 0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_65)>, type_list<const volatile bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_65)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_65)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_65)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_65)> == callable_traits<decltype(lambda_65)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_65)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_65)>, std::remove_const_t<decltype(lambda_65)>>);
+[[maybe_unused]] const auto lambda_67 = [](const bool * &&, ...) mutable noexcept -> const bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_67)>::signature_type, const bool * &&(const bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_67)>::result_type, const bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_67)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_67)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_67)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_67)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_67)>::arg0_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_67)>::arg_type<0>, const bool * &&>);
+static_assert(callable_traits<decltype(lambda_67)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_67)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_67)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_67)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_67)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_67)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_67)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_67)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_67)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_67)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_67)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_67)>::class_type, std::remove_const_t<decltype(lambda_67)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_67)>, const bool * &&(const bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_67)>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_67), 0>, const bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_67)>, type_list<const bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_67)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_67)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_67)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_67)> == callable_traits<decltype(lambda_67)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_67)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_67)>, std::remove_const_t<decltype(lambda_67)>>);
+[[maybe_unused]] const auto lambda_69 = [](const volatile bool * &&, ...) mutable -> const volatile bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_69)>::signature_type, const volatile bool * &&(const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_69)>::result_type, const volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_69)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_69)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_69)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_69)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_69)>::arg0_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_69)>::arg_type<0>, const volatile bool * &&>);
+static_assert(callable_traits<decltype(lambda_69)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_69)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_69)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_69)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_69)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_69)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_69)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_69)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_69)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_69)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_69)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_69)>::class_type, std::remove_const_t<decltype(lambda_69)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_69)>, const volatile bool * &&(const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_69)>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_69), 0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_69)>, type_list<const volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_69)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_69)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_69)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_69)> == callable_traits<decltype(lambda_69)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_69)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_69)>, std::remove_const_t<decltype(lambda_69)>>);
+[[maybe_unused]] const auto lambda_71 = [](const bool * const &&, ...) mutable noexcept -> const bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_71)>::signature_type, const bool * const &&(const bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_71)>::result_type, const bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_71)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_71)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_71)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_71)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_71)>::arg0_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_71)>::arg_type<0>, const bool * const &&>);
+static_assert(callable_traits<decltype(lambda_71)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_71)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_71)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_71)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_71)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_71)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_71)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_71)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_71)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_71)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_71)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_71)>::class_type, std::remove_const_t<decltype(lambda_71)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_71)>, const bool * const &&(const bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_71)>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_71), 0>, const bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_71)>, type_list<const bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_71)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_71)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_71)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_71)> == callable_traits<decltype(lambda_71)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_71)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_71)>, std::remove_const_t<decltype(lambda_71)>>);
+[[maybe_unused]] const auto lambda_73 = [](const volatile bool * const &&, ...) mutable -> const volatile bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_73)>::signature_type, const volatile bool * const &&(const volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_73)>::result_type, const volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_73)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_73)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_73)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_73)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_73)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_73)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(callable_traits<decltype(lambda_73)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_73)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_73)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_73)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_73)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_73)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_73)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_73)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_73)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_73)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_73)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_73)>::class_type, std::remove_const_t<decltype(lambda_73)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_73)>, const volatile bool * const &&(const volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_73)>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_73), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_73)>, type_list<const volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_73)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_73)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_73)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_73)> == callable_traits<decltype(lambda_73)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_73)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_73)>, std::remove_const_t<decltype(lambda_73)>>);
+[[maybe_unused]] const auto lambda_75 = [](const bool * volatile &&, ...) mutable noexcept -> const bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_75)>::signature_type, const bool * volatile &&(const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_75)>::result_type, const bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_75)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_75)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_75)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_75)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_75)>::arg0_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_75)>::arg_type<0>, const bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_75)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_75)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_75)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_75)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_75)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_75)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_75)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_75)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_75)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_75)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_75)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_75)>::class_type, std::remove_const_t<decltype(lambda_75)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_75)>, const bool * volatile &&(const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_75)>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_75), 0>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_75)>, type_list<const bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_75)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_75)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_75)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_75)> == callable_traits<decltype(lambda_75)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_75)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_75)>, std::remove_const_t<decltype(lambda_75)>>);
+[[maybe_unused]] const auto lambda_77 = [](const volatile bool * volatile &&, ...) mutable -> const volatile bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_77)>::signature_type, const volatile bool * volatile &&(const volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_77)>::result_type, const volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_77)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_77)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_77)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_77)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_77)>::arg0_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_77)>::arg_type<0>, const volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_77)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_77)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_77)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_77)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_77)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_77)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_77)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_77)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_77)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_77)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_77)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_77)>::class_type, std::remove_const_t<decltype(lambda_77)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_77)>, const volatile bool * volatile &&(const volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_77)>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_77), 0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_77)>, type_list<const volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_77)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_77)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_77)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_77)> == callable_traits<decltype(lambda_77)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_77)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_77)>, std::remove_const_t<decltype(lambda_77)>>);
+[[maybe_unused]] const auto lambda_79 = [](const bool * const volatile &&, ...) mutable noexcept -> const bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_79)>::signature_type, const bool * const volatile &&(const bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_79)>::result_type, const bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_79)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_79)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_79)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_79)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_79)>::arg0_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_79)>::arg_type<0>, const bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_79)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_79)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_79)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_79)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_79)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_79)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_79)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_79)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_79)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_79)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_79)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_79)>::class_type, std::remove_const_t<decltype(lambda_79)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_79)>, const bool * const volatile &&(const bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_79)>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_79), 0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_79)>, type_list<const bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_79)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_79)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_79)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_79)> == callable_traits<decltype(lambda_79)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_79)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_79)>, std::remove_const_t<decltype(lambda_79)>>);
+[[maybe_unused]] const auto lambda_81 = [](const volatile bool * const volatile &&, ...) mutable -> const volatile bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_81)>::signature_type, const volatile bool * const volatile &&(const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_81)>::result_type, const volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_81)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_81)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_81)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_81)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_81)>::arg0_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_81)>::arg_type<0>, const volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_81)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_81)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_81)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_81)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_81)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_81)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_81)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_81)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_81)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_81)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_81)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_81)>::class_type, std::remove_const_t<decltype(lambda_81)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_81)>, const volatile bool * const volatile &&(const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_81)>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_81), 0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_81)>, type_list<const volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_81)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_81)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_81)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_81)> == callable_traits<decltype(lambda_81)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_81)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_81)>, std::remove_const_t<decltype(lambda_81)>>);
+[[maybe_unused]] const auto lambda_83 = [](int *, ...) mutable noexcept -> int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_83)>::signature_type, int *(int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_83)>::result_type, int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_83)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_83)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_83)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_83)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_83)>::arg0_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_83)>::arg_type<0>, int *>);
+static_assert(callable_traits<decltype(lambda_83)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_83)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_83)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_83)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_83)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_83)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_83)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_83)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_83)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_83)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_83)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_83)>::class_type, std::remove_const_t<decltype(lambda_83)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_83)>, int *(int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_83)>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_83), 0>, int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_83)>, type_list<int *>>);
+static_assert(callable_arity_v<decltype(lambda_83)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_83)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_83)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_83)> == callable_traits<decltype(lambda_83)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_83)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_83)>, std::remove_const_t<decltype(lambda_83)>>);
+[[maybe_unused]] const auto lambda_85 = [](volatile int *, ...) mutable -> volatile int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_85)>::signature_type, volatile int *(volatile int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_85)>::result_type, volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_85)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_85)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_85)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_85)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_85)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_85)>::arg_type<0>, volatile int *>);
+static_assert(callable_traits<decltype(lambda_85)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_85)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_85)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_85)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_85)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_85)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_85)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_85)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_85)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_85)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_85)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_85)>::class_type, std::remove_const_t<decltype(lambda_85)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_85)>, volatile int *(volatile int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_85)>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_85), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_85)>, type_list<volatile int *>>);
+static_assert(callable_arity_v<decltype(lambda_85)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_85)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_85)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_85)> == callable_traits<decltype(lambda_85)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_85)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_85)>, std::remove_const_t<decltype(lambda_85)>>);
+[[maybe_unused]] const auto lambda_87 = [](int &, ...) mutable noexcept -> int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_87)>::signature_type, int &(int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_87)>::result_type, int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_87)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_87)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_87)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_87)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_87)>::arg0_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_87)>::arg_type<0>, int &>);
+static_assert(callable_traits<decltype(lambda_87)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_87)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_87)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_87)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_87)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_87)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_87)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_87)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_87)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_87)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_87)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_87)>::class_type, std::remove_const_t<decltype(lambda_87)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_87)>, int &(int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_87)>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_87), 0>, int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_87)>, type_list<int &>>);
+static_assert(callable_arity_v<decltype(lambda_87)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_87)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_87)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_87)> == callable_traits<decltype(lambda_87)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_87)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_87)>, std::remove_const_t<decltype(lambda_87)>>);
+[[maybe_unused]] const auto lambda_89 = [](volatile int &, ...) mutable -> volatile int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_89)>::signature_type, volatile int &(volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_89)>::result_type, volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_89)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_89)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_89)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_89)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_89)>::arg0_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_89)>::arg_type<0>, volatile int &>);
+static_assert(callable_traits<decltype(lambda_89)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_89)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_89)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_89)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_89)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_89)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_89)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_89)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_89)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_89)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_89)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_89)>::class_type, std::remove_const_t<decltype(lambda_89)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_89)>, volatile int &(volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_89)>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_89), 0>, volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_89)>, type_list<volatile int &>>);
+static_assert(callable_arity_v<decltype(lambda_89)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_89)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_89)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_89)> == callable_traits<decltype(lambda_89)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_89)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_89)>, std::remove_const_t<decltype(lambda_89)>>);
+[[maybe_unused]] const auto lambda_91 = [](int * &, ...) mutable noexcept -> int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_91)>::signature_type, int * &(int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_91)>::result_type, int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_91)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_91)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_91)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_91)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_91)>::arg0_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_91)>::arg_type<0>, int * &>);
+static_assert(callable_traits<decltype(lambda_91)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_91)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_91)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_91)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_91)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_91)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_91)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_91)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_91)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_91)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_91)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_91)>::class_type, std::remove_const_t<decltype(lambda_91)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_91)>, int * &(int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_91)>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_91), 0>, int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_91)>, type_list<int * &>>);
+static_assert(callable_arity_v<decltype(lambda_91)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_91)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_91)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_91)> == callable_traits<decltype(lambda_91)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_91)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_91)>, std::remove_const_t<decltype(lambda_91)>>);
+[[maybe_unused]] const auto lambda_93 = [](volatile int * &, ...) mutable -> volatile int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_93)>::signature_type, volatile int * &(volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_93)>::result_type, volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_93)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_93)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_93)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_93)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_93)>::arg0_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_93)>::arg_type<0>, volatile int * &>);
+static_assert(callable_traits<decltype(lambda_93)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_93)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_93)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_93)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_93)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_93)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_93)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_93)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_93)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_93)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_93)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_93)>::class_type, std::remove_const_t<decltype(lambda_93)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_93)>, volatile int * &(volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_93)>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_93), 0>, volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_93)>, type_list<volatile int * &>>);
+static_assert(callable_arity_v<decltype(lambda_93)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_93)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_93)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_93)> == callable_traits<decltype(lambda_93)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_93)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_93)>, std::remove_const_t<decltype(lambda_93)>>);
+[[maybe_unused]] const auto lambda_95 = [](int * const &, ...) mutable noexcept -> int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_95)>::signature_type, int * const &(int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_95)>::result_type, int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_95)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_95)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_95)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_95)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_95)>::arg0_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_95)>::arg_type<0>, int * const &>);
+static_assert(callable_traits<decltype(lambda_95)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_95)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_95)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_95)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_95)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_95)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_95)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_95)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_95)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_95)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_95)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_95)>::class_type, std::remove_const_t<decltype(lambda_95)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_95)>, int * const &(int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_95)>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_95), 0>, int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_95)>, type_list<int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_95)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_95)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_95)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_95)> == callable_traits<decltype(lambda_95)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_95)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_95)>, std::remove_const_t<decltype(lambda_95)>>);
+[[maybe_unused]] const auto lambda_97 = [](volatile int * const &, ...) mutable -> volatile int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_97)>::signature_type, volatile int * const &(volatile int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_97)>::result_type, volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_97)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_97)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_97)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_97)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_97)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_97)>::arg_type<0>, volatile int * const &>);
+static_assert(callable_traits<decltype(lambda_97)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_97)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_97)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_97)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_97)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_97)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_97)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_97)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_97)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_97)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_97)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_97)>::class_type, std::remove_const_t<decltype(lambda_97)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_97)>, volatile int * const &(volatile int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_97)>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_97), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_97)>, type_list<volatile int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_97)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_97)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_97)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_97)> == callable_traits<decltype(lambda_97)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_97)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_97)>, std::remove_const_t<decltype(lambda_97)>>);
+[[maybe_unused]] const auto lambda_99 = [](int * volatile &, ...) mutable noexcept -> int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_99)>::signature_type, int * volatile &(int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_99)>::result_type, int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_99)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_99)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_99)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_99)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_99)>::arg0_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_99)>::arg_type<0>, int * volatile &>);
+static_assert(callable_traits<decltype(lambda_99)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_99)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_99)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_99)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_99)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_99)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_99)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_99)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_99)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_99)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_99)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_99)>::class_type, std::remove_const_t<decltype(lambda_99)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_99)>, int * volatile &(int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_99)>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_99), 0>, int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_99)>, type_list<int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_99)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_99)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_99)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_99)> == callable_traits<decltype(lambda_99)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_99)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_99)>, std::remove_const_t<decltype(lambda_99)>>);
+[[maybe_unused]] const auto lambda_101 = [](volatile int * volatile &, ...) mutable -> volatile int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_101)>::signature_type, volatile int * volatile &(volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_101)>::result_type, volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_101)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_101)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_101)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_101)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_101)>::arg0_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_101)>::arg_type<0>, volatile int * volatile &>);
+static_assert(callable_traits<decltype(lambda_101)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_101)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_101)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_101)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_101)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_101)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_101)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_101)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_101)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_101)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_101)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_101)>::class_type, std::remove_const_t<decltype(lambda_101)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_101)>, volatile int * volatile &(volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_101)>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_101), 0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_101)>, type_list<volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_101)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_101)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_101)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_101)> == callable_traits<decltype(lambda_101)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_101)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_101)>, std::remove_const_t<decltype(lambda_101)>>);
+[[maybe_unused]] const auto lambda_103 = [](int * const volatile &, ...) mutable noexcept -> int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_103)>::signature_type, int * const volatile &(int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_103)>::result_type, int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_103)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_103)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_103)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_103)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_103)>::arg0_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_103)>::arg_type<0>, int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_103)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_103)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_103)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_103)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_103)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_103)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_103)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_103)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_103)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_103)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_103)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_103)>::class_type, std::remove_const_t<decltype(lambda_103)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_103)>, int * const volatile &(int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_103)>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_103), 0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_103)>, type_list<int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_103)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_103)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_103)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_103)> == callable_traits<decltype(lambda_103)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_103)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_103)>, std::remove_const_t<decltype(lambda_103)>>);
+[[maybe_unused]] const auto lambda_105 = [](volatile int * const volatile &, ...) mutable -> volatile int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_105)>::signature_type, volatile int * const volatile &(volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_105)>::result_type, volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_105)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_105)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_105)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_105)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_105)>::arg0_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_105)>::arg_type<0>, volatile int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_105)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_105)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_105)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_105)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_105)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_105)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_105)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_105)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_105)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_105)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_105)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_105)>::class_type, std::remove_const_t<decltype(lambda_105)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_105)>, volatile int * const volatile &(volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_105)>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_105), 0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_105)>, type_list<volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_105)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_105)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_105)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_105)> == callable_traits<decltype(lambda_105)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_105)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_105)>, std::remove_const_t<decltype(lambda_105)>>);
+[[maybe_unused]] const auto lambda_107 = [](int &&, ...) mutable noexcept -> int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_107)>::signature_type, int &&(int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_107)>::result_type, int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_107)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_107)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_107)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_107)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_107)>::arg0_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_107)>::arg_type<0>, int &&>);
+static_assert(callable_traits<decltype(lambda_107)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_107)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_107)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_107)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_107)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_107)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_107)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_107)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_107)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_107)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_107)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_107)>::class_type, std::remove_const_t<decltype(lambda_107)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_107)>, int &&(int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_107)>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_107), 0>, int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_107)>, type_list<int &&>>);
+static_assert(callable_arity_v<decltype(lambda_107)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_107)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_107)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_107)> == callable_traits<decltype(lambda_107)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_107)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_107)>, std::remove_const_t<decltype(lambda_107)>>);
+[[maybe_unused]] const auto lambda_109 = [](volatile int &&, ...) mutable -> volatile int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_109)>::signature_type, volatile int &&(volatile int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_109)>::result_type, volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_109)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_109)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_109)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_109)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_109)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_109)>::arg_type<0>, volatile int &&>);
+static_assert(callable_traits<decltype(lambda_109)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_109)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_109)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_109)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_109)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_109)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_109)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_109)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_109)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_109)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_109)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_109)>::class_type, std::remove_const_t<decltype(lambda_109)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_109)>, volatile int &&(volatile int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_109)>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_109), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_109)>, type_list<volatile int &&>>);
+static_assert(callable_arity_v<decltype(lambda_109)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_109)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_109)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_109)> == callable_traits<decltype(lambda_109)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_109)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_109)>, std::remove_const_t<decltype(lambda_109)>>);
+[[maybe_unused]] const auto lambda_111 = [](int * &&, ...) mutable noexcept -> int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_111)>::signature_type, int * &&(int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_111)>::result_type, int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_111)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_111)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_111)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_111)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_111)>::arg0_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_111)>::arg_type<0>, int * &&>);
+static_assert(callable_traits<decltype(lambda_111)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_111)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_111)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_111)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_111)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_111)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_111)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_111)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_111)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_111)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_111)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_111)>::class_type, std::remove_const_t<decltype(lambda_111)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_111)>, int * &&(int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_111)>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_111), 0>, int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_111)>, type_list<int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_111)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_111)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_111)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_111)> == callable_traits<decltype(lambda_111)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_111)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_111)>, std::remove_const_t<decltype(lambda_111)>>);
+[[maybe_unused]] const auto lambda_113 = [](volatile int * &&, ...) mutable -> volatile int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_113)>::signature_type, volatile int * &&(volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_113)>::result_type, volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_113)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_113)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_113)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_113)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_113)>::arg0_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_113)>::arg_type<0>, volatile int * &&>);
+static_assert(callable_traits<decltype(lambda_113)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_113)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_113)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_113)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_113)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_113)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_113)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_113)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_113)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_113)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_113)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_113)>::class_type, std::remove_const_t<decltype(lambda_113)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_113)>, volatile int * &&(volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_113)>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_113), 0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_113)>, type_list<volatile int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_113)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_113)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_113)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_113)> == callable_traits<decltype(lambda_113)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_113)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_113)>, std::remove_const_t<decltype(lambda_113)>>);
+[[maybe_unused]] const auto lambda_115 = [](int * const &&, ...) mutable noexcept -> int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_115)>::signature_type, int * const &&(int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_115)>::result_type, int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_115)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_115)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_115)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_115)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_115)>::arg0_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_115)>::arg_type<0>, int * const &&>);
+static_assert(callable_traits<decltype(lambda_115)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_115)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_115)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_115)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_115)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_115)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_115)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_115)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_115)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_115)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_115)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_115)>::class_type, std::remove_const_t<decltype(lambda_115)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_115)>, int * const &&(int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_115)>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_115), 0>, int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_115)>, type_list<int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_115)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_115)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_115)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_115)> == callable_traits<decltype(lambda_115)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_115)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_115)>, std::remove_const_t<decltype(lambda_115)>>);
+[[maybe_unused]] const auto lambda_117 = [](volatile int * const &&, ...) mutable -> volatile int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_117)>::signature_type, volatile int * const &&(volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_117)>::result_type, volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_117)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_117)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_117)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_117)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_117)>::arg0_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_117)>::arg_type<0>, volatile int * const &&>);
+static_assert(callable_traits<decltype(lambda_117)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_117)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_117)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_117)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_117)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_117)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_117)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_117)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_117)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_117)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_117)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_117)>::class_type, std::remove_const_t<decltype(lambda_117)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_117)>, volatile int * const &&(volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_117)>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_117), 0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_117)>, type_list<volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_117)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_117)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_117)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_117)> == callable_traits<decltype(lambda_117)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_117)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_117)>, std::remove_const_t<decltype(lambda_117)>>);
+[[maybe_unused]] const auto lambda_119 = [](int * volatile &&, ...) mutable noexcept -> int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_119)>::signature_type, int * volatile &&(int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_119)>::result_type, int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_119)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_119)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_119)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_119)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_119)>::arg0_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_119)>::arg_type<0>, int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_119)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_119)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_119)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_119)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_119)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_119)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_119)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_119)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_119)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_119)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_119)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_119)>::class_type, std::remove_const_t<decltype(lambda_119)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_119)>, int * volatile &&(int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_119)>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_119), 0>, int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_119)>, type_list<int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_119)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_119)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_119)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_119)> == callable_traits<decltype(lambda_119)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_119)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_119)>, std::remove_const_t<decltype(lambda_119)>>);
+[[maybe_unused]] const auto lambda_121 = [](volatile int * volatile &&, ...) mutable -> volatile int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_121)>::signature_type, volatile int * volatile &&(volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_121)>::result_type, volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_121)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_121)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_121)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_121)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_121)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_121)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_121)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_121)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_121)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_121)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_121)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_121)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_121)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_121)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_121)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_121)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_121)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_121)>::class_type, std::remove_const_t<decltype(lambda_121)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_121)>, volatile int * volatile &&(volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_121)>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_121), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_121)>, type_list<volatile int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_121)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_121)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_121)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_121)> == callable_traits<decltype(lambda_121)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_121)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_121)>, std::remove_const_t<decltype(lambda_121)>>);
+[[maybe_unused]] const auto lambda_123 = [](int * const volatile &&, ...) mutable noexcept -> int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_123)>::signature_type, int * const volatile &&(int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_123)>::result_type, int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_123)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_123)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_123)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_123)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_123)>::arg0_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_123)>::arg_type<0>, int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_123)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_123)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_123)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_123)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_123)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_123)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_123)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_123)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_123)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_123)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_123)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_123)>::class_type, std::remove_const_t<decltype(lambda_123)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_123)>, int * const volatile &&(int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_123)>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_123), 0>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_123)>, type_list<int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_123)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_123)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_123)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_123)> == callable_traits<decltype(lambda_123)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_123)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_123)>, std::remove_const_t<decltype(lambda_123)>>);
+[[maybe_unused]] const auto lambda_125 = [](volatile int * const volatile &&, ...) mutable -> volatile int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_125)>::signature_type, volatile int * const volatile &&(volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_125)>::result_type, volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_125)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_125)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_125)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_125)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_125)>::arg0_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_125)>::arg_type<0>, volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_125)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_125)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_125)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_125)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_125)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_125)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_125)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_125)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_125)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_125)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_125)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_125)>::class_type, std::remove_const_t<decltype(lambda_125)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_125)>, volatile int * const volatile &&(volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_125)>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_125), 0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_125)>, type_list<volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_125)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_125)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_125)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_125)> == callable_traits<decltype(lambda_125)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_125)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_125)>, std::remove_const_t<decltype(lambda_125)>>);
+[[maybe_unused]] const auto lambda_127 = [](float, ...) mutable noexcept -> float {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_127)>::signature_type, float(float)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_127)>::result_type, float>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_127)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_127)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_127)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_127)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_127)>::arg0_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_127)>::arg_type<0>, float>);
+static_assert(callable_traits<decltype(lambda_127)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_127)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_127)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_127)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_127)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_127)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_127)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_127)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_127)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_127)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_127)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_127)>::class_type, std::remove_const_t<decltype(lambda_127)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_127)>, float(float)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_127)>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_127), 0>, float>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_127)>, type_list<float>>);
+static_assert(callable_arity_v<decltype(lambda_127)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_127)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_127)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_127)> == callable_traits<decltype(lambda_127)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_127)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_127)>, std::remove_const_t<decltype(lambda_127)>>);
+[[maybe_unused]] const auto lambda_129 = [](const float *, ...) mutable -> const float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_129)>::signature_type, const float *(const float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_129)>::result_type, const float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_129)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_129)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_129)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_129)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_129)>::arg0_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_129)>::arg_type<0>, const float *>);
+static_assert(callable_traits<decltype(lambda_129)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_129)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_129)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_129)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_129)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_129)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_129)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_129)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_129)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_129)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_129)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_129)>::class_type, std::remove_const_t<decltype(lambda_129)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_129)>, const float *(const float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_129)>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_129), 0>, const float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_129)>, type_list<const float *>>);
+static_assert(callable_arity_v<decltype(lambda_129)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_129)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_129)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_129)> == callable_traits<decltype(lambda_129)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_129)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_129)>, std::remove_const_t<decltype(lambda_129)>>);
+[[maybe_unused]] const auto lambda_131 = [](const volatile float *, ...) mutable noexcept -> const volatile float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_131)>::signature_type, const volatile float *(const volatile float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_131)>::result_type, const volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_131)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_131)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_131)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_131)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_131)>::arg0_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_131)>::arg_type<0>, const volatile float *>);
+static_assert(callable_traits<decltype(lambda_131)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_131)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_131)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_131)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_131)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_131)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_131)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_131)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_131)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_131)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_131)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_131)>::class_type, std::remove_const_t<decltype(lambda_131)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_131)>, const volatile float *(const volatile float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_131)>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_131), 0>, const volatile float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_131)>, type_list<const volatile float *>>);
+static_assert(callable_arity_v<decltype(lambda_131)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_131)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_131)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_131)> == callable_traits<decltype(lambda_131)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_131)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_131)>, std::remove_const_t<decltype(lambda_131)>>);
+[[maybe_unused]] const auto lambda_133 = [](const float &, ...) mutable -> const float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_133)>::signature_type, const float &(const float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_133)>::result_type, const float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_133)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_133)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_133)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_133)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_133)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_133)>::arg_type<0>, const float &>);
+static_assert(callable_traits<decltype(lambda_133)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_133)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_133)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_133)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_133)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_133)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_133)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_133)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_133)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_133)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_133)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_133)>::class_type, std::remove_const_t<decltype(lambda_133)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_133)>, const float &(const float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_133)>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_133), 0>, const float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_133)>, type_list<const float &>>);
+static_assert(callable_arity_v<decltype(lambda_133)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_133)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_133)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_133)> == callable_traits<decltype(lambda_133)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_133)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_133)>, std::remove_const_t<decltype(lambda_133)>>);
+[[maybe_unused]] const auto lambda_135 = [](const volatile float &, ...) mutable noexcept -> const volatile float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_135)>::signature_type, const volatile float &(const volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_135)>::result_type, const volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_135)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_135)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_135)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_135)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_135)>::arg0_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_135)>::arg_type<0>, const volatile float &>);
+static_assert(callable_traits<decltype(lambda_135)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_135)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_135)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_135)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_135)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_135)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_135)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_135)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_135)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_135)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_135)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_135)>::class_type, std::remove_const_t<decltype(lambda_135)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_135)>, const volatile float &(const volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_135)>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_135), 0>, const volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_135)>, type_list<const volatile float &>>);
+static_assert(callable_arity_v<decltype(lambda_135)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_135)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_135)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_135)> == callable_traits<decltype(lambda_135)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_135)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_135)>, std::remove_const_t<decltype(lambda_135)>>);
+[[maybe_unused]] const auto lambda_137 = [](const float * &, ...) mutable -> const float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_137)>::signature_type, const float * &(const float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_137)>::result_type, const float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_137)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_137)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_137)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_137)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_137)>::arg0_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_137)>::arg_type<0>, const float * &>);
+static_assert(callable_traits<decltype(lambda_137)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_137)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_137)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_137)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_137)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_137)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_137)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_137)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_137)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_137)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_137)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_137)>::class_type, std::remove_const_t<decltype(lambda_137)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_137)>, const float * &(const float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_137)>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_137), 0>, const float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_137)>, type_list<const float * &>>);
+static_assert(callable_arity_v<decltype(lambda_137)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_137)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_137)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_137)> == callable_traits<decltype(lambda_137)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_137)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_137)>, std::remove_const_t<decltype(lambda_137)>>);
+[[maybe_unused]] const auto lambda_139 = [](const volatile float * &, ...) mutable noexcept -> const volatile float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_139)>::signature_type, const volatile float * &(const volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_139)>::result_type, const volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_139)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_139)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_139)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_139)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_139)>::arg0_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_139)>::arg_type<0>, const volatile float * &>);
+static_assert(callable_traits<decltype(lambda_139)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_139)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_139)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_139)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_139)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_139)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_139)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_139)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_139)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_139)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_139)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_139)>::class_type, std::remove_const_t<decltype(lambda_139)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_139)>, const volatile float * &(const volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_139)>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_139), 0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_139)>, type_list<const volatile float * &>>);
+static_assert(callable_arity_v<decltype(lambda_139)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_139)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_139)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_139)> == callable_traits<decltype(lambda_139)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_139)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_139)>, std::remove_const_t<decltype(lambda_139)>>);
+[[maybe_unused]] const auto lambda_141 = [](const float * const &, ...) mutable -> const float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_141)>::signature_type, const float * const &(const float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_141)>::result_type, const float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_141)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_141)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_141)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_141)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_141)>::arg0_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_141)>::arg_type<0>, const float * const &>);
+static_assert(callable_traits<decltype(lambda_141)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_141)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_141)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_141)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_141)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_141)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_141)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_141)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_141)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_141)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_141)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_141)>::class_type, std::remove_const_t<decltype(lambda_141)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_141)>, const float * const &(const float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_141)>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_141), 0>, const float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_141)>, type_list<const float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_141)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_141)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_141)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_141)> == callable_traits<decltype(lambda_141)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_141)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_141)>, std::remove_const_t<decltype(lambda_141)>>);
+[[maybe_unused]] const auto lambda_143 = [](const volatile float * const &, ...) mutable noexcept -> const volatile float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_143)>::signature_type, const volatile float * const &(const volatile float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_143)>::result_type, const volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_143)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_143)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_143)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_143)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_143)>::arg0_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_143)>::arg_type<0>, const volatile float * const &>);
+static_assert(callable_traits<decltype(lambda_143)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_143)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_143)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_143)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_143)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_143)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_143)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_143)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_143)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_143)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_143)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_143)>::class_type, std::remove_const_t<decltype(lambda_143)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_143)>, const volatile float * const &(const volatile float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_143)>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_143), 0>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_143)>, type_list<const volatile float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_143)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_143)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_143)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_143)> == callable_traits<decltype(lambda_143)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_143)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_143)>, std::remove_const_t<decltype(lambda_143)>>);
+[[maybe_unused]] const auto lambda_145 = [](const float * volatile &, ...) mutable -> const float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_145)>::signature_type, const float * volatile &(const float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_145)>::result_type, const float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_145)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_145)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_145)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_145)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_145)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_145)>::arg_type<0>, const float * volatile &>);
+static_assert(callable_traits<decltype(lambda_145)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_145)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_145)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_145)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_145)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_145)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_145)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_145)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_145)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_145)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_145)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_145)>::class_type, std::remove_const_t<decltype(lambda_145)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_145)>, const float * volatile &(const float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_145)>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_145), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_145)>, type_list<const float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_145)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_145)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_145)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_145)> == callable_traits<decltype(lambda_145)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_145)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_145)>, std::remove_const_t<decltype(lambda_145)>>);
+[[maybe_unused]] const auto lambda_147 = [](const volatile float * volatile &, ...) mutable noexcept -> const volatile float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_147)>::signature_type, const volatile float * volatile &(const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_147)>::result_type, const volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_147)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_147)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_147)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_147)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_147)>::arg0_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_147)>::arg_type<0>, const volatile float * volatile &>);
+static_assert(callable_traits<decltype(lambda_147)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_147)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_147)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_147)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_147)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_147)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_147)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_147)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_147)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_147)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_147)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_147)>::class_type, std::remove_const_t<decltype(lambda_147)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_147)>, const volatile float * volatile &(const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_147)>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_147), 0>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_147)>, type_list<const volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_147)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_147)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_147)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_147)> == callable_traits<decltype(lambda_147)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_147)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_147)>, std::remove_const_t<decltype(lambda_147)>>);
+[[maybe_unused]] const auto lambda_149 = [](const float * const volatile &, ...) mutable -> const float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_149)>::signature_type, const float * const volatile &(const float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_149)>::result_type, const float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_149)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_149)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_149)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_149)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_149)>::arg0_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_149)>::arg_type<0>, const float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_149)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_149)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_149)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_149)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_149)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_149)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_149)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_149)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_149)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_149)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_149)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_149)>::class_type, std::remove_const_t<decltype(lambda_149)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_149)>, const float * const volatile &(const float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_149)>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_149), 0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_149)>, type_list<const float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_149)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_149)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_149)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_149)> == callable_traits<decltype(lambda_149)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_149)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_149)>, std::remove_const_t<decltype(lambda_149)>>);
+[[maybe_unused]] const auto lambda_151 = [](const volatile float * const volatile &, ...) mutable noexcept -> const volatile float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_151)>::signature_type, const volatile float * const volatile &(const volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_151)>::result_type, const volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_151)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_151)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_151)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_151)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_151)>::arg0_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_151)>::arg_type<0>, const volatile float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_151)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_151)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_151)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_151)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_151)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_151)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_151)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_151)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_151)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_151)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_151)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_151)>::class_type, std::remove_const_t<decltype(lambda_151)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_151)>, const volatile float * const volatile &(const volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_151)>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_151), 0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_151)>, type_list<const volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_151)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_151)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_151)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_151)> == callable_traits<decltype(lambda_151)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_151)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_151)>, std::remove_const_t<decltype(lambda_151)>>);
+[[maybe_unused]] const auto lambda_153 = [](const float &&, ...) mutable -> const float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_153)>::signature_type, const float &&(const float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_153)>::result_type, const float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_153)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_153)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_153)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_153)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_153)>::arg0_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_153)>::arg_type<0>, const float &&>);
+static_assert(callable_traits<decltype(lambda_153)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_153)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_153)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_153)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_153)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_153)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_153)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_153)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_153)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_153)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_153)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_153)>::class_type, std::remove_const_t<decltype(lambda_153)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_153)>, const float &&(const float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_153)>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_153), 0>, const float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_153)>, type_list<const float &&>>);
+static_assert(callable_arity_v<decltype(lambda_153)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_153)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_153)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_153)> == callable_traits<decltype(lambda_153)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_153)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_153)>, std::remove_const_t<decltype(lambda_153)>>);
+[[maybe_unused]] const auto lambda_155 = [](const volatile float &&, ...) mutable noexcept -> const volatile float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_155)>::signature_type, const volatile float &&(const volatile float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_155)>::result_type, const volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_155)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_155)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_155)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_155)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_155)>::arg0_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_155)>::arg_type<0>, const volatile float &&>);
+static_assert(callable_traits<decltype(lambda_155)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_155)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_155)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_155)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_155)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_155)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_155)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_155)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_155)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_155)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_155)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_155)>::class_type, std::remove_const_t<decltype(lambda_155)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_155)>, const volatile float &&(const volatile float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_155)>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_155), 0>, const volatile float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_155)>, type_list<const volatile float &&>>);
+static_assert(callable_arity_v<decltype(lambda_155)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_155)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_155)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_155)> == callable_traits<decltype(lambda_155)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_155)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_155)>, std::remove_const_t<decltype(lambda_155)>>);
+[[maybe_unused]] const auto lambda_157 = [](const float * &&, ...) mutable -> const float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_157)>::signature_type, const float * &&(const float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_157)>::result_type, const float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_157)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_157)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_157)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_157)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_157)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_157)>::arg_type<0>, const float * &&>);
+static_assert(callable_traits<decltype(lambda_157)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_157)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_157)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_157)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_157)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_157)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_157)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_157)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_157)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_157)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_157)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_157)>::class_type, std::remove_const_t<decltype(lambda_157)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_157)>, const float * &&(const float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_157)>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_157), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_157)>, type_list<const float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_157)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_157)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_157)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_157)> == callable_traits<decltype(lambda_157)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_157)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_157)>, std::remove_const_t<decltype(lambda_157)>>);
+[[maybe_unused]] const auto lambda_159 = [](const volatile float * &&, ...) mutable noexcept -> const volatile float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_159)>::signature_type, const volatile float * &&(const volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_159)>::result_type, const volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_159)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_159)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_159)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_159)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_159)>::arg0_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_159)>::arg_type<0>, const volatile float * &&>);
+static_assert(callable_traits<decltype(lambda_159)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_159)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_159)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_159)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_159)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_159)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_159)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_159)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_159)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_159)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_159)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_159)>::class_type, std::remove_const_t<decltype(lambda_159)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_159)>, const volatile float * &&(const volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_159)>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_159), 0>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_159)>, type_list<const volatile float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_159)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_159)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_159)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_159)> == callable_traits<decltype(lambda_159)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_159)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_159)>, std::remove_const_t<decltype(lambda_159)>>);
+[[maybe_unused]] const auto lambda_161 = [](const float * const &&, ...) mutable -> const float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_161)>::signature_type, const float * const &&(const float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_161)>::result_type, const float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_161)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_161)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_161)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_161)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_161)>::arg0_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_161)>::arg_type<0>, const float * const &&>);
+static_assert(callable_traits<decltype(lambda_161)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_161)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_161)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_161)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_161)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_161)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_161)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_161)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_161)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_161)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_161)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_161)>::class_type, std::remove_const_t<decltype(lambda_161)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_161)>, const float * const &&(const float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_161)>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_161), 0>, const float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_161)>, type_list<const float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_161)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_161)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_161)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_161)> == callable_traits<decltype(lambda_161)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_161)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_161)>, std::remove_const_t<decltype(lambda_161)>>);
+[[maybe_unused]] const auto lambda_163 = [](const volatile float * const &&, ...) mutable noexcept -> const volatile float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_163)>::signature_type, const volatile float * const &&(const volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_163)>::result_type, const volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_163)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_163)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_163)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_163)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_163)>::arg0_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_163)>::arg_type<0>, const volatile float * const &&>);
+static_assert(callable_traits<decltype(lambda_163)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_163)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_163)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_163)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_163)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_163)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_163)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_163)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_163)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_163)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_163)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_163)>::class_type, std::remove_const_t<decltype(lambda_163)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_163)>, const volatile float * const &&(const volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_163)>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_163), 0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_163)>, type_list<const volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_163)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_163)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_163)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_163)> == callable_traits<decltype(lambda_163)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_163)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_163)>, std::remove_const_t<decltype(lambda_163)>>);
+[[maybe_unused]] const auto lambda_165 = [](const float * volatile &&, ...) mutable -> const float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_165)>::signature_type, const float * volatile &&(const float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_165)>::result_type, const float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_165)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_165)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_165)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_165)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_165)>::arg0_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_165)>::arg_type<0>, const float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_165)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_165)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_165)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_165)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_165)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_165)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_165)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_165)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_165)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_165)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_165)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_165)>::class_type, std::remove_const_t<decltype(lambda_165)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_165)>, const float * volatile &&(const float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_165)>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_165), 0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_165)>, type_list<const float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_165)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_165)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_165)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_165)> == callable_traits<decltype(lambda_165)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_165)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_165)>, std::remove_const_t<decltype(lambda_165)>>);
+[[maybe_unused]] const auto lambda_167 = [](const volatile float * volatile &&, ...) mutable noexcept -> const volatile float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_167)>::signature_type, const volatile float * volatile &&(const volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_167)>::result_type, const volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_167)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_167)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_167)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_167)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_167)>::arg0_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_167)>::arg_type<0>, const volatile float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_167)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_167)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_167)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_167)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_167)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_167)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_167)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_167)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_167)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_167)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_167)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_167)>::class_type, std::remove_const_t<decltype(lambda_167)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_167)>, const volatile float * volatile &&(const volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_167)>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_167), 0>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_167)>, type_list<const volatile float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_167)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_167)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_167)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_167)> == callable_traits<decltype(lambda_167)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_167)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_167)>, std::remove_const_t<decltype(lambda_167)>>);
+[[maybe_unused]] const auto lambda_169 = [](const float * const volatile &&, ...) mutable -> const float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_169)>::signature_type, const float * const volatile &&(const float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_169)>::result_type, const float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_169)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_169)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_169)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_169)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_169)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_169)>::arg_type<0>, const float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_169)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_169)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_169)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_169)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_169)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_169)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_169)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_169)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_169)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_169)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_169)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_169)>::class_type, std::remove_const_t<decltype(lambda_169)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_169)>, const float * const volatile &&(const float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_169)>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_169), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_169)>, type_list<const float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_169)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_169)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_169)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_169)> == callable_traits<decltype(lambda_169)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_169)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_169)>, std::remove_const_t<decltype(lambda_169)>>);
+[[maybe_unused]] const auto lambda_171 = [](const volatile float * const volatile &&, ...) mutable noexcept -> const volatile float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_171)>::signature_type, const volatile float * const volatile &&(const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_171)>::result_type, const volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_171)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_171)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_171)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_171)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_171)>::arg0_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_171)>::arg_type<0>, const volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_171)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_171)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_171)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_171)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_171)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_171)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_171)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_171)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_171)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_171)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_171)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_171)>::class_type, std::remove_const_t<decltype(lambda_171)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_171)>, const volatile float * const volatile &&(const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_171)>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_171), 0>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_171)>, type_list<const volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_171)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_171)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_171)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_171)> == callable_traits<decltype(lambda_171)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_171)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_171)>, std::remove_const_t<decltype(lambda_171)>>);
+[[maybe_unused]] const auto lambda_173 = [](std::string *, ...) mutable -> std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_173)>::signature_type, std::string *(std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_173)>::result_type, std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_173)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_173)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_173)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_173)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_173)>::arg0_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_173)>::arg_type<0>, std::string *>);
+static_assert(callable_traits<decltype(lambda_173)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_173)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_173)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_173)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_173)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_173)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_173)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_173)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_173)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_173)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_173)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_173)>::class_type, std::remove_const_t<decltype(lambda_173)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_173)>, std::string *(std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_173)>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_173), 0>, std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_173)>, type_list<std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_173)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_173)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_173)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_173)> == callable_traits<decltype(lambda_173)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_173)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_173)>, std::remove_const_t<decltype(lambda_173)>>);
+[[maybe_unused]] const auto lambda_175 = [](volatile std::string *, ...) mutable noexcept -> volatile std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_175)>::signature_type, volatile std::string *(volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_175)>::result_type, volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_175)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_175)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_175)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_175)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_175)>::arg0_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_175)>::arg_type<0>, volatile std::string *>);
+static_assert(callable_traits<decltype(lambda_175)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_175)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_175)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_175)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_175)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_175)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_175)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_175)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_175)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_175)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_175)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_175)>::class_type, std::remove_const_t<decltype(lambda_175)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_175)>, volatile std::string *(volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_175)>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_175), 0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_175)>, type_list<volatile std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_175)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_175)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_175)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_175)> == callable_traits<decltype(lambda_175)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_175)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_175)>, std::remove_const_t<decltype(lambda_175)>>);
+[[maybe_unused]] const auto lambda_177 = [](std::string &, ...) mutable -> std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_177)>::signature_type, std::string &(std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_177)>::result_type, std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_177)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_177)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_177)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_177)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_177)>::arg0_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_177)>::arg_type<0>, std::string &>);
+static_assert(callable_traits<decltype(lambda_177)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_177)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_177)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_177)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_177)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_177)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_177)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_177)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_177)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_177)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_177)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_177)>::class_type, std::remove_const_t<decltype(lambda_177)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_177)>, std::string &(std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_177)>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_177), 0>, std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_177)>, type_list<std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_177)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_177)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_177)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_177)> == callable_traits<decltype(lambda_177)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_177)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_177)>, std::remove_const_t<decltype(lambda_177)>>);
+[[maybe_unused]] const auto lambda_179 = [](volatile std::string &, ...) mutable noexcept -> volatile std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_179)>::signature_type, volatile std::string &(volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_179)>::result_type, volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_179)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_179)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_179)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_179)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_179)>::arg0_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_179)>::arg_type<0>, volatile std::string &>);
+static_assert(callable_traits<decltype(lambda_179)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_179)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_179)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_179)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_179)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_179)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_179)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_179)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_179)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_179)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_179)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_179)>::class_type, std::remove_const_t<decltype(lambda_179)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_179)>, volatile std::string &(volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_179)>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_179), 0>, volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_179)>, type_list<volatile std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_179)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_179)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_179)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_179)> == callable_traits<decltype(lambda_179)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_179)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_179)>, std::remove_const_t<decltype(lambda_179)>>);
+[[maybe_unused]] const auto lambda_181 = [](std::string * &, ...) mutable -> std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_181)>::signature_type, std::string * &(std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_181)>::result_type, std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_181)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_181)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_181)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_181)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_181)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_181)>::arg_type<0>, std::string * &>);
+static_assert(callable_traits<decltype(lambda_181)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_181)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_181)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_181)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_181)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_181)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_181)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_181)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_181)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_181)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_181)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_181)>::class_type, std::remove_const_t<decltype(lambda_181)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_181)>, std::string * &(std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_181)>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_181), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_181)>, type_list<std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_181)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_181)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_181)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_181)> == callable_traits<decltype(lambda_181)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_181)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_181)>, std::remove_const_t<decltype(lambda_181)>>);
+[[maybe_unused]] const auto lambda_183 = [](volatile std::string * &, ...) mutable noexcept -> volatile std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_183)>::signature_type, volatile std::string * &(volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_183)>::result_type, volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_183)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_183)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_183)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_183)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_183)>::arg0_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_183)>::arg_type<0>, volatile std::string * &>);
+static_assert(callable_traits<decltype(lambda_183)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_183)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_183)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_183)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_183)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_183)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_183)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_183)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_183)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_183)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_183)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_183)>::class_type, std::remove_const_t<decltype(lambda_183)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_183)>, volatile std::string * &(volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_183)>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_183), 0>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_183)>, type_list<volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_183)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_183)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_183)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_183)> == callable_traits<decltype(lambda_183)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_183)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_183)>, std::remove_const_t<decltype(lambda_183)>>);
+[[maybe_unused]] const auto lambda_185 = [](std::string * const &, ...) mutable -> std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_185)>::signature_type, std::string * const &(std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_185)>::result_type, std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_185)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_185)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_185)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_185)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_185)>::arg0_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_185)>::arg_type<0>, std::string * const &>);
+static_assert(callable_traits<decltype(lambda_185)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_185)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_185)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_185)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_185)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_185)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_185)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_185)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_185)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_185)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_185)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_185)>::class_type, std::remove_const_t<decltype(lambda_185)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_185)>, std::string * const &(std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_185)>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_185), 0>, std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_185)>, type_list<std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_185)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_185)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_185)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_185)> == callable_traits<decltype(lambda_185)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_185)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_185)>, std::remove_const_t<decltype(lambda_185)>>);
+[[maybe_unused]] const auto lambda_187 = [](volatile std::string * const &, ...) mutable noexcept -> volatile std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_187)>::signature_type, volatile std::string * const &(volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_187)>::result_type, volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_187)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_187)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_187)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_187)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_187)>::arg0_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_187)>::arg_type<0>, volatile std::string * const &>);
+static_assert(callable_traits<decltype(lambda_187)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_187)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_187)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_187)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_187)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_187)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_187)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_187)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_187)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_187)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_187)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_187)>::class_type, std::remove_const_t<decltype(lambda_187)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_187)>, volatile std::string * const &(volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_187)>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_187), 0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_187)>, type_list<volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_187)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_187)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_187)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_187)> == callable_traits<decltype(lambda_187)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_187)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_187)>, std::remove_const_t<decltype(lambda_187)>>);
+[[maybe_unused]] const auto lambda_189 = [](std::string * volatile &, ...) mutable -> std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_189)>::signature_type, std::string * volatile &(std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_189)>::result_type, std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_189)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_189)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_189)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_189)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_189)>::arg0_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_189)>::arg_type<0>, std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_189)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_189)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_189)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_189)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_189)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_189)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_189)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_189)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_189)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_189)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_189)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_189)>::class_type, std::remove_const_t<decltype(lambda_189)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_189)>, std::string * volatile &(std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_189)>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_189), 0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_189)>, type_list<std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_189)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_189)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_189)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_189)> == callable_traits<decltype(lambda_189)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_189)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_189)>, std::remove_const_t<decltype(lambda_189)>>);
+[[maybe_unused]] const auto lambda_191 = [](volatile std::string * volatile &, ...) mutable noexcept -> volatile std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_191)>::signature_type, volatile std::string * volatile &(volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_191)>::result_type, volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_191)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_191)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_191)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_191)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_191)>::arg0_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_191)>::arg_type<0>, volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_191)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_191)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_191)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_191)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_191)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_191)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_191)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_191)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_191)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_191)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_191)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_191)>::class_type, std::remove_const_t<decltype(lambda_191)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_191)>, volatile std::string * volatile &(volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_191)>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_191), 0>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_191)>, type_list<volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_191)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_191)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_191)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_191)> == callable_traits<decltype(lambda_191)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_191)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_191)>, std::remove_const_t<decltype(lambda_191)>>);
+[[maybe_unused]] const auto lambda_193 = [](std::string * const volatile &, ...) mutable -> std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_193)>::signature_type, std::string * const volatile &(std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_193)>::result_type, std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_193)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_193)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_193)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_193)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_193)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_193)>::arg_type<0>, std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_193)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_193)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_193)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_193)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_193)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_193)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_193)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_193)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_193)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_193)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_193)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_193)>::class_type, std::remove_const_t<decltype(lambda_193)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_193)>, std::string * const volatile &(std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_193)>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_193), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_193)>, type_list<std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_193)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_193)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_193)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_193)> == callable_traits<decltype(lambda_193)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_193)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_193)>, std::remove_const_t<decltype(lambda_193)>>);
+[[maybe_unused]] const auto lambda_195 = [](volatile std::string * const volatile &, ...) mutable noexcept -> volatile std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_195)>::signature_type, volatile std::string * const volatile &(volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_195)>::result_type, volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_195)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_195)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_195)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_195)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_195)>::arg0_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_195)>::arg_type<0>, volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_195)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_195)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_195)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_195)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_195)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_195)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_195)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_195)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_195)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_195)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_195)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_195)>::class_type, std::remove_const_t<decltype(lambda_195)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_195)>, volatile std::string * const volatile &(volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_195)>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_195), 0>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_195)>, type_list<volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_195)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_195)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_195)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_195)> == callable_traits<decltype(lambda_195)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_195)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_195)>, std::remove_const_t<decltype(lambda_195)>>);
+[[maybe_unused]] const auto lambda_197 = [](std::string &&, ...) mutable -> std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_197)>::signature_type, std::string &&(std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_197)>::result_type, std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_197)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_197)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_197)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_197)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_197)>::arg0_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_197)>::arg_type<0>, std::string &&>);
+static_assert(callable_traits<decltype(lambda_197)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_197)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_197)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_197)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_197)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_197)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_197)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_197)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_197)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_197)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_197)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_197)>::class_type, std::remove_const_t<decltype(lambda_197)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_197)>, std::string &&(std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_197)>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_197), 0>, std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_197)>, type_list<std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_197)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_197)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_197)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_197)> == callable_traits<decltype(lambda_197)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_197)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_197)>, std::remove_const_t<decltype(lambda_197)>>);
+[[maybe_unused]] const auto lambda_199 = [](volatile std::string &&, ...) mutable noexcept -> volatile std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_199)>::signature_type, volatile std::string &&(volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_199)>::result_type, volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_199)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_199)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_199)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_199)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_199)>::arg0_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_199)>::arg_type<0>, volatile std::string &&>);
+static_assert(callable_traits<decltype(lambda_199)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_199)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_199)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_199)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_199)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_199)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_199)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_199)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_199)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_199)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_199)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_199)>::class_type, std::remove_const_t<decltype(lambda_199)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_199)>, volatile std::string &&(volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_199)>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_199), 0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_199)>, type_list<volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_199)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_199)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_199)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_199)> == callable_traits<decltype(lambda_199)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_199)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_199)>, std::remove_const_t<decltype(lambda_199)>>);
+[[maybe_unused]] const auto lambda_201 = [](std::string * &&, ...) mutable -> std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_201)>::signature_type, std::string * &&(std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_201)>::result_type, std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_201)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_201)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_201)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_201)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_201)>::arg0_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_201)>::arg_type<0>, std::string * &&>);
+static_assert(callable_traits<decltype(lambda_201)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_201)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_201)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_201)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_201)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_201)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_201)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_201)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_201)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_201)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_201)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_201)>::class_type, std::remove_const_t<decltype(lambda_201)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_201)>, std::string * &&(std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_201)>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_201), 0>, std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_201)>, type_list<std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_201)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_201)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_201)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_201)> == callable_traits<decltype(lambda_201)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_201)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_201)>, std::remove_const_t<decltype(lambda_201)>>);
+[[maybe_unused]] const auto lambda_203 = [](volatile std::string * &&, ...) mutable noexcept -> volatile std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_203)>::signature_type, volatile std::string * &&(volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_203)>::result_type, volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_203)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_203)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_203)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_203)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_203)>::arg0_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_203)>::arg_type<0>, volatile std::string * &&>);
+static_assert(callable_traits<decltype(lambda_203)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_203)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_203)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_203)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_203)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_203)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_203)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_203)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_203)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_203)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_203)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_203)>::class_type, std::remove_const_t<decltype(lambda_203)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_203)>, volatile std::string * &&(volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_203)>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_203), 0>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_203)>, type_list<volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_203)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_203)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_203)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_203)> == callable_traits<decltype(lambda_203)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_203)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_203)>, std::remove_const_t<decltype(lambda_203)>>);
+[[maybe_unused]] const auto lambda_205 = [](std::string * const &&, ...) mutable -> std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_205)>::signature_type, std::string * const &&(std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_205)>::result_type, std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_205)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_205)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_205)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_205)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_205)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_205)>::arg_type<0>, std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_205)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_205)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_205)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_205)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_205)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_205)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_205)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_205)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_205)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_205)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_205)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_205)>::class_type, std::remove_const_t<decltype(lambda_205)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_205)>, std::string * const &&(std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_205)>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_205), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_205)>, type_list<std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_205)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_205)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_205)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_205)> == callable_traits<decltype(lambda_205)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_205)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_205)>, std::remove_const_t<decltype(lambda_205)>>);
+[[maybe_unused]] const auto lambda_207 = [](volatile std::string * const &&, ...) mutable noexcept -> volatile std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_207)>::signature_type, volatile std::string * const &&(volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_207)>::result_type, volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_207)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_207)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_207)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_207)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_207)>::arg0_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_207)>::arg_type<0>, volatile std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_207)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_207)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_207)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_207)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_207)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_207)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_207)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_207)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_207)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_207)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_207)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_207)>::class_type, std::remove_const_t<decltype(lambda_207)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_207)>, volatile std::string * const &&(volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_207)>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_207), 0>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_207)>, type_list<volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_207)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_207)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_207)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_207)> == callable_traits<decltype(lambda_207)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_207)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_207)>, std::remove_const_t<decltype(lambda_207)>>);
+[[maybe_unused]] const auto lambda_209 = [](std::string * volatile &&, ...) mutable -> std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_209)>::signature_type, std::string * volatile &&(std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_209)>::result_type, std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_209)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_209)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_209)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_209)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_209)>::arg0_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_209)>::arg_type<0>, std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_209)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_209)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_209)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_209)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_209)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_209)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_209)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_209)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_209)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_209)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_209)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_209)>::class_type, std::remove_const_t<decltype(lambda_209)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_209)>, std::string * volatile &&(std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_209)>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_209), 0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_209)>, type_list<std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_209)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_209)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_209)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_209)> == callable_traits<decltype(lambda_209)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_209)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_209)>, std::remove_const_t<decltype(lambda_209)>>);
+[[maybe_unused]] const auto lambda_211 = [](volatile std::string * volatile &&, ...) mutable noexcept -> volatile std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_211)>::signature_type, volatile std::string * volatile &&(volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_211)>::result_type, volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_211)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_211)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_211)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_211)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_211)>::arg0_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_211)>::arg_type<0>, volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_211)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_211)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_211)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_211)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_211)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_211)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_211)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_211)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_211)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_211)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_211)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_211)>::class_type, std::remove_const_t<decltype(lambda_211)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_211)>, volatile std::string * volatile &&(volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_211)>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_211), 0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_211)>, type_list<volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_211)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_211)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_211)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_211)> == callable_traits<decltype(lambda_211)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_211)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_211)>, std::remove_const_t<decltype(lambda_211)>>);
+[[maybe_unused]] const auto lambda_213 = [](std::string * const volatile &&, ...) mutable -> std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_213)>::signature_type, std::string * const volatile &&(std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_213)>::result_type, std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_213)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_213)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_213)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_213)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_213)>::arg0_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_213)>::arg_type<0>, std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_213)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_213)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_213)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_213)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_213)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_213)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_213)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_213)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_213)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_213)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_213)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_213)>::class_type, std::remove_const_t<decltype(lambda_213)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_213)>, std::string * const volatile &&(std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_213)>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_213), 0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_213)>, type_list<std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_213)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_213)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_213)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_213)> == callable_traits<decltype(lambda_213)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_213)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_213)>, std::remove_const_t<decltype(lambda_213)>>);
+[[maybe_unused]] const auto lambda_215 = [](volatile std::string * const volatile &&, ...) mutable noexcept -> volatile std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_215)>::signature_type, volatile std::string * const volatile &&(volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_215)>::result_type, volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_215)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_215)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_215)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_215)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_215)>::arg0_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_215)>::arg_type<0>, volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_215)>::arity == 1);
+static_assert(callable_traits<decltype(lambda_215)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_215)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_215)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_215)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_215)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_215)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_215)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_215)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_215)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_215)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_215)>::class_type, std::remove_const_t<decltype(lambda_215)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_215)>, volatile std::string * const volatile &&(volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_215)>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_215), 0>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_215)>, type_list<volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_215)> == 1);
+static_assert(callable_is_functor_v<decltype(lambda_215)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_215)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_215)> == callable_traits<decltype(lambda_215)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_215)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_215)>, std::remove_const_t<decltype(lambda_215)>>);
+[[maybe_unused]] const auto lambda_217 = [](void *, const void *, ...) mutable -> void {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::signature_type, void(void *, const void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::result_type, void>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_217)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_217)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_217)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_217)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::arg_type<0>, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::arg1_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::arg_type<1>, const void *>);
+static_assert(callable_traits<decltype(lambda_217)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_217)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_217)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_217)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_217)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_217)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_217)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_217)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_217)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_217)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_217)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_217)>::class_type, std::remove_const_t<decltype(lambda_217)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_217)>, void(void *, const void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_217)>, void>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_217), 0>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_217), 1>, const void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_217)>, type_list<void *, const void *>>);
+static_assert(callable_arity_v<decltype(lambda_217)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_217)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_217)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_217)> == callable_traits<decltype(lambda_217)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_217)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_217)>, std::remove_const_t<decltype(lambda_217)>>);
+[[maybe_unused]] const auto lambda_219 = [](void * &, const void * &, ...) mutable noexcept -> const void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::signature_type, const void *(void * &, const void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::result_type, const void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_219)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_219)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_219)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_219)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::arg0_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::arg_type<0>, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::arg1_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::arg_type<1>, const void * &>);
+static_assert(callable_traits<decltype(lambda_219)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_219)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_219)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_219)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_219)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_219)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_219)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_219)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_219)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_219)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_219)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_219)>::class_type, std::remove_const_t<decltype(lambda_219)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_219)>, const void *(void * &, const void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_219)>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_219), 0>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_219), 1>, const void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_219)>, type_list<void * &, const void * &>>);
+static_assert(callable_arity_v<decltype(lambda_219)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_219)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_219)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_219)> == callable_traits<decltype(lambda_219)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_219)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_219)>, std::remove_const_t<decltype(lambda_219)>>);
+[[maybe_unused]] const auto lambda_221 = [](void * const &, const void * const &, ...) mutable -> const volatile void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::signature_type, const volatile void *(void * const &, const void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::result_type, const volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_221)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_221)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_221)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_221)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::arg0_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::arg_type<0>, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::arg1_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::arg_type<1>, const void * const &>);
+static_assert(callable_traits<decltype(lambda_221)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_221)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_221)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_221)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_221)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_221)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_221)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_221)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_221)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_221)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_221)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_221)>::class_type, std::remove_const_t<decltype(lambda_221)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_221)>, const volatile void *(void * const &, const void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_221)>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_221), 0>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_221), 1>, const void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_221)>, type_list<void * const &, const void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_221)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_221)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_221)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_221)> == callable_traits<decltype(lambda_221)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_221)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_221)>, std::remove_const_t<decltype(lambda_221)>>);
+[[maybe_unused]] const auto lambda_223 = [](void * volatile &, const void * volatile &, ...) mutable noexcept -> const void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::signature_type, const void * &(void * volatile &, const void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::result_type, const void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_223)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_223)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_223)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_223)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::arg_type<0>, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::arg1_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::arg_type<1>, const void * volatile &>);
+static_assert(callable_traits<decltype(lambda_223)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_223)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_223)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_223)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_223)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_223)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_223)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_223)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_223)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_223)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_223)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_223)>::class_type, std::remove_const_t<decltype(lambda_223)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_223)>, const void * &(void * volatile &, const void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_223)>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_223), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_223), 1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_223)>, type_list<void * volatile &, const void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_223)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_223)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_223)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_223)> == callable_traits<decltype(lambda_223)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_223)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_223)>, std::remove_const_t<decltype(lambda_223)>>);
+[[maybe_unused]] const auto lambda_225 = [](void * const volatile &, const void * const volatile &, ...) mutable -> const volatile void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::signature_type, const volatile void * &(void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::result_type, const volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_225)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_225)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_225)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_225)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::arg0_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::arg_type<0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::arg1_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::arg_type<1>, const void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_225)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_225)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_225)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_225)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_225)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_225)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_225)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_225)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_225)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_225)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_225)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_225)>::class_type, std::remove_const_t<decltype(lambda_225)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_225)>, const volatile void * &(void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_225)>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_225), 0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_225), 1>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_225)>, type_list<void * const volatile &, const void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_225)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_225)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_225)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_225)> == callable_traits<decltype(lambda_225)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_225)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_225)>, std::remove_const_t<decltype(lambda_225)>>);
+[[maybe_unused]] const auto lambda_227 = [](void * &&, const void * &&, ...) mutable noexcept -> const void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::signature_type, const void * const &(void * &&, const void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::result_type, const void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_227)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_227)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_227)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_227)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::arg0_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::arg_type<0>, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::arg1_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::arg_type<1>, const void * &&>);
+static_assert(callable_traits<decltype(lambda_227)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_227)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_227)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_227)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_227)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_227)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_227)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_227)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_227)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_227)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_227)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_227)>::class_type, std::remove_const_t<decltype(lambda_227)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_227)>, const void * const &(void * &&, const void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_227)>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_227), 0>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_227), 1>, const void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_227)>, type_list<void * &&, const void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_227)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_227)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_227)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_227)> == callable_traits<decltype(lambda_227)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_227)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_227)>, std::remove_const_t<decltype(lambda_227)>>);
+[[maybe_unused]] const auto lambda_229 = [](void * const &&, const void * const &&, ...) mutable -> const volatile void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::signature_type, const volatile void * const &(void * const &&, const void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::result_type, const volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_229)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_229)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_229)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_229)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::arg_type<0>, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::arg1_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::arg_type<1>, const void * const &&>);
+static_assert(callable_traits<decltype(lambda_229)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_229)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_229)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_229)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_229)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_229)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_229)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_229)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_229)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_229)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_229)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_229)>::class_type, std::remove_const_t<decltype(lambda_229)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_229)>, const volatile void * const &(void * const &&, const void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_229)>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_229), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_229), 1>, const void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_229)>, type_list<void * const &&, const void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_229)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_229)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_229)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_229)> == callable_traits<decltype(lambda_229)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_229)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_229)>, std::remove_const_t<decltype(lambda_229)>>);
+[[maybe_unused]] const auto lambda_231 = [](void * volatile &&, const void * volatile &&, ...) mutable noexcept -> const void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::signature_type, const void * volatile &(void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::result_type, const void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_231)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_231)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_231)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_231)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::arg0_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::arg_type<0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::arg1_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::arg_type<1>, const void * volatile &&>);
+static_assert(callable_traits<decltype(lambda_231)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_231)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_231)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_231)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_231)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_231)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_231)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_231)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_231)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_231)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_231)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_231)>::class_type, std::remove_const_t<decltype(lambda_231)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_231)>, const void * volatile &(void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_231)>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_231), 0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_231), 1>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_231)>, type_list<void * volatile &&, const void * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_231)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_231)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_231)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_231)> == callable_traits<decltype(lambda_231)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_231)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_231)>, std::remove_const_t<decltype(lambda_231)>>);
+[[maybe_unused]] const auto lambda_233 = [](void * const volatile &&, const void * const volatile &&, ...) mutable -> const volatile void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::signature_type, const volatile void * volatile &(void * const volatile &&, const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::result_type, const volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_233)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_233)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_233)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_233)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::arg0_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::arg_type<0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::arg1_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::arg_type<1>, const void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_233)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_233)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_233)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_233)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_233)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_233)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_233)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_233)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_233)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_233)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_233)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_233)>::class_type, std::remove_const_t<decltype(lambda_233)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_233)>, const volatile void * volatile &(void * const volatile &&, const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_233)>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_233), 0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_233), 1>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_233)>, type_list<void * const volatile &&, const void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_233)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_233)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_233)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_233)> == callable_traits<decltype(lambda_233)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_233)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_233)>, std::remove_const_t<decltype(lambda_233)>>);
+[[maybe_unused]] const auto lambda_235 = [](bool, bool *, ...) mutable noexcept -> const void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::signature_type, const void * const volatile &(bool, bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::result_type, const void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_235)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_235)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_235)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_235)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::arg_type<0>, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::arg1_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::arg_type<1>, bool *>);
+static_assert(callable_traits<decltype(lambda_235)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_235)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_235)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_235)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_235)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_235)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_235)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_235)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_235)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_235)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_235)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_235)>::class_type, std::remove_const_t<decltype(lambda_235)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_235)>, const void * const volatile &(bool, bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_235)>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_235), 0>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_235), 1>, bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_235)>, type_list<bool, bool *>>);
+static_assert(callable_arity_v<decltype(lambda_235)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_235)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_235)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_235)> == callable_traits<decltype(lambda_235)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_235)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_235)>, std::remove_const_t<decltype(lambda_235)>>);
+[[maybe_unused]] const auto lambda_237 = [](const volatile bool *, bool &, ...) mutable -> const volatile void * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::signature_type, const volatile void * const volatile &(const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::result_type, const volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_237)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_237)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_237)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_237)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::arg0_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::arg_type<0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::arg1_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::arg_type<1>, bool &>);
+static_assert(callable_traits<decltype(lambda_237)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_237)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_237)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_237)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_237)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_237)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_237)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_237)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_237)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_237)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_237)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_237)>::class_type, std::remove_const_t<decltype(lambda_237)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_237)>, const volatile void * const volatile &(const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_237)>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_237), 0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_237), 1>, bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_237)>, type_list<const volatile bool *, bool &>>);
+static_assert(callable_arity_v<decltype(lambda_237)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_237)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_237)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_237)> == callable_traits<decltype(lambda_237)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_237)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_237)>, std::remove_const_t<decltype(lambda_237)>>);
+[[maybe_unused]] const auto lambda_239 = [](const volatile bool &, bool * &, ...) mutable noexcept -> const void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::signature_type, const void * &&(const volatile bool &, bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::result_type, const void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_239)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_239)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_239)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_239)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::arg0_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::arg_type<0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::arg1_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::arg_type<1>, bool * &>);
+static_assert(callable_traits<decltype(lambda_239)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_239)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_239)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_239)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_239)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_239)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_239)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_239)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_239)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_239)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_239)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_239)>::class_type, std::remove_const_t<decltype(lambda_239)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_239)>, const void * &&(const volatile bool &, bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_239)>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_239), 0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_239), 1>, bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_239)>, type_list<const volatile bool &, bool * &>>);
+static_assert(callable_arity_v<decltype(lambda_239)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_239)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_239)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_239)> == callable_traits<decltype(lambda_239)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_239)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_239)>, std::remove_const_t<decltype(lambda_239)>>);
+[[maybe_unused]] const auto lambda_241 = [](const volatile bool * &, bool * const &, ...) mutable -> const volatile void * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::signature_type, const volatile void * &&(const volatile bool * &, bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::result_type, const volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_241)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_241)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_241)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_241)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::arg_type<0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::arg1_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::arg_type<1>, bool * const &>);
+static_assert(callable_traits<decltype(lambda_241)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_241)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_241)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_241)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_241)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_241)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_241)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_241)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_241)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_241)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_241)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_241)>::class_type, std::remove_const_t<decltype(lambda_241)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_241)>, const volatile void * &&(const volatile bool * &, bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_241)>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_241), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_241), 1>, bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_241)>, type_list<const volatile bool * &, bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_241)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_241)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_241)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_241)> == callable_traits<decltype(lambda_241)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_241)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_241)>, std::remove_const_t<decltype(lambda_241)>>);
+[[maybe_unused]] const auto lambda_243 = [](const volatile bool * const &, bool * volatile &, ...) mutable noexcept -> const void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::signature_type, const void * const &&(const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::result_type, const void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_243)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_243)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_243)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_243)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::arg0_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::arg_type<0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::arg1_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::arg_type<1>, bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_243)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_243)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_243)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_243)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_243)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_243)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_243)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_243)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_243)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_243)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_243)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_243)>::class_type, std::remove_const_t<decltype(lambda_243)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_243)>, const void * const &&(const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_243)>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_243), 0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_243), 1>, bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_243)>, type_list<const volatile bool * const &, bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_243)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_243)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_243)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_243)> == callable_traits<decltype(lambda_243)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_243)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_243)>, std::remove_const_t<decltype(lambda_243)>>);
+[[maybe_unused]] const auto lambda_245 = [](const volatile bool * volatile &, bool * const volatile &, ...) mutable -> const volatile void * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::signature_type, const volatile void * const &&(const volatile bool * volatile &, bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::result_type, const volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_245)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_245)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_245)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_245)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::arg0_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::arg_type<0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::arg1_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::arg_type<1>, bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_245)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_245)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_245)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_245)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_245)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_245)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_245)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_245)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_245)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_245)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_245)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_245)>::class_type, std::remove_const_t<decltype(lambda_245)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_245)>, const volatile void * const &&(const volatile bool * volatile &, bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_245)>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_245), 0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_245), 1>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_245)>, type_list<const volatile bool * volatile &, bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_245)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_245)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_245)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_245)> == callable_traits<decltype(lambda_245)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_245)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_245)>, std::remove_const_t<decltype(lambda_245)>>);
+[[maybe_unused]] const auto lambda_247 = [](const volatile bool * const volatile &, bool &&, ...) mutable noexcept -> const void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::signature_type, const void * volatile &&(const volatile bool * const volatile &, bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::result_type, const void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_247)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_247)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_247)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_247)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::arg1_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::arg_type<1>, bool &&>);
+static_assert(callable_traits<decltype(lambda_247)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_247)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_247)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_247)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_247)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_247)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_247)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_247)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_247)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_247)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_247)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_247)>::class_type, std::remove_const_t<decltype(lambda_247)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_247)>, const void * volatile &&(const volatile bool * const volatile &, bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_247)>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_247), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_247), 1>, bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_247)>, type_list<const volatile bool * const volatile &, bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_247)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_247)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_247)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_247)> == callable_traits<decltype(lambda_247)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_247)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_247)>, std::remove_const_t<decltype(lambda_247)>>);
+[[maybe_unused]] const auto lambda_249 = [](const volatile bool &&, bool * &&, ...) mutable -> const volatile void * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::signature_type, const volatile void * volatile &&(const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::result_type, const volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_249)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_249)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_249)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_249)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::arg0_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::arg_type<0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::arg1_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::arg_type<1>, bool * &&>);
+static_assert(callable_traits<decltype(lambda_249)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_249)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_249)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_249)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_249)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_249)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_249)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_249)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_249)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_249)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_249)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_249)>::class_type, std::remove_const_t<decltype(lambda_249)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_249)>, const volatile void * volatile &&(const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_249)>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_249), 0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_249), 1>, bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_249)>, type_list<const volatile bool &&, bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_249)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_249)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_249)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_249)> == callable_traits<decltype(lambda_249)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_249)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_249)>, std::remove_const_t<decltype(lambda_249)>>);
+[[maybe_unused]] const auto lambda_251 = [](const volatile bool * &&, bool * const &&, ...) mutable noexcept -> const void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::signature_type, const void * const volatile &&(const volatile bool * &&, bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::result_type, const void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_251)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_251)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_251)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_251)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::arg0_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::arg_type<0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::arg1_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::arg_type<1>, bool * const &&>);
+static_assert(callable_traits<decltype(lambda_251)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_251)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_251)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_251)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_251)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_251)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_251)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_251)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_251)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_251)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_251)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_251)>::class_type, std::remove_const_t<decltype(lambda_251)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_251)>, const void * const volatile &&(const volatile bool * &&, bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_251)>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_251), 0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_251), 1>, bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_251)>, type_list<const volatile bool * &&, bool * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_251)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_251)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_251)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_251)> == callable_traits<decltype(lambda_251)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_251)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_251)>, std::remove_const_t<decltype(lambda_251)>>);
+[[maybe_unused]] const auto lambda_253 = [](const volatile bool * const &&, bool * volatile &&, ...) mutable -> const volatile void * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::signature_type, const volatile void * const volatile &&(const volatile bool * const &&, bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::result_type, const volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_253)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_253)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_253)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_253)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::arg1_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::arg_type<1>, bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_253)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_253)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_253)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_253)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_253)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_253)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_253)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_253)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_253)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_253)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_253)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_253)>::class_type, std::remove_const_t<decltype(lambda_253)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_253)>, const volatile void * const volatile &&(const volatile bool * const &&, bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_253)>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_253), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_253), 1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_253)>, type_list<const volatile bool * const &&, bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_253)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_253)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_253)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_253)> == callable_traits<decltype(lambda_253)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_253)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_253)>, std::remove_const_t<decltype(lambda_253)>>);
+[[maybe_unused]] const auto lambda_255 = [](const volatile bool * volatile &&, bool * const volatile &&, ...) mutable noexcept -> bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::signature_type, bool *(const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::result_type, bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_255)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_255)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_255)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_255)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::arg0_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::arg_type<0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::arg1_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::arg_type<1>, bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_255)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_255)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_255)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_255)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_255)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_255)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_255)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_255)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_255)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_255)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_255)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_255)>::class_type, std::remove_const_t<decltype(lambda_255)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_255)>, bool *(const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_255)>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_255), 0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_255), 1>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_255)>, type_list<const volatile bool * volatile &&, bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_255)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_255)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_255)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_255)> == callable_traits<decltype(lambda_255)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_255)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_255)>, std::remove_const_t<decltype(lambda_255)>>);
+[[maybe_unused]] const auto lambda_257 = [](const volatile bool * const volatile &&, int, ...) mutable -> volatile bool * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::signature_type, volatile bool *(const volatile bool * const volatile &&, int)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::result_type, volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_257)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_257)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_257)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_257)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::arg0_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::arg_type<0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::arg1_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::arg_type<1>, int>);
+static_assert(callable_traits<decltype(lambda_257)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_257)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_257)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_257)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_257)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_257)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_257)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_257)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_257)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_257)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_257)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_257)>::class_type, std::remove_const_t<decltype(lambda_257)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_257)>, volatile bool *(const volatile bool * const volatile &&, int)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_257)>, volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_257), 0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_257), 1>, int>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_257)>, type_list<const volatile bool * const volatile &&, int>>);
+static_assert(callable_arity_v<decltype(lambda_257)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_257)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_257)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_257)> == callable_traits<decltype(lambda_257)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_257)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_257)>, std::remove_const_t<decltype(lambda_257)>>);
+[[maybe_unused]] const auto lambda_259 = [](volatile int *, const volatile int *, ...) mutable noexcept -> bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::signature_type, bool &(volatile int *, const volatile int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::result_type, bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_259)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_259)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_259)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_259)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::arg_type<0>, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::arg1_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::arg_type<1>, const volatile int *>);
+static_assert(callable_traits<decltype(lambda_259)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_259)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_259)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_259)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_259)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_259)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_259)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_259)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_259)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_259)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_259)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_259)>::class_type, std::remove_const_t<decltype(lambda_259)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_259)>, bool &(volatile int *, const volatile int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_259)>, bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_259), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_259), 1>, const volatile int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_259)>, type_list<volatile int *, const volatile int *>>);
+static_assert(callable_arity_v<decltype(lambda_259)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_259)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_259)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_259)> == callable_traits<decltype(lambda_259)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_259)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_259)>, std::remove_const_t<decltype(lambda_259)>>);
+[[maybe_unused]] const auto lambda_261 = [](volatile int &, const volatile int &, ...) mutable -> volatile bool & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::signature_type, volatile bool &(volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::result_type, volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_261)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_261)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_261)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_261)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::arg0_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::arg_type<0>, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::arg1_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::arg_type<1>, const volatile int &>);
+static_assert(callable_traits<decltype(lambda_261)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_261)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_261)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_261)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_261)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_261)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_261)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_261)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_261)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_261)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_261)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_261)>::class_type, std::remove_const_t<decltype(lambda_261)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_261)>, volatile bool &(volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_261)>, volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_261), 0>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_261), 1>, const volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_261)>, type_list<volatile int &, const volatile int &>>);
+static_assert(callable_arity_v<decltype(lambda_261)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_261)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_261)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_261)> == callable_traits<decltype(lambda_261)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_261)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_261)>, std::remove_const_t<decltype(lambda_261)>>);
+[[maybe_unused]] const auto lambda_263 = [](volatile int * &, const volatile int * &, ...) mutable noexcept -> bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::signature_type, bool * &(volatile int * &, const volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::result_type, bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_263)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_263)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_263)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_263)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::arg0_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::arg_type<0>, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::arg1_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::arg_type<1>, const volatile int * &>);
+static_assert(callable_traits<decltype(lambda_263)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_263)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_263)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_263)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_263)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_263)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_263)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_263)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_263)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_263)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_263)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_263)>::class_type, std::remove_const_t<decltype(lambda_263)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_263)>, bool * &(volatile int * &, const volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_263)>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_263), 0>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_263), 1>, const volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_263)>, type_list<volatile int * &, const volatile int * &>>);
+static_assert(callable_arity_v<decltype(lambda_263)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_263)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_263)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_263)> == callable_traits<decltype(lambda_263)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_263)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_263)>, std::remove_const_t<decltype(lambda_263)>>);
+[[maybe_unused]] const auto lambda_265 = [](volatile int * const &, const volatile int * const &, ...) mutable -> volatile bool * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::signature_type, volatile bool * &(volatile int * const &, const volatile int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::result_type, volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_265)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_265)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_265)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_265)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::arg_type<0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::arg1_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::arg_type<1>, const volatile int * const &>);
+static_assert(callable_traits<decltype(lambda_265)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_265)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_265)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_265)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_265)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_265)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_265)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_265)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_265)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_265)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_265)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_265)>::class_type, std::remove_const_t<decltype(lambda_265)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_265)>, volatile bool * &(volatile int * const &, const volatile int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_265)>, volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_265), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_265), 1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_265)>, type_list<volatile int * const &, const volatile int * const &>>);
+static_assert(callable_arity_v<decltype(lambda_265)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_265)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_265)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_265)> == callable_traits<decltype(lambda_265)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_265)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_265)>, std::remove_const_t<decltype(lambda_265)>>);
+[[maybe_unused]] const auto lambda_267 = [](volatile int * volatile &, const volatile int * volatile &, ...) mutable noexcept -> bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::signature_type, bool * const &(volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::result_type, bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_267)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_267)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_267)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_267)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::arg0_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::arg_type<0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::arg1_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::arg_type<1>, const volatile int * volatile &>);
+static_assert(callable_traits<decltype(lambda_267)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_267)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_267)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_267)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_267)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_267)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_267)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_267)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_267)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_267)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_267)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_267)>::class_type, std::remove_const_t<decltype(lambda_267)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_267)>, bool * const &(volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_267)>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_267), 0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_267), 1>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_267)>, type_list<volatile int * volatile &, const volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_267)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_267)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_267)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_267)> == callable_traits<decltype(lambda_267)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_267)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_267)>, std::remove_const_t<decltype(lambda_267)>>);
+[[maybe_unused]] const auto lambda_269 = [](volatile int * const volatile &, const volatile int * const volatile &, ...) mutable -> volatile bool * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::signature_type, volatile bool * const &(volatile int * const volatile &, const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::result_type, volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_269)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_269)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_269)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_269)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::arg0_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::arg_type<0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::arg1_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::arg_type<1>, const volatile int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_269)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_269)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_269)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_269)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_269)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_269)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_269)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_269)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_269)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_269)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_269)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_269)>::class_type, std::remove_const_t<decltype(lambda_269)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_269)>, volatile bool * const &(volatile int * const volatile &, const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_269)>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_269), 0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_269), 1>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_269)>, type_list<volatile int * const volatile &, const volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_269)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_269)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_269)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_269)> == callable_traits<decltype(lambda_269)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_269)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_269)>, std::remove_const_t<decltype(lambda_269)>>);
+[[maybe_unused]] const auto lambda_271 = [](volatile int &&, const volatile int &&, ...) mutable noexcept -> bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::signature_type, bool * volatile &(volatile int &&, const volatile int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::result_type, bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_271)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_271)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_271)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_271)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::arg_type<0>, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::arg1_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::arg_type<1>, const volatile int &&>);
+static_assert(callable_traits<decltype(lambda_271)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_271)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_271)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_271)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_271)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_271)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_271)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_271)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_271)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_271)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_271)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_271)>::class_type, std::remove_const_t<decltype(lambda_271)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_271)>, bool * volatile &(volatile int &&, const volatile int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_271)>, bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_271), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_271), 1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_271)>, type_list<volatile int &&, const volatile int &&>>);
+static_assert(callable_arity_v<decltype(lambda_271)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_271)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_271)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_271)> == callable_traits<decltype(lambda_271)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_271)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_271)>, std::remove_const_t<decltype(lambda_271)>>);
+[[maybe_unused]] const auto lambda_273 = [](volatile int * &&, const volatile int * &&, ...) mutable -> volatile bool * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::signature_type, volatile bool * volatile &(volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::result_type, volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_273)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_273)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_273)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_273)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::arg0_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::arg_type<0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::arg1_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::arg_type<1>, const volatile int * &&>);
+static_assert(callable_traits<decltype(lambda_273)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_273)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_273)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_273)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_273)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_273)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_273)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_273)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_273)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_273)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_273)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_273)>::class_type, std::remove_const_t<decltype(lambda_273)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_273)>, volatile bool * volatile &(volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_273)>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_273), 0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_273), 1>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_273)>, type_list<volatile int * &&, const volatile int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_273)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_273)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_273)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_273)> == callable_traits<decltype(lambda_273)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_273)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_273)>, std::remove_const_t<decltype(lambda_273)>>);
+[[maybe_unused]] const auto lambda_275 = [](volatile int * const &&, const volatile int * const &&, ...) mutable noexcept -> bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::signature_type, bool * const volatile &(volatile int * const &&, const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::result_type, bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_275)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_275)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_275)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_275)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::arg0_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::arg_type<0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::arg1_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::arg_type<1>, const volatile int * const &&>);
+static_assert(callable_traits<decltype(lambda_275)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_275)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_275)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_275)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_275)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_275)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_275)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_275)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_275)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_275)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_275)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_275)>::class_type, std::remove_const_t<decltype(lambda_275)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_275)>, bool * const volatile &(volatile int * const &&, const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_275)>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_275), 0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_275), 1>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_275)>, type_list<volatile int * const &&, const volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_275)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_275)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_275)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_275)> == callable_traits<decltype(lambda_275)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_275)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_275)>, std::remove_const_t<decltype(lambda_275)>>);
+[[maybe_unused]] const auto lambda_277 = [](volatile int * volatile &&, const volatile int * volatile &&, ...) mutable -> volatile bool * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::signature_type, volatile bool * const volatile &(volatile int * volatile &&, const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::result_type, volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_277)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_277)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_277)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_277)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::arg1_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::arg_type<1>, const volatile int * volatile &&>);
+static_assert(callable_traits<decltype(lambda_277)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_277)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_277)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_277)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_277)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_277)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_277)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_277)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_277)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_277)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_277)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_277)>::class_type, std::remove_const_t<decltype(lambda_277)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_277)>, volatile bool * const volatile &(volatile int * volatile &&, const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_277)>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_277), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_277), 1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_277)>, type_list<volatile int * volatile &&, const volatile int * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_277)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_277)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_277)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_277)> == callable_traits<decltype(lambda_277)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_277)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_277)>, std::remove_const_t<decltype(lambda_277)>>);
+[[maybe_unused]] const auto lambda_279 = [](volatile int * const volatile &&, const volatile int * const volatile &&, ...) mutable noexcept -> bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::signature_type, bool &&(volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::result_type, bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_279)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_279)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_279)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_279)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::arg0_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::arg_type<0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::arg1_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::arg_type<1>, const volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_279)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_279)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_279)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_279)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_279)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_279)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_279)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_279)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_279)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_279)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_279)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_279)>::class_type, std::remove_const_t<decltype(lambda_279)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_279)>, bool &&(volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_279)>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_279), 0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_279), 1>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_279)>, type_list<volatile int * const volatile &&, const volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_279)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_279)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_279)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_279)> == callable_traits<decltype(lambda_279)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_279)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_279)>, std::remove_const_t<decltype(lambda_279)>>);
+[[maybe_unused]] const auto lambda_281 = [](const float *, volatile float *, ...) mutable -> volatile bool && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::signature_type, volatile bool &&(const float *, volatile float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::result_type, volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_281)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_281)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_281)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_281)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::arg0_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::arg_type<0>, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::arg1_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::arg_type<1>, volatile float *>);
+static_assert(callable_traits<decltype(lambda_281)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_281)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_281)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_281)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_281)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_281)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_281)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_281)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_281)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_281)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_281)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_281)>::class_type, std::remove_const_t<decltype(lambda_281)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_281)>, volatile bool &&(const float *, volatile float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_281)>, volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_281), 0>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_281), 1>, volatile float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_281)>, type_list<const float *, volatile float *>>);
+static_assert(callable_arity_v<decltype(lambda_281)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_281)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_281)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_281)> == callable_traits<decltype(lambda_281)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_281)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_281)>, std::remove_const_t<decltype(lambda_281)>>);
+[[maybe_unused]] const auto lambda_283 = [](const float &, volatile float &, ...) mutable noexcept -> bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::signature_type, bool * &&(const float &, volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::result_type, bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_283)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_283)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_283)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_283)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::arg_type<0>, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::arg1_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::arg_type<1>, volatile float &>);
+static_assert(callable_traits<decltype(lambda_283)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_283)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_283)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_283)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_283)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_283)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_283)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_283)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_283)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_283)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_283)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_283)>::class_type, std::remove_const_t<decltype(lambda_283)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_283)>, bool * &&(const float &, volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_283)>, bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_283), 0>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_283), 1>, volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_283)>, type_list<const float &, volatile float &>>);
+static_assert(callable_arity_v<decltype(lambda_283)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_283)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_283)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_283)> == callable_traits<decltype(lambda_283)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_283)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_283)>, std::remove_const_t<decltype(lambda_283)>>);
+[[maybe_unused]] const auto lambda_285 = [](const float * &, volatile float * &, ...) mutable -> volatile bool * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::signature_type, volatile bool * &&(const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::result_type, volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_285)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_285)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_285)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_285)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::arg0_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::arg_type<0>, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::arg1_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::arg_type<1>, volatile float * &>);
+static_assert(callable_traits<decltype(lambda_285)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_285)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_285)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_285)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_285)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_285)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_285)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_285)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_285)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_285)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_285)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_285)>::class_type, std::remove_const_t<decltype(lambda_285)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_285)>, volatile bool * &&(const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_285)>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_285), 0>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_285), 1>, volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_285)>, type_list<const float * &, volatile float * &>>);
+static_assert(callable_arity_v<decltype(lambda_285)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_285)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_285)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_285)> == callable_traits<decltype(lambda_285)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_285)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_285)>, std::remove_const_t<decltype(lambda_285)>>);
+[[maybe_unused]] const auto lambda_287 = [](const float * const &, volatile float * const &, ...) mutable noexcept -> bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::signature_type, bool * const &&(const float * const &, volatile float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::result_type, bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_287)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_287)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_287)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_287)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::arg0_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::arg_type<0>, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::arg1_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::arg_type<1>, volatile float * const &>);
+static_assert(callable_traits<decltype(lambda_287)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_287)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_287)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_287)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_287)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_287)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_287)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_287)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_287)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_287)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_287)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_287)>::class_type, std::remove_const_t<decltype(lambda_287)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_287)>, bool * const &&(const float * const &, volatile float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_287)>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_287), 0>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_287), 1>, volatile float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_287)>, type_list<const float * const &, volatile float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_287)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_287)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_287)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_287)> == callable_traits<decltype(lambda_287)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_287)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_287)>, std::remove_const_t<decltype(lambda_287)>>);
+[[maybe_unused]] const auto lambda_289 = [](const float * volatile &, volatile float * volatile &, ...) mutable -> volatile bool * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::signature_type, volatile bool * const &&(const float * volatile &, volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::result_type, volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_289)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_289)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_289)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_289)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::arg_type<0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::arg1_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::arg_type<1>, volatile float * volatile &>);
+static_assert(callable_traits<decltype(lambda_289)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_289)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_289)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_289)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_289)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_289)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_289)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_289)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_289)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_289)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_289)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_289)>::class_type, std::remove_const_t<decltype(lambda_289)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_289)>, volatile bool * const &&(const float * volatile &, volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_289)>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_289), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_289), 1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_289)>, type_list<const float * volatile &, volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_289)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_289)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_289)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_289)> == callable_traits<decltype(lambda_289)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_289)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_289)>, std::remove_const_t<decltype(lambda_289)>>);
+[[maybe_unused]] const auto lambda_291 = [](const float * const volatile &, volatile float * const volatile &, ...) mutable noexcept -> bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::signature_type, bool * volatile &&(const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::result_type, bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_291)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_291)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_291)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_291)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::arg0_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::arg_type<0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::arg1_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::arg_type<1>, volatile float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_291)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_291)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_291)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_291)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_291)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_291)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_291)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_291)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_291)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_291)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_291)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_291)>::class_type, std::remove_const_t<decltype(lambda_291)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_291)>, bool * volatile &&(const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_291)>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_291), 0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_291), 1>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_291)>, type_list<const float * const volatile &, volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_291)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_291)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_291)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_291)> == callable_traits<decltype(lambda_291)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_291)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_291)>, std::remove_const_t<decltype(lambda_291)>>);
+[[maybe_unused]] const auto lambda_293 = [](const float &&, volatile float &&, ...) mutable -> volatile bool * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::signature_type, volatile bool * volatile &&(const float &&, volatile float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::result_type, volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_293)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_293)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_293)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_293)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::arg0_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::arg_type<0>, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::arg1_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::arg_type<1>, volatile float &&>);
+static_assert(callable_traits<decltype(lambda_293)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_293)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_293)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_293)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_293)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_293)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_293)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_293)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_293)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_293)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_293)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_293)>::class_type, std::remove_const_t<decltype(lambda_293)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_293)>, volatile bool * volatile &&(const float &&, volatile float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_293)>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_293), 0>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_293), 1>, volatile float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_293)>, type_list<const float &&, volatile float &&>>);
+static_assert(callable_arity_v<decltype(lambda_293)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_293)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_293)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_293)> == callable_traits<decltype(lambda_293)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_293)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_293)>, std::remove_const_t<decltype(lambda_293)>>);
+[[maybe_unused]] const auto lambda_295 = [](const float * &&, volatile float * &&, ...) mutable noexcept -> bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::signature_type, bool * const volatile &&(const float * &&, volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::result_type, bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_295)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_295)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_295)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_295)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::arg_type<0>, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::arg1_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::arg_type<1>, volatile float * &&>);
+static_assert(callable_traits<decltype(lambda_295)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_295)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_295)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_295)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_295)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_295)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_295)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_295)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_295)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_295)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_295)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_295)>::class_type, std::remove_const_t<decltype(lambda_295)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_295)>, bool * const volatile &&(const float * &&, volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_295)>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_295), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_295), 1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_295)>, type_list<const float * &&, volatile float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_295)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_295)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_295)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_295)> == callable_traits<decltype(lambda_295)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_295)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_295)>, std::remove_const_t<decltype(lambda_295)>>);
+[[maybe_unused]] const auto lambda_297 = [](const float * const &&, volatile float * const &&, ...) mutable -> volatile bool * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::signature_type, volatile bool * const volatile &&(const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::result_type, volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_297)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_297)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_297)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_297)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::arg0_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::arg_type<0>, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::arg1_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::arg_type<1>, volatile float * const &&>);
+static_assert(callable_traits<decltype(lambda_297)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_297)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_297)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_297)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_297)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_297)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_297)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_297)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_297)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_297)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_297)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_297)>::class_type, std::remove_const_t<decltype(lambda_297)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_297)>, volatile bool * const volatile &&(const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_297)>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_297), 0>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_297), 1>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_297)>, type_list<const float * const &&, volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_297)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_297)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_297)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_297)> == callable_traits<decltype(lambda_297)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_297)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_297)>, std::remove_const_t<decltype(lambda_297)>>);
+[[maybe_unused]] const auto lambda_299 = [](const float * volatile &&, volatile float * volatile &&, ...) mutable noexcept -> int {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::signature_type, int(const float * volatile &&, volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::result_type, int>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_299)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_299)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_299)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_299)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::arg0_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::arg_type<0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::arg1_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::arg_type<1>, volatile float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_299)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_299)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_299)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_299)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_299)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_299)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_299)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_299)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_299)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_299)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_299)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_299)>::class_type, std::remove_const_t<decltype(lambda_299)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_299)>, int(const float * volatile &&, volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_299)>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_299), 0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_299), 1>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_299)>, type_list<const float * volatile &&, volatile float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_299)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_299)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_299)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_299)> == callable_traits<decltype(lambda_299)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_299)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_299)>, std::remove_const_t<decltype(lambda_299)>>);
+[[maybe_unused]] const auto lambda_301 = [](const float * const volatile &&, volatile float * const volatile &&, ...) mutable -> const int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::signature_type, const int *(const float * const volatile &&, volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::result_type, const int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_301)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_301)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_301)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_301)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::arg_type<0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::arg1_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::arg_type<1>, volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_301)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_301)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_301)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_301)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_301)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_301)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_301)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_301)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_301)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_301)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_301)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_301)>::class_type, std::remove_const_t<decltype(lambda_301)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_301)>, const int *(const float * const volatile &&, volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_301)>, const int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_301), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_301), 1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_301)>, type_list<const float * const volatile &&, volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_301)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_301)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_301)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_301)> == callable_traits<decltype(lambda_301)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_301)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_301)>, std::remove_const_t<decltype(lambda_301)>>);
+[[maybe_unused]] const auto lambda_303 = [](std::string *, const std::string *, ...) mutable noexcept -> const volatile int * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::signature_type, const volatile int *(std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::result_type, const volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_303)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_303)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_303)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_303)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::arg0_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::arg_type<0>, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::arg1_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::arg_type<1>, const std::string *>);
+static_assert(callable_traits<decltype(lambda_303)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_303)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_303)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_303)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_303)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_303)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_303)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_303)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_303)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_303)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_303)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_303)>::class_type, std::remove_const_t<decltype(lambda_303)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_303)>, const volatile int *(std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_303)>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_303), 0>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_303), 1>, const std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_303)>, type_list<std::string *, const std::string *>>);
+static_assert(callable_arity_v<decltype(lambda_303)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_303)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_303)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_303)> == callable_traits<decltype(lambda_303)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_303)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_303)>, std::remove_const_t<decltype(lambda_303)>>);
+[[maybe_unused]] const auto lambda_305 = [](std::string &, const std::string &, ...) mutable -> const int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::signature_type, const int &(std::string &, const std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::result_type, const int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_305)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_305)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_305)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_305)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::arg0_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::arg_type<0>, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::arg1_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::arg_type<1>, const std::string &>);
+static_assert(callable_traits<decltype(lambda_305)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_305)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_305)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_305)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_305)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_305)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_305)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_305)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_305)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_305)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_305)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_305)>::class_type, std::remove_const_t<decltype(lambda_305)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_305)>, const int &(std::string &, const std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_305)>, const int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_305), 0>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_305), 1>, const std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_305)>, type_list<std::string &, const std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_305)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_305)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_305)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_305)> == callable_traits<decltype(lambda_305)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_305)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_305)>, std::remove_const_t<decltype(lambda_305)>>);
+[[maybe_unused]] const auto lambda_307 = [](std::string * &, const std::string * &, ...) mutable noexcept -> const volatile int & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::signature_type, const volatile int &(std::string * &, const std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::result_type, const volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_307)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_307)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_307)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_307)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::arg_type<0>, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::arg1_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::arg_type<1>, const std::string * &>);
+static_assert(callable_traits<decltype(lambda_307)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_307)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_307)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_307)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_307)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_307)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_307)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_307)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_307)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_307)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_307)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_307)>::class_type, std::remove_const_t<decltype(lambda_307)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_307)>, const volatile int &(std::string * &, const std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_307)>, const volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_307), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_307), 1>, const std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_307)>, type_list<std::string * &, const std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_307)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_307)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_307)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_307)> == callable_traits<decltype(lambda_307)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_307)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_307)>, std::remove_const_t<decltype(lambda_307)>>);
+[[maybe_unused]] const auto lambda_309 = [](std::string * const &, const std::string * const &, ...) mutable -> const int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::signature_type, const int * &(std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::result_type, const int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_309)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_309)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_309)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_309)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::arg0_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::arg_type<0>, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::arg1_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::arg_type<1>, const std::string * const &>);
+static_assert(callable_traits<decltype(lambda_309)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_309)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_309)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_309)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_309)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_309)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_309)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_309)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_309)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_309)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_309)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_309)>::class_type, std::remove_const_t<decltype(lambda_309)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_309)>, const int * &(std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_309)>, const int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_309), 0>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_309), 1>, const std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_309)>, type_list<std::string * const &, const std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_309)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_309)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_309)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_309)> == callable_traits<decltype(lambda_309)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_309)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_309)>, std::remove_const_t<decltype(lambda_309)>>);
+[[maybe_unused]] const auto lambda_311 = [](std::string * volatile &, const std::string * volatile &, ...) mutable noexcept -> const volatile int * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::signature_type, const volatile int * &(std::string * volatile &, const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::result_type, const volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_311)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_311)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_311)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_311)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::arg0_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::arg_type<0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::arg1_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::arg_type<1>, const std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_311)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_311)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_311)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_311)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_311)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_311)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_311)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_311)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_311)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_311)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_311)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_311)>::class_type, std::remove_const_t<decltype(lambda_311)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_311)>, const volatile int * &(std::string * volatile &, const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_311)>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_311), 0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_311), 1>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_311)>, type_list<std::string * volatile &, const std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_311)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_311)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_311)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_311)> == callable_traits<decltype(lambda_311)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_311)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_311)>, std::remove_const_t<decltype(lambda_311)>>);
+[[maybe_unused]] const auto lambda_313 = [](std::string * const volatile &, const std::string * const volatile &, ...) mutable -> const int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::signature_type, const int * const &(std::string * const volatile &, const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::result_type, const int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_313)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_313)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_313)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_313)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::arg_type<0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::arg1_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::arg_type<1>, const std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_313)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_313)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_313)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_313)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_313)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_313)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_313)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_313)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_313)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_313)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_313)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_313)>::class_type, std::remove_const_t<decltype(lambda_313)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_313)>, const int * const &(std::string * const volatile &, const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_313)>, const int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_313), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_313), 1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_313)>, type_list<std::string * const volatile &, const std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_313)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_313)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_313)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_313)> == callable_traits<decltype(lambda_313)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_313)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_313)>, std::remove_const_t<decltype(lambda_313)>>);
+[[maybe_unused]] const auto lambda_315 = [](std::string &&, const std::string &&, ...) mutable noexcept -> const volatile int * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::signature_type, const volatile int * const &(std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::result_type, const volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_315)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_315)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_315)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_315)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::arg0_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::arg_type<0>, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::arg1_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::arg_type<1>, const std::string &&>);
+static_assert(callable_traits<decltype(lambda_315)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_315)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_315)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_315)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_315)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_315)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_315)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_315)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_315)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_315)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_315)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_315)>::class_type, std::remove_const_t<decltype(lambda_315)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_315)>, const volatile int * const &(std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_315)>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_315), 0>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_315), 1>, const std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_315)>, type_list<std::string &&, const std::string &&>>);
+static_assert(callable_arity_v<decltype(lambda_315)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_315)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_315)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_315)> == callable_traits<decltype(lambda_315)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_315)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_315)>, std::remove_const_t<decltype(lambda_315)>>);
+[[maybe_unused]] const auto lambda_317 = [](std::string * &&, const std::string * &&, ...) mutable -> const int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::signature_type, const int * volatile &(std::string * &&, const std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::result_type, const int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_317)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_317)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_317)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_317)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::arg0_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::arg_type<0>, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::arg1_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::arg_type<1>, const std::string * &&>);
+static_assert(callable_traits<decltype(lambda_317)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_317)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_317)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_317)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_317)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_317)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_317)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_317)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_317)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_317)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_317)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_317)>::class_type, std::remove_const_t<decltype(lambda_317)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_317)>, const int * volatile &(std::string * &&, const std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_317)>, const int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_317), 0>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_317), 1>, const std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_317)>, type_list<std::string * &&, const std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_317)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_317)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_317)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_317)> == callable_traits<decltype(lambda_317)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_317)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_317)>, std::remove_const_t<decltype(lambda_317)>>);
+[[maybe_unused]] const auto lambda_319 = [](std::string * const &&, const std::string * const &&, ...) mutable noexcept -> const volatile int * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::signature_type, const volatile int * volatile &(std::string * const &&, const std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::result_type, const volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_319)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_319)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_319)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_319)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::arg_type<0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::arg1_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::arg_type<1>, const std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_319)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_319)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_319)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_319)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_319)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_319)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_319)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_319)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_319)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_319)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_319)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_319)>::class_type, std::remove_const_t<decltype(lambda_319)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_319)>, const volatile int * volatile &(std::string * const &&, const std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_319)>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_319), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_319), 1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_319)>, type_list<std::string * const &&, const std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_319)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_319)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_319)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_319)> == callable_traits<decltype(lambda_319)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_319)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_319)>, std::remove_const_t<decltype(lambda_319)>>);
+[[maybe_unused]] const auto lambda_321 = [](std::string * volatile &&, const std::string * volatile &&, ...) mutable -> const int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::signature_type, const int * const volatile &(std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::result_type, const int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_321)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_321)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_321)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_321)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::arg0_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::arg_type<0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::arg1_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::arg_type<1>, const std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_321)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_321)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_321)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_321)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_321)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_321)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_321)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_321)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_321)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_321)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_321)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_321)>::class_type, std::remove_const_t<decltype(lambda_321)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_321)>, const int * const volatile &(std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_321)>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_321), 0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_321), 1>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_321)>, type_list<std::string * volatile &&, const std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_321)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_321)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_321)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_321)> == callable_traits<decltype(lambda_321)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_321)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_321)>, std::remove_const_t<decltype(lambda_321)>>);
+[[maybe_unused]] const auto lambda_323 = [](std::string * const volatile &&, const std::string * const volatile &&, ...) mutable noexcept -> const volatile int * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::signature_type, const volatile int * const volatile &(std::string * const volatile &&, const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::result_type, const volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_323)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_323)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_323)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_323)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::arg0_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::arg_type<0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::arg1_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::arg_type<1>, const std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_323)>::arity == 2);
+static_assert(callable_traits<decltype(lambda_323)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_323)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_323)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_323)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_323)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_323)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_323)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_323)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_323)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_323)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_323)>::class_type, std::remove_const_t<decltype(lambda_323)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_323)>, const volatile int * const volatile &(std::string * const volatile &&, const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_323)>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_323), 0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_323), 1>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_323)>, type_list<std::string * const volatile &&, const std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_323)> == 2);
+static_assert(callable_is_functor_v<decltype(lambda_323)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_323)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_323)> == callable_traits<decltype(lambda_323)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_323)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_323)>, std::remove_const_t<decltype(lambda_323)>>);
+[[maybe_unused]] const auto lambda_325 = [](void *, const void *, volatile void *, ...) mutable -> const int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::signature_type, const int &&(void *, const void *, volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::result_type, const int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_325)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_325)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_325)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_325)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::arg_type<0>, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::arg1_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::arg_type<1>, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::arg2_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::arg_type<2>, volatile void *>);
+static_assert(callable_traits<decltype(lambda_325)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_325)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_325)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_325)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_325)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_325)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_325)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_325)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_325)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_325)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_325)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_325)>::class_type, std::remove_const_t<decltype(lambda_325)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_325)>, const int &&(void *, const void *, volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_325)>, const int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_325), 0>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_325), 1>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_325), 2>, volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_325)>, type_list<void *, const void *, volatile void *>>);
+static_assert(callable_arity_v<decltype(lambda_325)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_325)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_325)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_325)> == callable_traits<decltype(lambda_325)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_325)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_325)>, std::remove_const_t<decltype(lambda_325)>>);
+[[maybe_unused]] const auto lambda_327 = [](volatile void * &, const volatile void * &, void * const &, ...) mutable noexcept -> const volatile int && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::signature_type, const volatile int &&(volatile void * &, const volatile void * &, void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::result_type, const volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_327)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_327)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_327)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_327)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::arg0_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::arg_type<0>, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::arg1_type, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::arg_type<1>, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::arg2_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::arg_type<2>, void * const &>);
+static_assert(callable_traits<decltype(lambda_327)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_327)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_327)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_327)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_327)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_327)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_327)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_327)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_327)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_327)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_327)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_327)>::class_type, std::remove_const_t<decltype(lambda_327)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_327)>, const volatile int &&(volatile void * &, const volatile void * &, void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_327)>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_327), 0>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_327), 1>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_327), 2>, void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_327)>, type_list<volatile void * &, const volatile void * &, void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_327)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_327)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_327)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_327)> == callable_traits<decltype(lambda_327)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_327)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_327)>, std::remove_const_t<decltype(lambda_327)>>);
+[[maybe_unused]] const auto lambda_329 = [](void * volatile &, const void * volatile &, volatile void * volatile &, ...) mutable -> const int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::signature_type, const int * &&(void * volatile &, const void * volatile &, volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::result_type, const int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_329)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_329)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_329)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_329)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::arg_type<0>, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::arg1_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::arg_type<1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::arg2_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::arg_type<2>, volatile void * volatile &>);
+static_assert(callable_traits<decltype(lambda_329)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_329)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_329)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_329)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_329)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_329)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_329)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_329)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_329)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_329)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_329)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_329)>::class_type, std::remove_const_t<decltype(lambda_329)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_329)>, const int * &&(void * volatile &, const void * volatile &, volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_329)>, const int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_329), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_329), 1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_329), 2>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_329)>, type_list<void * volatile &, const void * volatile &, volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_329)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_329)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_329)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_329)> == callable_traits<decltype(lambda_329)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_329)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_329)>, std::remove_const_t<decltype(lambda_329)>>);
+[[maybe_unused]] const auto lambda_331 = [](volatile void * const volatile &, const volatile void * const volatile &, void * &&, ...) mutable noexcept -> const volatile int * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::signature_type, const volatile int * &&(volatile void * const volatile &, const volatile void * const volatile &, void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::result_type, const volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_331)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_331)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_331)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_331)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::arg0_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::arg_type<0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::arg1_type, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::arg_type<1>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::arg2_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::arg_type<2>, void * &&>);
+static_assert(callable_traits<decltype(lambda_331)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_331)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_331)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_331)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_331)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_331)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_331)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_331)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_331)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_331)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_331)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_331)>::class_type, std::remove_const_t<decltype(lambda_331)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_331)>, const volatile int * &&(volatile void * const volatile &, const volatile void * const volatile &, void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_331)>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_331), 0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_331), 1>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_331), 2>, void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_331)>, type_list<volatile void * const volatile &, const volatile void * const volatile &, void * &&>>);
+static_assert(callable_arity_v<decltype(lambda_331)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_331)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_331)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_331)> == callable_traits<decltype(lambda_331)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_331)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_331)>, std::remove_const_t<decltype(lambda_331)>>);
+[[maybe_unused]] const auto lambda_333 = [](void * const &&, const void * const &&, volatile void * const &&, ...) mutable -> const int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::signature_type, const int * const &&(void * const &&, const void * const &&, volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::result_type, const int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_333)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_333)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_333)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_333)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::arg_type<0>, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::arg1_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::arg_type<1>, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::arg2_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::arg_type<2>, volatile void * const &&>);
+static_assert(callable_traits<decltype(lambda_333)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_333)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_333)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_333)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_333)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_333)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_333)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_333)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_333)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_333)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_333)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_333)>::class_type, std::remove_const_t<decltype(lambda_333)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_333)>, const int * const &&(void * const &&, const void * const &&, volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_333)>, const int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_333), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_333), 1>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_333), 2>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_333)>, type_list<void * const &&, const void * const &&, volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_333)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_333)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_333)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_333)> == callable_traits<decltype(lambda_333)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_333)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_333)>, std::remove_const_t<decltype(lambda_333)>>);
+[[maybe_unused]] const auto lambda_335 = [](volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&, ...) mutable noexcept -> const volatile int * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::signature_type, const volatile int * const &&(volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::result_type, const volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_335)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_335)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_335)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_335)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::arg0_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::arg_type<0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::arg1_type, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::arg_type<1>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::arg2_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::arg_type<2>, void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_335)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_335)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_335)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_335)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_335)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_335)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_335)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_335)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_335)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_335)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_335)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_335)>::class_type, std::remove_const_t<decltype(lambda_335)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_335)>, const volatile int * const &&(volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_335)>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_335), 0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_335), 1>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_335), 2>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_335)>, type_list<volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_335)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_335)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_335)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_335)> == callable_traits<decltype(lambda_335)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_335)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_335)>, std::remove_const_t<decltype(lambda_335)>>);
+[[maybe_unused]] const auto lambda_337 = [](bool, bool *, const bool *, ...) mutable -> const int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::signature_type, const int * volatile &&(bool, bool *, const bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::result_type, const int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_337)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_337)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_337)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_337)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::arg_type<0>, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::arg1_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::arg_type<1>, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::arg2_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::arg_type<2>, const bool *>);
+static_assert(callable_traits<decltype(lambda_337)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_337)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_337)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_337)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_337)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_337)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_337)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_337)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_337)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_337)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_337)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_337)>::class_type, std::remove_const_t<decltype(lambda_337)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_337)>, const int * volatile &&(bool, bool *, const bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_337)>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_337), 0>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_337), 1>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_337), 2>, const bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_337)>, type_list<bool, bool *, const bool *>>);
+static_assert(callable_arity_v<decltype(lambda_337)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_337)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_337)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_337)> == callable_traits<decltype(lambda_337)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_337)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_337)>, std::remove_const_t<decltype(lambda_337)>>);
+[[maybe_unused]] const auto lambda_339 = [](const bool &, volatile bool &, const volatile bool &, ...) mutable noexcept -> const volatile int * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::signature_type, const volatile int * volatile &&(const bool &, volatile bool &, const volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::result_type, const volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_339)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_339)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_339)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_339)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::arg0_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::arg_type<0>, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::arg1_type, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::arg_type<1>, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::arg2_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::arg_type<2>, const volatile bool &>);
+static_assert(callable_traits<decltype(lambda_339)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_339)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_339)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_339)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_339)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_339)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_339)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_339)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_339)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_339)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_339)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_339)>::class_type, std::remove_const_t<decltype(lambda_339)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_339)>, const volatile int * volatile &&(const bool &, volatile bool &, const volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_339)>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_339), 0>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_339), 1>, volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_339), 2>, const volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_339)>, type_list<const bool &, volatile bool &, const volatile bool &>>);
+static_assert(callable_arity_v<decltype(lambda_339)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_339)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_339)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_339)> == callable_traits<decltype(lambda_339)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_339)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_339)>, std::remove_const_t<decltype(lambda_339)>>);
+[[maybe_unused]] const auto lambda_341 = [](const volatile bool * &, bool * const &, const bool * const &, ...) mutable -> const int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::signature_type, const int * const volatile &&(const volatile bool * &, bool * const &, const bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::result_type, const int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_341)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_341)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_341)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_341)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::arg_type<0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::arg1_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::arg_type<1>, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::arg2_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::arg_type<2>, const bool * const &>);
+static_assert(callable_traits<decltype(lambda_341)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_341)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_341)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_341)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_341)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_341)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_341)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_341)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_341)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_341)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_341)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_341)>::class_type, std::remove_const_t<decltype(lambda_341)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_341)>, const int * const volatile &&(const volatile bool * &, bool * const &, const bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_341)>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_341), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_341), 1>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_341), 2>, const bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_341)>, type_list<const volatile bool * &, bool * const &, const bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_341)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_341)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_341)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_341)> == callable_traits<decltype(lambda_341)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_341)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_341)>, std::remove_const_t<decltype(lambda_341)>>);
+[[maybe_unused]] const auto lambda_343 = [](const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &, ...) mutable noexcept -> const volatile int * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::signature_type, const volatile int * const volatile &&(const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::result_type, const volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_343)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_343)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_343)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_343)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::arg0_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::arg_type<0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::arg1_type, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::arg_type<1>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::arg2_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::arg_type<2>, const volatile bool * volatile &>);
+static_assert(callable_traits<decltype(lambda_343)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_343)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_343)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_343)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_343)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_343)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_343)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_343)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_343)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_343)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_343)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_343)>::class_type, std::remove_const_t<decltype(lambda_343)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_343)>, const volatile int * const volatile &&(const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_343)>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_343), 0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_343), 1>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_343), 2>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_343)>, type_list<const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_343)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_343)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_343)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_343)> == callable_traits<decltype(lambda_343)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_343)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_343)>, std::remove_const_t<decltype(lambda_343)>>);
+[[maybe_unused]] const auto lambda_345 = [](const volatile bool * const volatile &, bool &&, const bool &&, ...) mutable -> float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::signature_type, float *(const volatile bool * const volatile &, bool &&, const bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::result_type, float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_345)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_345)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_345)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_345)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::arg1_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::arg_type<1>, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::arg2_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::arg_type<2>, const bool &&>);
+static_assert(callable_traits<decltype(lambda_345)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_345)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_345)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_345)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_345)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_345)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_345)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_345)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_345)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_345)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_345)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_345)>::class_type, std::remove_const_t<decltype(lambda_345)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_345)>, float *(const volatile bool * const volatile &, bool &&, const bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_345)>, float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_345), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_345), 1>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_345), 2>, const bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_345)>, type_list<const volatile bool * const volatile &, bool &&, const bool &&>>);
+static_assert(callable_arity_v<decltype(lambda_345)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_345)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_345)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_345)> == callable_traits<decltype(lambda_345)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_345)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_345)>, std::remove_const_t<decltype(lambda_345)>>);
+[[maybe_unused]] const auto lambda_347 = [](const bool * &&, volatile bool * &&, const volatile bool * &&, ...) mutable noexcept -> volatile float * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::signature_type, volatile float *(const bool * &&, volatile bool * &&, const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::result_type, volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_347)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_347)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_347)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_347)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::arg0_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::arg_type<0>, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::arg1_type, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::arg_type<1>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::arg2_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::arg_type<2>, const volatile bool * &&>);
+static_assert(callable_traits<decltype(lambda_347)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_347)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_347)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_347)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_347)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_347)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_347)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_347)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_347)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_347)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_347)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_347)>::class_type, std::remove_const_t<decltype(lambda_347)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_347)>, volatile float *(const bool * &&, volatile bool * &&, const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_347)>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_347), 0>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_347), 1>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_347), 2>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_347)>, type_list<const bool * &&, volatile bool * &&, const volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_347)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_347)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_347)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_347)> == callable_traits<decltype(lambda_347)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_347)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_347)>, std::remove_const_t<decltype(lambda_347)>>);
+[[maybe_unused]] const auto lambda_349 = [](const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, ...) mutable -> float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::signature_type, float &(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::result_type, float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_349)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_349)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_349)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_349)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::arg1_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::arg_type<1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::arg2_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::arg_type<2>, const bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_349)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_349)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_349)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_349)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_349)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_349)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_349)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_349)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_349)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_349)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_349)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_349)>::class_type, std::remove_const_t<decltype(lambda_349)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_349)>, float &(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_349)>, float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_349), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_349), 1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_349), 2>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_349)>, type_list<const volatile bool * const &&, bool * volatile &&, const bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_349)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_349)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_349)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_349)> == callable_traits<decltype(lambda_349)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_349)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_349)>, std::remove_const_t<decltype(lambda_349)>>);
+[[maybe_unused]] const auto lambda_351 = [](const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&, ...) mutable noexcept -> volatile float & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::signature_type, volatile float &(const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::result_type, volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_351)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_351)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_351)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_351)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::arg0_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::arg_type<0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::arg1_type, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::arg_type<1>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::arg2_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::arg_type<2>, const volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_351)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_351)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_351)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_351)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_351)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_351)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_351)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_351)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_351)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_351)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_351)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_351)>::class_type, std::remove_const_t<decltype(lambda_351)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_351)>, volatile float &(const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_351)>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_351), 0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_351), 1>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_351), 2>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_351)>, type_list<const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_351)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_351)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_351)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_351)> == callable_traits<decltype(lambda_351)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_351)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_351)>, std::remove_const_t<decltype(lambda_351)>>);
+[[maybe_unused]] const auto lambda_353 = [](volatile int *, const volatile int *, int &, ...) mutable -> float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::signature_type, float * &(volatile int *, const volatile int *, int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::result_type, float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_353)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_353)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_353)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_353)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::arg_type<0>, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::arg1_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::arg_type<1>, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::arg2_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::arg_type<2>, int &>);
+static_assert(callable_traits<decltype(lambda_353)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_353)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_353)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_353)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_353)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_353)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_353)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_353)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_353)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_353)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_353)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_353)>::class_type, std::remove_const_t<decltype(lambda_353)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_353)>, float * &(volatile int *, const volatile int *, int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_353)>, float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_353), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_353), 1>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_353), 2>, int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_353)>, type_list<volatile int *, const volatile int *, int &>>);
+static_assert(callable_arity_v<decltype(lambda_353)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_353)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_353)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_353)> == callable_traits<decltype(lambda_353)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_353)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_353)>, std::remove_const_t<decltype(lambda_353)>>);
+[[maybe_unused]] const auto lambda_355 = [](int * &, const int * &, volatile int * &, ...) mutable noexcept -> volatile float * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::signature_type, volatile float * &(int * &, const int * &, volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::result_type, volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_355)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_355)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_355)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_355)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::arg0_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::arg_type<0>, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::arg1_type, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::arg_type<1>, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::arg2_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::arg_type<2>, volatile int * &>);
+static_assert(callable_traits<decltype(lambda_355)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_355)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_355)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_355)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_355)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_355)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_355)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_355)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_355)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_355)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_355)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_355)>::class_type, std::remove_const_t<decltype(lambda_355)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_355)>, volatile float * &(int * &, const int * &, volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_355)>, volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_355), 0>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_355), 1>, const int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_355), 2>, volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_355)>, type_list<int * &, const int * &, volatile int * &>>);
+static_assert(callable_arity_v<decltype(lambda_355)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_355)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_355)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_355)> == callable_traits<decltype(lambda_355)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_355)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_355)>, std::remove_const_t<decltype(lambda_355)>>);
+[[maybe_unused]] const auto lambda_357 = [](volatile int * const &, const volatile int * const &, int * volatile &, ...) mutable -> float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::signature_type, float * const &(volatile int * const &, const volatile int * const &, int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::result_type, float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_357)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_357)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_357)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_357)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::arg_type<0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::arg1_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::arg_type<1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::arg2_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::arg_type<2>, int * volatile &>);
+static_assert(callable_traits<decltype(lambda_357)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_357)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_357)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_357)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_357)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_357)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_357)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_357)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_357)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_357)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_357)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_357)>::class_type, std::remove_const_t<decltype(lambda_357)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_357)>, float * const &(volatile int * const &, const volatile int * const &, int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_357)>, float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_357), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_357), 1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_357), 2>, int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_357)>, type_list<volatile int * const &, const volatile int * const &, int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_357)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_357)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_357)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_357)> == callable_traits<decltype(lambda_357)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_357)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_357)>, std::remove_const_t<decltype(lambda_357)>>);
+[[maybe_unused]] const auto lambda_359 = [](int * const volatile &, const int * const volatile &, volatile int * const volatile &, ...) mutable noexcept -> volatile float * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::signature_type, volatile float * const &(int * const volatile &, const int * const volatile &, volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::result_type, volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_359)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_359)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_359)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_359)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::arg0_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::arg_type<0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::arg1_type, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::arg_type<1>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::arg2_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::arg_type<2>, volatile int * const volatile &>);
+static_assert(callable_traits<decltype(lambda_359)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_359)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_359)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_359)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_359)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_359)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_359)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_359)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_359)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_359)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_359)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_359)>::class_type, std::remove_const_t<decltype(lambda_359)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_359)>, volatile float * const &(int * const volatile &, const int * const volatile &, volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_359)>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_359), 0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_359), 1>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_359), 2>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_359)>, type_list<int * const volatile &, const int * const volatile &, volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_359)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_359)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_359)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_359)> == callable_traits<decltype(lambda_359)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_359)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_359)>, std::remove_const_t<decltype(lambda_359)>>);
+[[maybe_unused]] const auto lambda_361 = [](volatile int &&, const volatile int &&, int * &&, ...) mutable -> float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::signature_type, float * volatile &(volatile int &&, const volatile int &&, int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::result_type, float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_361)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_361)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_361)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_361)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::arg_type<0>, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::arg1_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::arg_type<1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::arg2_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::arg_type<2>, int * &&>);
+static_assert(callable_traits<decltype(lambda_361)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_361)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_361)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_361)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_361)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_361)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_361)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_361)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_361)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_361)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_361)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_361)>::class_type, std::remove_const_t<decltype(lambda_361)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_361)>, float * volatile &(volatile int &&, const volatile int &&, int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_361)>, float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_361), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_361), 1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_361), 2>, int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_361)>, type_list<volatile int &&, const volatile int &&, int * &&>>);
+static_assert(callable_arity_v<decltype(lambda_361)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_361)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_361)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_361)> == callable_traits<decltype(lambda_361)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_361)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_361)>, std::remove_const_t<decltype(lambda_361)>>);
+[[maybe_unused]] const auto lambda_363 = [](int * const &&, const int * const &&, volatile int * const &&, ...) mutable noexcept -> volatile float * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::signature_type, volatile float * volatile &(int * const &&, const int * const &&, volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::result_type, volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_363)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_363)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_363)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_363)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::arg0_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::arg_type<0>, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::arg1_type, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::arg_type<1>, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::arg2_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::arg_type<2>, volatile int * const &&>);
+static_assert(callable_traits<decltype(lambda_363)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_363)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_363)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_363)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_363)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_363)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_363)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_363)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_363)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_363)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_363)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_363)>::class_type, std::remove_const_t<decltype(lambda_363)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_363)>, volatile float * volatile &(int * const &&, const int * const &&, volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_363)>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_363), 0>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_363), 1>, const int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_363), 2>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_363)>, type_list<int * const &&, const int * const &&, volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_363)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_363)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_363)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_363)> == callable_traits<decltype(lambda_363)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_363)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_363)>, std::remove_const_t<decltype(lambda_363)>>);
+[[maybe_unused]] const auto lambda_365 = [](volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, ...) mutable -> float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::signature_type, float * const volatile &(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::result_type, float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_365)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_365)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_365)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_365)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::arg1_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::arg_type<1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::arg2_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::arg_type<2>, int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_365)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_365)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_365)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_365)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_365)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_365)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_365)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_365)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_365)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_365)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_365)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_365)>::class_type, std::remove_const_t<decltype(lambda_365)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_365)>, float * const volatile &(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_365)>, float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_365), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_365), 1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_365), 2>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_365)>, type_list<volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_365)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_365)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_365)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_365)> == callable_traits<decltype(lambda_365)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_365)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_365)>, std::remove_const_t<decltype(lambda_365)>>);
+[[maybe_unused]] const auto lambda_367 = [](float, float *, const float *, ...) mutable noexcept -> volatile float * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::signature_type, volatile float * const volatile &(float, float *, const float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::result_type, volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_367)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_367)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_367)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_367)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::arg0_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::arg_type<0>, float>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::arg1_type, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::arg_type<1>, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::arg2_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::arg_type<2>, const float *>);
+static_assert(callable_traits<decltype(lambda_367)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_367)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_367)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_367)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_367)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_367)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_367)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_367)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_367)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_367)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_367)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_367)>::class_type, std::remove_const_t<decltype(lambda_367)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_367)>, volatile float * const volatile &(float, float *, const float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_367)>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_367), 0>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_367), 1>, float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_367), 2>, const float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_367)>, type_list<float, float *, const float *>>);
+static_assert(callable_arity_v<decltype(lambda_367)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_367)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_367)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_367)> == callable_traits<decltype(lambda_367)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_367)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_367)>, std::remove_const_t<decltype(lambda_367)>>);
+[[maybe_unused]] const auto lambda_369 = [](const float &, volatile float &, const volatile float &, ...) mutable -> float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::signature_type, float &&(const float &, volatile float &, const volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::result_type, float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_369)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_369)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_369)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_369)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::arg_type<0>, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::arg1_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::arg_type<1>, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::arg2_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::arg_type<2>, const volatile float &>);
+static_assert(callable_traits<decltype(lambda_369)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_369)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_369)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_369)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_369)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_369)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_369)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_369)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_369)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_369)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_369)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_369)>::class_type, std::remove_const_t<decltype(lambda_369)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_369)>, float &&(const float &, volatile float &, const volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_369)>, float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_369), 0>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_369), 1>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_369), 2>, const volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_369)>, type_list<const float &, volatile float &, const volatile float &>>);
+static_assert(callable_arity_v<decltype(lambda_369)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_369)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_369)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_369)> == callable_traits<decltype(lambda_369)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_369)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_369)>, std::remove_const_t<decltype(lambda_369)>>);
+[[maybe_unused]] const auto lambda_371 = [](const volatile float * &, float * const &, const float * const &, ...) mutable noexcept -> volatile float && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::signature_type, volatile float &&(const volatile float * &, float * const &, const float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::result_type, volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_371)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_371)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_371)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_371)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::arg0_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::arg_type<0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::arg1_type, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::arg_type<1>, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::arg2_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::arg_type<2>, const float * const &>);
+static_assert(callable_traits<decltype(lambda_371)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_371)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_371)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_371)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_371)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_371)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_371)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_371)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_371)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_371)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_371)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_371)>::class_type, std::remove_const_t<decltype(lambda_371)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_371)>, volatile float &&(const volatile float * &, float * const &, const float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_371)>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_371), 0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_371), 1>, float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_371), 2>, const float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_371)>, type_list<const volatile float * &, float * const &, const float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_371)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_371)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_371)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_371)> == callable_traits<decltype(lambda_371)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_371)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_371)>, std::remove_const_t<decltype(lambda_371)>>);
+[[maybe_unused]] const auto lambda_373 = [](const float * volatile &, volatile float * volatile &, const volatile float * volatile &, ...) mutable -> float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::signature_type, float * &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::result_type, float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_373)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_373)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_373)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_373)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::arg_type<0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::arg1_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::arg_type<1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::arg2_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::arg_type<2>, const volatile float * volatile &>);
+static_assert(callable_traits<decltype(lambda_373)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_373)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_373)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_373)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_373)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_373)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_373)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_373)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_373)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_373)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_373)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_373)>::class_type, std::remove_const_t<decltype(lambda_373)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_373)>, float * &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_373)>, float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_373), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_373), 1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_373), 2>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_373)>, type_list<const float * volatile &, volatile float * volatile &, const volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_373)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_373)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_373)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_373)> == callable_traits<decltype(lambda_373)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_373)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_373)>, std::remove_const_t<decltype(lambda_373)>>);
+[[maybe_unused]] const auto lambda_375 = [](const volatile float * const volatile &, float &&, const float &&, ...) mutable noexcept -> volatile float * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::signature_type, volatile float * &&(const volatile float * const volatile &, float &&, const float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::result_type, volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_375)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_375)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_375)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_375)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::arg0_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::arg_type<0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::arg1_type, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::arg_type<1>, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::arg2_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::arg_type<2>, const float &&>);
+static_assert(callable_traits<decltype(lambda_375)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_375)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_375)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_375)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_375)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_375)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_375)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_375)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_375)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_375)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_375)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_375)>::class_type, std::remove_const_t<decltype(lambda_375)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_375)>, volatile float * &&(const volatile float * const volatile &, float &&, const float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_375)>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_375), 0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_375), 1>, float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_375), 2>, const float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_375)>, type_list<const volatile float * const volatile &, float &&, const float &&>>);
+static_assert(callable_arity_v<decltype(lambda_375)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_375)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_375)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_375)> == callable_traits<decltype(lambda_375)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_375)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_375)>, std::remove_const_t<decltype(lambda_375)>>);
+[[maybe_unused]] const auto lambda_377 = [](const float * &&, volatile float * &&, const volatile float * &&, ...) mutable -> float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::signature_type, float * const &&(const float * &&, volatile float * &&, const volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::result_type, float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_377)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_377)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_377)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_377)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::arg_type<0>, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::arg1_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::arg_type<1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::arg2_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::arg_type<2>, const volatile float * &&>);
+static_assert(callable_traits<decltype(lambda_377)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_377)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_377)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_377)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_377)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_377)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_377)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_377)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_377)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_377)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_377)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_377)>::class_type, std::remove_const_t<decltype(lambda_377)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_377)>, float * const &&(const float * &&, volatile float * &&, const volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_377)>, float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_377), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_377), 1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_377), 2>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_377)>, type_list<const float * &&, volatile float * &&, const volatile float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_377)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_377)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_377)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_377)> == callable_traits<decltype(lambda_377)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_377)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_377)>, std::remove_const_t<decltype(lambda_377)>>);
+[[maybe_unused]] const auto lambda_379 = [](const volatile float * const &&, float * volatile &&, const float * volatile &&, ...) mutable noexcept -> volatile float * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::signature_type, volatile float * const &&(const volatile float * const &&, float * volatile &&, const float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::result_type, volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_379)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_379)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_379)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_379)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::arg0_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::arg_type<0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::arg1_type, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::arg_type<1>, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::arg2_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::arg_type<2>, const float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_379)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_379)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_379)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_379)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_379)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_379)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_379)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_379)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_379)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_379)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_379)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_379)>::class_type, std::remove_const_t<decltype(lambda_379)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_379)>, volatile float * const &&(const volatile float * const &&, float * volatile &&, const float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_379)>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_379), 0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_379), 1>, float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_379), 2>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_379)>, type_list<const volatile float * const &&, float * volatile &&, const float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_379)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_379)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_379)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_379)> == callable_traits<decltype(lambda_379)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_379)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_379)>, std::remove_const_t<decltype(lambda_379)>>);
+[[maybe_unused]] const auto lambda_381 = [](const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, ...) mutable -> float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::signature_type, float * volatile &&(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::result_type, float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_381)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_381)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_381)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_381)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::arg_type<0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::arg1_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::arg_type<1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::arg2_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::arg_type<2>, const volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_381)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_381)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_381)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_381)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_381)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_381)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_381)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_381)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_381)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_381)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_381)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_381)>::class_type, std::remove_const_t<decltype(lambda_381)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_381)>, float * volatile &&(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_381)>, float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_381), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_381), 1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_381), 2>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_381)>, type_list<const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_381)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_381)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_381)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_381)> == callable_traits<decltype(lambda_381)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_381)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_381)>, std::remove_const_t<decltype(lambda_381)>>);
+[[maybe_unused]] const auto lambda_383 = [](volatile std::string *, const volatile std::string *, std::string &, ...) mutable noexcept -> volatile float * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::signature_type, volatile float * volatile &&(volatile std::string *, const volatile std::string *, std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::result_type, volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_383)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_383)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_383)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_383)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::arg0_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::arg_type<0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::arg1_type, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::arg_type<1>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::arg2_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::arg_type<2>, std::string &>);
+static_assert(callable_traits<decltype(lambda_383)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_383)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_383)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_383)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_383)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_383)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_383)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_383)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_383)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_383)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_383)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_383)>::class_type, std::remove_const_t<decltype(lambda_383)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_383)>, volatile float * volatile &&(volatile std::string *, const volatile std::string *, std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_383)>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_383), 0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_383), 1>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_383), 2>, std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_383)>, type_list<volatile std::string *, const volatile std::string *, std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_383)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_383)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_383)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_383)> == callable_traits<decltype(lambda_383)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_383)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_383)>, std::remove_const_t<decltype(lambda_383)>>);
+[[maybe_unused]] const auto lambda_385 = [](std::string * &, const std::string * &, volatile std::string * &, ...) mutable -> float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::signature_type, float * const volatile &&(std::string * &, const std::string * &, volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::result_type, float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_385)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_385)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_385)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_385)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::arg_type<0>, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::arg1_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::arg_type<1>, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::arg2_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::arg_type<2>, volatile std::string * &>);
+static_assert(callable_traits<decltype(lambda_385)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_385)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_385)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_385)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_385)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_385)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_385)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_385)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_385)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_385)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_385)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_385)>::class_type, std::remove_const_t<decltype(lambda_385)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_385)>, float * const volatile &&(std::string * &, const std::string * &, volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_385)>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_385), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_385), 1>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_385), 2>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_385)>, type_list<std::string * &, const std::string * &, volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(lambda_385)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_385)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_385)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_385)> == callable_traits<decltype(lambda_385)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_385)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_385)>, std::remove_const_t<decltype(lambda_385)>>);
+[[maybe_unused]] const auto lambda_387 = [](volatile std::string * const &, const volatile std::string * const &, std::string * volatile &, ...) mutable noexcept -> volatile float * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::signature_type, volatile float * const volatile &&(volatile std::string * const &, const volatile std::string * const &, std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::result_type, volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_387)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_387)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_387)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_387)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::arg0_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::arg_type<0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::arg1_type, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::arg_type<1>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::arg2_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::arg_type<2>, std::string * volatile &>);
+static_assert(callable_traits<decltype(lambda_387)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_387)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_387)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_387)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_387)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_387)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_387)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_387)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_387)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_387)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_387)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_387)>::class_type, std::remove_const_t<decltype(lambda_387)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_387)>, volatile float * const volatile &&(volatile std::string * const &, const volatile std::string * const &, std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_387)>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_387), 0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_387), 1>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_387), 2>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_387)>, type_list<volatile std::string * const &, const volatile std::string * const &, std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_387)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_387)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_387)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_387)> == callable_traits<decltype(lambda_387)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_387)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_387)>, std::remove_const_t<decltype(lambda_387)>>);
+[[maybe_unused]] const auto lambda_389 = [](std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, ...) mutable -> std::string {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::signature_type, std::string(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::result_type, std::string>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_389)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_389)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_389)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_389)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::arg_type<0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::arg1_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::arg_type<1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::arg2_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::arg_type<2>, volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_389)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_389)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_389)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_389)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_389)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_389)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_389)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_389)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_389)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_389)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_389)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_389)>::class_type, std::remove_const_t<decltype(lambda_389)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_389)>, std::string(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_389)>, std::string>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_389), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_389), 1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_389), 2>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_389)>, type_list<std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_389)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_389)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_389)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_389)> == callable_traits<decltype(lambda_389)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_389)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_389)>, std::remove_const_t<decltype(lambda_389)>>);
+[[maybe_unused]] const auto lambda_391 = [](volatile std::string &&, const volatile std::string &&, std::string * &&, ...) mutable noexcept -> const std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::signature_type, const std::string *(volatile std::string &&, const volatile std::string &&, std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::result_type, const std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_391)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_391)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_391)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_391)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::arg0_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::arg_type<0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::arg1_type, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::arg_type<1>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::arg2_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::arg_type<2>, std::string * &&>);
+static_assert(callable_traits<decltype(lambda_391)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_391)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_391)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_391)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_391)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_391)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_391)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_391)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_391)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_391)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_391)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_391)>::class_type, std::remove_const_t<decltype(lambda_391)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_391)>, const std::string *(volatile std::string &&, const volatile std::string &&, std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_391)>, const std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_391), 0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_391), 1>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_391), 2>, std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_391)>, type_list<volatile std::string &&, const volatile std::string &&, std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_391)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_391)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_391)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_391)> == callable_traits<decltype(lambda_391)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_391)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_391)>, std::remove_const_t<decltype(lambda_391)>>);
+[[maybe_unused]] const auto lambda_393 = [](std::string * const &&, const std::string * const &&, volatile std::string * const &&, ...) mutable -> const volatile std::string * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::signature_type, const volatile std::string *(std::string * const &&, const std::string * const &&, volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::result_type, const volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_393)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_393)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_393)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_393)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::arg_type<0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::arg1_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::arg_type<1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::arg2_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::arg_type<2>, volatile std::string * const &&>);
+static_assert(callable_traits<decltype(lambda_393)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_393)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_393)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_393)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_393)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_393)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_393)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_393)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_393)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_393)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_393)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_393)>::class_type, std::remove_const_t<decltype(lambda_393)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_393)>, const volatile std::string *(std::string * const &&, const std::string * const &&, volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_393)>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_393), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_393), 1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_393), 2>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_393)>, type_list<std::string * const &&, const std::string * const &&, volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_393)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_393)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_393)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_393)> == callable_traits<decltype(lambda_393)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_393)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_393)>, std::remove_const_t<decltype(lambda_393)>>);
+[[maybe_unused]] const auto lambda_395 = [](volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&, ...) mutable noexcept -> const std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::signature_type, const std::string &(volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::result_type, const std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_395)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_395)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_395)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_395)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::arg0_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::arg_type<0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::arg1_type, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::arg_type<1>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::arg2_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::arg_type<2>, std::string * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_395)>::arity == 3);
+static_assert(callable_traits<decltype(lambda_395)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_395)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_395)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_395)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_395)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_395)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_395)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_395)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_395)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_395)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_395)>::class_type, std::remove_const_t<decltype(lambda_395)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_395)>, const std::string &(volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_395)>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_395), 0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_395), 1>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_395), 2>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_395)>, type_list<volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_395)> == 3);
+static_assert(callable_is_functor_v<decltype(lambda_395)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_395)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_395)> == callable_traits<decltype(lambda_395)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_395)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_395)>, std::remove_const_t<decltype(lambda_395)>>);
+[[maybe_unused]] const auto lambda_397 = [](void *, const void *, volatile void *, const volatile void *, ...) mutable -> const volatile std::string & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::signature_type, const volatile std::string &(void *, const void *, volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::result_type, const volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_397)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_397)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_397)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_397)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg_type<0>, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg1_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg_type<1>, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg2_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg_type<2>, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::arg_type<3>, const volatile void *>);
+static_assert(callable_traits<decltype(lambda_397)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_397)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_397)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_397)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_397)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_397)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_397)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_397)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_397)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_397)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_397)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_397)>::class_type, std::remove_const_t<decltype(lambda_397)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_397)>, const volatile std::string &(void *, const void *, volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_397)>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_397), 0>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_397), 1>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_397), 2>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_397), 3>, const volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_397)>, type_list<void *, const void *, volatile void *, const volatile void *>>);
+static_assert(callable_arity_v<decltype(lambda_397)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_397)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_397)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_397)> == callable_traits<decltype(lambda_397)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_397)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_397)>, std::remove_const_t<decltype(lambda_397)>>);
+[[maybe_unused]] const auto lambda_399 = [](void * const &, const void * const &, volatile void * const &, const volatile void * const &, ...) mutable noexcept -> const std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::signature_type, const std::string * &(void * const &, const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::result_type, const std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_399)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_399)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_399)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_399)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg0_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg_type<0>, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg1_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg_type<1>, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg2_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg_type<2>, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::arg_type<3>, const volatile void * const &>);
+static_assert(callable_traits<decltype(lambda_399)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_399)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_399)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_399)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_399)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_399)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_399)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_399)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_399)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_399)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_399)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_399)>::class_type, std::remove_const_t<decltype(lambda_399)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_399)>, const std::string * &(void * const &, const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_399)>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_399), 0>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_399), 1>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_399), 2>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_399), 3>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_399)>, type_list<void * const &, const void * const &, volatile void * const &, const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(lambda_399)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_399)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_399)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_399)> == callable_traits<decltype(lambda_399)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_399)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_399)>, std::remove_const_t<decltype(lambda_399)>>);
+[[maybe_unused]] const auto lambda_401 = [](void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &, ...) mutable -> const volatile std::string * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::signature_type, const volatile std::string * &(void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::result_type, const volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_401)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_401)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_401)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_401)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg0_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg_type<0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg1_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg_type<1>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg2_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg_type<2>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::arg_type<3>, const volatile void * const volatile &>);
+static_assert(callable_traits<decltype(lambda_401)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_401)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_401)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_401)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_401)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_401)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_401)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_401)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_401)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_401)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_401)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_401)>::class_type, std::remove_const_t<decltype(lambda_401)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_401)>, const volatile std::string * &(void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_401)>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_401), 0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_401), 1>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_401), 2>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_401), 3>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_401)>, type_list<void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_401)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_401)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_401)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_401)> == callable_traits<decltype(lambda_401)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_401)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_401)>, std::remove_const_t<decltype(lambda_401)>>);
+[[maybe_unused]] const auto lambda_403 = [](void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&, ...) mutable noexcept -> const std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::signature_type, const std::string * const &(void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::result_type, const std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_403)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_403)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_403)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_403)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg_type<0>, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg1_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg_type<1>, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg2_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg_type<2>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::arg_type<3>, const volatile void * const &&>);
+static_assert(callable_traits<decltype(lambda_403)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_403)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_403)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_403)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_403)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_403)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_403)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_403)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_403)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_403)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_403)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_403)>::class_type, std::remove_const_t<decltype(lambda_403)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_403)>, const std::string * const &(void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_403)>, const std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_403), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_403), 1>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_403), 2>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_403), 3>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_403)>, type_list<void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_403)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_403)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_403)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_403)> == callable_traits<decltype(lambda_403)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_403)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_403)>, std::remove_const_t<decltype(lambda_403)>>);
+[[maybe_unused]] const auto lambda_405 = [](void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&, ...) mutable -> const volatile std::string * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::signature_type, const volatile std::string * const &(void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::result_type, const volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_405)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_405)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_405)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_405)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg0_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg_type<0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg1_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg_type<1>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg2_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg_type<2>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::arg_type<3>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_405)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_405)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_405)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_405)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_405)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_405)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_405)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_405)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_405)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_405)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_405)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_405)>::class_type, std::remove_const_t<decltype(lambda_405)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_405)>, const volatile std::string * const &(void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_405)>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_405), 0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_405), 1>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_405), 2>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_405), 3>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_405)>, type_list<void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_405)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_405)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_405)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_405)> == callable_traits<decltype(lambda_405)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_405)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_405)>, std::remove_const_t<decltype(lambda_405)>>);
+[[maybe_unused]] const auto lambda_407 = [](const volatile bool *, bool &, const bool &, volatile bool &, ...) mutable noexcept -> const std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::signature_type, const std::string * volatile &(const volatile bool *, bool &, const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::result_type, const std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_407)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_407)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_407)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_407)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg0_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg_type<0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg1_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg_type<1>, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg2_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg_type<2>, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::arg_type<3>, volatile bool &>);
+static_assert(callable_traits<decltype(lambda_407)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_407)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_407)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_407)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_407)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_407)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_407)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_407)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_407)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_407)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_407)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_407)>::class_type, std::remove_const_t<decltype(lambda_407)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_407)>, const std::string * volatile &(const volatile bool *, bool &, const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_407)>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_407), 0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_407), 1>, bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_407), 2>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_407), 3>, volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_407)>, type_list<const volatile bool *, bool &, const bool &, volatile bool &>>);
+static_assert(callable_arity_v<decltype(lambda_407)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_407)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_407)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_407)> == callable_traits<decltype(lambda_407)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_407)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_407)>, std::remove_const_t<decltype(lambda_407)>>);
+[[maybe_unused]] const auto lambda_409 = [](const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &, ...) mutable -> const volatile std::string * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::signature_type, const volatile std::string * volatile &(const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::result_type, const volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_409)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_409)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_409)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_409)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg_type<0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg1_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg_type<1>, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg2_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg_type<2>, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::arg_type<3>, volatile bool * const &>);
+static_assert(callable_traits<decltype(lambda_409)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_409)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_409)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_409)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_409)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_409)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_409)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_409)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_409)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_409)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_409)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_409)>::class_type, std::remove_const_t<decltype(lambda_409)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_409)>, const volatile std::string * volatile &(const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_409)>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_409), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_409), 1>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_409), 2>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_409), 3>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_409)>, type_list<const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(lambda_409)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_409)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_409)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_409)> == callable_traits<decltype(lambda_409)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_409)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_409)>, std::remove_const_t<decltype(lambda_409)>>);
+[[maybe_unused]] const auto lambda_411 = [](const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &, ...) mutable noexcept -> const std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::signature_type, const std::string * const volatile &(const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::result_type, const std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_411)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_411)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_411)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_411)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg0_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg_type<0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg1_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg_type<1>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg2_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg_type<2>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::arg_type<3>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(lambda_411)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_411)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_411)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_411)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_411)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_411)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_411)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_411)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_411)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_411)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_411)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_411)>::class_type, std::remove_const_t<decltype(lambda_411)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_411)>, const std::string * const volatile &(const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_411)>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_411), 0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_411), 1>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_411), 2>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_411), 3>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_411)>, type_list<const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_411)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_411)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_411)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_411)> == callable_traits<decltype(lambda_411)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_411)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_411)>, std::remove_const_t<decltype(lambda_411)>>);
+[[maybe_unused]] const auto lambda_413 = [](const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&, ...) mutable -> const volatile std::string * const volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::signature_type, const volatile std::string * const volatile &(const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::result_type, const volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_413)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_413)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_413)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_413)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg0_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg_type<0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg1_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg_type<1>, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg2_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg_type<2>, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::arg_type<3>, volatile bool * &&>);
+static_assert(callable_traits<decltype(lambda_413)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_413)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_413)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_413)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_413)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_413)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_413)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_413)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_413)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_413)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_413)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_413)>::class_type, std::remove_const_t<decltype(lambda_413)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_413)>, const volatile std::string * const volatile &(const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_413)>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_413), 0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_413), 1>, bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_413), 2>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_413), 3>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_413)>, type_list<const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(lambda_413)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_413)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_413)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_413)> == callable_traits<decltype(lambda_413)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_413)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_413)>, std::remove_const_t<decltype(lambda_413)>>);
+[[maybe_unused]] const auto lambda_415 = [](const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&, ...) mutable noexcept -> const std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::signature_type, const std::string &&(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::result_type, const std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_415)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_415)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_415)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_415)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg1_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg_type<1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg2_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg_type<2>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::arg_type<3>, volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(lambda_415)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_415)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_415)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_415)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_415)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_415)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_415)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_415)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_415)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_415)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_415)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_415)>::class_type, std::remove_const_t<decltype(lambda_415)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_415)>, const std::string &&(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_415)>, const std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_415), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_415), 1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_415), 2>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_415), 3>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_415)>, type_list<const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_415)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_415)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_415)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_415)> == callable_traits<decltype(lambda_415)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_415)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_415)>, std::remove_const_t<decltype(lambda_415)>>);
+[[maybe_unused]] const auto lambda_417 = [](const volatile bool * const volatile &&, int, int *, const int *, ...) mutable -> const volatile std::string && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::signature_type, const volatile std::string &&(const volatile bool * const volatile &&, int, int *, const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::result_type, const volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_417)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_417)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_417)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_417)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg0_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg_type<0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg1_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg_type<1>, int>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg2_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg_type<2>, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::arg_type<3>, const int *>);
+static_assert(callable_traits<decltype(lambda_417)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_417)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_417)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_417)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_417)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_417)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_417)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_417)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_417)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_417)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_417)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_417)>::class_type, std::remove_const_t<decltype(lambda_417)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_417)>, const volatile std::string &&(const volatile bool * const volatile &&, int, int *, const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_417)>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_417), 0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_417), 1>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_417), 2>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_417), 3>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_417)>, type_list<const volatile bool * const volatile &&, int, int *, const int *>>);
+static_assert(callable_arity_v<decltype(lambda_417)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_417)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_417)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_417)> == callable_traits<decltype(lambda_417)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_417)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_417)>, std::remove_const_t<decltype(lambda_417)>>);
+[[maybe_unused]] const auto lambda_419 = [](volatile int &, const volatile int &, int * &, const int * &, ...) mutable noexcept -> const std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::signature_type, const std::string * &&(volatile int &, const volatile int &, int * &, const int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::result_type, const std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_419)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_419)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_419)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_419)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg0_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg_type<0>, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg1_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg_type<1>, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg2_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg_type<2>, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::arg_type<3>, const int * &>);
+static_assert(callable_traits<decltype(lambda_419)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_419)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_419)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_419)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_419)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_419)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_419)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_419)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_419)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_419)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_419)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_419)>::class_type, std::remove_const_t<decltype(lambda_419)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_419)>, const std::string * &&(volatile int &, const volatile int &, int * &, const int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_419)>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_419), 0>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_419), 1>, const volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_419), 2>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_419), 3>, const int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_419)>, type_list<volatile int &, const volatile int &, int * &, const int * &>>);
+static_assert(callable_arity_v<decltype(lambda_419)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_419)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_419)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_419)> == callable_traits<decltype(lambda_419)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_419)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_419)>, std::remove_const_t<decltype(lambda_419)>>);
+[[maybe_unused]] const auto lambda_421 = [](volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &, ...) mutable -> const volatile std::string * && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::signature_type, const volatile std::string * &&(volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::result_type, const volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_421)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_421)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_421)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_421)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg_type<0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg1_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg_type<1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg2_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg_type<2>, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::arg_type<3>, const int * volatile &>);
+static_assert(callable_traits<decltype(lambda_421)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_421)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_421)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_421)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_421)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_421)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_421)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_421)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_421)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_421)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_421)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_421)>::class_type, std::remove_const_t<decltype(lambda_421)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_421)>, const volatile std::string * &&(volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_421)>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_421), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_421), 1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_421), 2>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_421), 3>, const int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_421)>, type_list<volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_421)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_421)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_421)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_421)> == callable_traits<decltype(lambda_421)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_421)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_421)>, std::remove_const_t<decltype(lambda_421)>>);
+[[maybe_unused]] const auto lambda_423 = [](volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&, ...) mutable noexcept -> const std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::signature_type, const std::string * const &&(volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::result_type, const std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_423)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_423)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_423)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_423)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg0_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg_type<0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg1_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg_type<1>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg2_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg_type<2>, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::arg_type<3>, const int &&>);
+static_assert(callable_traits<decltype(lambda_423)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_423)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_423)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_423)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_423)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_423)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_423)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_423)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_423)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_423)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_423)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_423)>::class_type, std::remove_const_t<decltype(lambda_423)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_423)>, const std::string * const &&(volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_423)>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_423), 0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_423), 1>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_423), 2>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_423), 3>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_423)>, type_list<volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&>>);
+static_assert(callable_arity_v<decltype(lambda_423)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_423)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_423)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_423)> == callable_traits<decltype(lambda_423)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_423)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_423)>, std::remove_const_t<decltype(lambda_423)>>);
+[[maybe_unused]] const auto lambda_425 = [](volatile int * &&, const volatile int * &&, int * const &&, const int * const &&, ...) mutable -> const volatile std::string * const && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::signature_type, const volatile std::string * const &&(volatile int * &&, const volatile int * &&, int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::result_type, const volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_425)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_425)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_425)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_425)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg0_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg_type<0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg1_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg_type<1>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg2_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg_type<2>, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::arg_type<3>, const int * const &&>);
+static_assert(callable_traits<decltype(lambda_425)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_425)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_425)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_425)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_425)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_425)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_425)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_425)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_425)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_425)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_425)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_425)>::class_type, std::remove_const_t<decltype(lambda_425)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_425)>, const volatile std::string * const &&(volatile int * &&, const volatile int * &&, int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_425)>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_425), 0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_425), 1>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_425), 2>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_425), 3>, const int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_425)>, type_list<volatile int * &&, const volatile int * &&, int * const &&, const int * const &&>>);
+static_assert(callable_arity_v<decltype(lambda_425)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_425)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_425)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_425)> == callable_traits<decltype(lambda_425)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_425)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_425)>, std::remove_const_t<decltype(lambda_425)>>);
+[[maybe_unused]] const auto lambda_427 = [](volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&, ...) mutable noexcept -> const std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::signature_type, const std::string * volatile &&(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::result_type, const std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_427)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_427)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_427)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_427)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg1_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg_type<1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg2_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg_type<2>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::arg_type<3>, const int * const volatile &&>);
+static_assert(callable_traits<decltype(lambda_427)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_427)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_427)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_427)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_427)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_427)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_427)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_427)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_427)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_427)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_427)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_427)>::class_type, std::remove_const_t<decltype(lambda_427)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_427)>, const std::string * volatile &&(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_427)>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_427), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_427), 1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_427), 2>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_427), 3>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_427)>, type_list<volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_427)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_427)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_427)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_427)> == callable_traits<decltype(lambda_427)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_427)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_427)>, std::remove_const_t<decltype(lambda_427)>>);
+[[maybe_unused]] const auto lambda_429 = [](const float *, volatile float *, const volatile float *, float &, ...) mutable -> const volatile std::string * volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::signature_type, const volatile std::string * volatile &&(const float *, volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::result_type, const volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_429)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_429)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_429)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_429)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg0_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg_type<0>, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg1_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg_type<1>, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg2_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg_type<2>, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::arg_type<3>, float &>);
+static_assert(callable_traits<decltype(lambda_429)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_429)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_429)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_429)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_429)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_429)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_429)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_429)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_429)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_429)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_429)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_429)>::class_type, std::remove_const_t<decltype(lambda_429)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_429)>, const volatile std::string * volatile &&(const float *, volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_429)>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_429), 0>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_429), 1>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_429), 2>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_429), 3>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_429)>, type_list<const float *, volatile float *, const volatile float *, float &>>);
+static_assert(callable_arity_v<decltype(lambda_429)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_429)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_429)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_429)> == callable_traits<decltype(lambda_429)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_429)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_429)>, std::remove_const_t<decltype(lambda_429)>>);
+[[maybe_unused]] const auto lambda_431 = [](const float * &, volatile float * &, const volatile float * &, float * const &, ...) mutable noexcept -> const std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::signature_type, const std::string * const volatile &&(const float * &, volatile float * &, const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::result_type, const std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_431)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_431)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_431)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_431)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg0_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg_type<0>, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg1_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg_type<1>, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg2_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg_type<2>, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::arg_type<3>, float * const &>);
+static_assert(callable_traits<decltype(lambda_431)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_431)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_431)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_431)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_431)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_431)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_431)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_431)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_431)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_431)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_431)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_431)>::class_type, std::remove_const_t<decltype(lambda_431)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_431)>, const std::string * const volatile &&(const float * &, volatile float * &, const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_431)>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_431), 0>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_431), 1>, volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_431), 2>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_431), 3>, float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_431)>, type_list<const float * &, volatile float * &, const volatile float * &, float * const &>>);
+static_assert(callable_arity_v<decltype(lambda_431)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_431)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_431)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_431)> == callable_traits<decltype(lambda_431)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_431)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_431)>, std::remove_const_t<decltype(lambda_431)>>);
+[[maybe_unused]] const auto lambda_433 = [](const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &, ...) mutable -> const volatile std::string * const volatile && {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::signature_type, const volatile std::string * const volatile &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::result_type, const volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_433)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_433)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_433)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_433)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg_type<0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg1_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg_type<1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg2_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg_type<2>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::arg_type<3>, float * const volatile &>);
+static_assert(callable_traits<decltype(lambda_433)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_433)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_433)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_433)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_433)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_433)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_433)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_433)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_433)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_433)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_433)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_433)>::class_type, std::remove_const_t<decltype(lambda_433)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_433)>, const volatile std::string * const volatile &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_433)>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_433), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_433), 1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_433), 2>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_433), 3>, float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_433)>, type_list<const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_433)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_433)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_433)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_433)> == callable_traits<decltype(lambda_433)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_433)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_433)>, std::remove_const_t<decltype(lambda_433)>>);
+[[maybe_unused]] const auto lambda_435 = [](const float &&, volatile float &&, const volatile float &&, float * &&, ...) mutable noexcept -> void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::signature_type, void *(const float &&, volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::result_type, void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_435)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_435)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_435)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_435)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg0_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg_type<0>, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg1_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg_type<1>, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg2_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg_type<2>, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::arg_type<3>, float * &&>);
+static_assert(callable_traits<decltype(lambda_435)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_435)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_435)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_435)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_435)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_435)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_435)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_435)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_435)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_435)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_435)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_435)>::class_type, std::remove_const_t<decltype(lambda_435)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_435)>, void *(const float &&, volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_435)>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_435), 0>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_435), 1>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_435), 2>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_435), 3>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_435)>, type_list<const float &&, volatile float &&, const volatile float &&, float * &&>>);
+static_assert(callable_arity_v<decltype(lambda_435)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_435)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_435)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_435)> == callable_traits<decltype(lambda_435)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_435)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_435)>, std::remove_const_t<decltype(lambda_435)>>);
+[[maybe_unused]] const auto lambda_437 = [](const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&, ...) mutable -> volatile void * {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::signature_type, volatile void *(const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::result_type, volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_437)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_437)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_437)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_437)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg0_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg_type<0>, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg1_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg_type<1>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg2_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg_type<2>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::arg_type<3>, float * volatile &&>);
+static_assert(callable_traits<decltype(lambda_437)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_437)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_437)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_437)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_437)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_437)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_437)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_437)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_437)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_437)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_437)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_437)>::class_type, std::remove_const_t<decltype(lambda_437)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_437)>, volatile void *(const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_437)>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_437), 0>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_437), 1>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_437), 2>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_437), 3>, float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_437)>, type_list<const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_437)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_437)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_437)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_437)> == callable_traits<decltype(lambda_437)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_437)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_437)>, std::remove_const_t<decltype(lambda_437)>>);
+[[maybe_unused]] const auto lambda_439 = [](const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string, ...) mutable noexcept -> void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::signature_type, void * &(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::result_type, void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_439)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_439)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_439)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_439)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg_type<0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg1_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg_type<1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg2_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg_type<2>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::arg_type<3>, std::string>);
+static_assert(callable_traits<decltype(lambda_439)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_439)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_439)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_439)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_439)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_439)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_439)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_439)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_439)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_439)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_439)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_439)>::class_type, std::remove_const_t<decltype(lambda_439)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_439)>, void * &(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_439)>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_439), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_439), 1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_439), 2>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_439), 3>, std::string>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_439)>, type_list<const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string>>);
+static_assert(callable_arity_v<decltype(lambda_439)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_439)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_439)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_439)> == callable_traits<decltype(lambda_439)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_439)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_439)>, std::remove_const_t<decltype(lambda_439)>>);
+[[maybe_unused]] const auto lambda_441 = [](std::string &, const std::string &, volatile std::string &, const volatile std::string &, ...) mutable -> volatile void * & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::signature_type, volatile void * &(std::string &, const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::result_type, volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_441)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_441)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_441)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_441)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg0_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg_type<0>, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg1_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg_type<1>, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg2_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg_type<2>, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::arg_type<3>, const volatile std::string &>);
+static_assert(callable_traits<decltype(lambda_441)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_441)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_441)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_441)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_441)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_441)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_441)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_441)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_441)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_441)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_441)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_441)>::class_type, std::remove_const_t<decltype(lambda_441)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_441)>, volatile void * &(std::string &, const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_441)>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_441), 0>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_441), 1>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_441), 2>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_441), 3>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_441)>, type_list<std::string &, const std::string &, volatile std::string &, const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(lambda_441)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_441)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_441)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_441)> == callable_traits<decltype(lambda_441)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_441)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_441)>, std::remove_const_t<decltype(lambda_441)>>);
+[[maybe_unused]] const auto lambda_443 = [](std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &, ...) mutable noexcept -> void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::signature_type, void * const &(std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::result_type, void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_443)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_443)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_443)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_443)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg0_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg_type<0>, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg1_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg_type<1>, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg2_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg_type<2>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::arg_type<3>, const volatile std::string * const &>);
+static_assert(callable_traits<decltype(lambda_443)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_443)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_443)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_443)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_443)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_443)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_443)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_443)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_443)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_443)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_443)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_443)>::class_type, std::remove_const_t<decltype(lambda_443)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_443)>, void * const &(std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_443)>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_443), 0>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_443), 1>, const std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_443), 2>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_443), 3>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_443)>, type_list<std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(lambda_443)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_443)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_443)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_443)> == callable_traits<decltype(lambda_443)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_443)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_443)>, std::remove_const_t<decltype(lambda_443)>>);
+[[maybe_unused]] const auto lambda_445 = [](std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &, ...) mutable -> volatile void * const & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::signature_type, volatile void * const &(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::result_type, volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_445)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_445)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_445)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_445)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg_type<0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg1_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg_type<1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg2_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg_type<2>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::arg_type<3>, const volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(lambda_445)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_445)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_445)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_445)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_445)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_445)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_445)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_445)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_445)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_445)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_445)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_445)>::class_type, std::remove_const_t<decltype(lambda_445)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_445)>, volatile void * const &(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_445)>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_445), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_445), 1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_445), 2>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_445), 3>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_445)>, type_list<std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(lambda_445)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_445)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_445)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_445)> == callable_traits<decltype(lambda_445)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_445)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_445)>, std::remove_const_t<decltype(lambda_445)>>);
+[[maybe_unused]] const auto lambda_447 = [](std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&, ...) mutable noexcept -> void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::signature_type, void * volatile &(std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::result_type, void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_447)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_447)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_447)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_447)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg0_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg_type<0>, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg1_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg_type<1>, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg2_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg_type<2>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::arg_type<3>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(lambda_447)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_447)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_447)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_447)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_447)>::is_noexcept == true);
+static_assert(callable_traits<decltype(lambda_447)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_447)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_447)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_447)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_447)>::specifier_mask == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_447)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_447)>::class_type, std::remove_const_t<decltype(lambda_447)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_447)>, void * volatile &(std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_447)>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_447), 0>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_447), 1>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_447), 2>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_447), 3>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_447)>, type_list<std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(lambda_447)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_447)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_447)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_447)> == callable_traits<decltype(lambda_447)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_447)> == (callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_447)>, std::remove_const_t<decltype(lambda_447)>>);
+[[maybe_unused]] const auto lambda_449 = [](std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&, ...) mutable -> volatile void * volatile & {};
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::signature_type, volatile void * volatile &(std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::result_type, volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(lambda_449)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(lambda_449)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(lambda_449)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(lambda_449)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg0_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg_type<0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg1_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg_type<1>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg2_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg_type<2>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::arg_type<3>, const volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(lambda_449)>::arity == 4);
+static_assert(callable_traits<decltype(lambda_449)>::is_functor == true);
+static_assert(callable_traits<decltype(lambda_449)>::is_member_function == false);
+static_assert(callable_traits<decltype(lambda_449)>::is_variadic == true);
+static_assert(callable_traits<decltype(lambda_449)>::is_noexcept == false);
+static_assert(callable_traits<decltype(lambda_449)>::is_const == false);
+static_assert(callable_traits<decltype(lambda_449)>::is_volatile == false);
+static_assert(callable_traits<decltype(lambda_449)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_449)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(lambda_449)>::specifier_mask == (callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(lambda_449)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(lambda_449)>::class_type, std::remove_const_t<decltype(lambda_449)>>);
+static_assert(std::is_same_v<callable_signature_t<decltype(lambda_449)>, volatile void * volatile &(std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(lambda_449)>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_449), 0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_449), 1>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_449), 2>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(lambda_449), 3>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(lambda_449)>, type_list<std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(lambda_449)> == 4);
+static_assert(callable_is_functor_v<decltype(lambda_449)> == true);
+static_assert(callable_is_member_function_v<decltype(lambda_449)> == false);
+static_assert(callable_is_noexcept_v<decltype(lambda_449)> == callable_traits<decltype(lambda_449)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(lambda_449)> == (callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(lambda_449)>, std::remove_const_t<decltype(lambda_449)>>);
@@ -0,0 +1,3 @@
+/* This file was auto-generated */
+
+int main() { return 0; }
@@ -0,0 +1,3801 @@
+/* This file was auto-generated */
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "../../include/callable_traits.hpp"
+#include "../callable_traits_test_helper.hpp"
+
+struct class_0 { void mem_fn(); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_0::mem_fn)>::signature_type, void()>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_0::mem_fn)>::result_type, void>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_0::mem_fn)>> == false);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_0::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_0::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_0::mem_fn)>> == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::arity == 0);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_0::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_0::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_0::mem_fn)>::class_type, class_0>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_0::mem_fn)>, void()>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_0::mem_fn)>, void>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_0::mem_fn)>, type_list<>>);
+static_assert(callable_arity_v<decltype(&class_0::mem_fn)> == 0);
+static_assert(callable_is_functor_v<decltype(&class_0::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_0::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_0::mem_fn)> == callable_traits<decltype(&class_0::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_0::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_0::mem_fn)>, class_0>);
+struct class_4 { const volatile void * mem_fn(const volatile void *) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_4::mem_fn)>::signature_type, const volatile void *(const volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_4::mem_fn)>::result_type, const volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_4::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_4::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_4::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_4::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_4::mem_fn)>::arg0_type, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_4::mem_fn)>::arg_type<0>, const volatile void *>);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_4::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_4::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_4::mem_fn)>::class_type, class_4>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_4::mem_fn)>, const volatile void *(const volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_4::mem_fn)>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_4::mem_fn), 0>, const volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_4::mem_fn)>, type_list<const volatile void *>>);
+static_assert(callable_arity_v<decltype(&class_4::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_4::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_4::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_4::mem_fn)> == callable_traits<decltype(&class_4::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_4::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_4::mem_fn)>, class_4>);
+struct class_8 { const volatile void * & mem_fn(const volatile void * &) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_8::mem_fn)>::signature_type, const volatile void * &(const volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_8::mem_fn)>::result_type, const volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_8::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_8::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_8::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_8::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_8::mem_fn)>::arg0_type, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_8::mem_fn)>::arg_type<0>, const volatile void * &>);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_8::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_8::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_8::mem_fn)>::class_type, class_8>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_8::mem_fn)>, const volatile void * &(const volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_8::mem_fn)>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_8::mem_fn), 0>, const volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_8::mem_fn)>, type_list<const volatile void * &>>);
+static_assert(callable_arity_v<decltype(&class_8::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_8::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_8::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_8::mem_fn)> == callable_traits<decltype(&class_8::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_8::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_8::mem_fn)>, class_8>);
+struct class_12 { const volatile void * const & mem_fn(const volatile void * const &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_12::mem_fn)>::signature_type, const volatile void * const &(const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_12::mem_fn)>::result_type, const volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_12::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_12::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_12::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_12::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_12::mem_fn)>::arg0_type, const volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_12::mem_fn)>::arg_type<0>, const volatile void * const &>);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_12::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_12::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_12::mem_fn)>::class_type, class_12>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_12::mem_fn)>, const volatile void * const &(const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_12::mem_fn)>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_12::mem_fn), 0>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_12::mem_fn)>, type_list<const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(&class_12::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_12::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_12::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_12::mem_fn)> == callable_traits<decltype(&class_12::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_12::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_12::mem_fn)>, class_12>);
+struct class_16 { const volatile void * volatile & mem_fn(const volatile void * volatile &) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_16::mem_fn)>::signature_type, const volatile void * volatile &(const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_16::mem_fn)>::result_type, const volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_16::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_16::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_16::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_16::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_16::mem_fn)>::arg0_type, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_16::mem_fn)>::arg_type<0>, const volatile void * volatile &>);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_16::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_16::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_16::mem_fn)>::class_type, class_16>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_16::mem_fn)>, const volatile void * volatile &(const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_16::mem_fn)>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_16::mem_fn), 0>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_16::mem_fn)>, type_list<const volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_16::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_16::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_16::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_16::mem_fn)> == callable_traits<decltype(&class_16::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_16::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_16::mem_fn)>, class_16>);
+struct class_20 { const volatile void * const volatile & mem_fn(const volatile void * const volatile &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_20::mem_fn)>::signature_type, const volatile void * const volatile &(const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_20::mem_fn)>::result_type, const volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_20::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_20::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_20::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_20::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_20::mem_fn)>::arg0_type, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_20::mem_fn)>::arg_type<0>, const volatile void * const volatile &>);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_20::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_20::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_20::mem_fn)>::class_type, class_20>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_20::mem_fn)>, const volatile void * const volatile &(const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_20::mem_fn)>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_20::mem_fn), 0>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_20::mem_fn)>, type_list<const volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_20::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_20::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_20::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_20::mem_fn)> == callable_traits<decltype(&class_20::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_20::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_20::mem_fn)>, class_20>);
+struct class_24 { const volatile void * && mem_fn(const volatile void * &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_24::mem_fn)>::signature_type, const volatile void * &&(const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_24::mem_fn)>::result_type, const volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_24::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_24::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_24::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_24::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_24::mem_fn)>::arg0_type, const volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_24::mem_fn)>::arg_type<0>, const volatile void * &&>);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_24::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_24::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_24::mem_fn)>::class_type, class_24>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_24::mem_fn)>, const volatile void * &&(const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_24::mem_fn)>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_24::mem_fn), 0>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_24::mem_fn)>, type_list<const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(&class_24::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_24::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_24::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_24::mem_fn)> == callable_traits<decltype(&class_24::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_24::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_24::mem_fn)>, class_24>);
+struct class_28 { const volatile void * const && mem_fn(const volatile void * const &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_28::mem_fn)>::signature_type, const volatile void * const &&(const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_28::mem_fn)>::result_type, const volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_28::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_28::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_28::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_28::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_28::mem_fn)>::arg0_type, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_28::mem_fn)>::arg_type<0>, const volatile void * const &&>);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_28::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_28::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_28::mem_fn)>::class_type, class_28>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_28::mem_fn)>, const volatile void * const &&(const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_28::mem_fn)>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_28::mem_fn), 0>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_28::mem_fn)>, type_list<const volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_28::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_28::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_28::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_28::mem_fn)> == callable_traits<decltype(&class_28::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_28::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_28::mem_fn)>, class_28>);
+struct class_32 { const volatile void * volatile && mem_fn(const volatile void * volatile &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_32::mem_fn)>::signature_type, const volatile void * volatile &&(const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_32::mem_fn)>::result_type, const volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_32::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_32::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_32::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_32::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_32::mem_fn)>::arg0_type, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_32::mem_fn)>::arg_type<0>, const volatile void * volatile &&>);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_32::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_32::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_32::mem_fn)>::class_type, class_32>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_32::mem_fn)>, const volatile void * volatile &&(const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_32::mem_fn)>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_32::mem_fn), 0>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_32::mem_fn)>, type_list<const volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_32::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_32::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_32::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_32::mem_fn)> == callable_traits<decltype(&class_32::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_32::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_32::mem_fn)>, class_32>);
+struct class_36 { const volatile void * const volatile && mem_fn(const volatile void * const volatile &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_36::mem_fn)>::signature_type, const volatile void * const volatile &&(const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_36::mem_fn)>::result_type, const volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_36::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_36::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_36::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_36::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_36::mem_fn)>::arg0_type, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_36::mem_fn)>::arg_type<0>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_36::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_36::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_36::mem_fn)>::class_type, class_36>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_36::mem_fn)>, const volatile void * const volatile &&(const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_36::mem_fn)>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_36::mem_fn), 0>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_36::mem_fn)>, type_list<const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_36::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_36::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_36::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_36::mem_fn)> == callable_traits<decltype(&class_36::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_36::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_36::mem_fn)>, class_36>);
+struct class_40 { volatile bool * mem_fn(volatile bool *) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_40::mem_fn)>::signature_type, volatile bool *(volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_40::mem_fn)>::result_type, volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_40::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_40::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_40::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_40::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_40::mem_fn)>::arg0_type, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_40::mem_fn)>::arg_type<0>, volatile bool *>);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_40::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_40::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_40::mem_fn)>::class_type, class_40>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_40::mem_fn)>, volatile bool *(volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_40::mem_fn)>, volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_40::mem_fn), 0>, volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_40::mem_fn)>, type_list<volatile bool *>>);
+static_assert(callable_arity_v<decltype(&class_40::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_40::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_40::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_40::mem_fn)> == callable_traits<decltype(&class_40::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_40::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_40::mem_fn)>, class_40>);
+struct class_44 { volatile bool & mem_fn(volatile bool &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_44::mem_fn)>::signature_type, volatile bool &(volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_44::mem_fn)>::result_type, volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_44::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_44::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_44::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_44::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_44::mem_fn)>::arg0_type, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_44::mem_fn)>::arg_type<0>, volatile bool &>);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_44::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_44::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_44::mem_fn)>::class_type, class_44>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_44::mem_fn)>, volatile bool &(volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_44::mem_fn)>, volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_44::mem_fn), 0>, volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_44::mem_fn)>, type_list<volatile bool &>>);
+static_assert(callable_arity_v<decltype(&class_44::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_44::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_44::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_44::mem_fn)> == callable_traits<decltype(&class_44::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_44::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_44::mem_fn)>, class_44>);
+struct class_48 { volatile bool * & mem_fn(volatile bool * &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_48::mem_fn)>::signature_type, volatile bool * &(volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_48::mem_fn)>::result_type, volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_48::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_48::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_48::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_48::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_48::mem_fn)>::arg0_type, volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_48::mem_fn)>::arg_type<0>, volatile bool * &>);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_48::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_48::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_48::mem_fn)>::class_type, class_48>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_48::mem_fn)>, volatile bool * &(volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_48::mem_fn)>, volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_48::mem_fn), 0>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_48::mem_fn)>, type_list<volatile bool * &>>);
+static_assert(callable_arity_v<decltype(&class_48::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_48::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_48::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_48::mem_fn)> == callable_traits<decltype(&class_48::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_48::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_48::mem_fn)>, class_48>);
+struct class_52 { volatile bool * const & mem_fn(volatile bool * const &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_52::mem_fn)>::signature_type, volatile bool * const &(volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_52::mem_fn)>::result_type, volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_52::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_52::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_52::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_52::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_52::mem_fn)>::arg0_type, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_52::mem_fn)>::arg_type<0>, volatile bool * const &>);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_52::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_52::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_52::mem_fn)>::class_type, class_52>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_52::mem_fn)>, volatile bool * const &(volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_52::mem_fn)>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_52::mem_fn), 0>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_52::mem_fn)>, type_list<volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_52::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_52::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_52::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_52::mem_fn)> == callable_traits<decltype(&class_52::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_52::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_52::mem_fn)>, class_52>);
+struct class_56 { volatile bool * volatile & mem_fn(volatile bool * volatile &) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_56::mem_fn)>::signature_type, volatile bool * volatile &(volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_56::mem_fn)>::result_type, volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_56::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_56::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_56::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_56::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_56::mem_fn)>::arg0_type, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_56::mem_fn)>::arg_type<0>, volatile bool * volatile &>);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_56::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_56::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_56::mem_fn)>::class_type, class_56>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_56::mem_fn)>, volatile bool * volatile &(volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_56::mem_fn)>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_56::mem_fn), 0>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_56::mem_fn)>, type_list<volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_56::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_56::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_56::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_56::mem_fn)> == callable_traits<decltype(&class_56::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_56::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_56::mem_fn)>, class_56>);
+struct class_60 { volatile bool * const volatile & mem_fn(volatile bool * const volatile &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_60::mem_fn)>::signature_type, volatile bool * const volatile &(volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_60::mem_fn)>::result_type, volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_60::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_60::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_60::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_60::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_60::mem_fn)>::arg0_type, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_60::mem_fn)>::arg_type<0>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_60::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_60::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_60::mem_fn)>::class_type, class_60>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_60::mem_fn)>, volatile bool * const volatile &(volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_60::mem_fn)>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_60::mem_fn), 0>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_60::mem_fn)>, type_list<volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_60::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_60::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_60::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_60::mem_fn)> == callable_traits<decltype(&class_60::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_60::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_60::mem_fn)>, class_60>);
+struct class_64 { volatile bool && mem_fn(volatile bool &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_64::mem_fn)>::signature_type, volatile bool &&(volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_64::mem_fn)>::result_type, volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_64::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_64::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_64::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_64::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_64::mem_fn)>::arg0_type, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_64::mem_fn)>::arg_type<0>, volatile bool &&>);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_64::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_64::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_64::mem_fn)>::class_type, class_64>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_64::mem_fn)>, volatile bool &&(volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_64::mem_fn)>, volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_64::mem_fn), 0>, volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_64::mem_fn)>, type_list<volatile bool &&>>);
+static_assert(callable_arity_v<decltype(&class_64::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_64::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_64::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_64::mem_fn)> == callable_traits<decltype(&class_64::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_64::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_64::mem_fn)>, class_64>);
+struct class_68 { volatile bool * && mem_fn(volatile bool * &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_68::mem_fn)>::signature_type, volatile bool * &&(volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_68::mem_fn)>::result_type, volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_68::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_68::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_68::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_68::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_68::mem_fn)>::arg0_type, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_68::mem_fn)>::arg_type<0>, volatile bool * &&>);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_68::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_68::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_68::mem_fn)>::class_type, class_68>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_68::mem_fn)>, volatile bool * &&(volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_68::mem_fn)>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_68::mem_fn), 0>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_68::mem_fn)>, type_list<volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_68::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_68::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_68::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_68::mem_fn)> == callable_traits<decltype(&class_68::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_68::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_68::mem_fn)>, class_68>);
+struct class_72 { volatile bool * const && mem_fn(volatile bool * const &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_72::mem_fn)>::signature_type, volatile bool * const &&(volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_72::mem_fn)>::result_type, volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_72::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_72::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_72::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_72::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_72::mem_fn)>::arg0_type, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_72::mem_fn)>::arg_type<0>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_72::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_72::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_72::mem_fn)>::class_type, class_72>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_72::mem_fn)>, volatile bool * const &&(volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_72::mem_fn)>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_72::mem_fn), 0>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_72::mem_fn)>, type_list<volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_72::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_72::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_72::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_72::mem_fn)> == callable_traits<decltype(&class_72::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_72::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_72::mem_fn)>, class_72>);
+struct class_76 { volatile bool * volatile && mem_fn(volatile bool * volatile &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_76::mem_fn)>::signature_type, volatile bool * volatile &&(volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_76::mem_fn)>::result_type, volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_76::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_76::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_76::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_76::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_76::mem_fn)>::arg0_type, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_76::mem_fn)>::arg_type<0>, volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_76::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_76::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_76::mem_fn)>::class_type, class_76>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_76::mem_fn)>, volatile bool * volatile &&(volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_76::mem_fn)>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_76::mem_fn), 0>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_76::mem_fn)>, type_list<volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_76::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_76::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_76::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_76::mem_fn)> == callable_traits<decltype(&class_76::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_76::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_76::mem_fn)>, class_76>);
+struct class_80 { volatile bool * const volatile && mem_fn(volatile bool * const volatile &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_80::mem_fn)>::signature_type, volatile bool * const volatile &&(volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_80::mem_fn)>::result_type, volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_80::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_80::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_80::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_80::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_80::mem_fn)>::arg0_type, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_80::mem_fn)>::arg_type<0>, volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_80::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_80::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_80::mem_fn)>::class_type, class_80>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_80::mem_fn)>, volatile bool * const volatile &&(volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_80::mem_fn)>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_80::mem_fn), 0>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_80::mem_fn)>, type_list<volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_80::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_80::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_80::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_80::mem_fn)> == callable_traits<decltype(&class_80::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_80::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_80::mem_fn)>, class_80>);
+struct class_84 { const int * mem_fn(const int *) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_84::mem_fn)>::signature_type, const int *(const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_84::mem_fn)>::result_type, const int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_84::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_84::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_84::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_84::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_84::mem_fn)>::arg0_type, const int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_84::mem_fn)>::arg_type<0>, const int *>);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_84::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_84::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_84::mem_fn)>::class_type, class_84>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_84::mem_fn)>, const int *(const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_84::mem_fn)>, const int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_84::mem_fn), 0>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_84::mem_fn)>, type_list<const int *>>);
+static_assert(callable_arity_v<decltype(&class_84::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_84::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_84::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_84::mem_fn)> == callable_traits<decltype(&class_84::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_84::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_84::mem_fn)>, class_84>);
+struct class_88 { const int & mem_fn(const int &) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_88::mem_fn)>::signature_type, const int &(const int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_88::mem_fn)>::result_type, const int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_88::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_88::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_88::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_88::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_88::mem_fn)>::arg0_type, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_88::mem_fn)>::arg_type<0>, const int &>);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_88::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_88::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_88::mem_fn)>::class_type, class_88>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_88::mem_fn)>, const int &(const int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_88::mem_fn)>, const int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_88::mem_fn), 0>, const int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_88::mem_fn)>, type_list<const int &>>);
+static_assert(callable_arity_v<decltype(&class_88::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_88::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_88::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_88::mem_fn)> == callable_traits<decltype(&class_88::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_88::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_88::mem_fn)>, class_88>);
+struct class_92 { const int * & mem_fn(const int * &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_92::mem_fn)>::signature_type, const int * &(const int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_92::mem_fn)>::result_type, const int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_92::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_92::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_92::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_92::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_92::mem_fn)>::arg0_type, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_92::mem_fn)>::arg_type<0>, const int * &>);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_92::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_92::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_92::mem_fn)>::class_type, class_92>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_92::mem_fn)>, const int * &(const int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_92::mem_fn)>, const int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_92::mem_fn), 0>, const int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_92::mem_fn)>, type_list<const int * &>>);
+static_assert(callable_arity_v<decltype(&class_92::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_92::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_92::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_92::mem_fn)> == callable_traits<decltype(&class_92::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_92::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_92::mem_fn)>, class_92>);
+struct class_96 { const int * const & mem_fn(const int * const &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_96::mem_fn)>::signature_type, const int * const &(const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_96::mem_fn)>::result_type, const int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_96::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_96::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_96::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_96::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_96::mem_fn)>::arg0_type, const int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_96::mem_fn)>::arg_type<0>, const int * const &>);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_96::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_96::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_96::mem_fn)>::class_type, class_96>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_96::mem_fn)>, const int * const &(const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_96::mem_fn)>, const int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_96::mem_fn), 0>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_96::mem_fn)>, type_list<const int * const &>>);
+static_assert(callable_arity_v<decltype(&class_96::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_96::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_96::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_96::mem_fn)> == callable_traits<decltype(&class_96::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_96::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_96::mem_fn)>, class_96>);
+struct class_100 { const int * volatile & mem_fn(const int * volatile &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_100::mem_fn)>::signature_type, const int * volatile &(const int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_100::mem_fn)>::result_type, const int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_100::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_100::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_100::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_100::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_100::mem_fn)>::arg0_type, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_100::mem_fn)>::arg_type<0>, const int * volatile &>);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_100::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_100::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_100::mem_fn)>::class_type, class_100>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_100::mem_fn)>, const int * volatile &(const int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_100::mem_fn)>, const int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_100::mem_fn), 0>, const int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_100::mem_fn)>, type_list<const int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_100::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_100::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_100::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_100::mem_fn)> == callable_traits<decltype(&class_100::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_100::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_100::mem_fn)>, class_100>);
+struct class_104 { const int * const volatile & mem_fn(const int * const volatile &) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_104::mem_fn)>::signature_type, const int * const volatile &(const int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_104::mem_fn)>::result_type, const int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_104::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_104::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_104::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_104::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_104::mem_fn)>::arg0_type, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_104::mem_fn)>::arg_type<0>, const int * const volatile &>);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_104::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_104::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_104::mem_fn)>::class_type, class_104>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_104::mem_fn)>, const int * const volatile &(const int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_104::mem_fn)>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_104::mem_fn), 0>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_104::mem_fn)>, type_list<const int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_104::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_104::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_104::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_104::mem_fn)> == callable_traits<decltype(&class_104::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_104::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_104::mem_fn)>, class_104>);
+struct class_108 { const int && mem_fn(const int &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_108::mem_fn)>::signature_type, const int &&(const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_108::mem_fn)>::result_type, const int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_108::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_108::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_108::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_108::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_108::mem_fn)>::arg0_type, const int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_108::mem_fn)>::arg_type<0>, const int &&>);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_108::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_108::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_108::mem_fn)>::class_type, class_108>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_108::mem_fn)>, const int &&(const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_108::mem_fn)>, const int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_108::mem_fn), 0>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_108::mem_fn)>, type_list<const int &&>>);
+static_assert(callable_arity_v<decltype(&class_108::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_108::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_108::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_108::mem_fn)> == callable_traits<decltype(&class_108::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_108::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_108::mem_fn)>, class_108>);
+struct class_112 { const int * && mem_fn(const int * &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_112::mem_fn)>::signature_type, const int * &&(const int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_112::mem_fn)>::result_type, const int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_112::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_112::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_112::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_112::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_112::mem_fn)>::arg0_type, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_112::mem_fn)>::arg_type<0>, const int * &&>);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_112::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_112::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_112::mem_fn)>::class_type, class_112>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_112::mem_fn)>, const int * &&(const int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_112::mem_fn)>, const int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_112::mem_fn), 0>, const int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_112::mem_fn)>, type_list<const int * &&>>);
+static_assert(callable_arity_v<decltype(&class_112::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_112::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_112::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_112::mem_fn)> == callable_traits<decltype(&class_112::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_112::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_112::mem_fn)>, class_112>);
+struct class_116 { const int * const && mem_fn(const int * const &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_116::mem_fn)>::signature_type, const int * const &&(const int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_116::mem_fn)>::result_type, const int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_116::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_116::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_116::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_116::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_116::mem_fn)>::arg0_type, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_116::mem_fn)>::arg_type<0>, const int * const &&>);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_116::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_116::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_116::mem_fn)>::class_type, class_116>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_116::mem_fn)>, const int * const &&(const int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_116::mem_fn)>, const int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_116::mem_fn), 0>, const int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_116::mem_fn)>, type_list<const int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_116::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_116::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_116::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_116::mem_fn)> == callable_traits<decltype(&class_116::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_116::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_116::mem_fn)>, class_116>);
+struct class_120 { const int * volatile && mem_fn(const int * volatile &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_120::mem_fn)>::signature_type, const int * volatile &&(const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_120::mem_fn)>::result_type, const int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_120::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_120::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_120::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_120::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_120::mem_fn)>::arg0_type, const int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_120::mem_fn)>::arg_type<0>, const int * volatile &&>);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_120::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_120::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_120::mem_fn)>::class_type, class_120>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_120::mem_fn)>, const int * volatile &&(const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_120::mem_fn)>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_120::mem_fn), 0>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_120::mem_fn)>, type_list<const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_120::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_120::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_120::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_120::mem_fn)> == callable_traits<decltype(&class_120::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_120::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_120::mem_fn)>, class_120>);
+struct class_124 { const int * const volatile && mem_fn(const int * const volatile &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_124::mem_fn)>::signature_type, const int * const volatile &&(const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_124::mem_fn)>::result_type, const int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_124::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_124::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_124::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_124::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_124::mem_fn)>::arg0_type, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_124::mem_fn)>::arg_type<0>, const int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_124::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_124::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_124::mem_fn)>::class_type, class_124>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_124::mem_fn)>, const int * const volatile &&(const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_124::mem_fn)>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_124::mem_fn), 0>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_124::mem_fn)>, type_list<const int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_124::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_124::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_124::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_124::mem_fn)> == callable_traits<decltype(&class_124::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_124::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_124::mem_fn)>, class_124>);
+struct class_128 { float * mem_fn(float *) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_128::mem_fn)>::signature_type, float *(float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_128::mem_fn)>::result_type, float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_128::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_128::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_128::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_128::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_128::mem_fn)>::arg0_type, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_128::mem_fn)>::arg_type<0>, float *>);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_128::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_128::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_128::mem_fn)>::class_type, class_128>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_128::mem_fn)>, float *(float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_128::mem_fn)>, float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_128::mem_fn), 0>, float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_128::mem_fn)>, type_list<float *>>);
+static_assert(callable_arity_v<decltype(&class_128::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_128::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_128::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_128::mem_fn)> == callable_traits<decltype(&class_128::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_128::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_128::mem_fn)>, class_128>);
+struct class_132 { float & mem_fn(float &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_132::mem_fn)>::signature_type, float &(float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_132::mem_fn)>::result_type, float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_132::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_132::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_132::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_132::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_132::mem_fn)>::arg0_type, float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_132::mem_fn)>::arg_type<0>, float &>);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_132::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_132::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_132::mem_fn)>::class_type, class_132>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_132::mem_fn)>, float &(float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_132::mem_fn)>, float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_132::mem_fn), 0>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_132::mem_fn)>, type_list<float &>>);
+static_assert(callable_arity_v<decltype(&class_132::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_132::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_132::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_132::mem_fn)> == callable_traits<decltype(&class_132::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_132::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_132::mem_fn)>, class_132>);
+struct class_136 { float * & mem_fn(float * &) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_136::mem_fn)>::signature_type, float * &(float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_136::mem_fn)>::result_type, float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_136::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_136::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_136::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_136::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_136::mem_fn)>::arg0_type, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_136::mem_fn)>::arg_type<0>, float * &>);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_136::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_136::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_136::mem_fn)>::class_type, class_136>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_136::mem_fn)>, float * &(float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_136::mem_fn)>, float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_136::mem_fn), 0>, float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_136::mem_fn)>, type_list<float * &>>);
+static_assert(callable_arity_v<decltype(&class_136::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_136::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_136::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_136::mem_fn)> == callable_traits<decltype(&class_136::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_136::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_136::mem_fn)>, class_136>);
+struct class_140 { float * const & mem_fn(float * const &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_140::mem_fn)>::signature_type, float * const &(float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_140::mem_fn)>::result_type, float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_140::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_140::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_140::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_140::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_140::mem_fn)>::arg0_type, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_140::mem_fn)>::arg_type<0>, float * const &>);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_140::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_140::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_140::mem_fn)>::class_type, class_140>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_140::mem_fn)>, float * const &(float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_140::mem_fn)>, float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_140::mem_fn), 0>, float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_140::mem_fn)>, type_list<float * const &>>);
+static_assert(callable_arity_v<decltype(&class_140::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_140::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_140::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_140::mem_fn)> == callable_traits<decltype(&class_140::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_140::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_140::mem_fn)>, class_140>);
+struct class_144 { float * volatile & mem_fn(float * volatile &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_144::mem_fn)>::signature_type, float * volatile &(float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_144::mem_fn)>::result_type, float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_144::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_144::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_144::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_144::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_144::mem_fn)>::arg0_type, float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_144::mem_fn)>::arg_type<0>, float * volatile &>);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_144::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_144::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_144::mem_fn)>::class_type, class_144>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_144::mem_fn)>, float * volatile &(float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_144::mem_fn)>, float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_144::mem_fn), 0>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_144::mem_fn)>, type_list<float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_144::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_144::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_144::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_144::mem_fn)> == callable_traits<decltype(&class_144::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_144::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_144::mem_fn)>, class_144>);
+struct class_148 { float * const volatile & mem_fn(float * const volatile &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_148::mem_fn)>::signature_type, float * const volatile &(float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_148::mem_fn)>::result_type, float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_148::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_148::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_148::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_148::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_148::mem_fn)>::arg0_type, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_148::mem_fn)>::arg_type<0>, float * const volatile &>);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_148::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_148::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_148::mem_fn)>::class_type, class_148>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_148::mem_fn)>, float * const volatile &(float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_148::mem_fn)>, float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_148::mem_fn), 0>, float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_148::mem_fn)>, type_list<float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_148::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_148::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_148::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_148::mem_fn)> == callable_traits<decltype(&class_148::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_148::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_148::mem_fn)>, class_148>);
+struct class_152 { float && mem_fn(float &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_152::mem_fn)>::signature_type, float &&(float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_152::mem_fn)>::result_type, float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_152::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_152::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_152::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_152::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_152::mem_fn)>::arg0_type, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_152::mem_fn)>::arg_type<0>, float &&>);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_152::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_152::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_152::mem_fn)>::class_type, class_152>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_152::mem_fn)>, float &&(float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_152::mem_fn)>, float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_152::mem_fn), 0>, float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_152::mem_fn)>, type_list<float &&>>);
+static_assert(callable_arity_v<decltype(&class_152::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_152::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_152::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_152::mem_fn)> == callable_traits<decltype(&class_152::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_152::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_152::mem_fn)>, class_152>);
+struct class_156 { float * && mem_fn(float * &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_156::mem_fn)>::signature_type, float * &&(float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_156::mem_fn)>::result_type, float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_156::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_156::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_156::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_156::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_156::mem_fn)>::arg0_type, float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_156::mem_fn)>::arg_type<0>, float * &&>);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_156::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_156::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_156::mem_fn)>::class_type, class_156>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_156::mem_fn)>, float * &&(float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_156::mem_fn)>, float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_156::mem_fn), 0>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_156::mem_fn)>, type_list<float * &&>>);
+static_assert(callable_arity_v<decltype(&class_156::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_156::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_156::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_156::mem_fn)> == callable_traits<decltype(&class_156::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_156::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_156::mem_fn)>, class_156>);
+struct class_160 { float * const && mem_fn(float * const &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_160::mem_fn)>::signature_type, float * const &&(float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_160::mem_fn)>::result_type, float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_160::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_160::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_160::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_160::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_160::mem_fn)>::arg0_type, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_160::mem_fn)>::arg_type<0>, float * const &&>);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_160::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_160::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_160::mem_fn)>::class_type, class_160>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_160::mem_fn)>, float * const &&(float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_160::mem_fn)>, float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_160::mem_fn), 0>, float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_160::mem_fn)>, type_list<float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_160::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_160::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_160::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_160::mem_fn)> == callable_traits<decltype(&class_160::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_160::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_160::mem_fn)>, class_160>);
+struct class_164 { float * volatile && mem_fn(float * volatile &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_164::mem_fn)>::signature_type, float * volatile &&(float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_164::mem_fn)>::result_type, float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_164::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_164::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_164::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_164::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_164::mem_fn)>::arg0_type, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_164::mem_fn)>::arg_type<0>, float * volatile &&>);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_164::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_164::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_164::mem_fn)>::class_type, class_164>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_164::mem_fn)>, float * volatile &&(float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_164::mem_fn)>, float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_164::mem_fn), 0>, float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_164::mem_fn)>, type_list<float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_164::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_164::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_164::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_164::mem_fn)> == callable_traits<decltype(&class_164::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_164::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_164::mem_fn)>, class_164>);
+struct class_168 { float * const volatile && mem_fn(float * const volatile &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_168::mem_fn)>::signature_type, float * const volatile &&(float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_168::mem_fn)>::result_type, float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_168::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_168::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_168::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_168::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_168::mem_fn)>::arg0_type, float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_168::mem_fn)>::arg_type<0>, float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_168::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_168::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_168::mem_fn)>::class_type, class_168>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_168::mem_fn)>, float * const volatile &&(float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_168::mem_fn)>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_168::mem_fn), 0>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_168::mem_fn)>, type_list<float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_168::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_168::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_168::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_168::mem_fn)> == callable_traits<decltype(&class_168::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_168::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_168::mem_fn)>, class_168>);
+struct class_172 { std::string mem_fn(std::string) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_172::mem_fn)>::signature_type, std::string(std::string)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_172::mem_fn)>::result_type, std::string>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_172::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_172::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_172::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_172::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_172::mem_fn)>::arg0_type, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_172::mem_fn)>::arg_type<0>, std::string>);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_172::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_172::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_172::mem_fn)>::class_type, class_172>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_172::mem_fn)>, std::string(std::string)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_172::mem_fn)>, std::string>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_172::mem_fn), 0>, std::string>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_172::mem_fn)>, type_list<std::string>>);
+static_assert(callable_arity_v<decltype(&class_172::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_172::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_172::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_172::mem_fn)> == callable_traits<decltype(&class_172::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_172::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_172::mem_fn)>, class_172>);
+struct class_176 { const volatile std::string * mem_fn(const volatile std::string *) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_176::mem_fn)>::signature_type, const volatile std::string *(const volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_176::mem_fn)>::result_type, const volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_176::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_176::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_176::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_176::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_176::mem_fn)>::arg0_type, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_176::mem_fn)>::arg_type<0>, const volatile std::string *>);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_176::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_176::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_176::mem_fn)>::class_type, class_176>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_176::mem_fn)>, const volatile std::string *(const volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_176::mem_fn)>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_176::mem_fn), 0>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_176::mem_fn)>, type_list<const volatile std::string *>>);
+static_assert(callable_arity_v<decltype(&class_176::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_176::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_176::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_176::mem_fn)> == callable_traits<decltype(&class_176::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_176::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_176::mem_fn)>, class_176>);
+struct class_180 { const volatile std::string & mem_fn(const volatile std::string &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_180::mem_fn)>::signature_type, const volatile std::string &(const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_180::mem_fn)>::result_type, const volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_180::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_180::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_180::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_180::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_180::mem_fn)>::arg0_type, const volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_180::mem_fn)>::arg_type<0>, const volatile std::string &>);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_180::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_180::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_180::mem_fn)>::class_type, class_180>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_180::mem_fn)>, const volatile std::string &(const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_180::mem_fn)>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_180::mem_fn), 0>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_180::mem_fn)>, type_list<const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(&class_180::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_180::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_180::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_180::mem_fn)> == callable_traits<decltype(&class_180::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_180::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_180::mem_fn)>, class_180>);
+struct class_184 { const volatile std::string * & mem_fn(const volatile std::string * &) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_184::mem_fn)>::signature_type, const volatile std::string * &(const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_184::mem_fn)>::result_type, const volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_184::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_184::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_184::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_184::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_184::mem_fn)>::arg0_type, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_184::mem_fn)>::arg_type<0>, const volatile std::string * &>);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_184::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_184::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_184::mem_fn)>::class_type, class_184>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_184::mem_fn)>, const volatile std::string * &(const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_184::mem_fn)>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_184::mem_fn), 0>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_184::mem_fn)>, type_list<const volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_184::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_184::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_184::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_184::mem_fn)> == callable_traits<decltype(&class_184::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_184::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_184::mem_fn)>, class_184>);
+struct class_188 { const volatile std::string * const & mem_fn(const volatile std::string * const &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_188::mem_fn)>::signature_type, const volatile std::string * const &(const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_188::mem_fn)>::result_type, const volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_188::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_188::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_188::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_188::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_188::mem_fn)>::arg0_type, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_188::mem_fn)>::arg_type<0>, const volatile std::string * const &>);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_188::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_188::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_188::mem_fn)>::class_type, class_188>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_188::mem_fn)>, const volatile std::string * const &(const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_188::mem_fn)>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_188::mem_fn), 0>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_188::mem_fn)>, type_list<const volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_188::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_188::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_188::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_188::mem_fn)> == callable_traits<decltype(&class_188::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_188::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_188::mem_fn)>, class_188>);
+struct class_192 { const volatile std::string * volatile & mem_fn(const volatile std::string * volatile &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_192::mem_fn)>::signature_type, const volatile std::string * volatile &(const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_192::mem_fn)>::result_type, const volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_192::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_192::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_192::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_192::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_192::mem_fn)>::arg0_type, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_192::mem_fn)>::arg_type<0>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_192::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_192::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_192::mem_fn)>::class_type, class_192>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_192::mem_fn)>, const volatile std::string * volatile &(const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_192::mem_fn)>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_192::mem_fn), 0>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_192::mem_fn)>, type_list<const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_192::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_192::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_192::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_192::mem_fn)> == callable_traits<decltype(&class_192::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_192::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_192::mem_fn)>, class_192>);
+struct class_196 { const volatile std::string * const volatile & mem_fn(const volatile std::string * const volatile &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_196::mem_fn)>::signature_type, const volatile std::string * const volatile &(const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_196::mem_fn)>::result_type, const volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_196::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_196::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_196::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_196::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_196::mem_fn)>::arg0_type, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_196::mem_fn)>::arg_type<0>, const volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_196::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_196::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_196::mem_fn)>::class_type, class_196>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_196::mem_fn)>, const volatile std::string * const volatile &(const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_196::mem_fn)>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_196::mem_fn), 0>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_196::mem_fn)>, type_list<const volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_196::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_196::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_196::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_196::mem_fn)> == callable_traits<decltype(&class_196::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_196::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_196::mem_fn)>, class_196>);
+struct class_200 { const volatile std::string && mem_fn(const volatile std::string &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_200::mem_fn)>::signature_type, const volatile std::string &&(const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_200::mem_fn)>::result_type, const volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_200::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_200::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_200::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_200::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_200::mem_fn)>::arg0_type, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_200::mem_fn)>::arg_type<0>, const volatile std::string &&>);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_200::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_200::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_200::mem_fn)>::class_type, class_200>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_200::mem_fn)>, const volatile std::string &&(const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_200::mem_fn)>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_200::mem_fn), 0>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_200::mem_fn)>, type_list<const volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_200::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_200::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_200::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_200::mem_fn)> == callable_traits<decltype(&class_200::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_200::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_200::mem_fn)>, class_200>);
+struct class_204 { const volatile std::string * && mem_fn(const volatile std::string * &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_204::mem_fn)>::signature_type, const volatile std::string * &&(const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_204::mem_fn)>::result_type, const volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_204::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_204::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_204::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_204::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_204::mem_fn)>::arg0_type, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_204::mem_fn)>::arg_type<0>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_204::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_204::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_204::mem_fn)>::class_type, class_204>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_204::mem_fn)>, const volatile std::string * &&(const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_204::mem_fn)>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_204::mem_fn), 0>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_204::mem_fn)>, type_list<const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_204::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_204::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_204::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_204::mem_fn)> == callable_traits<decltype(&class_204::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_204::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_204::mem_fn)>, class_204>);
+struct class_208 { const volatile std::string * const && mem_fn(const volatile std::string * const &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_208::mem_fn)>::signature_type, const volatile std::string * const &&(const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_208::mem_fn)>::result_type, const volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_208::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_208::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_208::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_208::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_208::mem_fn)>::arg0_type, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_208::mem_fn)>::arg_type<0>, const volatile std::string * const &&>);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_208::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_208::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_208::mem_fn)>::class_type, class_208>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_208::mem_fn)>, const volatile std::string * const &&(const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_208::mem_fn)>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_208::mem_fn), 0>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_208::mem_fn)>, type_list<const volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_208::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_208::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_208::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_208::mem_fn)> == callable_traits<decltype(&class_208::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_208::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_208::mem_fn)>, class_208>);
+struct class_212 { const volatile std::string * volatile && mem_fn(const volatile std::string * volatile &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_212::mem_fn)>::signature_type, const volatile std::string * volatile &&(const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_212::mem_fn)>::result_type, const volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_212::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_212::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_212::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_212::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_212::mem_fn)>::arg0_type, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_212::mem_fn)>::arg_type<0>, const volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_212::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_212::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_212::mem_fn)>::class_type, class_212>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_212::mem_fn)>, const volatile std::string * volatile &&(const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_212::mem_fn)>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_212::mem_fn), 0>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_212::mem_fn)>, type_list<const volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_212::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_212::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_212::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_212::mem_fn)> == callable_traits<decltype(&class_212::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_212::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_212::mem_fn)>, class_212>);
+struct class_216 { const volatile std::string * const volatile && mem_fn(const volatile std::string * const volatile &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_216::mem_fn)>::signature_type, const volatile std::string * const volatile &&(const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_216::mem_fn)>::result_type, const volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_216::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_216::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_216::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_216::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_216::mem_fn)>::arg0_type, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_216::mem_fn)>::arg_type<0>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_216::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_216::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_216::mem_fn)>::class_type, class_216>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_216::mem_fn)>, const volatile std::string * const volatile &&(const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_216::mem_fn)>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_216::mem_fn), 0>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_216::mem_fn)>, type_list<const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_216::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_216::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_216::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_216::mem_fn)> == callable_traits<decltype(&class_216::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_216::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_216::mem_fn)>, class_216>);
+struct class_220 { volatile void * mem_fn(volatile void * &, const volatile void * &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::signature_type, volatile void *(volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::result_type, volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_220::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_220::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_220::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_220::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::arg0_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::arg_type<0>, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::arg1_type, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::arg_type<1>, const volatile void * &>);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_220::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_220::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_220::mem_fn)>::class_type, class_220>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_220::mem_fn)>, volatile void *(volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_220::mem_fn)>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_220::mem_fn), 0>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_220::mem_fn), 1>, const volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_220::mem_fn)>, type_list<volatile void * &, const volatile void * &>>);
+static_assert(callable_arity_v<decltype(&class_220::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_220::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_220::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_220::mem_fn)> == callable_traits<decltype(&class_220::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_220::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_220::mem_fn)>, class_220>);
+struct class_224 { volatile void * & mem_fn(volatile void * volatile &, const volatile void * volatile &) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::signature_type, volatile void * &(volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::result_type, volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_224::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_224::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_224::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_224::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::arg0_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::arg_type<0>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::arg1_type, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::arg_type<1>, const volatile void * volatile &>);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_224::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_224::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_224::mem_fn)>::class_type, class_224>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_224::mem_fn)>, volatile void * &(volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_224::mem_fn)>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_224::mem_fn), 0>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_224::mem_fn), 1>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_224::mem_fn)>, type_list<volatile void * volatile &, const volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_224::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_224::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_224::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_224::mem_fn)> == callable_traits<decltype(&class_224::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_224::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_224::mem_fn)>, class_224>);
+struct class_228 { volatile void * const & mem_fn(volatile void * &&, const volatile void * &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::signature_type, volatile void * const &(volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::result_type, volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_228::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_228::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_228::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_228::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::arg0_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::arg_type<0>, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::arg1_type, const volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::arg_type<1>, const volatile void * &&>);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_228::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_228::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_228::mem_fn)>::class_type, class_228>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_228::mem_fn)>, volatile void * const &(volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_228::mem_fn)>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_228::mem_fn), 0>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_228::mem_fn), 1>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_228::mem_fn)>, type_list<volatile void * &&, const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(&class_228::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_228::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_228::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_228::mem_fn)> == callable_traits<decltype(&class_228::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_228::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_228::mem_fn)>, class_228>);
+struct class_232 { volatile void * volatile & mem_fn(volatile void * volatile &&, const volatile void * volatile &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::signature_type, volatile void * volatile &(volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::result_type, volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_232::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_232::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_232::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_232::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::arg0_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::arg_type<0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::arg1_type, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::arg_type<1>, const volatile void * volatile &&>);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_232::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_232::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_232::mem_fn)>::class_type, class_232>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_232::mem_fn)>, volatile void * volatile &(volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_232::mem_fn)>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_232::mem_fn), 0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_232::mem_fn), 1>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_232::mem_fn)>, type_list<volatile void * volatile &&, const volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_232::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_232::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_232::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_232::mem_fn)> == callable_traits<decltype(&class_232::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_232::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_232::mem_fn)>, class_232>);
+struct class_236 { volatile void * const volatile & mem_fn(const bool *, volatile bool *) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::signature_type, volatile void * const volatile &(const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::result_type, volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_236::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_236::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_236::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_236::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::arg0_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::arg_type<0>, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::arg1_type, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::arg_type<1>, volatile bool *>);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_236::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_236::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_236::mem_fn)>::class_type, class_236>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_236::mem_fn)>, volatile void * const volatile &(const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_236::mem_fn)>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_236::mem_fn), 0>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_236::mem_fn), 1>, volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_236::mem_fn)>, type_list<const bool *, volatile bool *>>);
+static_assert(callable_arity_v<decltype(&class_236::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_236::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_236::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_236::mem_fn)> == callable_traits<decltype(&class_236::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_236::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_236::mem_fn)>, class_236>);
+struct class_240 { volatile void * && mem_fn(const bool * &, volatile bool * &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::signature_type, volatile void * &&(const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::result_type, volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_240::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_240::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_240::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_240::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::arg0_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::arg_type<0>, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::arg1_type, volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::arg_type<1>, volatile bool * &>);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_240::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_240::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_240::mem_fn)>::class_type, class_240>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_240::mem_fn)>, volatile void * &&(const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_240::mem_fn)>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_240::mem_fn), 0>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_240::mem_fn), 1>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_240::mem_fn)>, type_list<const bool * &, volatile bool * &>>);
+static_assert(callable_arity_v<decltype(&class_240::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_240::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_240::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_240::mem_fn)> == callable_traits<decltype(&class_240::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_240::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_240::mem_fn)>, class_240>);
+struct class_244 { volatile void * const && mem_fn(const bool * volatile &, volatile bool * volatile &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::signature_type, volatile void * const &&(const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::result_type, volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_244::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_244::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_244::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_244::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::arg0_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::arg_type<0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::arg1_type, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::arg_type<1>, volatile bool * volatile &>);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_244::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_244::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_244::mem_fn)>::class_type, class_244>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_244::mem_fn)>, volatile void * const &&(const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_244::mem_fn)>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_244::mem_fn), 0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_244::mem_fn), 1>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_244::mem_fn)>, type_list<const bool * volatile &, volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_244::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_244::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_244::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_244::mem_fn)> == callable_traits<decltype(&class_244::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_244::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_244::mem_fn)>, class_244>);
+struct class_248 { volatile void * volatile && mem_fn(const bool &&, volatile bool &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::signature_type, volatile void * volatile &&(const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::result_type, volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_248::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_248::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_248::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_248::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::arg0_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::arg_type<0>, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::arg1_type, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::arg_type<1>, volatile bool &&>);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_248::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_248::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_248::mem_fn)>::class_type, class_248>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_248::mem_fn)>, volatile void * volatile &&(const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_248::mem_fn)>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_248::mem_fn), 0>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_248::mem_fn), 1>, volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_248::mem_fn)>, type_list<const bool &&, volatile bool &&>>);
+static_assert(callable_arity_v<decltype(&class_248::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_248::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_248::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_248::mem_fn)> == callable_traits<decltype(&class_248::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_248::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_248::mem_fn)>, class_248>);
+struct class_252 { volatile void * const volatile && mem_fn(const bool * const &&, volatile bool * const &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::signature_type, volatile void * const volatile &&(const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::result_type, volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_252::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_252::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_252::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_252::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::arg0_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::arg_type<0>, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::arg1_type, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::arg_type<1>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_252::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_252::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_252::mem_fn)>::class_type, class_252>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_252::mem_fn)>, volatile void * const volatile &&(const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_252::mem_fn)>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_252::mem_fn), 0>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_252::mem_fn), 1>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_252::mem_fn)>, type_list<const bool * const &&, volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_252::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_252::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_252::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_252::mem_fn)> == callable_traits<decltype(&class_252::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_252::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_252::mem_fn)>, class_252>);
+struct class_256 { const bool * mem_fn(const bool * const volatile &&, volatile bool * const volatile &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::signature_type, const bool *(const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::result_type, const bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_256::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_256::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_256::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_256::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::arg0_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::arg_type<0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::arg1_type, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::arg_type<1>, volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_256::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_256::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_256::mem_fn)>::class_type, class_256>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_256::mem_fn)>, const bool *(const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_256::mem_fn)>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_256::mem_fn), 0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_256::mem_fn), 1>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_256::mem_fn)>, type_list<const bool * const volatile &&, volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_256::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_256::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_256::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_256::mem_fn)> == callable_traits<decltype(&class_256::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_256::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_256::mem_fn)>, class_256>);
+struct class_260 { const bool & mem_fn(int &, const int &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::signature_type, const bool &(int &, const int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::result_type, const bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_260::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_260::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_260::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_260::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::arg0_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::arg_type<0>, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::arg1_type, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::arg_type<1>, const int &>);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_260::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_260::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_260::mem_fn)>::class_type, class_260>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_260::mem_fn)>, const bool &(int &, const int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_260::mem_fn)>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_260::mem_fn), 0>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_260::mem_fn), 1>, const int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_260::mem_fn)>, type_list<int &, const int &>>);
+static_assert(callable_arity_v<decltype(&class_260::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_260::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_260::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_260::mem_fn)> == callable_traits<decltype(&class_260::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_260::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_260::mem_fn)>, class_260>);
+struct class_264 { const bool * & mem_fn(int * const &, const int * const &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::signature_type, const bool * &(int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::result_type, const bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_264::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_264::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_264::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_264::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::arg0_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::arg_type<0>, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::arg1_type, const int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::arg_type<1>, const int * const &>);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_264::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_264::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_264::mem_fn)>::class_type, class_264>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_264::mem_fn)>, const bool * &(int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_264::mem_fn)>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_264::mem_fn), 0>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_264::mem_fn), 1>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_264::mem_fn)>, type_list<int * const &, const int * const &>>);
+static_assert(callable_arity_v<decltype(&class_264::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_264::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_264::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_264::mem_fn)> == callable_traits<decltype(&class_264::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_264::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_264::mem_fn)>, class_264>);
+struct class_268 { const bool * const & mem_fn(int * const volatile &, const int * const volatile &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::signature_type, const bool * const &(int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::result_type, const bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_268::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_268::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_268::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_268::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::arg0_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::arg_type<0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::arg1_type, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::arg_type<1>, const int * const volatile &>);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_268::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_268::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_268::mem_fn)>::class_type, class_268>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_268::mem_fn)>, const bool * const &(int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_268::mem_fn)>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_268::mem_fn), 0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_268::mem_fn), 1>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_268::mem_fn)>, type_list<int * const volatile &, const int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_268::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_268::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_268::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_268::mem_fn)> == callable_traits<decltype(&class_268::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_268::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_268::mem_fn)>, class_268>);
+struct class_272 { const bool * volatile & mem_fn(int * &&, const int * &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::signature_type, const bool * volatile &(int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::result_type, const bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_272::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_272::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_272::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_272::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::arg0_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::arg_type<0>, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::arg1_type, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::arg_type<1>, const int * &&>);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_272::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_272::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_272::mem_fn)>::class_type, class_272>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_272::mem_fn)>, const bool * volatile &(int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_272::mem_fn)>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_272::mem_fn), 0>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_272::mem_fn), 1>, const int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_272::mem_fn)>, type_list<int * &&, const int * &&>>);
+static_assert(callable_arity_v<decltype(&class_272::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_272::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_272::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_272::mem_fn)> == callable_traits<decltype(&class_272::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_272::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_272::mem_fn)>, class_272>);
+struct class_276 { const bool * const volatile & mem_fn(int * volatile &&, const int * volatile &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::signature_type, const bool * const volatile &(int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::result_type, const bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_276::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_276::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_276::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_276::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::arg0_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::arg_type<0>, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::arg1_type, const int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::arg_type<1>, const int * volatile &&>);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_276::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_276::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_276::mem_fn)>::class_type, class_276>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_276::mem_fn)>, const bool * const volatile &(int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_276::mem_fn)>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_276::mem_fn), 0>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_276::mem_fn), 1>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_276::mem_fn)>, type_list<int * volatile &&, const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_276::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_276::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_276::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_276::mem_fn)> == callable_traits<decltype(&class_276::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_276::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_276::mem_fn)>, class_276>);
+struct class_280 { const bool && mem_fn(float, float *) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::signature_type, const bool &&(float, float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::result_type, const bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_280::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_280::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_280::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_280::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::arg0_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::arg_type<0>, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::arg1_type, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::arg_type<1>, float *>);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_280::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_280::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_280::mem_fn)>::class_type, class_280>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_280::mem_fn)>, const bool &&(float, float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_280::mem_fn)>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_280::mem_fn), 0>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_280::mem_fn), 1>, float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_280::mem_fn)>, type_list<float, float *>>);
+static_assert(callable_arity_v<decltype(&class_280::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_280::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_280::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_280::mem_fn)> == callable_traits<decltype(&class_280::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_280::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_280::mem_fn)>, class_280>);
+struct class_284 { const bool * && mem_fn(const volatile float &, float * &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::signature_type, const bool * &&(const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::result_type, const bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_284::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_284::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_284::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_284::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::arg0_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::arg_type<0>, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::arg1_type, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::arg_type<1>, float * &>);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_284::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_284::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_284::mem_fn)>::class_type, class_284>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_284::mem_fn)>, const bool * &&(const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_284::mem_fn)>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_284::mem_fn), 0>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_284::mem_fn), 1>, float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_284::mem_fn)>, type_list<const volatile float &, float * &>>);
+static_assert(callable_arity_v<decltype(&class_284::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_284::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_284::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_284::mem_fn)> == callable_traits<decltype(&class_284::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_284::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_284::mem_fn)>, class_284>);
+struct class_288 { const bool * const && mem_fn(const volatile float * const &, float * volatile &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::signature_type, const bool * const &&(const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::result_type, const bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_288::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_288::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_288::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_288::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::arg0_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::arg_type<0>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::arg1_type, float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::arg_type<1>, float * volatile &>);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_288::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_288::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_288::mem_fn)>::class_type, class_288>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_288::mem_fn)>, const bool * const &&(const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_288::mem_fn)>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_288::mem_fn), 0>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_288::mem_fn), 1>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_288::mem_fn)>, type_list<const volatile float * const &, float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_288::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_288::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_288::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_288::mem_fn)> == callable_traits<decltype(&class_288::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_288::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_288::mem_fn)>, class_288>);
+struct class_292 { const bool * volatile && mem_fn(const volatile float * const volatile &, float &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::signature_type, const bool * volatile &&(const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::result_type, const bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_292::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_292::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_292::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_292::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::arg0_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::arg_type<0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::arg1_type, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::arg_type<1>, float &&>);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_292::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_292::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_292::mem_fn)>::class_type, class_292>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_292::mem_fn)>, const bool * volatile &&(const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_292::mem_fn)>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_292::mem_fn), 0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_292::mem_fn), 1>, float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_292::mem_fn)>, type_list<const volatile float * const volatile &, float &&>>);
+static_assert(callable_arity_v<decltype(&class_292::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_292::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_292::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_292::mem_fn)> == callable_traits<decltype(&class_292::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_292::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_292::mem_fn)>, class_292>);
+struct class_296 { const bool * const volatile && mem_fn(const volatile float * &&, float * const &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::signature_type, const bool * const volatile &&(const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::result_type, const bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_296::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_296::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_296::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_296::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::arg0_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::arg_type<0>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::arg1_type, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::arg_type<1>, float * const &&>);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_296::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_296::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_296::mem_fn)>::class_type, class_296>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_296::mem_fn)>, const bool * const volatile &&(const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_296::mem_fn)>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_296::mem_fn), 0>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_296::mem_fn), 1>, float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_296::mem_fn)>, type_list<const volatile float * &&, float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_296::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_296::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_296::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_296::mem_fn)> == callable_traits<decltype(&class_296::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_296::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_296::mem_fn)>, class_296>);
+struct class_300 { int * mem_fn(const volatile float * volatile &&, float * const volatile &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::signature_type, int *(const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::result_type, int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_300::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_300::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_300::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_300::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::arg0_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::arg_type<0>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::arg1_type, float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::arg_type<1>, float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_300::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_300::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_300::mem_fn)>::class_type, class_300>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_300::mem_fn)>, int *(const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_300::mem_fn)>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_300::mem_fn), 0>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_300::mem_fn), 1>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_300::mem_fn)>, type_list<const volatile float * volatile &&, float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_300::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_300::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_300::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_300::mem_fn)> == callable_traits<decltype(&class_300::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_300::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_300::mem_fn)>, class_300>);
+struct class_304 { int & mem_fn(volatile std::string *, const volatile std::string *) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::signature_type, int &(volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::result_type, int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_304::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_304::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_304::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_304::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::arg0_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::arg_type<0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::arg1_type, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::arg_type<1>, const volatile std::string *>);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_304::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_304::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_304::mem_fn)>::class_type, class_304>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_304::mem_fn)>, int &(volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_304::mem_fn)>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_304::mem_fn), 0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_304::mem_fn), 1>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_304::mem_fn)>, type_list<volatile std::string *, const volatile std::string *>>);
+static_assert(callable_arity_v<decltype(&class_304::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_304::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_304::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_304::mem_fn)> == callable_traits<decltype(&class_304::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_304::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_304::mem_fn)>, class_304>);
+struct class_308 { int * & mem_fn(volatile std::string * &, const volatile std::string * &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::signature_type, int * &(volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::result_type, int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_308::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_308::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_308::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_308::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::arg0_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::arg_type<0>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::arg1_type, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::arg_type<1>, const volatile std::string * &>);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_308::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_308::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_308::mem_fn)>::class_type, class_308>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_308::mem_fn)>, int * &(volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_308::mem_fn)>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_308::mem_fn), 0>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_308::mem_fn), 1>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_308::mem_fn)>, type_list<volatile std::string * &, const volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_308::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_308::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_308::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_308::mem_fn)> == callable_traits<decltype(&class_308::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_308::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_308::mem_fn)>, class_308>);
+struct class_312 { int * const & mem_fn(volatile std::string * volatile &, const volatile std::string * volatile &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::signature_type, int * const &(volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::result_type, int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_312::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_312::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_312::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_312::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::arg0_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::arg_type<0>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::arg1_type, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::arg_type<1>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_312::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_312::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_312::mem_fn)>::class_type, class_312>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_312::mem_fn)>, int * const &(volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_312::mem_fn)>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_312::mem_fn), 0>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_312::mem_fn), 1>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_312::mem_fn)>, type_list<volatile std::string * volatile &, const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_312::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_312::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_312::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_312::mem_fn)> == callable_traits<decltype(&class_312::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_312::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_312::mem_fn)>, class_312>);
+struct class_316 { int * volatile & mem_fn(volatile std::string &&, const volatile std::string &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::signature_type, int * volatile &(volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::result_type, int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_316::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_316::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_316::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_316::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::arg0_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::arg_type<0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::arg1_type, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::arg_type<1>, const volatile std::string &&>);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_316::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_316::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_316::mem_fn)>::class_type, class_316>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_316::mem_fn)>, int * volatile &(volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_316::mem_fn)>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_316::mem_fn), 0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_316::mem_fn), 1>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_316::mem_fn)>, type_list<volatile std::string &&, const volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_316::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_316::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_316::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_316::mem_fn)> == callable_traits<decltype(&class_316::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_316::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_316::mem_fn)>, class_316>);
+struct class_320 { int * const volatile & mem_fn(volatile std::string * const &&, const volatile std::string * const &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::signature_type, int * const volatile &(volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::result_type, int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_320::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_320::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_320::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_320::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::arg0_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::arg_type<0>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::arg1_type, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::arg_type<1>, const volatile std::string * const &&>);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_320::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_320::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_320::mem_fn)>::class_type, class_320>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_320::mem_fn)>, int * const volatile &(volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_320::mem_fn)>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_320::mem_fn), 0>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_320::mem_fn), 1>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_320::mem_fn)>, type_list<volatile std::string * const &&, const volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_320::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_320::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_320::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_320::mem_fn)> == callable_traits<decltype(&class_320::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_320::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_320::mem_fn)>, class_320>);
+struct class_324 { int && mem_fn(volatile std::string * const volatile &&, const volatile std::string * const volatile &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::signature_type, int &&(volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::result_type, int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_324::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_324::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_324::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_324::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::arg0_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::arg_type<0>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::arg1_type, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::arg_type<1>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_324::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_324::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_324::mem_fn)>::class_type, class_324>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_324::mem_fn)>, int &&(volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_324::mem_fn)>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_324::mem_fn), 0>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_324::mem_fn), 1>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_324::mem_fn)>, type_list<volatile std::string * const volatile &&, const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_324::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_324::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_324::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_324::mem_fn)> == callable_traits<decltype(&class_324::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_324::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_324::mem_fn)>, class_324>);
+struct class_328 { int * && mem_fn(const void * const &, volatile void * const &, const volatile void * const &) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::signature_type, int * &&(const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::result_type, int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_328::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_328::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_328::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_328::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::arg0_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::arg_type<0>, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::arg1_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::arg_type<1>, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::arg2_type, const volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::arg_type<2>, const volatile void * const &>);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_328::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_328::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_328::mem_fn)>::class_type, class_328>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_328::mem_fn)>, int * &&(const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_328::mem_fn)>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_328::mem_fn), 0>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_328::mem_fn), 1>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_328::mem_fn), 2>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_328::mem_fn)>, type_list<const void * const &, volatile void * const &, const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(&class_328::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_328::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_328::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_328::mem_fn)> == callable_traits<decltype(&class_328::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_328::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_328::mem_fn)>, class_328>);
+struct class_332 { int * const && mem_fn(const void * &&, volatile void * &&, const volatile void * &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::signature_type, int * const &&(const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::result_type, int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_332::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_332::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_332::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_332::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::arg0_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::arg_type<0>, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::arg1_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::arg_type<1>, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::arg2_type, const volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::arg_type<2>, const volatile void * &&>);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_332::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_332::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_332::mem_fn)>::class_type, class_332>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_332::mem_fn)>, int * const &&(const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_332::mem_fn)>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_332::mem_fn), 0>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_332::mem_fn), 1>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_332::mem_fn), 2>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_332::mem_fn)>, type_list<const void * &&, volatile void * &&, const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(&class_332::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_332::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_332::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_332::mem_fn)> == callable_traits<decltype(&class_332::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_332::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_332::mem_fn)>, class_332>);
+struct class_336 { int * volatile && mem_fn(const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::signature_type, int * volatile &&(const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::result_type, int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_336::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_336::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_336::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_336::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::arg0_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::arg_type<0>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::arg1_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::arg_type<1>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::arg2_type, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::arg_type<2>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_336::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_336::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_336::mem_fn)>::class_type, class_336>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_336::mem_fn)>, int * volatile &&(const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_336::mem_fn)>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_336::mem_fn), 0>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_336::mem_fn), 1>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_336::mem_fn), 2>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_336::mem_fn)>, type_list<const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_336::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_336::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_336::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_336::mem_fn)> == callable_traits<decltype(&class_336::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_336::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_336::mem_fn)>, class_336>);
+struct class_340 { int * const volatile && mem_fn(bool * &, const bool * &, volatile bool * &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::signature_type, int * const volatile &&(bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::result_type, int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_340::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_340::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_340::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_340::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::arg0_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::arg_type<0>, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::arg1_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::arg_type<1>, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::arg2_type, volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::arg_type<2>, volatile bool * &>);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_340::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_340::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_340::mem_fn)>::class_type, class_340>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_340::mem_fn)>, int * const volatile &&(bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_340::mem_fn)>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_340::mem_fn), 0>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_340::mem_fn), 1>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_340::mem_fn), 2>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_340::mem_fn)>, type_list<bool * &, const bool * &, volatile bool * &>>);
+static_assert(callable_arity_v<decltype(&class_340::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_340::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_340::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_340::mem_fn)> == callable_traits<decltype(&class_340::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_340::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_340::mem_fn)>, class_340>);
+struct class_344 { float mem_fn(bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::signature_type, float(bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::result_type, float>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_344::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_344::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_344::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_344::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::arg0_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::arg_type<0>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::arg1_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::arg_type<1>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::arg2_type, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::arg_type<2>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_344::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_344::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_344::mem_fn)>::class_type, class_344>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_344::mem_fn)>, float(bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_344::mem_fn)>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_344::mem_fn), 0>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_344::mem_fn), 1>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_344::mem_fn), 2>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_344::mem_fn)>, type_list<bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_344::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_344::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_344::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_344::mem_fn)> == callable_traits<decltype(&class_344::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_344::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_344::mem_fn)>, class_344>);
+struct class_348 { const volatile float * mem_fn(bool * const &&, const bool * const &&, volatile bool * const &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::signature_type, const volatile float *(bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::result_type, const volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_348::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_348::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_348::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_348::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::arg0_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::arg_type<0>, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::arg1_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::arg_type<1>, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::arg2_type, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::arg_type<2>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_348::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_348::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_348::mem_fn)>::class_type, class_348>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_348::mem_fn)>, const volatile float *(bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_348::mem_fn)>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_348::mem_fn), 0>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_348::mem_fn), 1>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_348::mem_fn), 2>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_348::mem_fn)>, type_list<bool * const &&, const bool * const &&, volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_348::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_348::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_348::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_348::mem_fn)> == callable_traits<decltype(&class_348::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_348::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_348::mem_fn)>, class_348>);
+struct class_352 { const volatile float & mem_fn(int, int *, const int *) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::signature_type, const volatile float &(int, int *, const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::result_type, const volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_352::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_352::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_352::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_352::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::arg0_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::arg_type<0>, int>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::arg1_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::arg_type<1>, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::arg2_type, const int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::arg_type<2>, const int *>);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_352::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_352::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_352::mem_fn)>::class_type, class_352>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_352::mem_fn)>, const volatile float &(int, int *, const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_352::mem_fn)>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_352::mem_fn), 0>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_352::mem_fn), 1>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_352::mem_fn), 2>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_352::mem_fn)>, type_list<int, int *, const int *>>);
+static_assert(callable_arity_v<decltype(&class_352::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_352::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_352::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_352::mem_fn)> == callable_traits<decltype(&class_352::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_352::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_352::mem_fn)>, class_352>);
+struct class_356 { const volatile float * & mem_fn(const volatile int * &, int * const &, const int * const &) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::signature_type, const volatile float * &(const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::result_type, const volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_356::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_356::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_356::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_356::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::arg0_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::arg_type<0>, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::arg1_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::arg_type<1>, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::arg2_type, const int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::arg_type<2>, const int * const &>);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_356::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_356::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_356::mem_fn)>::class_type, class_356>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_356::mem_fn)>, const volatile float * &(const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_356::mem_fn)>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_356::mem_fn), 0>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_356::mem_fn), 1>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_356::mem_fn), 2>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_356::mem_fn)>, type_list<const volatile int * &, int * const &, const int * const &>>);
+static_assert(callable_arity_v<decltype(&class_356::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_356::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_356::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_356::mem_fn)> == callable_traits<decltype(&class_356::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_356::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_356::mem_fn)>, class_356>);
+struct class_360 { const volatile float * const & mem_fn(const volatile int * const volatile &, int &&, const int &&); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::signature_type, const volatile float * const &(const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::result_type, const volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_360::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_360::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_360::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_360::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::arg0_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::arg_type<0>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::arg1_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::arg_type<1>, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::arg2_type, const int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::arg_type<2>, const int &&>);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_360::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_360::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_360::mem_fn)>::class_type, class_360>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_360::mem_fn)>, const volatile float * const &(const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_360::mem_fn)>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_360::mem_fn), 0>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_360::mem_fn), 1>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_360::mem_fn), 2>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_360::mem_fn)>, type_list<const volatile int * const volatile &, int &&, const int &&>>);
+static_assert(callable_arity_v<decltype(&class_360::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_360::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_360::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_360::mem_fn)> == callable_traits<decltype(&class_360::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_360::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_360::mem_fn)>, class_360>);
+struct class_364 { const volatile float * volatile & mem_fn(const volatile int * const &&, int * volatile &&, const int * volatile &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::signature_type, const volatile float * volatile &(const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::result_type, const volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_364::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_364::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_364::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_364::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::arg0_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::arg_type<0>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::arg1_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::arg_type<1>, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::arg2_type, const int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::arg_type<2>, const int * volatile &&>);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_364::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_364::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_364::mem_fn)>::class_type, class_364>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_364::mem_fn)>, const volatile float * volatile &(const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_364::mem_fn)>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_364::mem_fn), 0>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_364::mem_fn), 1>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_364::mem_fn), 2>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_364::mem_fn)>, type_list<const volatile int * const &&, int * volatile &&, const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_364::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_364::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_364::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_364::mem_fn)> == callable_traits<decltype(&class_364::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_364::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_364::mem_fn)>, class_364>);
+struct class_368 { const volatile float * const volatile & mem_fn(volatile float *, const volatile float *, float &) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::signature_type, const volatile float * const volatile &(volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::result_type, const volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_368::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_368::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_368::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_368::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::arg0_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::arg_type<0>, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::arg1_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::arg_type<1>, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::arg2_type, float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::arg_type<2>, float &>);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_368::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_368::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_368::mem_fn)>::class_type, class_368>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_368::mem_fn)>, const volatile float * const volatile &(volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_368::mem_fn)>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_368::mem_fn), 0>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_368::mem_fn), 1>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_368::mem_fn), 2>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_368::mem_fn)>, type_list<volatile float *, const volatile float *, float &>>);
+static_assert(callable_arity_v<decltype(&class_368::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_368::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_368::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_368::mem_fn)> == callable_traits<decltype(&class_368::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_368::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_368::mem_fn)>, class_368>);
+struct class_372 { const volatile float && mem_fn(volatile float * const &, const volatile float * const &, float * volatile &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::signature_type, const volatile float &&(volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::result_type, const volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_372::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_372::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_372::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_372::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::arg0_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::arg_type<0>, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::arg1_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::arg_type<1>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::arg2_type, float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::arg_type<2>, float * volatile &>);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_372::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_372::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_372::mem_fn)>::class_type, class_372>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_372::mem_fn)>, const volatile float &&(volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_372::mem_fn)>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_372::mem_fn), 0>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_372::mem_fn), 1>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_372::mem_fn), 2>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_372::mem_fn)>, type_list<volatile float * const &, const volatile float * const &, float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_372::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_372::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_372::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_372::mem_fn)> == callable_traits<decltype(&class_372::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_372::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_372::mem_fn)>, class_372>);
+struct class_376 { const volatile float * && mem_fn(volatile float &&, const volatile float &&, float * &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::signature_type, const volatile float * &&(volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::result_type, const volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_376::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_376::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_376::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_376::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::arg0_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::arg_type<0>, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::arg1_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::arg_type<1>, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::arg2_type, float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::arg_type<2>, float * &&>);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_376::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_376::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_376::mem_fn)>::class_type, class_376>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_376::mem_fn)>, const volatile float * &&(volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_376::mem_fn)>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_376::mem_fn), 0>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_376::mem_fn), 1>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_376::mem_fn), 2>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_376::mem_fn)>, type_list<volatile float &&, const volatile float &&, float * &&>>);
+static_assert(callable_arity_v<decltype(&class_376::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_376::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_376::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_376::mem_fn)> == callable_traits<decltype(&class_376::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_376::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_376::mem_fn)>, class_376>);
+struct class_380 { const volatile float * const && mem_fn(volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::signature_type, const volatile float * const &&(volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::result_type, const volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_380::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_380::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_380::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_380::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::arg0_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::arg_type<0>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::arg1_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::arg_type<1>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::arg2_type, float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::arg_type<2>, float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_380::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_380::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_380::mem_fn)>::class_type, class_380>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_380::mem_fn)>, const volatile float * const &&(volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_380::mem_fn)>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_380::mem_fn), 0>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_380::mem_fn), 1>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_380::mem_fn), 2>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_380::mem_fn)>, type_list<volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_380::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_380::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_380::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_380::mem_fn)> == callable_traits<decltype(&class_380::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_380::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_380::mem_fn)>, class_380>);
+struct class_384 { const volatile float * volatile && mem_fn(const std::string &, volatile std::string &, const volatile std::string &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::signature_type, const volatile float * volatile &&(const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::result_type, const volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_384::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_384::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_384::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_384::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::arg0_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::arg_type<0>, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::arg1_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::arg_type<1>, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::arg2_type, const volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::arg_type<2>, const volatile std::string &>);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_384::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_384::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_384::mem_fn)>::class_type, class_384>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_384::mem_fn)>, const volatile float * volatile &&(const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_384::mem_fn)>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_384::mem_fn), 0>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_384::mem_fn), 1>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_384::mem_fn), 2>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_384::mem_fn)>, type_list<const std::string &, volatile std::string &, const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(&class_384::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_384::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_384::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_384::mem_fn)> == callable_traits<decltype(&class_384::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_384::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_384::mem_fn)>, class_384>);
+struct class_388 { const volatile float * const volatile && mem_fn(const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::signature_type, const volatile float * const volatile &&(const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::result_type, const volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_388::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_388::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_388::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_388::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::arg0_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::arg_type<0>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::arg1_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::arg_type<1>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::arg2_type, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::arg_type<2>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_388::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_388::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_388::mem_fn)>::class_type, class_388>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_388::mem_fn)>, const volatile float * const volatile &&(const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_388::mem_fn)>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_388::mem_fn), 0>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_388::mem_fn), 1>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_388::mem_fn), 2>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_388::mem_fn)>, type_list<const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_388::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_388::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_388::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_388::mem_fn)> == callable_traits<decltype(&class_388::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_388::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_388::mem_fn)>, class_388>);
+struct class_392 { volatile std::string * mem_fn(const std::string * &&, volatile std::string * &&, const volatile std::string * &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::signature_type, volatile std::string *(const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::result_type, volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_392::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_392::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_392::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_392::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::arg0_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::arg_type<0>, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::arg1_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::arg_type<1>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::arg2_type, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::arg_type<2>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_392::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_392::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_392::mem_fn)>::class_type, class_392>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_392::mem_fn)>, volatile std::string *(const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_392::mem_fn)>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_392::mem_fn), 0>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_392::mem_fn), 1>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_392::mem_fn), 2>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_392::mem_fn)>, type_list<const std::string * &&, volatile std::string * &&, const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_392::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_392::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_392::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_392::mem_fn)> == callable_traits<decltype(&class_392::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_392::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_392::mem_fn)>, class_392>);
+struct class_396 { volatile std::string & mem_fn(const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::signature_type, volatile std::string &(const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::result_type, volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_396::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_396::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_396::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_396::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::arg0_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::arg_type<0>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::arg1_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::arg_type<1>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::arg2_type, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::arg_type<2>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_396::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_396::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_396::mem_fn)>::class_type, class_396>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_396::mem_fn)>, volatile std::string &(const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_396::mem_fn)>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_396::mem_fn), 0>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_396::mem_fn), 1>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_396::mem_fn), 2>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_396::mem_fn)>, type_list<const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_396::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_396::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_396::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_396::mem_fn)> == callable_traits<decltype(&class_396::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_396::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_396::mem_fn)>, class_396>);
+struct class_400 { volatile std::string * & mem_fn(void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::signature_type, volatile std::string * &(void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::result_type, volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_400::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_400::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_400::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_400::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg_type<0>, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg1_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg_type<1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg2_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg_type<2>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::arg_type<3>, const volatile void * volatile &>);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_400::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_400::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_400::mem_fn)>::class_type, class_400>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_400::mem_fn)>, volatile std::string * &(void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_400::mem_fn)>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_400::mem_fn), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_400::mem_fn), 1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_400::mem_fn), 2>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_400::mem_fn), 3>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_400::mem_fn)>, type_list<void * volatile &, const void * volatile &, volatile void * volatile &, const volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_400::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_400::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_400::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_400::mem_fn)> == callable_traits<decltype(&class_400::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_400::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_400::mem_fn)>, class_400>);
+struct class_404 { volatile std::string * const & mem_fn(void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::signature_type, volatile std::string * const &(void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::result_type, volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_404::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_404::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_404::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_404::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg0_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg_type<0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg1_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg_type<1>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg2_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg_type<2>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::arg_type<3>, const volatile void * volatile &&>);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_404::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_404::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_404::mem_fn)>::class_type, class_404>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_404::mem_fn)>, volatile std::string * const &(void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_404::mem_fn)>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_404::mem_fn), 0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_404::mem_fn), 1>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_404::mem_fn), 2>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_404::mem_fn), 3>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_404::mem_fn)>, type_list<void * volatile &&, const void * volatile &&, volatile void * volatile &&, const volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_404::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_404::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_404::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_404::mem_fn)> == callable_traits<decltype(&class_404::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_404::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_404::mem_fn)>, class_404>);
+struct class_408 { volatile std::string * volatile & mem_fn(const volatile bool &, bool * &, const bool * &, volatile bool * &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::signature_type, volatile std::string * volatile &(const volatile bool &, bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::result_type, volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_408::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_408::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_408::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_408::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg0_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg_type<0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg1_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg_type<1>, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg2_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg_type<2>, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::arg_type<3>, volatile bool * &>);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_408::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_408::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_408::mem_fn)>::class_type, class_408>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_408::mem_fn)>, volatile std::string * volatile &(const volatile bool &, bool * &, const bool * &, volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_408::mem_fn)>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_408::mem_fn), 0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_408::mem_fn), 1>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_408::mem_fn), 2>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_408::mem_fn), 3>, volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_408::mem_fn)>, type_list<const volatile bool &, bool * &, const bool * &, volatile bool * &>>);
+static_assert(callable_arity_v<decltype(&class_408::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_408::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_408::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_408::mem_fn)> == callable_traits<decltype(&class_408::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_408::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_408::mem_fn)>, class_408>);
+struct class_412 { volatile std::string * const volatile & mem_fn(const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::signature_type, volatile std::string * const volatile &(const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::result_type, volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_412::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_412::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_412::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_412::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg1_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg_type<1>, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg2_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg_type<2>, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::arg_type<3>, volatile bool &&>);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_412::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_412::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_412::mem_fn)>::class_type, class_412>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_412::mem_fn)>, volatile std::string * const volatile &(const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_412::mem_fn)>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_412::mem_fn), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_412::mem_fn), 1>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_412::mem_fn), 2>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_412::mem_fn), 3>, volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_412::mem_fn)>, type_list<const volatile bool * const volatile &, bool &&, const bool &&, volatile bool &&>>);
+static_assert(callable_arity_v<decltype(&class_412::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_412::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_412::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_412::mem_fn)> == callable_traits<decltype(&class_412::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_412::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_412::mem_fn)>, class_412>);
+struct class_416 { volatile std::string && mem_fn(const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::signature_type, volatile std::string &&(const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::result_type, volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_416::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_416::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_416::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_416::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg0_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg_type<0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg1_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg_type<1>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg2_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg_type<2>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::arg_type<3>, volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_416::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_416::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_416::mem_fn)>::class_type, class_416>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_416::mem_fn)>, volatile std::string &&(const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_416::mem_fn)>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_416::mem_fn), 0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_416::mem_fn), 1>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_416::mem_fn), 2>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_416::mem_fn), 3>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_416::mem_fn)>, type_list<const volatile bool * volatile &&, bool * const volatile &&, const bool * const volatile &&, volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_416::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_416::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_416::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_416::mem_fn)> == callable_traits<decltype(&class_416::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_416::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_416::mem_fn)>, class_416>);
+struct class_420 { volatile std::string * && mem_fn(volatile int * &, const volatile int * &, int * const &, const int * const &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::signature_type, volatile std::string * &&(volatile int * &, const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::result_type, volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_420::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_420::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_420::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_420::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg0_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg_type<0>, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg1_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg_type<1>, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg2_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg_type<2>, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::arg_type<3>, const int * const &>);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_420::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_420::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_420::mem_fn)>::class_type, class_420>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_420::mem_fn)>, volatile std::string * &&(volatile int * &, const volatile int * &, int * const &, const int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_420::mem_fn)>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_420::mem_fn), 0>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_420::mem_fn), 1>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_420::mem_fn), 2>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_420::mem_fn), 3>, const int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_420::mem_fn)>, type_list<volatile int * &, const volatile int * &, int * const &, const int * const &>>);
+static_assert(callable_arity_v<decltype(&class_420::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_420::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_420::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_420::mem_fn)> == callable_traits<decltype(&class_420::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_420::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_420::mem_fn)>, class_420>);
+struct class_424 { volatile std::string * const && mem_fn(volatile int &&, const volatile int &&, int * &&, const int * &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::signature_type, volatile std::string * const &&(volatile int &&, const volatile int &&, int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::result_type, volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_424::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_424::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_424::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_424::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg_type<0>, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg1_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg_type<1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg2_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg_type<2>, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::arg_type<3>, const int * &&>);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_424::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_424::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_424::mem_fn)>::class_type, class_424>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_424::mem_fn)>, volatile std::string * const &&(volatile int &&, const volatile int &&, int * &&, const int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_424::mem_fn)>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_424::mem_fn), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_424::mem_fn), 1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_424::mem_fn), 2>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_424::mem_fn), 3>, const int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_424::mem_fn)>, type_list<volatile int &&, const volatile int &&, int * &&, const int * &&>>);
+static_assert(callable_arity_v<decltype(&class_424::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_424::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_424::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_424::mem_fn)> == callable_traits<decltype(&class_424::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_424::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_424::mem_fn)>, class_424>);
+struct class_428 { volatile std::string * volatile && mem_fn(volatile int * const volatile &&, const volatile int * const volatile &&, float, float *) && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::signature_type, volatile std::string * volatile &&(volatile int * const volatile &&, const volatile int * const volatile &&, float, float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::result_type, volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_428::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_428::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_428::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_428::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg0_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg_type<0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg1_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg_type<1>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg2_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg_type<2>, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::arg_type<3>, float *>);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_428::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_428::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_428::mem_fn)>::class_type, class_428>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_428::mem_fn)>, volatile std::string * volatile &&(volatile int * const volatile &&, const volatile int * const volatile &&, float, float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_428::mem_fn)>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_428::mem_fn), 0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_428::mem_fn), 1>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_428::mem_fn), 2>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_428::mem_fn), 3>, float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_428::mem_fn)>, type_list<volatile int * const volatile &&, const volatile int * const volatile &&, float, float *>>);
+static_assert(callable_arity_v<decltype(&class_428::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_428::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_428::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_428::mem_fn)> == callable_traits<decltype(&class_428::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_428::mem_fn)> == (callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_428::mem_fn)>, class_428>);
+struct class_432 { volatile std::string * const volatile && mem_fn(const float * const &, volatile float * const &, const volatile float * const &, float * volatile &); };
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::signature_type, volatile std::string * const volatile &&(const float * const &, volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::result_type, volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_432::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_432::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_432::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_432::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg0_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg_type<0>, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg1_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg_type<1>, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg2_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg_type<2>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::arg_type<3>, float * volatile &>);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_432::mem_fn)>::specifier_mask == (callable_specifier::none));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_432::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_432::mem_fn)>::class_type, class_432>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_432::mem_fn)>, volatile std::string * const volatile &&(const float * const &, volatile float * const &, const volatile float * const &, float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_432::mem_fn)>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_432::mem_fn), 0>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_432::mem_fn), 1>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_432::mem_fn), 2>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_432::mem_fn), 3>, float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_432::mem_fn)>, type_list<const float * const &, volatile float * const &, const volatile float * const &, float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_432::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_432::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_432::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_432::mem_fn)> == callable_traits<decltype(&class_432::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_432::mem_fn)> == (callable_specifier::none));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_432::mem_fn)>, class_432>);
+struct class_436 { const void * mem_fn(const float * &&, volatile float * &&, const volatile float * &&, float * const &&) &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::signature_type, const void *(const float * &&, volatile float * &&, const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::result_type, const void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_436::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_436::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_436::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_436::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg_type<0>, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg1_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg_type<1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg2_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg_type<2>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::arg_type<3>, float * const &&>);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_436::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_436::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_436::mem_fn)>::class_type, class_436>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_436::mem_fn)>, const void *(const float * &&, volatile float * &&, const volatile float * &&, float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_436::mem_fn)>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_436::mem_fn), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_436::mem_fn), 1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_436::mem_fn), 2>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_436::mem_fn), 3>, float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_436::mem_fn)>, type_list<const float * &&, volatile float * &&, const volatile float * &&, float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_436::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_436::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_436::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_436::mem_fn)> == callable_traits<decltype(&class_436::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_436::mem_fn)> == (callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_436::mem_fn)>, class_436>);
+struct class_440 { const void * & mem_fn(std::string *, const std::string *, volatile std::string *, const volatile std::string *) &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::signature_type, const void * &(std::string *, const std::string *, volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::result_type, const void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_440::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_440::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_440::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_440::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg0_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg_type<0>, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg1_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg_type<1>, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg2_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg_type<2>, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::arg_type<3>, const volatile std::string *>);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_440::mem_fn)>::specifier_mask == (callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_440::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_440::mem_fn)>::class_type, class_440>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_440::mem_fn)>, const void * &(std::string *, const std::string *, volatile std::string *, const volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_440::mem_fn)>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_440::mem_fn), 0>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_440::mem_fn), 1>, const std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_440::mem_fn), 2>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_440::mem_fn), 3>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_440::mem_fn)>, type_list<std::string *, const std::string *, volatile std::string *, const volatile std::string *>>);
+static_assert(callable_arity_v<decltype(&class_440::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_440::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_440::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_440::mem_fn)> == callable_traits<decltype(&class_440::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_440::mem_fn)> == (callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_440::mem_fn)>, class_440>);
+struct class_444 { const void * const & mem_fn(std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &) noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::signature_type, const void * const &(std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::result_type, const void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_444::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_444::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_444::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_444::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg0_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg_type<0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg1_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg_type<1>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg2_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg_type<2>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::arg_type<3>, const volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_444::mem_fn)>::specifier_mask == (callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_444::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_444::mem_fn)>::class_type, class_444>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_444::mem_fn)>, const void * const &(std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_444::mem_fn)>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_444::mem_fn), 0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_444::mem_fn), 1>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_444::mem_fn), 2>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_444::mem_fn), 3>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_444::mem_fn)>, type_list<std::string * volatile &, const std::string * volatile &, volatile std::string * volatile &, const volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_444::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_444::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_444::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_444::mem_fn)> == callable_traits<decltype(&class_444::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_444::mem_fn)> == (callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_444::mem_fn)>, class_444>);
+struct class_448 { const void * volatile & mem_fn(std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&) & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::signature_type, const void * volatile &(std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::result_type, const void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_448::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_448::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_448::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_448::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg_type<0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg1_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg_type<1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg2_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg_type<2>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::arg_type<3>, const volatile std::string * const &&>);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_448::mem_fn)>::specifier_mask == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_448::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_448::mem_fn)>::class_type, class_448>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_448::mem_fn)>, const void * volatile &(std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_448::mem_fn)>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_448::mem_fn), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_448::mem_fn), 1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_448::mem_fn), 2>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_448::mem_fn), 3>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_448::mem_fn)>, type_list<std::string * const &&, const std::string * const &&, volatile std::string * const &&, const volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_448::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_448::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_448::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_448::mem_fn)> == callable_traits<decltype(&class_448::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_448::mem_fn)> == (callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_448::mem_fn)>, class_448>);
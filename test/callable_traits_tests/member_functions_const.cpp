@@ -0,0 +1,3812 @@
+/* This file was auto-generated */
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "../../include/callable_traits.hpp"
+#include "../callable_traits_test_helper.hpp"
+
+struct class_1 { void * mem_fn(void *, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_1::mem_fn)>::signature_type, void *(void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_1::mem_fn)>::result_type, void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_1::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_1::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_1::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_1::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_1::mem_fn)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_1::mem_fn)>::arg_type<0>, void *>);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_1::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_1::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_1::mem_fn)>::class_type, class_1>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_1::mem_fn)>, void *(void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_1::mem_fn)>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_1::mem_fn), 0>, void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_1::mem_fn)>, type_list<void *>>);
+static_assert(callable_arity_v<decltype(&class_1::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_1::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_1::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_1::mem_fn)> == callable_traits<decltype(&class_1::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_1::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_1::mem_fn)>, class_1>);
+struct class_5 { void * & mem_fn(void * &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_5::mem_fn)>::signature_type, void * &(void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_5::mem_fn)>::result_type, void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_5::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_5::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_5::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_5::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_5::mem_fn)>::arg0_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_5::mem_fn)>::arg_type<0>, void * &>);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_5::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_5::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_5::mem_fn)>::class_type, class_5>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_5::mem_fn)>, void * &(void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_5::mem_fn)>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_5::mem_fn), 0>, void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_5::mem_fn)>, type_list<void * &>>);
+static_assert(callable_arity_v<decltype(&class_5::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_5::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_5::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_5::mem_fn)> == callable_traits<decltype(&class_5::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_5::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_5::mem_fn)>, class_5>);
+struct class_9 { void * const & mem_fn(void * const &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_9::mem_fn)>::signature_type, void * const &(void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_9::mem_fn)>::result_type, void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_9::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_9::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_9::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_9::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_9::mem_fn)>::arg0_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_9::mem_fn)>::arg_type<0>, void * const &>);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_9::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_9::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_9::mem_fn)>::class_type, class_9>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_9::mem_fn)>, void * const &(void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_9::mem_fn)>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_9::mem_fn), 0>, void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_9::mem_fn)>, type_list<void * const &>>);
+static_assert(callable_arity_v<decltype(&class_9::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_9::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_9::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_9::mem_fn)> == callable_traits<decltype(&class_9::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_9::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_9::mem_fn)>, class_9>);
+struct class_13 { void * volatile & mem_fn(void * volatile &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_13::mem_fn)>::signature_type, void * volatile &(void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_13::mem_fn)>::result_type, void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_13::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_13::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_13::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_13::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_13::mem_fn)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_13::mem_fn)>::arg_type<0>, void * volatile &>);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_13::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_13::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_13::mem_fn)>::class_type, class_13>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_13::mem_fn)>, void * volatile &(void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_13::mem_fn)>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_13::mem_fn), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_13::mem_fn)>, type_list<void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_13::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_13::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_13::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_13::mem_fn)> == callable_traits<decltype(&class_13::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_13::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_13::mem_fn)>, class_13>);
+struct class_17 { void * const volatile & mem_fn(void * const volatile &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_17::mem_fn)>::signature_type, void * const volatile &(void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_17::mem_fn)>::result_type, void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_17::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_17::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_17::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_17::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_17::mem_fn)>::arg0_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_17::mem_fn)>::arg_type<0>, void * const volatile &>);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_17::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_17::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_17::mem_fn)>::class_type, class_17>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_17::mem_fn)>, void * const volatile &(void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_17::mem_fn)>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_17::mem_fn), 0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_17::mem_fn)>, type_list<void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_17::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_17::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_17::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_17::mem_fn)> == callable_traits<decltype(&class_17::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_17::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_17::mem_fn)>, class_17>);
+struct class_21 { void * && mem_fn(void * &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_21::mem_fn)>::signature_type, void * &&(void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_21::mem_fn)>::result_type, void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_21::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_21::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_21::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_21::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_21::mem_fn)>::arg0_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_21::mem_fn)>::arg_type<0>, void * &&>);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_21::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_21::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_21::mem_fn)>::class_type, class_21>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_21::mem_fn)>, void * &&(void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_21::mem_fn)>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_21::mem_fn), 0>, void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_21::mem_fn)>, type_list<void * &&>>);
+static_assert(callable_arity_v<decltype(&class_21::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_21::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_21::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_21::mem_fn)> == callable_traits<decltype(&class_21::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_21::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_21::mem_fn)>, class_21>);
+struct class_25 { void * const && mem_fn(void * const &&, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_25::mem_fn)>::signature_type, void * const &&(void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_25::mem_fn)>::result_type, void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_25::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_25::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_25::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_25::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_25::mem_fn)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_25::mem_fn)>::arg_type<0>, void * const &&>);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_25::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_25::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_25::mem_fn)>::class_type, class_25>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_25::mem_fn)>, void * const &&(void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_25::mem_fn)>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_25::mem_fn), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_25::mem_fn)>, type_list<void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_25::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_25::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_25::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_25::mem_fn)> == callable_traits<decltype(&class_25::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_25::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_25::mem_fn)>, class_25>);
+struct class_29 { void * volatile && mem_fn(void * volatile &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_29::mem_fn)>::signature_type, void * volatile &&(void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_29::mem_fn)>::result_type, void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_29::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_29::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_29::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_29::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_29::mem_fn)>::arg0_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_29::mem_fn)>::arg_type<0>, void * volatile &&>);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_29::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_29::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_29::mem_fn)>::class_type, class_29>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_29::mem_fn)>, void * volatile &&(void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_29::mem_fn)>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_29::mem_fn), 0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_29::mem_fn)>, type_list<void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_29::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_29::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_29::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_29::mem_fn)> == callable_traits<decltype(&class_29::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_29::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_29::mem_fn)>, class_29>);
+struct class_33 { void * const volatile && mem_fn(void * const volatile &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_33::mem_fn)>::signature_type, void * const volatile &&(void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_33::mem_fn)>::result_type, void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_33::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_33::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_33::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_33::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_33::mem_fn)>::arg0_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_33::mem_fn)>::arg_type<0>, void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_33::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_33::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_33::mem_fn)>::class_type, class_33>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_33::mem_fn)>, void * const volatile &&(void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_33::mem_fn)>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_33::mem_fn), 0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_33::mem_fn)>, type_list<void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_33::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_33::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_33::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_33::mem_fn)> == callable_traits<decltype(&class_33::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_33::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_33::mem_fn)>, class_33>);
+struct class_37 { bool mem_fn(bool, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_37::mem_fn)>::signature_type, bool(bool)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_37::mem_fn)>::result_type, bool>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_37::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_37::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_37::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_37::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_37::mem_fn)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_37::mem_fn)>::arg_type<0>, bool>);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_37::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_37::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_37::mem_fn)>::class_type, class_37>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_37::mem_fn)>, bool(bool)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_37::mem_fn)>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_37::mem_fn), 0>, bool>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_37::mem_fn)>, type_list<bool>>);
+static_assert(callable_arity_v<decltype(&class_37::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_37::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_37::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_37::mem_fn)> == callable_traits<decltype(&class_37::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_37::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_37::mem_fn)>, class_37>);
+struct class_41 { const volatile bool * mem_fn(const volatile bool *, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_41::mem_fn)>::signature_type, const volatile bool *(const volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_41::mem_fn)>::result_type, const volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_41::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_41::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_41::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_41::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_41::mem_fn)>::arg0_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_41::mem_fn)>::arg_type<0>, const volatile bool *>);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_41::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_41::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_41::mem_fn)>::class_type, class_41>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_41::mem_fn)>, const volatile bool *(const volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_41::mem_fn)>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_41::mem_fn), 0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_41::mem_fn)>, type_list<const volatile bool *>>);
+static_assert(callable_arity_v<decltype(&class_41::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_41::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_41::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_41::mem_fn)> == callable_traits<decltype(&class_41::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_41::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_41::mem_fn)>, class_41>);
+struct class_45 { const volatile bool & mem_fn(const volatile bool &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_45::mem_fn)>::signature_type, const volatile bool &(const volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_45::mem_fn)>::result_type, const volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_45::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_45::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_45::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_45::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_45::mem_fn)>::arg0_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_45::mem_fn)>::arg_type<0>, const volatile bool &>);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_45::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_45::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_45::mem_fn)>::class_type, class_45>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_45::mem_fn)>, const volatile bool &(const volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_45::mem_fn)>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_45::mem_fn), 0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_45::mem_fn)>, type_list<const volatile bool &>>);
+static_assert(callable_arity_v<decltype(&class_45::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_45::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_45::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_45::mem_fn)> == callable_traits<decltype(&class_45::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_45::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_45::mem_fn)>, class_45>);
+struct class_49 { const volatile bool * & mem_fn(const volatile bool * &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_49::mem_fn)>::signature_type, const volatile bool * &(const volatile bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_49::mem_fn)>::result_type, const volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_49::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_49::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_49::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_49::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_49::mem_fn)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_49::mem_fn)>::arg_type<0>, const volatile bool * &>);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_49::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_49::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_49::mem_fn)>::class_type, class_49>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_49::mem_fn)>, const volatile bool * &(const volatile bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_49::mem_fn)>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_49::mem_fn), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_49::mem_fn)>, type_list<const volatile bool * &>>);
+static_assert(callable_arity_v<decltype(&class_49::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_49::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_49::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_49::mem_fn)> == callable_traits<decltype(&class_49::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_49::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_49::mem_fn)>, class_49>);
+struct class_53 { const volatile bool * const & mem_fn(const volatile bool * const &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_53::mem_fn)>::signature_type, const volatile bool * const &(const volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_53::mem_fn)>::result_type, const volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_53::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_53::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_53::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_53::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_53::mem_fn)>::arg0_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_53::mem_fn)>::arg_type<0>, const volatile bool * const &>);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_53::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_53::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_53::mem_fn)>::class_type, class_53>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_53::mem_fn)>, const volatile bool * const &(const volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_53::mem_fn)>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_53::mem_fn), 0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_53::mem_fn)>, type_list<const volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_53::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_53::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_53::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_53::mem_fn)> == callable_traits<decltype(&class_53::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_53::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_53::mem_fn)>, class_53>);
+struct class_57 { const volatile bool * volatile & mem_fn(const volatile bool * volatile &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_57::mem_fn)>::signature_type, const volatile bool * volatile &(const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_57::mem_fn)>::result_type, const volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_57::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_57::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_57::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_57::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_57::mem_fn)>::arg0_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_57::mem_fn)>::arg_type<0>, const volatile bool * volatile &>);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_57::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_57::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_57::mem_fn)>::class_type, class_57>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_57::mem_fn)>, const volatile bool * volatile &(const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_57::mem_fn)>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_57::mem_fn), 0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_57::mem_fn)>, type_list<const volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_57::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_57::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_57::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_57::mem_fn)> == callable_traits<decltype(&class_57::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_57::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_57::mem_fn)>, class_57>);
+struct class_61 { const volatile bool * const volatile & mem_fn(const volatile bool * const volatile &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_61::mem_fn)>::signature_type, const volatile bool * const volatile &(const volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_61::mem_fn)>::result_type, const volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_61::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_61::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_61::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_61::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_61::mem_fn)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_61::mem_fn)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_61::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_61::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_61::mem_fn)>::class_type, class_61>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_61::mem_fn)>, const volatile bool * const volatile &(const volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_61::mem_fn)>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_61::mem_fn), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_61::mem_fn)>, type_list<const volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_61::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_61::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_61::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_61::mem_fn)> == callable_traits<decltype(&class_61::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_61::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_61::mem_fn)>, class_61>);
+struct class_65 { const volatile bool && mem_fn(const volatile bool &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_65::mem_fn)>::signature_type, const volatile bool &&(const volatile bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_65::mem_fn)>::result_type, const volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_65::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_65::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_65::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_65::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_65::mem_fn)>::arg0_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_65::mem_fn)>::arg_type<0>, const volatile bool &&>);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_65::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_65::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_65::mem_fn)>::class_type, class_65>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_65::mem_fn)>, const volatile bool &&(const volatile bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_65::mem_fn)>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_65::mem_fn), 0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_65::mem_fn)>, type_list<const volatile bool &&>>);
+static_assert(callable_arity_v<decltype(&class_65::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_65::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_65::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_65::mem_fn)> == callable_traits<decltype(&class_65::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_65::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_65::mem_fn)>, class_65>);
+struct class_69 { const volatile bool * && mem_fn(const volatile bool * &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_69::mem_fn)>::signature_type, const volatile bool * &&(const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_69::mem_fn)>::result_type, const volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_69::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_69::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_69::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_69::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_69::mem_fn)>::arg0_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_69::mem_fn)>::arg_type<0>, const volatile bool * &&>);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_69::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_69::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_69::mem_fn)>::class_type, class_69>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_69::mem_fn)>, const volatile bool * &&(const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_69::mem_fn)>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_69::mem_fn), 0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_69::mem_fn)>, type_list<const volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_69::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_69::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_69::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_69::mem_fn)> == callable_traits<decltype(&class_69::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_69::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_69::mem_fn)>, class_69>);
+struct class_73 { const volatile bool * const && mem_fn(const volatile bool * const &&, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_73::mem_fn)>::signature_type, const volatile bool * const &&(const volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_73::mem_fn)>::result_type, const volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_73::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_73::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_73::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_73::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_73::mem_fn)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_73::mem_fn)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_73::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_73::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_73::mem_fn)>::class_type, class_73>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_73::mem_fn)>, const volatile bool * const &&(const volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_73::mem_fn)>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_73::mem_fn), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_73::mem_fn)>, type_list<const volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_73::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_73::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_73::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_73::mem_fn)> == callable_traits<decltype(&class_73::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_73::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_73::mem_fn)>, class_73>);
+struct class_77 { const volatile bool * volatile && mem_fn(const volatile bool * volatile &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_77::mem_fn)>::signature_type, const volatile bool * volatile &&(const volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_77::mem_fn)>::result_type, const volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_77::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_77::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_77::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_77::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_77::mem_fn)>::arg0_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_77::mem_fn)>::arg_type<0>, const volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_77::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_77::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_77::mem_fn)>::class_type, class_77>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_77::mem_fn)>, const volatile bool * volatile &&(const volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_77::mem_fn)>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_77::mem_fn), 0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_77::mem_fn)>, type_list<const volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_77::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_77::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_77::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_77::mem_fn)> == callable_traits<decltype(&class_77::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_77::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_77::mem_fn)>, class_77>);
+struct class_81 { const volatile bool * const volatile && mem_fn(const volatile bool * const volatile &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_81::mem_fn)>::signature_type, const volatile bool * const volatile &&(const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_81::mem_fn)>::result_type, const volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_81::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_81::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_81::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_81::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_81::mem_fn)>::arg0_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_81::mem_fn)>::arg_type<0>, const volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_81::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_81::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_81::mem_fn)>::class_type, class_81>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_81::mem_fn)>, const volatile bool * const volatile &&(const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_81::mem_fn)>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_81::mem_fn), 0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_81::mem_fn)>, type_list<const volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_81::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_81::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_81::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_81::mem_fn)> == callable_traits<decltype(&class_81::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_81::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_81::mem_fn)>, class_81>);
+struct class_85 { volatile int * mem_fn(volatile int *, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_85::mem_fn)>::signature_type, volatile int *(volatile int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_85::mem_fn)>::result_type, volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_85::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_85::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_85::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_85::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_85::mem_fn)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_85::mem_fn)>::arg_type<0>, volatile int *>);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_85::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_85::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_85::mem_fn)>::class_type, class_85>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_85::mem_fn)>, volatile int *(volatile int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_85::mem_fn)>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_85::mem_fn), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_85::mem_fn)>, type_list<volatile int *>>);
+static_assert(callable_arity_v<decltype(&class_85::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_85::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_85::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_85::mem_fn)> == callable_traits<decltype(&class_85::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_85::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_85::mem_fn)>, class_85>);
+struct class_89 { volatile int & mem_fn(volatile int &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_89::mem_fn)>::signature_type, volatile int &(volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_89::mem_fn)>::result_type, volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_89::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_89::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_89::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_89::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_89::mem_fn)>::arg0_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_89::mem_fn)>::arg_type<0>, volatile int &>);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_89::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_89::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_89::mem_fn)>::class_type, class_89>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_89::mem_fn)>, volatile int &(volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_89::mem_fn)>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_89::mem_fn), 0>, volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_89::mem_fn)>, type_list<volatile int &>>);
+static_assert(callable_arity_v<decltype(&class_89::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_89::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_89::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_89::mem_fn)> == callable_traits<decltype(&class_89::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_89::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_89::mem_fn)>, class_89>);
+struct class_93 { volatile int * & mem_fn(volatile int * &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_93::mem_fn)>::signature_type, volatile int * &(volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_93::mem_fn)>::result_type, volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_93::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_93::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_93::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_93::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_93::mem_fn)>::arg0_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_93::mem_fn)>::arg_type<0>, volatile int * &>);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_93::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_93::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_93::mem_fn)>::class_type, class_93>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_93::mem_fn)>, volatile int * &(volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_93::mem_fn)>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_93::mem_fn), 0>, volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_93::mem_fn)>, type_list<volatile int * &>>);
+static_assert(callable_arity_v<decltype(&class_93::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_93::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_93::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_93::mem_fn)> == callable_traits<decltype(&class_93::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_93::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_93::mem_fn)>, class_93>);
+struct class_97 { volatile int * const & mem_fn(volatile int * const &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_97::mem_fn)>::signature_type, volatile int * const &(volatile int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_97::mem_fn)>::result_type, volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_97::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_97::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_97::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_97::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_97::mem_fn)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_97::mem_fn)>::arg_type<0>, volatile int * const &>);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_97::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_97::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_97::mem_fn)>::class_type, class_97>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_97::mem_fn)>, volatile int * const &(volatile int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_97::mem_fn)>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_97::mem_fn), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_97::mem_fn)>, type_list<volatile int * const &>>);
+static_assert(callable_arity_v<decltype(&class_97::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_97::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_97::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_97::mem_fn)> == callable_traits<decltype(&class_97::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_97::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_97::mem_fn)>, class_97>);
+struct class_101 { volatile int * volatile & mem_fn(volatile int * volatile &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_101::mem_fn)>::signature_type, volatile int * volatile &(volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_101::mem_fn)>::result_type, volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_101::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_101::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_101::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_101::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_101::mem_fn)>::arg0_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_101::mem_fn)>::arg_type<0>, volatile int * volatile &>);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_101::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_101::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_101::mem_fn)>::class_type, class_101>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_101::mem_fn)>, volatile int * volatile &(volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_101::mem_fn)>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_101::mem_fn), 0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_101::mem_fn)>, type_list<volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_101::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_101::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_101::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_101::mem_fn)> == callable_traits<decltype(&class_101::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_101::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_101::mem_fn)>, class_101>);
+struct class_105 { volatile int * const volatile & mem_fn(volatile int * const volatile &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_105::mem_fn)>::signature_type, volatile int * const volatile &(volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_105::mem_fn)>::result_type, volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_105::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_105::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_105::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_105::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_105::mem_fn)>::arg0_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_105::mem_fn)>::arg_type<0>, volatile int * const volatile &>);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_105::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_105::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_105::mem_fn)>::class_type, class_105>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_105::mem_fn)>, volatile int * const volatile &(volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_105::mem_fn)>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_105::mem_fn), 0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_105::mem_fn)>, type_list<volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_105::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_105::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_105::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_105::mem_fn)> == callable_traits<decltype(&class_105::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_105::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_105::mem_fn)>, class_105>);
+struct class_109 { volatile int && mem_fn(volatile int &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_109::mem_fn)>::signature_type, volatile int &&(volatile int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_109::mem_fn)>::result_type, volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_109::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_109::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_109::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_109::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_109::mem_fn)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_109::mem_fn)>::arg_type<0>, volatile int &&>);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_109::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_109::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_109::mem_fn)>::class_type, class_109>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_109::mem_fn)>, volatile int &&(volatile int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_109::mem_fn)>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_109::mem_fn), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_109::mem_fn)>, type_list<volatile int &&>>);
+static_assert(callable_arity_v<decltype(&class_109::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_109::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_109::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_109::mem_fn)> == callable_traits<decltype(&class_109::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_109::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_109::mem_fn)>, class_109>);
+struct class_113 { volatile int * && mem_fn(volatile int * &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_113::mem_fn)>::signature_type, volatile int * &&(volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_113::mem_fn)>::result_type, volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_113::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_113::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_113::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_113::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_113::mem_fn)>::arg0_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_113::mem_fn)>::arg_type<0>, volatile int * &&>);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_113::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_113::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_113::mem_fn)>::class_type, class_113>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_113::mem_fn)>, volatile int * &&(volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_113::mem_fn)>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_113::mem_fn), 0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_113::mem_fn)>, type_list<volatile int * &&>>);
+static_assert(callable_arity_v<decltype(&class_113::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_113::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_113::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_113::mem_fn)> == callable_traits<decltype(&class_113::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_113::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_113::mem_fn)>, class_113>);
+struct class_117 { volatile int * const && mem_fn(volatile int * const &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_117::mem_fn)>::signature_type, volatile int * const &&(volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_117::mem_fn)>::result_type, volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_117::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_117::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_117::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_117::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_117::mem_fn)>::arg0_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_117::mem_fn)>::arg_type<0>, volatile int * const &&>);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_117::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_117::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_117::mem_fn)>::class_type, class_117>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_117::mem_fn)>, volatile int * const &&(volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_117::mem_fn)>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_117::mem_fn), 0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_117::mem_fn)>, type_list<volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_117::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_117::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_117::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_117::mem_fn)> == callable_traits<decltype(&class_117::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_117::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_117::mem_fn)>, class_117>);
+struct class_121 { volatile int * volatile && mem_fn(volatile int * volatile &&, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_121::mem_fn)>::signature_type, volatile int * volatile &&(volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_121::mem_fn)>::result_type, volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_121::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_121::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_121::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_121::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_121::mem_fn)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_121::mem_fn)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_121::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_121::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_121::mem_fn)>::class_type, class_121>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_121::mem_fn)>, volatile int * volatile &&(volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_121::mem_fn)>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_121::mem_fn), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_121::mem_fn)>, type_list<volatile int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_121::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_121::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_121::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_121::mem_fn)> == callable_traits<decltype(&class_121::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_121::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_121::mem_fn)>, class_121>);
+struct class_125 { volatile int * const volatile && mem_fn(volatile int * const volatile &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_125::mem_fn)>::signature_type, volatile int * const volatile &&(volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_125::mem_fn)>::result_type, volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_125::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_125::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_125::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_125::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_125::mem_fn)>::arg0_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_125::mem_fn)>::arg_type<0>, volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_125::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_125::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_125::mem_fn)>::class_type, class_125>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_125::mem_fn)>, volatile int * const volatile &&(volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_125::mem_fn)>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_125::mem_fn), 0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_125::mem_fn)>, type_list<volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_125::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_125::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_125::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_125::mem_fn)> == callable_traits<decltype(&class_125::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_125::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_125::mem_fn)>, class_125>);
+struct class_129 { const float * mem_fn(const float *, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_129::mem_fn)>::signature_type, const float *(const float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_129::mem_fn)>::result_type, const float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_129::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_129::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_129::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_129::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_129::mem_fn)>::arg0_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_129::mem_fn)>::arg_type<0>, const float *>);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_129::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_129::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_129::mem_fn)>::class_type, class_129>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_129::mem_fn)>, const float *(const float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_129::mem_fn)>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_129::mem_fn), 0>, const float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_129::mem_fn)>, type_list<const float *>>);
+static_assert(callable_arity_v<decltype(&class_129::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_129::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_129::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_129::mem_fn)> == callable_traits<decltype(&class_129::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_129::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_129::mem_fn)>, class_129>);
+struct class_133 { const float & mem_fn(const float &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_133::mem_fn)>::signature_type, const float &(const float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_133::mem_fn)>::result_type, const float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_133::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_133::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_133::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_133::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_133::mem_fn)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_133::mem_fn)>::arg_type<0>, const float &>);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_133::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_133::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_133::mem_fn)>::class_type, class_133>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_133::mem_fn)>, const float &(const float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_133::mem_fn)>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_133::mem_fn), 0>, const float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_133::mem_fn)>, type_list<const float &>>);
+static_assert(callable_arity_v<decltype(&class_133::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_133::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_133::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_133::mem_fn)> == callable_traits<decltype(&class_133::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_133::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_133::mem_fn)>, class_133>);
+struct class_137 { const float * & mem_fn(const float * &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_137::mem_fn)>::signature_type, const float * &(const float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_137::mem_fn)>::result_type, const float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_137::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_137::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_137::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_137::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_137::mem_fn)>::arg0_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_137::mem_fn)>::arg_type<0>, const float * &>);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_137::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_137::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_137::mem_fn)>::class_type, class_137>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_137::mem_fn)>, const float * &(const float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_137::mem_fn)>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_137::mem_fn), 0>, const float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_137::mem_fn)>, type_list<const float * &>>);
+static_assert(callable_arity_v<decltype(&class_137::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_137::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_137::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_137::mem_fn)> == callable_traits<decltype(&class_137::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_137::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_137::mem_fn)>, class_137>);
+struct class_141 { const float * const & mem_fn(const float * const &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_141::mem_fn)>::signature_type, const float * const &(const float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_141::mem_fn)>::result_type, const float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_141::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_141::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_141::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_141::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_141::mem_fn)>::arg0_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_141::mem_fn)>::arg_type<0>, const float * const &>);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_141::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_141::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_141::mem_fn)>::class_type, class_141>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_141::mem_fn)>, const float * const &(const float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_141::mem_fn)>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_141::mem_fn), 0>, const float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_141::mem_fn)>, type_list<const float * const &>>);
+static_assert(callable_arity_v<decltype(&class_141::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_141::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_141::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_141::mem_fn)> == callable_traits<decltype(&class_141::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_141::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_141::mem_fn)>, class_141>);
+struct class_145 { const float * volatile & mem_fn(const float * volatile &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_145::mem_fn)>::signature_type, const float * volatile &(const float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_145::mem_fn)>::result_type, const float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_145::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_145::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_145::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_145::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_145::mem_fn)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_145::mem_fn)>::arg_type<0>, const float * volatile &>);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_145::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_145::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_145::mem_fn)>::class_type, class_145>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_145::mem_fn)>, const float * volatile &(const float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_145::mem_fn)>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_145::mem_fn), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_145::mem_fn)>, type_list<const float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_145::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_145::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_145::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_145::mem_fn)> == callable_traits<decltype(&class_145::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_145::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_145::mem_fn)>, class_145>);
+struct class_149 { const float * const volatile & mem_fn(const float * const volatile &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_149::mem_fn)>::signature_type, const float * const volatile &(const float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_149::mem_fn)>::result_type, const float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_149::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_149::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_149::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_149::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_149::mem_fn)>::arg0_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_149::mem_fn)>::arg_type<0>, const float * const volatile &>);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_149::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_149::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_149::mem_fn)>::class_type, class_149>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_149::mem_fn)>, const float * const volatile &(const float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_149::mem_fn)>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_149::mem_fn), 0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_149::mem_fn)>, type_list<const float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_149::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_149::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_149::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_149::mem_fn)> == callable_traits<decltype(&class_149::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_149::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_149::mem_fn)>, class_149>);
+struct class_153 { const float && mem_fn(const float &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_153::mem_fn)>::signature_type, const float &&(const float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_153::mem_fn)>::result_type, const float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_153::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_153::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_153::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_153::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_153::mem_fn)>::arg0_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_153::mem_fn)>::arg_type<0>, const float &&>);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_153::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_153::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_153::mem_fn)>::class_type, class_153>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_153::mem_fn)>, const float &&(const float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_153::mem_fn)>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_153::mem_fn), 0>, const float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_153::mem_fn)>, type_list<const float &&>>);
+static_assert(callable_arity_v<decltype(&class_153::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_153::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_153::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_153::mem_fn)> == callable_traits<decltype(&class_153::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_153::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_153::mem_fn)>, class_153>);
+struct class_157 { const float * && mem_fn(const float * &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_157::mem_fn)>::signature_type, const float * &&(const float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_157::mem_fn)>::result_type, const float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_157::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_157::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_157::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_157::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_157::mem_fn)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_157::mem_fn)>::arg_type<0>, const float * &&>);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_157::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_157::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_157::mem_fn)>::class_type, class_157>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_157::mem_fn)>, const float * &&(const float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_157::mem_fn)>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_157::mem_fn), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_157::mem_fn)>, type_list<const float * &&>>);
+static_assert(callable_arity_v<decltype(&class_157::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_157::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_157::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_157::mem_fn)> == callable_traits<decltype(&class_157::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_157::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_157::mem_fn)>, class_157>);
+struct class_161 { const float * const && mem_fn(const float * const &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_161::mem_fn)>::signature_type, const float * const &&(const float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_161::mem_fn)>::result_type, const float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_161::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_161::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_161::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_161::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_161::mem_fn)>::arg0_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_161::mem_fn)>::arg_type<0>, const float * const &&>);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_161::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_161::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_161::mem_fn)>::class_type, class_161>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_161::mem_fn)>, const float * const &&(const float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_161::mem_fn)>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_161::mem_fn), 0>, const float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_161::mem_fn)>, type_list<const float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_161::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_161::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_161::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_161::mem_fn)> == callable_traits<decltype(&class_161::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_161::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_161::mem_fn)>, class_161>);
+struct class_165 { const float * volatile && mem_fn(const float * volatile &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_165::mem_fn)>::signature_type, const float * volatile &&(const float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_165::mem_fn)>::result_type, const float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_165::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_165::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_165::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_165::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_165::mem_fn)>::arg0_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_165::mem_fn)>::arg_type<0>, const float * volatile &&>);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_165::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_165::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_165::mem_fn)>::class_type, class_165>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_165::mem_fn)>, const float * volatile &&(const float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_165::mem_fn)>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_165::mem_fn), 0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_165::mem_fn)>, type_list<const float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_165::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_165::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_165::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_165::mem_fn)> == callable_traits<decltype(&class_165::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_165::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_165::mem_fn)>, class_165>);
+struct class_169 { const float * const volatile && mem_fn(const float * const volatile &&, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_169::mem_fn)>::signature_type, const float * const volatile &&(const float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_169::mem_fn)>::result_type, const float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_169::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_169::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_169::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_169::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_169::mem_fn)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_169::mem_fn)>::arg_type<0>, const float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_169::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_169::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_169::mem_fn)>::class_type, class_169>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_169::mem_fn)>, const float * const volatile &&(const float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_169::mem_fn)>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_169::mem_fn), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_169::mem_fn)>, type_list<const float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_169::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_169::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_169::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_169::mem_fn)> == callable_traits<decltype(&class_169::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_169::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_169::mem_fn)>, class_169>);
+struct class_173 { std::string * mem_fn(std::string *, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_173::mem_fn)>::signature_type, std::string *(std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_173::mem_fn)>::result_type, std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_173::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_173::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_173::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_173::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_173::mem_fn)>::arg0_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_173::mem_fn)>::arg_type<0>, std::string *>);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_173::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_173::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_173::mem_fn)>::class_type, class_173>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_173::mem_fn)>, std::string *(std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_173::mem_fn)>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_173::mem_fn), 0>, std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_173::mem_fn)>, type_list<std::string *>>);
+static_assert(callable_arity_v<decltype(&class_173::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_173::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_173::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_173::mem_fn)> == callable_traits<decltype(&class_173::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_173::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_173::mem_fn)>, class_173>);
+struct class_177 { std::string & mem_fn(std::string &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_177::mem_fn)>::signature_type, std::string &(std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_177::mem_fn)>::result_type, std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_177::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_177::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_177::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_177::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_177::mem_fn)>::arg0_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_177::mem_fn)>::arg_type<0>, std::string &>);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_177::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_177::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_177::mem_fn)>::class_type, class_177>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_177::mem_fn)>, std::string &(std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_177::mem_fn)>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_177::mem_fn), 0>, std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_177::mem_fn)>, type_list<std::string &>>);
+static_assert(callable_arity_v<decltype(&class_177::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_177::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_177::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_177::mem_fn)> == callable_traits<decltype(&class_177::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_177::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_177::mem_fn)>, class_177>);
+struct class_181 { std::string * & mem_fn(std::string * &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_181::mem_fn)>::signature_type, std::string * &(std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_181::mem_fn)>::result_type, std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_181::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_181::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_181::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_181::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_181::mem_fn)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_181::mem_fn)>::arg_type<0>, std::string * &>);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_181::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_181::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_181::mem_fn)>::class_type, class_181>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_181::mem_fn)>, std::string * &(std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_181::mem_fn)>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_181::mem_fn), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_181::mem_fn)>, type_list<std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_181::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_181::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_181::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_181::mem_fn)> == callable_traits<decltype(&class_181::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_181::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_181::mem_fn)>, class_181>);
+struct class_185 { std::string * const & mem_fn(std::string * const &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_185::mem_fn)>::signature_type, std::string * const &(std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_185::mem_fn)>::result_type, std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_185::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_185::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_185::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_185::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_185::mem_fn)>::arg0_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_185::mem_fn)>::arg_type<0>, std::string * const &>);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_185::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_185::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_185::mem_fn)>::class_type, class_185>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_185::mem_fn)>, std::string * const &(std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_185::mem_fn)>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_185::mem_fn), 0>, std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_185::mem_fn)>, type_list<std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_185::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_185::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_185::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_185::mem_fn)> == callable_traits<decltype(&class_185::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_185::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_185::mem_fn)>, class_185>);
+struct class_189 { std::string * volatile & mem_fn(std::string * volatile &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_189::mem_fn)>::signature_type, std::string * volatile &(std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_189::mem_fn)>::result_type, std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_189::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_189::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_189::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_189::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_189::mem_fn)>::arg0_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_189::mem_fn)>::arg_type<0>, std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_189::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_189::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_189::mem_fn)>::class_type, class_189>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_189::mem_fn)>, std::string * volatile &(std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_189::mem_fn)>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_189::mem_fn), 0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_189::mem_fn)>, type_list<std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_189::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_189::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_189::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_189::mem_fn)> == callable_traits<decltype(&class_189::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_189::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_189::mem_fn)>, class_189>);
+struct class_193 { std::string * const volatile & mem_fn(std::string * const volatile &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_193::mem_fn)>::signature_type, std::string * const volatile &(std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_193::mem_fn)>::result_type, std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_193::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_193::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_193::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_193::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_193::mem_fn)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_193::mem_fn)>::arg_type<0>, std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_193::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_193::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_193::mem_fn)>::class_type, class_193>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_193::mem_fn)>, std::string * const volatile &(std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_193::mem_fn)>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_193::mem_fn), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_193::mem_fn)>, type_list<std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_193::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_193::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_193::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_193::mem_fn)> == callable_traits<decltype(&class_193::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_193::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_193::mem_fn)>, class_193>);
+struct class_197 { std::string && mem_fn(std::string &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_197::mem_fn)>::signature_type, std::string &&(std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_197::mem_fn)>::result_type, std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_197::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_197::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_197::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_197::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_197::mem_fn)>::arg0_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_197::mem_fn)>::arg_type<0>, std::string &&>);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_197::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_197::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_197::mem_fn)>::class_type, class_197>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_197::mem_fn)>, std::string &&(std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_197::mem_fn)>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_197::mem_fn), 0>, std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_197::mem_fn)>, type_list<std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_197::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_197::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_197::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_197::mem_fn)> == callable_traits<decltype(&class_197::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_197::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_197::mem_fn)>, class_197>);
+struct class_201 { std::string * && mem_fn(std::string * &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_201::mem_fn)>::signature_type, std::string * &&(std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_201::mem_fn)>::result_type, std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_201::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_201::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_201::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_201::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_201::mem_fn)>::arg0_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_201::mem_fn)>::arg_type<0>, std::string * &&>);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_201::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_201::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_201::mem_fn)>::class_type, class_201>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_201::mem_fn)>, std::string * &&(std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_201::mem_fn)>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_201::mem_fn), 0>, std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_201::mem_fn)>, type_list<std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_201::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_201::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_201::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_201::mem_fn)> == callable_traits<decltype(&class_201::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_201::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_201::mem_fn)>, class_201>);
+struct class_205 { std::string * const && mem_fn(std::string * const &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_205::mem_fn)>::signature_type, std::string * const &&(std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_205::mem_fn)>::result_type, std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_205::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_205::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_205::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_205::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_205::mem_fn)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_205::mem_fn)>::arg_type<0>, std::string * const &&>);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_205::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_205::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_205::mem_fn)>::class_type, class_205>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_205::mem_fn)>, std::string * const &&(std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_205::mem_fn)>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_205::mem_fn), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_205::mem_fn)>, type_list<std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_205::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_205::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_205::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_205::mem_fn)> == callable_traits<decltype(&class_205::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_205::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_205::mem_fn)>, class_205>);
+struct class_209 { std::string * volatile && mem_fn(std::string * volatile &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_209::mem_fn)>::signature_type, std::string * volatile &&(std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_209::mem_fn)>::result_type, std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_209::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_209::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_209::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_209::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_209::mem_fn)>::arg0_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_209::mem_fn)>::arg_type<0>, std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_209::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_209::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_209::mem_fn)>::class_type, class_209>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_209::mem_fn)>, std::string * volatile &&(std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_209::mem_fn)>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_209::mem_fn), 0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_209::mem_fn)>, type_list<std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_209::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_209::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_209::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_209::mem_fn)> == callable_traits<decltype(&class_209::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_209::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_209::mem_fn)>, class_209>);
+struct class_213 { std::string * const volatile && mem_fn(std::string * const volatile &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_213::mem_fn)>::signature_type, std::string * const volatile &&(std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_213::mem_fn)>::result_type, std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_213::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_213::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_213::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_213::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_213::mem_fn)>::arg0_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_213::mem_fn)>::arg_type<0>, std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_213::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_213::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_213::mem_fn)>::class_type, class_213>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_213::mem_fn)>, std::string * const volatile &&(std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_213::mem_fn)>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_213::mem_fn), 0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_213::mem_fn)>, type_list<std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_213::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_213::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_213::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_213::mem_fn)> == callable_traits<decltype(&class_213::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_213::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_213::mem_fn)>, class_213>);
+struct class_217 { void mem_fn(void *, const void *, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::signature_type, void(void *, const void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::result_type, void>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_217::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_217::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_217::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_217::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::arg_type<0>, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::arg1_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::arg_type<1>, const void *>);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_217::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_217::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_217::mem_fn)>::class_type, class_217>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_217::mem_fn)>, void(void *, const void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_217::mem_fn)>, void>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_217::mem_fn), 0>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_217::mem_fn), 1>, const void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_217::mem_fn)>, type_list<void *, const void *>>);
+static_assert(callable_arity_v<decltype(&class_217::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_217::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_217::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_217::mem_fn)> == callable_traits<decltype(&class_217::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_217::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_217::mem_fn)>, class_217>);
+struct class_221 { const volatile void * mem_fn(void * const &, const void * const &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::signature_type, const volatile void *(void * const &, const void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::result_type, const volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_221::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_221::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_221::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_221::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::arg0_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::arg_type<0>, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::arg1_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::arg_type<1>, const void * const &>);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_221::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_221::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_221::mem_fn)>::class_type, class_221>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_221::mem_fn)>, const volatile void *(void * const &, const void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_221::mem_fn)>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_221::mem_fn), 0>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_221::mem_fn), 1>, const void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_221::mem_fn)>, type_list<void * const &, const void * const &>>);
+static_assert(callable_arity_v<decltype(&class_221::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_221::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_221::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_221::mem_fn)> == callable_traits<decltype(&class_221::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_221::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_221::mem_fn)>, class_221>);
+struct class_225 { const volatile void * & mem_fn(void * const volatile &, const void * const volatile &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::signature_type, const volatile void * &(void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::result_type, const volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_225::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_225::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_225::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_225::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::arg0_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::arg_type<0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::arg1_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::arg_type<1>, const void * const volatile &>);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_225::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_225::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_225::mem_fn)>::class_type, class_225>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_225::mem_fn)>, const volatile void * &(void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_225::mem_fn)>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_225::mem_fn), 0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_225::mem_fn), 1>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_225::mem_fn)>, type_list<void * const volatile &, const void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_225::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_225::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_225::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_225::mem_fn)> == callable_traits<decltype(&class_225::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_225::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_225::mem_fn)>, class_225>);
+struct class_229 { const volatile void * const & mem_fn(void * const &&, const void * const &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::signature_type, const volatile void * const &(void * const &&, const void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::result_type, const volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_229::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_229::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_229::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_229::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::arg_type<0>, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::arg1_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::arg_type<1>, const void * const &&>);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_229::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_229::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_229::mem_fn)>::class_type, class_229>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_229::mem_fn)>, const volatile void * const &(void * const &&, const void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_229::mem_fn)>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_229::mem_fn), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_229::mem_fn), 1>, const void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_229::mem_fn)>, type_list<void * const &&, const void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_229::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_229::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_229::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_229::mem_fn)> == callable_traits<decltype(&class_229::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_229::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_229::mem_fn)>, class_229>);
+struct class_233 { const volatile void * volatile & mem_fn(void * const volatile &&, const void * const volatile &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::signature_type, const volatile void * volatile &(void * const volatile &&, const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::result_type, const volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_233::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_233::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_233::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_233::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::arg0_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::arg_type<0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::arg1_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::arg_type<1>, const void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_233::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_233::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_233::mem_fn)>::class_type, class_233>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_233::mem_fn)>, const volatile void * volatile &(void * const volatile &&, const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_233::mem_fn)>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_233::mem_fn), 0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_233::mem_fn), 1>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_233::mem_fn)>, type_list<void * const volatile &&, const void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_233::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_233::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_233::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_233::mem_fn)> == callable_traits<decltype(&class_233::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_233::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_233::mem_fn)>, class_233>);
+struct class_237 { const volatile void * const volatile & mem_fn(const volatile bool *, bool &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::signature_type, const volatile void * const volatile &(const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::result_type, const volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_237::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_237::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_237::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_237::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::arg0_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::arg_type<0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::arg1_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::arg_type<1>, bool &>);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_237::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_237::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_237::mem_fn)>::class_type, class_237>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_237::mem_fn)>, const volatile void * const volatile &(const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_237::mem_fn)>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_237::mem_fn), 0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_237::mem_fn), 1>, bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_237::mem_fn)>, type_list<const volatile bool *, bool &>>);
+static_assert(callable_arity_v<decltype(&class_237::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_237::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_237::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_237::mem_fn)> == callable_traits<decltype(&class_237::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_237::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_237::mem_fn)>, class_237>);
+struct class_241 { const volatile void * && mem_fn(const volatile bool * &, bool * const &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::signature_type, const volatile void * &&(const volatile bool * &, bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::result_type, const volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_241::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_241::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_241::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_241::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::arg_type<0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::arg1_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::arg_type<1>, bool * const &>);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_241::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_241::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_241::mem_fn)>::class_type, class_241>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_241::mem_fn)>, const volatile void * &&(const volatile bool * &, bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_241::mem_fn)>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_241::mem_fn), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_241::mem_fn), 1>, bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_241::mem_fn)>, type_list<const volatile bool * &, bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_241::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_241::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_241::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_241::mem_fn)> == callable_traits<decltype(&class_241::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_241::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_241::mem_fn)>, class_241>);
+struct class_245 { const volatile void * const && mem_fn(const volatile bool * volatile &, bool * const volatile &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::signature_type, const volatile void * const &&(const volatile bool * volatile &, bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::result_type, const volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_245::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_245::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_245::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_245::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::arg0_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::arg_type<0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::arg1_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::arg_type<1>, bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_245::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_245::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_245::mem_fn)>::class_type, class_245>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_245::mem_fn)>, const volatile void * const &&(const volatile bool * volatile &, bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_245::mem_fn)>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_245::mem_fn), 0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_245::mem_fn), 1>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_245::mem_fn)>, type_list<const volatile bool * volatile &, bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_245::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_245::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_245::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_245::mem_fn)> == callable_traits<decltype(&class_245::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_245::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_245::mem_fn)>, class_245>);
+struct class_249 { const volatile void * volatile && mem_fn(const volatile bool &&, bool * &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::signature_type, const volatile void * volatile &&(const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::result_type, const volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_249::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_249::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_249::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_249::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::arg0_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::arg_type<0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::arg1_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::arg_type<1>, bool * &&>);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_249::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_249::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_249::mem_fn)>::class_type, class_249>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_249::mem_fn)>, const volatile void * volatile &&(const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_249::mem_fn)>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_249::mem_fn), 0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_249::mem_fn), 1>, bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_249::mem_fn)>, type_list<const volatile bool &&, bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_249::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_249::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_249::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_249::mem_fn)> == callable_traits<decltype(&class_249::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_249::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_249::mem_fn)>, class_249>);
+struct class_253 { const volatile void * const volatile && mem_fn(const volatile bool * const &&, bool * volatile &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::signature_type, const volatile void * const volatile &&(const volatile bool * const &&, bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::result_type, const volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_253::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_253::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_253::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_253::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::arg1_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::arg_type<1>, bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_253::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_253::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_253::mem_fn)>::class_type, class_253>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_253::mem_fn)>, const volatile void * const volatile &&(const volatile bool * const &&, bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_253::mem_fn)>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_253::mem_fn), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_253::mem_fn), 1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_253::mem_fn)>, type_list<const volatile bool * const &&, bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_253::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_253::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_253::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_253::mem_fn)> == callable_traits<decltype(&class_253::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_253::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_253::mem_fn)>, class_253>);
+struct class_257 { volatile bool * mem_fn(const volatile bool * const volatile &&, int, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::signature_type, volatile bool *(const volatile bool * const volatile &&, int)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::result_type, volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_257::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_257::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_257::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_257::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::arg0_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::arg_type<0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::arg1_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::arg_type<1>, int>);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_257::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_257::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_257::mem_fn)>::class_type, class_257>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_257::mem_fn)>, volatile bool *(const volatile bool * const volatile &&, int)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_257::mem_fn)>, volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_257::mem_fn), 0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_257::mem_fn), 1>, int>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_257::mem_fn)>, type_list<const volatile bool * const volatile &&, int>>);
+static_assert(callable_arity_v<decltype(&class_257::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_257::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_257::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_257::mem_fn)> == callable_traits<decltype(&class_257::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_257::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_257::mem_fn)>, class_257>);
+struct class_261 { volatile bool & mem_fn(volatile int &, const volatile int &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::signature_type, volatile bool &(volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::result_type, volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_261::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_261::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_261::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_261::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::arg0_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::arg_type<0>, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::arg1_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::arg_type<1>, const volatile int &>);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_261::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_261::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_261::mem_fn)>::class_type, class_261>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_261::mem_fn)>, volatile bool &(volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_261::mem_fn)>, volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_261::mem_fn), 0>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_261::mem_fn), 1>, const volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_261::mem_fn)>, type_list<volatile int &, const volatile int &>>);
+static_assert(callable_arity_v<decltype(&class_261::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_261::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_261::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_261::mem_fn)> == callable_traits<decltype(&class_261::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_261::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_261::mem_fn)>, class_261>);
+struct class_265 { volatile bool * & mem_fn(volatile int * const &, const volatile int * const &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::signature_type, volatile bool * &(volatile int * const &, const volatile int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::result_type, volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_265::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_265::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_265::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_265::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::arg_type<0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::arg1_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::arg_type<1>, const volatile int * const &>);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_265::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_265::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_265::mem_fn)>::class_type, class_265>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_265::mem_fn)>, volatile bool * &(volatile int * const &, const volatile int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_265::mem_fn)>, volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_265::mem_fn), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_265::mem_fn), 1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_265::mem_fn)>, type_list<volatile int * const &, const volatile int * const &>>);
+static_assert(callable_arity_v<decltype(&class_265::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_265::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_265::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_265::mem_fn)> == callable_traits<decltype(&class_265::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_265::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_265::mem_fn)>, class_265>);
+struct class_269 { volatile bool * const & mem_fn(volatile int * const volatile &, const volatile int * const volatile &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::signature_type, volatile bool * const &(volatile int * const volatile &, const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::result_type, volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_269::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_269::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_269::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_269::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::arg0_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::arg_type<0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::arg1_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::arg_type<1>, const volatile int * const volatile &>);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_269::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_269::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_269::mem_fn)>::class_type, class_269>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_269::mem_fn)>, volatile bool * const &(volatile int * const volatile &, const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_269::mem_fn)>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_269::mem_fn), 0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_269::mem_fn), 1>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_269::mem_fn)>, type_list<volatile int * const volatile &, const volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_269::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_269::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_269::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_269::mem_fn)> == callable_traits<decltype(&class_269::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_269::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_269::mem_fn)>, class_269>);
+struct class_273 { volatile bool * volatile & mem_fn(volatile int * &&, const volatile int * &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::signature_type, volatile bool * volatile &(volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::result_type, volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_273::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_273::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_273::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_273::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::arg0_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::arg_type<0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::arg1_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::arg_type<1>, const volatile int * &&>);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_273::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_273::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_273::mem_fn)>::class_type, class_273>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_273::mem_fn)>, volatile bool * volatile &(volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_273::mem_fn)>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_273::mem_fn), 0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_273::mem_fn), 1>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_273::mem_fn)>, type_list<volatile int * &&, const volatile int * &&>>);
+static_assert(callable_arity_v<decltype(&class_273::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_273::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_273::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_273::mem_fn)> == callable_traits<decltype(&class_273::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_273::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_273::mem_fn)>, class_273>);
+struct class_277 { volatile bool * const volatile & mem_fn(volatile int * volatile &&, const volatile int * volatile &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::signature_type, volatile bool * const volatile &(volatile int * volatile &&, const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::result_type, volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_277::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_277::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_277::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_277::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::arg1_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::arg_type<1>, const volatile int * volatile &&>);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_277::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_277::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_277::mem_fn)>::class_type, class_277>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_277::mem_fn)>, volatile bool * const volatile &(volatile int * volatile &&, const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_277::mem_fn)>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_277::mem_fn), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_277::mem_fn), 1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_277::mem_fn)>, type_list<volatile int * volatile &&, const volatile int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_277::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_277::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_277::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_277::mem_fn)> == callable_traits<decltype(&class_277::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_277::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_277::mem_fn)>, class_277>);
+struct class_281 { volatile bool && mem_fn(const float *, volatile float *, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::signature_type, volatile bool &&(const float *, volatile float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::result_type, volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_281::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_281::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_281::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_281::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::arg0_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::arg_type<0>, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::arg1_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::arg_type<1>, volatile float *>);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_281::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_281::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_281::mem_fn)>::class_type, class_281>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_281::mem_fn)>, volatile bool &&(const float *, volatile float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_281::mem_fn)>, volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_281::mem_fn), 0>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_281::mem_fn), 1>, volatile float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_281::mem_fn)>, type_list<const float *, volatile float *>>);
+static_assert(callable_arity_v<decltype(&class_281::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_281::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_281::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_281::mem_fn)> == callable_traits<decltype(&class_281::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_281::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_281::mem_fn)>, class_281>);
+struct class_285 { volatile bool * && mem_fn(const float * &, volatile float * &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::signature_type, volatile bool * &&(const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::result_type, volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_285::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_285::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_285::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_285::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::arg0_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::arg_type<0>, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::arg1_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::arg_type<1>, volatile float * &>);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_285::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_285::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_285::mem_fn)>::class_type, class_285>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_285::mem_fn)>, volatile bool * &&(const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_285::mem_fn)>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_285::mem_fn), 0>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_285::mem_fn), 1>, volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_285::mem_fn)>, type_list<const float * &, volatile float * &>>);
+static_assert(callable_arity_v<decltype(&class_285::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_285::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_285::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_285::mem_fn)> == callable_traits<decltype(&class_285::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_285::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_285::mem_fn)>, class_285>);
+struct class_289 { volatile bool * const && mem_fn(const float * volatile &, volatile float * volatile &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::signature_type, volatile bool * const &&(const float * volatile &, volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::result_type, volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_289::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_289::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_289::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_289::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::arg_type<0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::arg1_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::arg_type<1>, volatile float * volatile &>);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_289::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_289::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_289::mem_fn)>::class_type, class_289>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_289::mem_fn)>, volatile bool * const &&(const float * volatile &, volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_289::mem_fn)>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_289::mem_fn), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_289::mem_fn), 1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_289::mem_fn)>, type_list<const float * volatile &, volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_289::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_289::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_289::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_289::mem_fn)> == callable_traits<decltype(&class_289::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_289::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_289::mem_fn)>, class_289>);
+struct class_293 { volatile bool * volatile && mem_fn(const float &&, volatile float &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::signature_type, volatile bool * volatile &&(const float &&, volatile float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::result_type, volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_293::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_293::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_293::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_293::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::arg0_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::arg_type<0>, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::arg1_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::arg_type<1>, volatile float &&>);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_293::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_293::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_293::mem_fn)>::class_type, class_293>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_293::mem_fn)>, volatile bool * volatile &&(const float &&, volatile float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_293::mem_fn)>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_293::mem_fn), 0>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_293::mem_fn), 1>, volatile float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_293::mem_fn)>, type_list<const float &&, volatile float &&>>);
+static_assert(callable_arity_v<decltype(&class_293::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_293::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_293::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_293::mem_fn)> == callable_traits<decltype(&class_293::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_293::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_293::mem_fn)>, class_293>);
+struct class_297 { volatile bool * const volatile && mem_fn(const float * const &&, volatile float * const &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::signature_type, volatile bool * const volatile &&(const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::result_type, volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_297::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_297::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_297::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_297::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::arg0_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::arg_type<0>, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::arg1_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::arg_type<1>, volatile float * const &&>);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_297::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_297::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_297::mem_fn)>::class_type, class_297>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_297::mem_fn)>, volatile bool * const volatile &&(const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_297::mem_fn)>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_297::mem_fn), 0>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_297::mem_fn), 1>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_297::mem_fn)>, type_list<const float * const &&, volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_297::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_297::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_297::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_297::mem_fn)> == callable_traits<decltype(&class_297::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_297::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_297::mem_fn)>, class_297>);
+struct class_301 { const int * mem_fn(const float * const volatile &&, volatile float * const volatile &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::signature_type, const int *(const float * const volatile &&, volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::result_type, const int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_301::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_301::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_301::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_301::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::arg_type<0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::arg1_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::arg_type<1>, volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_301::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_301::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_301::mem_fn)>::class_type, class_301>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_301::mem_fn)>, const int *(const float * const volatile &&, volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_301::mem_fn)>, const int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_301::mem_fn), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_301::mem_fn), 1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_301::mem_fn)>, type_list<const float * const volatile &&, volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_301::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_301::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_301::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_301::mem_fn)> == callable_traits<decltype(&class_301::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_301::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_301::mem_fn)>, class_301>);
+struct class_305 { const int & mem_fn(std::string &, const std::string &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::signature_type, const int &(std::string &, const std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::result_type, const int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_305::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_305::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_305::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_305::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::arg0_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::arg_type<0>, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::arg1_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::arg_type<1>, const std::string &>);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_305::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_305::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_305::mem_fn)>::class_type, class_305>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_305::mem_fn)>, const int &(std::string &, const std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_305::mem_fn)>, const int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_305::mem_fn), 0>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_305::mem_fn), 1>, const std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_305::mem_fn)>, type_list<std::string &, const std::string &>>);
+static_assert(callable_arity_v<decltype(&class_305::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_305::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_305::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_305::mem_fn)> == callable_traits<decltype(&class_305::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_305::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_305::mem_fn)>, class_305>);
+struct class_309 { const int * & mem_fn(std::string * const &, const std::string * const &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::signature_type, const int * &(std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::result_type, const int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_309::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_309::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_309::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_309::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::arg0_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::arg_type<0>, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::arg1_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::arg_type<1>, const std::string * const &>);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_309::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_309::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_309::mem_fn)>::class_type, class_309>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_309::mem_fn)>, const int * &(std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_309::mem_fn)>, const int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_309::mem_fn), 0>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_309::mem_fn), 1>, const std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_309::mem_fn)>, type_list<std::string * const &, const std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_309::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_309::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_309::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_309::mem_fn)> == callable_traits<decltype(&class_309::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_309::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_309::mem_fn)>, class_309>);
+struct class_313 { const int * const & mem_fn(std::string * const volatile &, const std::string * const volatile &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::signature_type, const int * const &(std::string * const volatile &, const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::result_type, const int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_313::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_313::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_313::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_313::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::arg_type<0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::arg1_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::arg_type<1>, const std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_313::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_313::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_313::mem_fn)>::class_type, class_313>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_313::mem_fn)>, const int * const &(std::string * const volatile &, const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_313::mem_fn)>, const int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_313::mem_fn), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_313::mem_fn), 1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_313::mem_fn)>, type_list<std::string * const volatile &, const std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_313::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_313::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_313::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_313::mem_fn)> == callable_traits<decltype(&class_313::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_313::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_313::mem_fn)>, class_313>);
+struct class_317 { const int * volatile & mem_fn(std::string * &&, const std::string * &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::signature_type, const int * volatile &(std::string * &&, const std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::result_type, const int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_317::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_317::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_317::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_317::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::arg0_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::arg_type<0>, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::arg1_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::arg_type<1>, const std::string * &&>);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_317::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_317::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_317::mem_fn)>::class_type, class_317>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_317::mem_fn)>, const int * volatile &(std::string * &&, const std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_317::mem_fn)>, const int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_317::mem_fn), 0>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_317::mem_fn), 1>, const std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_317::mem_fn)>, type_list<std::string * &&, const std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_317::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_317::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_317::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_317::mem_fn)> == callable_traits<decltype(&class_317::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_317::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_317::mem_fn)>, class_317>);
+struct class_321 { const int * const volatile & mem_fn(std::string * volatile &&, const std::string * volatile &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::signature_type, const int * const volatile &(std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::result_type, const int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_321::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_321::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_321::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_321::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::arg0_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::arg_type<0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::arg1_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::arg_type<1>, const std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_321::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_321::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_321::mem_fn)>::class_type, class_321>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_321::mem_fn)>, const int * const volatile &(std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_321::mem_fn)>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_321::mem_fn), 0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_321::mem_fn), 1>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_321::mem_fn)>, type_list<std::string * volatile &&, const std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_321::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_321::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_321::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_321::mem_fn)> == callable_traits<decltype(&class_321::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_321::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_321::mem_fn)>, class_321>);
+struct class_325 { const int && mem_fn(void *, const void *, volatile void *, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::signature_type, const int &&(void *, const void *, volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::result_type, const int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_325::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_325::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_325::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_325::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::arg_type<0>, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::arg1_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::arg_type<1>, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::arg2_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::arg_type<2>, volatile void *>);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_325::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_325::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_325::mem_fn)>::class_type, class_325>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_325::mem_fn)>, const int &&(void *, const void *, volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_325::mem_fn)>, const int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_325::mem_fn), 0>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_325::mem_fn), 1>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_325::mem_fn), 2>, volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_325::mem_fn)>, type_list<void *, const void *, volatile void *>>);
+static_assert(callable_arity_v<decltype(&class_325::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_325::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_325::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_325::mem_fn)> == callable_traits<decltype(&class_325::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_325::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_325::mem_fn)>, class_325>);
+struct class_329 { const int * && mem_fn(void * volatile &, const void * volatile &, volatile void * volatile &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::signature_type, const int * &&(void * volatile &, const void * volatile &, volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::result_type, const int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_329::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_329::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_329::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_329::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::arg_type<0>, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::arg1_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::arg_type<1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::arg2_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::arg_type<2>, volatile void * volatile &>);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_329::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_329::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_329::mem_fn)>::class_type, class_329>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_329::mem_fn)>, const int * &&(void * volatile &, const void * volatile &, volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_329::mem_fn)>, const int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_329::mem_fn), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_329::mem_fn), 1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_329::mem_fn), 2>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_329::mem_fn)>, type_list<void * volatile &, const void * volatile &, volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_329::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_329::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_329::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_329::mem_fn)> == callable_traits<decltype(&class_329::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_329::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_329::mem_fn)>, class_329>);
+struct class_333 { const int * const && mem_fn(void * const &&, const void * const &&, volatile void * const &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::signature_type, const int * const &&(void * const &&, const void * const &&, volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::result_type, const int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_333::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_333::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_333::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_333::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::arg_type<0>, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::arg1_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::arg_type<1>, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::arg2_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::arg_type<2>, volatile void * const &&>);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_333::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_333::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_333::mem_fn)>::class_type, class_333>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_333::mem_fn)>, const int * const &&(void * const &&, const void * const &&, volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_333::mem_fn)>, const int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_333::mem_fn), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_333::mem_fn), 1>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_333::mem_fn), 2>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_333::mem_fn)>, type_list<void * const &&, const void * const &&, volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_333::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_333::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_333::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_333::mem_fn)> == callable_traits<decltype(&class_333::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_333::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_333::mem_fn)>, class_333>);
+struct class_337 { const int * volatile && mem_fn(bool, bool *, const bool *, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::signature_type, const int * volatile &&(bool, bool *, const bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::result_type, const int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_337::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_337::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_337::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_337::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::arg_type<0>, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::arg1_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::arg_type<1>, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::arg2_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::arg_type<2>, const bool *>);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_337::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_337::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_337::mem_fn)>::class_type, class_337>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_337::mem_fn)>, const int * volatile &&(bool, bool *, const bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_337::mem_fn)>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_337::mem_fn), 0>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_337::mem_fn), 1>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_337::mem_fn), 2>, const bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_337::mem_fn)>, type_list<bool, bool *, const bool *>>);
+static_assert(callable_arity_v<decltype(&class_337::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_337::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_337::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_337::mem_fn)> == callable_traits<decltype(&class_337::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_337::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_337::mem_fn)>, class_337>);
+struct class_341 { const int * const volatile && mem_fn(const volatile bool * &, bool * const &, const bool * const &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::signature_type, const int * const volatile &&(const volatile bool * &, bool * const &, const bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::result_type, const int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_341::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_341::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_341::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_341::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::arg_type<0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::arg1_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::arg_type<1>, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::arg2_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::arg_type<2>, const bool * const &>);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_341::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_341::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_341::mem_fn)>::class_type, class_341>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_341::mem_fn)>, const int * const volatile &&(const volatile bool * &, bool * const &, const bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_341::mem_fn)>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_341::mem_fn), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_341::mem_fn), 1>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_341::mem_fn), 2>, const bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_341::mem_fn)>, type_list<const volatile bool * &, bool * const &, const bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_341::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_341::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_341::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_341::mem_fn)> == callable_traits<decltype(&class_341::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_341::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_341::mem_fn)>, class_341>);
+struct class_345 { float * mem_fn(const volatile bool * const volatile &, bool &&, const bool &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::signature_type, float *(const volatile bool * const volatile &, bool &&, const bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::result_type, float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_345::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_345::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_345::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_345::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::arg1_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::arg_type<1>, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::arg2_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::arg_type<2>, const bool &&>);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_345::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_345::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_345::mem_fn)>::class_type, class_345>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_345::mem_fn)>, float *(const volatile bool * const volatile &, bool &&, const bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_345::mem_fn)>, float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_345::mem_fn), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_345::mem_fn), 1>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_345::mem_fn), 2>, const bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_345::mem_fn)>, type_list<const volatile bool * const volatile &, bool &&, const bool &&>>);
+static_assert(callable_arity_v<decltype(&class_345::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_345::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_345::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_345::mem_fn)> == callable_traits<decltype(&class_345::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_345::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_345::mem_fn)>, class_345>);
+struct class_349 { float & mem_fn(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::signature_type, float &(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::result_type, float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_349::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_349::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_349::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_349::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::arg1_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::arg_type<1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::arg2_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::arg_type<2>, const bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_349::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_349::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_349::mem_fn)>::class_type, class_349>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_349::mem_fn)>, float &(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_349::mem_fn)>, float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_349::mem_fn), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_349::mem_fn), 1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_349::mem_fn), 2>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_349::mem_fn)>, type_list<const volatile bool * const &&, bool * volatile &&, const bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_349::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_349::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_349::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_349::mem_fn)> == callable_traits<decltype(&class_349::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_349::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_349::mem_fn)>, class_349>);
+struct class_353 { float * & mem_fn(volatile int *, const volatile int *, int &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::signature_type, float * &(volatile int *, const volatile int *, int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::result_type, float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_353::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_353::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_353::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_353::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::arg_type<0>, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::arg1_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::arg_type<1>, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::arg2_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::arg_type<2>, int &>);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_353::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_353::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_353::mem_fn)>::class_type, class_353>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_353::mem_fn)>, float * &(volatile int *, const volatile int *, int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_353::mem_fn)>, float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_353::mem_fn), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_353::mem_fn), 1>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_353::mem_fn), 2>, int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_353::mem_fn)>, type_list<volatile int *, const volatile int *, int &>>);
+static_assert(callable_arity_v<decltype(&class_353::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_353::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_353::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_353::mem_fn)> == callable_traits<decltype(&class_353::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_353::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_353::mem_fn)>, class_353>);
+struct class_357 { float * const & mem_fn(volatile int * const &, const volatile int * const &, int * volatile &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::signature_type, float * const &(volatile int * const &, const volatile int * const &, int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::result_type, float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_357::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_357::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_357::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_357::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::arg_type<0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::arg1_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::arg_type<1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::arg2_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::arg_type<2>, int * volatile &>);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_357::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_357::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_357::mem_fn)>::class_type, class_357>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_357::mem_fn)>, float * const &(volatile int * const &, const volatile int * const &, int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_357::mem_fn)>, float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_357::mem_fn), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_357::mem_fn), 1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_357::mem_fn), 2>, int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_357::mem_fn)>, type_list<volatile int * const &, const volatile int * const &, int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_357::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_357::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_357::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_357::mem_fn)> == callable_traits<decltype(&class_357::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_357::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_357::mem_fn)>, class_357>);
+struct class_361 { float * volatile & mem_fn(volatile int &&, const volatile int &&, int * &&, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::signature_type, float * volatile &(volatile int &&, const volatile int &&, int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::result_type, float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_361::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_361::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_361::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_361::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::arg_type<0>, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::arg1_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::arg_type<1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::arg2_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::arg_type<2>, int * &&>);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_361::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_361::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_361::mem_fn)>::class_type, class_361>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_361::mem_fn)>, float * volatile &(volatile int &&, const volatile int &&, int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_361::mem_fn)>, float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_361::mem_fn), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_361::mem_fn), 1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_361::mem_fn), 2>, int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_361::mem_fn)>, type_list<volatile int &&, const volatile int &&, int * &&>>);
+static_assert(callable_arity_v<decltype(&class_361::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_361::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_361::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_361::mem_fn)> == callable_traits<decltype(&class_361::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_361::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_361::mem_fn)>, class_361>);
+struct class_365 { float * const volatile & mem_fn(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::signature_type, float * const volatile &(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::result_type, float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_365::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_365::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_365::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_365::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::arg1_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::arg_type<1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::arg2_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::arg_type<2>, int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_365::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_365::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_365::mem_fn)>::class_type, class_365>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_365::mem_fn)>, float * const volatile &(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_365::mem_fn)>, float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_365::mem_fn), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_365::mem_fn), 1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_365::mem_fn), 2>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_365::mem_fn)>, type_list<volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_365::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_365::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_365::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_365::mem_fn)> == callable_traits<decltype(&class_365::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_365::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_365::mem_fn)>, class_365>);
+struct class_369 { float && mem_fn(const float &, volatile float &, const volatile float &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::signature_type, float &&(const float &, volatile float &, const volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::result_type, float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_369::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_369::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_369::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_369::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::arg_type<0>, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::arg1_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::arg_type<1>, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::arg2_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::arg_type<2>, const volatile float &>);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_369::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_369::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_369::mem_fn)>::class_type, class_369>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_369::mem_fn)>, float &&(const float &, volatile float &, const volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_369::mem_fn)>, float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_369::mem_fn), 0>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_369::mem_fn), 1>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_369::mem_fn), 2>, const volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_369::mem_fn)>, type_list<const float &, volatile float &, const volatile float &>>);
+static_assert(callable_arity_v<decltype(&class_369::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_369::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_369::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_369::mem_fn)> == callable_traits<decltype(&class_369::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_369::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_369::mem_fn)>, class_369>);
+struct class_373 { float * && mem_fn(const float * volatile &, volatile float * volatile &, const volatile float * volatile &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::signature_type, float * &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::result_type, float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_373::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_373::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_373::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_373::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::arg_type<0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::arg1_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::arg_type<1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::arg2_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::arg_type<2>, const volatile float * volatile &>);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_373::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_373::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_373::mem_fn)>::class_type, class_373>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_373::mem_fn)>, float * &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_373::mem_fn)>, float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_373::mem_fn), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_373::mem_fn), 1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_373::mem_fn), 2>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_373::mem_fn)>, type_list<const float * volatile &, volatile float * volatile &, const volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_373::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_373::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_373::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_373::mem_fn)> == callable_traits<decltype(&class_373::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_373::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_373::mem_fn)>, class_373>);
+struct class_377 { float * const && mem_fn(const float * &&, volatile float * &&, const volatile float * &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::signature_type, float * const &&(const float * &&, volatile float * &&, const volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::result_type, float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_377::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_377::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_377::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_377::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::arg_type<0>, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::arg1_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::arg_type<1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::arg2_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::arg_type<2>, const volatile float * &&>);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_377::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_377::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_377::mem_fn)>::class_type, class_377>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_377::mem_fn)>, float * const &&(const float * &&, volatile float * &&, const volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_377::mem_fn)>, float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_377::mem_fn), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_377::mem_fn), 1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_377::mem_fn), 2>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_377::mem_fn)>, type_list<const float * &&, volatile float * &&, const volatile float * &&>>);
+static_assert(callable_arity_v<decltype(&class_377::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_377::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_377::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_377::mem_fn)> == callable_traits<decltype(&class_377::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_377::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_377::mem_fn)>, class_377>);
+struct class_381 { float * volatile && mem_fn(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::signature_type, float * volatile &&(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::result_type, float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_381::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_381::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_381::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_381::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::arg_type<0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::arg1_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::arg_type<1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::arg2_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::arg_type<2>, const volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_381::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_381::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_381::mem_fn)>::class_type, class_381>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_381::mem_fn)>, float * volatile &&(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_381::mem_fn)>, float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_381::mem_fn), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_381::mem_fn), 1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_381::mem_fn), 2>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_381::mem_fn)>, type_list<const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_381::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_381::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_381::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_381::mem_fn)> == callable_traits<decltype(&class_381::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_381::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_381::mem_fn)>, class_381>);
+struct class_385 { float * const volatile && mem_fn(std::string * &, const std::string * &, volatile std::string * &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::signature_type, float * const volatile &&(std::string * &, const std::string * &, volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::result_type, float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_385::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_385::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_385::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_385::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::arg_type<0>, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::arg1_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::arg_type<1>, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::arg2_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::arg_type<2>, volatile std::string * &>);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_385::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_385::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_385::mem_fn)>::class_type, class_385>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_385::mem_fn)>, float * const volatile &&(std::string * &, const std::string * &, volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_385::mem_fn)>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_385::mem_fn), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_385::mem_fn), 1>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_385::mem_fn), 2>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_385::mem_fn)>, type_list<std::string * &, const std::string * &, volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_385::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_385::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_385::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_385::mem_fn)> == callable_traits<decltype(&class_385::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_385::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_385::mem_fn)>, class_385>);
+struct class_389 { std::string mem_fn(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::signature_type, std::string(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::result_type, std::string>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_389::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_389::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_389::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_389::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::arg_type<0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::arg1_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::arg_type<1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::arg2_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::arg_type<2>, volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_389::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_389::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_389::mem_fn)>::class_type, class_389>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_389::mem_fn)>, std::string(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_389::mem_fn)>, std::string>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_389::mem_fn), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_389::mem_fn), 1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_389::mem_fn), 2>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_389::mem_fn)>, type_list<std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_389::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_389::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_389::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_389::mem_fn)> == callable_traits<decltype(&class_389::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_389::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_389::mem_fn)>, class_389>);
+struct class_393 { const volatile std::string * mem_fn(std::string * const &&, const std::string * const &&, volatile std::string * const &&, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::signature_type, const volatile std::string *(std::string * const &&, const std::string * const &&, volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::result_type, const volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_393::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_393::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_393::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_393::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::arg_type<0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::arg1_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::arg_type<1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::arg2_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::arg_type<2>, volatile std::string * const &&>);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_393::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_393::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_393::mem_fn)>::class_type, class_393>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_393::mem_fn)>, const volatile std::string *(std::string * const &&, const std::string * const &&, volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_393::mem_fn)>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_393::mem_fn), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_393::mem_fn), 1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_393::mem_fn), 2>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_393::mem_fn)>, type_list<std::string * const &&, const std::string * const &&, volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_393::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_393::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_393::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_393::mem_fn)> == callable_traits<decltype(&class_393::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_393::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_393::mem_fn)>, class_393>);
+struct class_397 { const volatile std::string & mem_fn(void *, const void *, volatile void *, const volatile void *, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::signature_type, const volatile std::string &(void *, const void *, volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::result_type, const volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_397::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_397::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_397::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_397::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg0_type, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg_type<0>, void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg1_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg_type<1>, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg2_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg_type<2>, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::arg_type<3>, const volatile void *>);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_397::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_397::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_397::mem_fn)>::class_type, class_397>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_397::mem_fn)>, const volatile std::string &(void *, const void *, volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_397::mem_fn)>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_397::mem_fn), 0>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_397::mem_fn), 1>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_397::mem_fn), 2>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_397::mem_fn), 3>, const volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_397::mem_fn)>, type_list<void *, const void *, volatile void *, const volatile void *>>);
+static_assert(callable_arity_v<decltype(&class_397::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_397::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_397::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_397::mem_fn)> == callable_traits<decltype(&class_397::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_397::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_397::mem_fn)>, class_397>);
+struct class_401 { const volatile std::string * & mem_fn(void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::signature_type, const volatile std::string * &(void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::result_type, const volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_401::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_401::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_401::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_401::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg0_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg_type<0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg1_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg_type<1>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg2_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg_type<2>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::arg_type<3>, const volatile void * const volatile &>);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_401::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_401::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_401::mem_fn)>::class_type, class_401>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_401::mem_fn)>, const volatile std::string * &(void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_401::mem_fn)>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_401::mem_fn), 0>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_401::mem_fn), 1>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_401::mem_fn), 2>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_401::mem_fn), 3>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_401::mem_fn)>, type_list<void * const volatile &, const void * const volatile &, volatile void * const volatile &, const volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_401::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_401::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_401::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_401::mem_fn)> == callable_traits<decltype(&class_401::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_401::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_401::mem_fn)>, class_401>);
+struct class_405 { const volatile std::string * const & mem_fn(void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::signature_type, const volatile std::string * const &(void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::result_type, const volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_405::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_405::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_405::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_405::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg0_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg_type<0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg1_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg_type<1>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg2_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg_type<2>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::arg_type<3>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_405::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_405::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_405::mem_fn)>::class_type, class_405>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_405::mem_fn)>, const volatile std::string * const &(void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_405::mem_fn)>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_405::mem_fn), 0>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_405::mem_fn), 1>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_405::mem_fn), 2>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_405::mem_fn), 3>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_405::mem_fn)>, type_list<void * const volatile &&, const void * const volatile &&, volatile void * const volatile &&, const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_405::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_405::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_405::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_405::mem_fn)> == callable_traits<decltype(&class_405::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_405::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_405::mem_fn)>, class_405>);
+struct class_409 { const volatile std::string * volatile & mem_fn(const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::signature_type, const volatile std::string * volatile &(const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::result_type, const volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_409::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_409::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_409::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_409::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg0_type, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg_type<0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg1_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg_type<1>, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg2_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg_type<2>, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::arg_type<3>, volatile bool * const &>);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_409::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_409::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_409::mem_fn)>::class_type, class_409>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_409::mem_fn)>, const volatile std::string * volatile &(const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_409::mem_fn)>, const volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_409::mem_fn), 0>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_409::mem_fn), 1>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_409::mem_fn), 2>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_409::mem_fn), 3>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_409::mem_fn)>, type_list<const volatile bool * &, bool * const &, const bool * const &, volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_409::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_409::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_409::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_409::mem_fn)> == callable_traits<decltype(&class_409::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_409::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_409::mem_fn)>, class_409>);
+struct class_413 { const volatile std::string * const volatile & mem_fn(const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::signature_type, const volatile std::string * const volatile &(const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::result_type, const volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_413::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_413::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_413::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_413::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg0_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg_type<0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg1_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg_type<1>, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg2_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg_type<2>, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::arg_type<3>, volatile bool * &&>);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_413::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_413::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_413::mem_fn)>::class_type, class_413>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_413::mem_fn)>, const volatile std::string * const volatile &(const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_413::mem_fn)>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_413::mem_fn), 0>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_413::mem_fn), 1>, bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_413::mem_fn), 2>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_413::mem_fn), 3>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_413::mem_fn)>, type_list<const volatile bool &&, bool * &&, const bool * &&, volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_413::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_413::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_413::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_413::mem_fn)> == callable_traits<decltype(&class_413::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_413::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_413::mem_fn)>, class_413>);
+struct class_417 { const volatile std::string && mem_fn(const volatile bool * const volatile &&, int, int *, const int *, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::signature_type, const volatile std::string &&(const volatile bool * const volatile &&, int, int *, const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::result_type, const volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_417::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_417::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_417::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_417::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg0_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg_type<0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg1_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg_type<1>, int>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg2_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg_type<2>, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::arg_type<3>, const int *>);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_417::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_417::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_417::mem_fn)>::class_type, class_417>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_417::mem_fn)>, const volatile std::string &&(const volatile bool * const volatile &&, int, int *, const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_417::mem_fn)>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_417::mem_fn), 0>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_417::mem_fn), 1>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_417::mem_fn), 2>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_417::mem_fn), 3>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_417::mem_fn)>, type_list<const volatile bool * const volatile &&, int, int *, const int *>>);
+static_assert(callable_arity_v<decltype(&class_417::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_417::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_417::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_417::mem_fn)> == callable_traits<decltype(&class_417::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_417::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_417::mem_fn)>, class_417>);
+struct class_421 { const volatile std::string * && mem_fn(volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::signature_type, const volatile std::string * &&(volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::result_type, const volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_421::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_421::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_421::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_421::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg0_type, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg_type<0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg1_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg_type<1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg2_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg_type<2>, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::arg_type<3>, const int * volatile &>);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_421::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_421::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_421::mem_fn)>::class_type, class_421>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_421::mem_fn)>, const volatile std::string * &&(volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_421::mem_fn)>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_421::mem_fn), 0>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_421::mem_fn), 1>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_421::mem_fn), 2>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_421::mem_fn), 3>, const int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_421::mem_fn)>, type_list<volatile int * const &, const volatile int * const &, int * volatile &, const int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_421::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_421::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_421::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_421::mem_fn)> == callable_traits<decltype(&class_421::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_421::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_421::mem_fn)>, class_421>);
+struct class_425 { const volatile std::string * const && mem_fn(volatile int * &&, const volatile int * &&, int * const &&, const int * const &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::signature_type, const volatile std::string * const &&(volatile int * &&, const volatile int * &&, int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::result_type, const volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_425::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_425::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_425::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_425::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg0_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg_type<0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg1_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg_type<1>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg2_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg_type<2>, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::arg_type<3>, const int * const &&>);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_425::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_425::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_425::mem_fn)>::class_type, class_425>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_425::mem_fn)>, const volatile std::string * const &&(volatile int * &&, const volatile int * &&, int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_425::mem_fn)>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_425::mem_fn), 0>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_425::mem_fn), 1>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_425::mem_fn), 2>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_425::mem_fn), 3>, const int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_425::mem_fn)>, type_list<volatile int * &&, const volatile int * &&, int * const &&, const int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_425::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_425::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_425::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_425::mem_fn)> == callable_traits<decltype(&class_425::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_425::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_425::mem_fn)>, class_425>);
+struct class_429 { const volatile std::string * volatile && mem_fn(const float *, volatile float *, const volatile float *, float &, ...) const && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::signature_type, const volatile std::string * volatile &&(const float *, volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::result_type, const volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_429::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_429::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_429::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_429::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg0_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg_type<0>, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg1_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg_type<1>, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg2_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg_type<2>, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::arg_type<3>, float &>);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_429::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_429::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_429::mem_fn)>::class_type, class_429>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_429::mem_fn)>, const volatile std::string * volatile &&(const float *, volatile float *, const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_429::mem_fn)>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_429::mem_fn), 0>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_429::mem_fn), 1>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_429::mem_fn), 2>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_429::mem_fn), 3>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_429::mem_fn)>, type_list<const float *, volatile float *, const volatile float *, float &>>);
+static_assert(callable_arity_v<decltype(&class_429::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_429::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_429::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_429::mem_fn)> == callable_traits<decltype(&class_429::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_429::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_429::mem_fn)>, class_429>);
+struct class_433 { const volatile std::string * const volatile && mem_fn(const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &, ...) const; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::signature_type, const volatile std::string * const volatile &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::result_type, const volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_433::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_433::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_433::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_433::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg0_type, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg_type<0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg1_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg_type<1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg2_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg_type<2>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::arg_type<3>, float * const volatile &>);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_433::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_433::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_433::mem_fn)>::class_type, class_433>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_433::mem_fn)>, const volatile std::string * const volatile &&(const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_433::mem_fn)>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_433::mem_fn), 0>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_433::mem_fn), 1>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_433::mem_fn), 2>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_433::mem_fn), 3>, float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_433::mem_fn)>, type_list<const float * volatile &, volatile float * volatile &, const volatile float * volatile &, float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_433::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_433::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_433::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_433::mem_fn)> == callable_traits<decltype(&class_433::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_433::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_433::mem_fn)>, class_433>);
+struct class_437 { volatile void * mem_fn(const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&, ...) const &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::signature_type, volatile void *(const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::result_type, volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_437::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_437::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_437::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_437::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg0_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg_type<0>, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg1_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg_type<1>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg2_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg_type<2>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::arg_type<3>, float * volatile &&>);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_437::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_437::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_437::mem_fn)>::class_type, class_437>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_437::mem_fn)>, volatile void *(const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_437::mem_fn)>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_437::mem_fn), 0>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_437::mem_fn), 1>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_437::mem_fn), 2>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_437::mem_fn), 3>, float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_437::mem_fn)>, type_list<const float * const &&, volatile float * const &&, const volatile float * const &&, float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_437::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_437::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_437::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_437::mem_fn)> == callable_traits<decltype(&class_437::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_437::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_437::mem_fn)>, class_437>);
+struct class_441 { volatile void * & mem_fn(std::string &, const std::string &, volatile std::string &, const volatile std::string &, ...) const &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::signature_type, volatile void * &(std::string &, const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::result_type, volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_441::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_441::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_441::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_441::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg0_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg_type<0>, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg1_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg_type<1>, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg2_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg_type<2>, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::arg_type<3>, const volatile std::string &>);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_441::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_441::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_441::mem_fn)>::class_type, class_441>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_441::mem_fn)>, volatile void * &(std::string &, const std::string &, volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_441::mem_fn)>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_441::mem_fn), 0>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_441::mem_fn), 1>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_441::mem_fn), 2>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_441::mem_fn), 3>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_441::mem_fn)>, type_list<std::string &, const std::string &, volatile std::string &, const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(&class_441::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_441::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_441::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_441::mem_fn)> == callable_traits<decltype(&class_441::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_441::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_441::mem_fn)>, class_441>);
+struct class_445 { volatile void * const & mem_fn(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &, ...) const noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::signature_type, volatile void * const &(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::result_type, volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_445::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_445::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_445::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_445::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg0_type, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg_type<0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg1_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg_type<1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg2_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg_type<2>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::arg_type<3>, const volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_445::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_445::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_445::mem_fn)>::class_type, class_445>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_445::mem_fn)>, volatile void * const &(std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_445::mem_fn)>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_445::mem_fn), 0>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_445::mem_fn), 1>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_445::mem_fn), 2>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_445::mem_fn), 3>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_445::mem_fn)>, type_list<std::string * const volatile &, const std::string * const volatile &, volatile std::string * const volatile &, const volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_445::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_445::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_445::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_445::mem_fn)> == callable_traits<decltype(&class_445::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_445::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_445::mem_fn)>, class_445>);
+struct class_449 { volatile void * volatile & mem_fn(std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&, ...) const & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::signature_type, volatile void * volatile &(std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::result_type, volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_449::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_449::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_449::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_449::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg0_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg_type<0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg1_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg_type<1>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg2_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg_type<2>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::arg_type<3>, const volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_volatile == false);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_449::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_449::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_449::mem_fn)>::class_type, class_449>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_449::mem_fn)>, volatile void * volatile &(std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_449::mem_fn)>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_449::mem_fn), 0>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_449::mem_fn), 1>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_449::mem_fn), 2>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_449::mem_fn), 3>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_449::mem_fn)>, type_list<std::string * volatile &&, const std::string * volatile &&, volatile std::string * volatile &&, const volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_449::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_449::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_449::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_449::mem_fn)> == callable_traits<decltype(&class_449::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_449::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_449::mem_fn)>, class_449>);
@@ -0,0 +1,3773 @@
+/* This file was auto-generated */
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "../../include/callable_traits.hpp"
+#include "../callable_traits_test_helper.hpp"
+
+struct class_3 { volatile void * mem_fn(volatile void *, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_3::mem_fn)>::signature_type, volatile void *(volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_3::mem_fn)>::result_type, volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_3::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_3::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_3::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_3::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_3::mem_fn)>::arg0_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_3::mem_fn)>::arg_type<0>, volatile void *>);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_3::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_3::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_3::mem_fn)>::class_type, class_3>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_3::mem_fn)>, volatile void *(volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_3::mem_fn)>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_3::mem_fn), 0>, volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_3::mem_fn)>, type_list<volatile void *>>);
+static_assert(callable_arity_v<decltype(&class_3::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_3::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_3::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_3::mem_fn)> == callable_traits<decltype(&class_3::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_3::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_3::mem_fn)>, class_3>);
+struct class_7 { volatile void * & mem_fn(volatile void * &, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_7::mem_fn)>::signature_type, volatile void * &(volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_7::mem_fn)>::result_type, volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_7::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_7::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_7::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_7::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_7::mem_fn)>::arg0_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_7::mem_fn)>::arg_type<0>, volatile void * &>);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_7::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_7::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_7::mem_fn)>::class_type, class_7>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_7::mem_fn)>, volatile void * &(volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_7::mem_fn)>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_7::mem_fn), 0>, volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_7::mem_fn)>, type_list<volatile void * &>>);
+static_assert(callable_arity_v<decltype(&class_7::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_7::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_7::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_7::mem_fn)> == callable_traits<decltype(&class_7::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_7::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_7::mem_fn)>, class_7>);
+struct class_11 { volatile void * const & mem_fn(volatile void * const &, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_11::mem_fn)>::signature_type, volatile void * const &(volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_11::mem_fn)>::result_type, volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_11::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_11::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_11::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_11::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_11::mem_fn)>::arg0_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_11::mem_fn)>::arg_type<0>, volatile void * const &>);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_11::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_11::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_11::mem_fn)>::class_type, class_11>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_11::mem_fn)>, volatile void * const &(volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_11::mem_fn)>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_11::mem_fn), 0>, volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_11::mem_fn)>, type_list<volatile void * const &>>);
+static_assert(callable_arity_v<decltype(&class_11::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_11::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_11::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_11::mem_fn)> == callable_traits<decltype(&class_11::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_11::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_11::mem_fn)>, class_11>);
+struct class_15 { volatile void * volatile & mem_fn(volatile void * volatile &, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_15::mem_fn)>::signature_type, volatile void * volatile &(volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_15::mem_fn)>::result_type, volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_15::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_15::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_15::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_15::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_15::mem_fn)>::arg0_type, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_15::mem_fn)>::arg_type<0>, volatile void * volatile &>);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_15::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_15::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_15::mem_fn)>::class_type, class_15>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_15::mem_fn)>, volatile void * volatile &(volatile void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_15::mem_fn)>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_15::mem_fn), 0>, volatile void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_15::mem_fn)>, type_list<volatile void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_15::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_15::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_15::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_15::mem_fn)> == callable_traits<decltype(&class_15::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_15::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_15::mem_fn)>, class_15>);
+struct class_19 { volatile void * const volatile & mem_fn(volatile void * const volatile &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_19::mem_fn)>::signature_type, volatile void * const volatile &(volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_19::mem_fn)>::result_type, volatile void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_19::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_19::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_19::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_19::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_19::mem_fn)>::arg0_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_19::mem_fn)>::arg_type<0>, volatile void * const volatile &>);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_19::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_19::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_19::mem_fn)>::class_type, class_19>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_19::mem_fn)>, volatile void * const volatile &(volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_19::mem_fn)>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_19::mem_fn), 0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_19::mem_fn)>, type_list<volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_19::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_19::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_19::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_19::mem_fn)> == callable_traits<decltype(&class_19::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_19::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_19::mem_fn)>, class_19>);
+struct class_23 { volatile void * && mem_fn(volatile void * &&, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_23::mem_fn)>::signature_type, volatile void * &&(volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_23::mem_fn)>::result_type, volatile void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_23::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_23::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_23::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_23::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_23::mem_fn)>::arg0_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_23::mem_fn)>::arg_type<0>, volatile void * &&>);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_23::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_23::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_23::mem_fn)>::class_type, class_23>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_23::mem_fn)>, volatile void * &&(volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_23::mem_fn)>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_23::mem_fn), 0>, volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_23::mem_fn)>, type_list<volatile void * &&>>);
+static_assert(callable_arity_v<decltype(&class_23::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_23::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_23::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_23::mem_fn)> == callable_traits<decltype(&class_23::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_23::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_23::mem_fn)>, class_23>);
+struct class_27 { volatile void * const && mem_fn(volatile void * const &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_27::mem_fn)>::signature_type, volatile void * const &&(volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_27::mem_fn)>::result_type, volatile void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_27::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_27::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_27::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_27::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_27::mem_fn)>::arg0_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_27::mem_fn)>::arg_type<0>, volatile void * const &&>);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_27::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_27::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_27::mem_fn)>::class_type, class_27>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_27::mem_fn)>, volatile void * const &&(volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_27::mem_fn)>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_27::mem_fn), 0>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_27::mem_fn)>, type_list<volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_27::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_27::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_27::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_27::mem_fn)> == callable_traits<decltype(&class_27::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_27::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_27::mem_fn)>, class_27>);
+struct class_31 { volatile void * volatile && mem_fn(volatile void * volatile &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_31::mem_fn)>::signature_type, volatile void * volatile &&(volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_31::mem_fn)>::result_type, volatile void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_31::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_31::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_31::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_31::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_31::mem_fn)>::arg0_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_31::mem_fn)>::arg_type<0>, volatile void * volatile &&>);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_31::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_31::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_31::mem_fn)>::class_type, class_31>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_31::mem_fn)>, volatile void * volatile &&(volatile void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_31::mem_fn)>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_31::mem_fn), 0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_31::mem_fn)>, type_list<volatile void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_31::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_31::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_31::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_31::mem_fn)> == callable_traits<decltype(&class_31::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_31::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_31::mem_fn)>, class_31>);
+struct class_35 { volatile void * const volatile && mem_fn(volatile void * const volatile &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_35::mem_fn)>::signature_type, volatile void * const volatile &&(volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_35::mem_fn)>::result_type, volatile void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_35::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_35::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_35::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_35::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_35::mem_fn)>::arg0_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_35::mem_fn)>::arg_type<0>, volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_35::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_35::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_35::mem_fn)>::class_type, class_35>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_35::mem_fn)>, volatile void * const volatile &&(volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_35::mem_fn)>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_35::mem_fn), 0>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_35::mem_fn)>, type_list<volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_35::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_35::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_35::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_35::mem_fn)> == callable_traits<decltype(&class_35::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_35::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_35::mem_fn)>, class_35>);
+struct class_39 { const bool * mem_fn(const bool *, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_39::mem_fn)>::signature_type, const bool *(const bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_39::mem_fn)>::result_type, const bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_39::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_39::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_39::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_39::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_39::mem_fn)>::arg0_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_39::mem_fn)>::arg_type<0>, const bool *>);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_39::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_39::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_39::mem_fn)>::class_type, class_39>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_39::mem_fn)>, const bool *(const bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_39::mem_fn)>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_39::mem_fn), 0>, const bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_39::mem_fn)>, type_list<const bool *>>);
+static_assert(callable_arity_v<decltype(&class_39::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_39::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_39::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_39::mem_fn)> == callable_traits<decltype(&class_39::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_39::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_39::mem_fn)>, class_39>);
+struct class_43 { const bool & mem_fn(const bool &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_43::mem_fn)>::signature_type, const bool &(const bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_43::mem_fn)>::result_type, const bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_43::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_43::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_43::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_43::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_43::mem_fn)>::arg0_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_43::mem_fn)>::arg_type<0>, const bool &>);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_43::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_43::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_43::mem_fn)>::class_type, class_43>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_43::mem_fn)>, const bool &(const bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_43::mem_fn)>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_43::mem_fn), 0>, const bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_43::mem_fn)>, type_list<const bool &>>);
+static_assert(callable_arity_v<decltype(&class_43::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_43::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_43::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_43::mem_fn)> == callable_traits<decltype(&class_43::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_43::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_43::mem_fn)>, class_43>);
+struct class_47 { const bool * & mem_fn(const bool * &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_47::mem_fn)>::signature_type, const bool * &(const bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_47::mem_fn)>::result_type, const bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_47::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_47::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_47::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_47::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_47::mem_fn)>::arg0_type, const bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_47::mem_fn)>::arg_type<0>, const bool * &>);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_47::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_47::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_47::mem_fn)>::class_type, class_47>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_47::mem_fn)>, const bool * &(const bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_47::mem_fn)>, const bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_47::mem_fn), 0>, const bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_47::mem_fn)>, type_list<const bool * &>>);
+static_assert(callable_arity_v<decltype(&class_47::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_47::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_47::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_47::mem_fn)> == callable_traits<decltype(&class_47::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_47::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_47::mem_fn)>, class_47>);
+struct class_51 { const bool * const & mem_fn(const bool * const &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_51::mem_fn)>::signature_type, const bool * const &(const bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_51::mem_fn)>::result_type, const bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_51::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_51::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_51::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_51::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_51::mem_fn)>::arg0_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_51::mem_fn)>::arg_type<0>, const bool * const &>);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_51::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_51::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_51::mem_fn)>::class_type, class_51>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_51::mem_fn)>, const bool * const &(const bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_51::mem_fn)>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_51::mem_fn), 0>, const bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_51::mem_fn)>, type_list<const bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_51::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_51::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_51::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_51::mem_fn)> == callable_traits<decltype(&class_51::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_51::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_51::mem_fn)>, class_51>);
+struct class_55 { const bool * volatile & mem_fn(const bool * volatile &, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_55::mem_fn)>::signature_type, const bool * volatile &(const bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_55::mem_fn)>::result_type, const bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_55::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_55::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_55::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_55::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_55::mem_fn)>::arg0_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_55::mem_fn)>::arg_type<0>, const bool * volatile &>);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_55::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_55::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_55::mem_fn)>::class_type, class_55>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_55::mem_fn)>, const bool * volatile &(const bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_55::mem_fn)>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_55::mem_fn), 0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_55::mem_fn)>, type_list<const bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_55::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_55::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_55::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_55::mem_fn)> == callable_traits<decltype(&class_55::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_55::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_55::mem_fn)>, class_55>);
+struct class_59 { const bool * const volatile & mem_fn(const bool * const volatile &, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_59::mem_fn)>::signature_type, const bool * const volatile &(const bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_59::mem_fn)>::result_type, const bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_59::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_59::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_59::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_59::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_59::mem_fn)>::arg0_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_59::mem_fn)>::arg_type<0>, const bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_59::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_59::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_59::mem_fn)>::class_type, class_59>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_59::mem_fn)>, const bool * const volatile &(const bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_59::mem_fn)>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_59::mem_fn), 0>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_59::mem_fn)>, type_list<const bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_59::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_59::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_59::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_59::mem_fn)> == callable_traits<decltype(&class_59::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_59::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_59::mem_fn)>, class_59>);
+struct class_63 { const bool && mem_fn(const bool &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_63::mem_fn)>::signature_type, const bool &&(const bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_63::mem_fn)>::result_type, const bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_63::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_63::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_63::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_63::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_63::mem_fn)>::arg0_type, const bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_63::mem_fn)>::arg_type<0>, const bool &&>);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_63::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_63::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_63::mem_fn)>::class_type, class_63>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_63::mem_fn)>, const bool &&(const bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_63::mem_fn)>, const bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_63::mem_fn), 0>, const bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_63::mem_fn)>, type_list<const bool &&>>);
+static_assert(callable_arity_v<decltype(&class_63::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_63::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_63::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_63::mem_fn)> == callable_traits<decltype(&class_63::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_63::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_63::mem_fn)>, class_63>);
+struct class_67 { const bool * && mem_fn(const bool * &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_67::mem_fn)>::signature_type, const bool * &&(const bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_67::mem_fn)>::result_type, const bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_67::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_67::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_67::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_67::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_67::mem_fn)>::arg0_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_67::mem_fn)>::arg_type<0>, const bool * &&>);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_67::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_67::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_67::mem_fn)>::class_type, class_67>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_67::mem_fn)>, const bool * &&(const bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_67::mem_fn)>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_67::mem_fn), 0>, const bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_67::mem_fn)>, type_list<const bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_67::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_67::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_67::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_67::mem_fn)> == callable_traits<decltype(&class_67::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_67::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_67::mem_fn)>, class_67>);
+struct class_71 { const bool * const && mem_fn(const bool * const &&, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_71::mem_fn)>::signature_type, const bool * const &&(const bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_71::mem_fn)>::result_type, const bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_71::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_71::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_71::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_71::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_71::mem_fn)>::arg0_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_71::mem_fn)>::arg_type<0>, const bool * const &&>);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_71::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_71::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_71::mem_fn)>::class_type, class_71>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_71::mem_fn)>, const bool * const &&(const bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_71::mem_fn)>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_71::mem_fn), 0>, const bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_71::mem_fn)>, type_list<const bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_71::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_71::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_71::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_71::mem_fn)> == callable_traits<decltype(&class_71::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_71::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_71::mem_fn)>, class_71>);
+struct class_75 { const bool * volatile && mem_fn(const bool * volatile &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_75::mem_fn)>::signature_type, const bool * volatile &&(const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_75::mem_fn)>::result_type, const bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_75::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_75::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_75::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_75::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_75::mem_fn)>::arg0_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_75::mem_fn)>::arg_type<0>, const bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_75::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_75::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_75::mem_fn)>::class_type, class_75>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_75::mem_fn)>, const bool * volatile &&(const bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_75::mem_fn)>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_75::mem_fn), 0>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_75::mem_fn)>, type_list<const bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_75::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_75::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_75::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_75::mem_fn)> == callable_traits<decltype(&class_75::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_75::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_75::mem_fn)>, class_75>);
+struct class_79 { const bool * const volatile && mem_fn(const bool * const volatile &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_79::mem_fn)>::signature_type, const bool * const volatile &&(const bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_79::mem_fn)>::result_type, const bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_79::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_79::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_79::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_79::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_79::mem_fn)>::arg0_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_79::mem_fn)>::arg_type<0>, const bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_79::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_79::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_79::mem_fn)>::class_type, class_79>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_79::mem_fn)>, const bool * const volatile &&(const bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_79::mem_fn)>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_79::mem_fn), 0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_79::mem_fn)>, type_list<const bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_79::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_79::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_79::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_79::mem_fn)> == callable_traits<decltype(&class_79::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_79::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_79::mem_fn)>, class_79>);
+struct class_83 { int * mem_fn(int *, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_83::mem_fn)>::signature_type, int *(int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_83::mem_fn)>::result_type, int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_83::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_83::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_83::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_83::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_83::mem_fn)>::arg0_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_83::mem_fn)>::arg_type<0>, int *>);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_83::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_83::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_83::mem_fn)>::class_type, class_83>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_83::mem_fn)>, int *(int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_83::mem_fn)>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_83::mem_fn), 0>, int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_83::mem_fn)>, type_list<int *>>);
+static_assert(callable_arity_v<decltype(&class_83::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_83::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_83::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_83::mem_fn)> == callable_traits<decltype(&class_83::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_83::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_83::mem_fn)>, class_83>);
+struct class_87 { int & mem_fn(int &, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_87::mem_fn)>::signature_type, int &(int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_87::mem_fn)>::result_type, int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_87::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_87::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_87::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_87::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_87::mem_fn)>::arg0_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_87::mem_fn)>::arg_type<0>, int &>);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_87::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_87::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_87::mem_fn)>::class_type, class_87>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_87::mem_fn)>, int &(int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_87::mem_fn)>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_87::mem_fn), 0>, int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_87::mem_fn)>, type_list<int &>>);
+static_assert(callable_arity_v<decltype(&class_87::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_87::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_87::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_87::mem_fn)> == callable_traits<decltype(&class_87::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_87::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_87::mem_fn)>, class_87>);
+struct class_91 { int * & mem_fn(int * &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_91::mem_fn)>::signature_type, int * &(int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_91::mem_fn)>::result_type, int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_91::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_91::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_91::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_91::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_91::mem_fn)>::arg0_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_91::mem_fn)>::arg_type<0>, int * &>);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_91::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_91::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_91::mem_fn)>::class_type, class_91>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_91::mem_fn)>, int * &(int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_91::mem_fn)>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_91::mem_fn), 0>, int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_91::mem_fn)>, type_list<int * &>>);
+static_assert(callable_arity_v<decltype(&class_91::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_91::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_91::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_91::mem_fn)> == callable_traits<decltype(&class_91::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_91::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_91::mem_fn)>, class_91>);
+struct class_95 { int * const & mem_fn(int * const &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_95::mem_fn)>::signature_type, int * const &(int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_95::mem_fn)>::result_type, int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_95::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_95::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_95::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_95::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_95::mem_fn)>::arg0_type, int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_95::mem_fn)>::arg_type<0>, int * const &>);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_95::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_95::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_95::mem_fn)>::class_type, class_95>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_95::mem_fn)>, int * const &(int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_95::mem_fn)>, int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_95::mem_fn), 0>, int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_95::mem_fn)>, type_list<int * const &>>);
+static_assert(callable_arity_v<decltype(&class_95::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_95::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_95::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_95::mem_fn)> == callable_traits<decltype(&class_95::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_95::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_95::mem_fn)>, class_95>);
+struct class_99 { int * volatile & mem_fn(int * volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_99::mem_fn)>::signature_type, int * volatile &(int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_99::mem_fn)>::result_type, int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_99::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_99::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_99::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_99::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_99::mem_fn)>::arg0_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_99::mem_fn)>::arg_type<0>, int * volatile &>);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_99::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_99::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_99::mem_fn)>::class_type, class_99>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_99::mem_fn)>, int * volatile &(int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_99::mem_fn)>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_99::mem_fn), 0>, int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_99::mem_fn)>, type_list<int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_99::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_99::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_99::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_99::mem_fn)> == callable_traits<decltype(&class_99::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_99::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_99::mem_fn)>, class_99>);
+struct class_103 { int * const volatile & mem_fn(int * const volatile &, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_103::mem_fn)>::signature_type, int * const volatile &(int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_103::mem_fn)>::result_type, int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_103::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_103::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_103::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_103::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_103::mem_fn)>::arg0_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_103::mem_fn)>::arg_type<0>, int * const volatile &>);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_103::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_103::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_103::mem_fn)>::class_type, class_103>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_103::mem_fn)>, int * const volatile &(int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_103::mem_fn)>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_103::mem_fn), 0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_103::mem_fn)>, type_list<int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_103::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_103::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_103::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_103::mem_fn)> == callable_traits<decltype(&class_103::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_103::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_103::mem_fn)>, class_103>);
+struct class_107 { int && mem_fn(int &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_107::mem_fn)>::signature_type, int &&(int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_107::mem_fn)>::result_type, int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_107::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_107::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_107::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_107::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_107::mem_fn)>::arg0_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_107::mem_fn)>::arg_type<0>, int &&>);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_107::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_107::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_107::mem_fn)>::class_type, class_107>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_107::mem_fn)>, int &&(int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_107::mem_fn)>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_107::mem_fn), 0>, int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_107::mem_fn)>, type_list<int &&>>);
+static_assert(callable_arity_v<decltype(&class_107::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_107::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_107::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_107::mem_fn)> == callable_traits<decltype(&class_107::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_107::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_107::mem_fn)>, class_107>);
+struct class_111 { int * && mem_fn(int * &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_111::mem_fn)>::signature_type, int * &&(int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_111::mem_fn)>::result_type, int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_111::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_111::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_111::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_111::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_111::mem_fn)>::arg0_type, int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_111::mem_fn)>::arg_type<0>, int * &&>);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_111::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_111::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_111::mem_fn)>::class_type, class_111>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_111::mem_fn)>, int * &&(int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_111::mem_fn)>, int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_111::mem_fn), 0>, int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_111::mem_fn)>, type_list<int * &&>>);
+static_assert(callable_arity_v<decltype(&class_111::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_111::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_111::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_111::mem_fn)> == callable_traits<decltype(&class_111::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_111::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_111::mem_fn)>, class_111>);
+struct class_115 { int * const && mem_fn(int * const &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_115::mem_fn)>::signature_type, int * const &&(int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_115::mem_fn)>::result_type, int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_115::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_115::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_115::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_115::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_115::mem_fn)>::arg0_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_115::mem_fn)>::arg_type<0>, int * const &&>);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_115::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_115::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_115::mem_fn)>::class_type, class_115>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_115::mem_fn)>, int * const &&(int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_115::mem_fn)>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_115::mem_fn), 0>, int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_115::mem_fn)>, type_list<int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_115::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_115::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_115::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_115::mem_fn)> == callable_traits<decltype(&class_115::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_115::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_115::mem_fn)>, class_115>);
+struct class_119 { int * volatile && mem_fn(int * volatile &&, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_119::mem_fn)>::signature_type, int * volatile &&(int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_119::mem_fn)>::result_type, int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_119::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_119::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_119::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_119::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_119::mem_fn)>::arg0_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_119::mem_fn)>::arg_type<0>, int * volatile &&>);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_119::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_119::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_119::mem_fn)>::class_type, class_119>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_119::mem_fn)>, int * volatile &&(int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_119::mem_fn)>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_119::mem_fn), 0>, int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_119::mem_fn)>, type_list<int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_119::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_119::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_119::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_119::mem_fn)> == callable_traits<decltype(&class_119::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_119::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_119::mem_fn)>, class_119>);
+struct class_123 { int * const volatile && mem_fn(int * const volatile &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_123::mem_fn)>::signature_type, int * const volatile &&(int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_123::mem_fn)>::result_type, int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_123::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_123::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_123::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_123::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_123::mem_fn)>::arg0_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_123::mem_fn)>::arg_type<0>, int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_123::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_123::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_123::mem_fn)>::class_type, class_123>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_123::mem_fn)>, int * const volatile &&(int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_123::mem_fn)>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_123::mem_fn), 0>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_123::mem_fn)>, type_list<int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_123::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_123::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_123::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_123::mem_fn)> == callable_traits<decltype(&class_123::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_123::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_123::mem_fn)>, class_123>);
+struct class_127 { float mem_fn(float, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_127::mem_fn)>::signature_type, float(float)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_127::mem_fn)>::result_type, float>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_127::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_127::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_127::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_127::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_127::mem_fn)>::arg0_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_127::mem_fn)>::arg_type<0>, float>);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_127::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_127::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_127::mem_fn)>::class_type, class_127>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_127::mem_fn)>, float(float)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_127::mem_fn)>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_127::mem_fn), 0>, float>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_127::mem_fn)>, type_list<float>>);
+static_assert(callable_arity_v<decltype(&class_127::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_127::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_127::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_127::mem_fn)> == callable_traits<decltype(&class_127::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_127::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_127::mem_fn)>, class_127>);
+struct class_131 { const volatile float * mem_fn(const volatile float *, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_131::mem_fn)>::signature_type, const volatile float *(const volatile float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_131::mem_fn)>::result_type, const volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_131::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_131::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_131::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_131::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_131::mem_fn)>::arg0_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_131::mem_fn)>::arg_type<0>, const volatile float *>);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_131::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_131::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_131::mem_fn)>::class_type, class_131>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_131::mem_fn)>, const volatile float *(const volatile float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_131::mem_fn)>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_131::mem_fn), 0>, const volatile float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_131::mem_fn)>, type_list<const volatile float *>>);
+static_assert(callable_arity_v<decltype(&class_131::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_131::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_131::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_131::mem_fn)> == callable_traits<decltype(&class_131::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_131::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_131::mem_fn)>, class_131>);
+struct class_135 { const volatile float & mem_fn(const volatile float &, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_135::mem_fn)>::signature_type, const volatile float &(const volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_135::mem_fn)>::result_type, const volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_135::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_135::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_135::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_135::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_135::mem_fn)>::arg0_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_135::mem_fn)>::arg_type<0>, const volatile float &>);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_135::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_135::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_135::mem_fn)>::class_type, class_135>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_135::mem_fn)>, const volatile float &(const volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_135::mem_fn)>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_135::mem_fn), 0>, const volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_135::mem_fn)>, type_list<const volatile float &>>);
+static_assert(callable_arity_v<decltype(&class_135::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_135::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_135::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_135::mem_fn)> == callable_traits<decltype(&class_135::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_135::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_135::mem_fn)>, class_135>);
+struct class_139 { const volatile float * & mem_fn(const volatile float * &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_139::mem_fn)>::signature_type, const volatile float * &(const volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_139::mem_fn)>::result_type, const volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_139::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_139::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_139::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_139::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_139::mem_fn)>::arg0_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_139::mem_fn)>::arg_type<0>, const volatile float * &>);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_139::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_139::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_139::mem_fn)>::class_type, class_139>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_139::mem_fn)>, const volatile float * &(const volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_139::mem_fn)>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_139::mem_fn), 0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_139::mem_fn)>, type_list<const volatile float * &>>);
+static_assert(callable_arity_v<decltype(&class_139::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_139::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_139::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_139::mem_fn)> == callable_traits<decltype(&class_139::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_139::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_139::mem_fn)>, class_139>);
+struct class_143 { const volatile float * const & mem_fn(const volatile float * const &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_143::mem_fn)>::signature_type, const volatile float * const &(const volatile float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_143::mem_fn)>::result_type, const volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_143::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_143::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_143::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_143::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_143::mem_fn)>::arg0_type, const volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_143::mem_fn)>::arg_type<0>, const volatile float * const &>);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_143::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_143::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_143::mem_fn)>::class_type, class_143>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_143::mem_fn)>, const volatile float * const &(const volatile float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_143::mem_fn)>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_143::mem_fn), 0>, const volatile float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_143::mem_fn)>, type_list<const volatile float * const &>>);
+static_assert(callable_arity_v<decltype(&class_143::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_143::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_143::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_143::mem_fn)> == callable_traits<decltype(&class_143::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_143::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_143::mem_fn)>, class_143>);
+struct class_147 { const volatile float * volatile & mem_fn(const volatile float * volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_147::mem_fn)>::signature_type, const volatile float * volatile &(const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_147::mem_fn)>::result_type, const volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_147::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_147::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_147::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_147::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_147::mem_fn)>::arg0_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_147::mem_fn)>::arg_type<0>, const volatile float * volatile &>);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_147::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_147::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_147::mem_fn)>::class_type, class_147>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_147::mem_fn)>, const volatile float * volatile &(const volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_147::mem_fn)>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_147::mem_fn), 0>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_147::mem_fn)>, type_list<const volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_147::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_147::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_147::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_147::mem_fn)> == callable_traits<decltype(&class_147::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_147::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_147::mem_fn)>, class_147>);
+struct class_151 { const volatile float * const volatile & mem_fn(const volatile float * const volatile &, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_151::mem_fn)>::signature_type, const volatile float * const volatile &(const volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_151::mem_fn)>::result_type, const volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_151::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_151::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_151::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_151::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_151::mem_fn)>::arg0_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_151::mem_fn)>::arg_type<0>, const volatile float * const volatile &>);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_151::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_151::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_151::mem_fn)>::class_type, class_151>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_151::mem_fn)>, const volatile float * const volatile &(const volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_151::mem_fn)>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_151::mem_fn), 0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_151::mem_fn)>, type_list<const volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_151::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_151::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_151::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_151::mem_fn)> == callable_traits<decltype(&class_151::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_151::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_151::mem_fn)>, class_151>);
+struct class_155 { const volatile float && mem_fn(const volatile float &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_155::mem_fn)>::signature_type, const volatile float &&(const volatile float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_155::mem_fn)>::result_type, const volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_155::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_155::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_155::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_155::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_155::mem_fn)>::arg0_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_155::mem_fn)>::arg_type<0>, const volatile float &&>);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_155::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_155::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_155::mem_fn)>::class_type, class_155>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_155::mem_fn)>, const volatile float &&(const volatile float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_155::mem_fn)>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_155::mem_fn), 0>, const volatile float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_155::mem_fn)>, type_list<const volatile float &&>>);
+static_assert(callable_arity_v<decltype(&class_155::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_155::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_155::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_155::mem_fn)> == callable_traits<decltype(&class_155::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_155::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_155::mem_fn)>, class_155>);
+struct class_159 { const volatile float * && mem_fn(const volatile float * &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_159::mem_fn)>::signature_type, const volatile float * &&(const volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_159::mem_fn)>::result_type, const volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_159::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_159::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_159::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_159::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_159::mem_fn)>::arg0_type, const volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_159::mem_fn)>::arg_type<0>, const volatile float * &&>);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_159::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_159::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_159::mem_fn)>::class_type, class_159>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_159::mem_fn)>, const volatile float * &&(const volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_159::mem_fn)>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_159::mem_fn), 0>, const volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_159::mem_fn)>, type_list<const volatile float * &&>>);
+static_assert(callable_arity_v<decltype(&class_159::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_159::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_159::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_159::mem_fn)> == callable_traits<decltype(&class_159::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_159::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_159::mem_fn)>, class_159>);
+struct class_163 { const volatile float * const && mem_fn(const volatile float * const &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_163::mem_fn)>::signature_type, const volatile float * const &&(const volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_163::mem_fn)>::result_type, const volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_163::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_163::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_163::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_163::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_163::mem_fn)>::arg0_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_163::mem_fn)>::arg_type<0>, const volatile float * const &&>);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_163::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_163::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_163::mem_fn)>::class_type, class_163>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_163::mem_fn)>, const volatile float * const &&(const volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_163::mem_fn)>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_163::mem_fn), 0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_163::mem_fn)>, type_list<const volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_163::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_163::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_163::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_163::mem_fn)> == callable_traits<decltype(&class_163::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_163::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_163::mem_fn)>, class_163>);
+struct class_167 { const volatile float * volatile && mem_fn(const volatile float * volatile &&, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_167::mem_fn)>::signature_type, const volatile float * volatile &&(const volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_167::mem_fn)>::result_type, const volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_167::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_167::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_167::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_167::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_167::mem_fn)>::arg0_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_167::mem_fn)>::arg_type<0>, const volatile float * volatile &&>);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_167::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_167::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_167::mem_fn)>::class_type, class_167>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_167::mem_fn)>, const volatile float * volatile &&(const volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_167::mem_fn)>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_167::mem_fn), 0>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_167::mem_fn)>, type_list<const volatile float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_167::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_167::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_167::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_167::mem_fn)> == callable_traits<decltype(&class_167::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_167::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_167::mem_fn)>, class_167>);
+struct class_171 { const volatile float * const volatile && mem_fn(const volatile float * const volatile &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_171::mem_fn)>::signature_type, const volatile float * const volatile &&(const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_171::mem_fn)>::result_type, const volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_171::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_171::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_171::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_171::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_171::mem_fn)>::arg0_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_171::mem_fn)>::arg_type<0>, const volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_171::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_171::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_171::mem_fn)>::class_type, class_171>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_171::mem_fn)>, const volatile float * const volatile &&(const volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_171::mem_fn)>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_171::mem_fn), 0>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_171::mem_fn)>, type_list<const volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_171::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_171::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_171::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_171::mem_fn)> == callable_traits<decltype(&class_171::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_171::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_171::mem_fn)>, class_171>);
+struct class_175 { volatile std::string * mem_fn(volatile std::string *, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_175::mem_fn)>::signature_type, volatile std::string *(volatile std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_175::mem_fn)>::result_type, volatile std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_175::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_175::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_175::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_175::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_175::mem_fn)>::arg0_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_175::mem_fn)>::arg_type<0>, volatile std::string *>);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_175::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_175::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_175::mem_fn)>::class_type, class_175>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_175::mem_fn)>, volatile std::string *(volatile std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_175::mem_fn)>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_175::mem_fn), 0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_175::mem_fn)>, type_list<volatile std::string *>>);
+static_assert(callable_arity_v<decltype(&class_175::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_175::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_175::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_175::mem_fn)> == callable_traits<decltype(&class_175::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_175::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_175::mem_fn)>, class_175>);
+struct class_179 { volatile std::string & mem_fn(volatile std::string &, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_179::mem_fn)>::signature_type, volatile std::string &(volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_179::mem_fn)>::result_type, volatile std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_179::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_179::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_179::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_179::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_179::mem_fn)>::arg0_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_179::mem_fn)>::arg_type<0>, volatile std::string &>);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_179::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_179::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_179::mem_fn)>::class_type, class_179>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_179::mem_fn)>, volatile std::string &(volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_179::mem_fn)>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_179::mem_fn), 0>, volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_179::mem_fn)>, type_list<volatile std::string &>>);
+static_assert(callable_arity_v<decltype(&class_179::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_179::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_179::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_179::mem_fn)> == callable_traits<decltype(&class_179::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_179::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_179::mem_fn)>, class_179>);
+struct class_183 { volatile std::string * & mem_fn(volatile std::string * &, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_183::mem_fn)>::signature_type, volatile std::string * &(volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_183::mem_fn)>::result_type, volatile std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_183::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_183::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_183::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_183::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_183::mem_fn)>::arg0_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_183::mem_fn)>::arg_type<0>, volatile std::string * &>);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_183::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_183::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_183::mem_fn)>::class_type, class_183>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_183::mem_fn)>, volatile std::string * &(volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_183::mem_fn)>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_183::mem_fn), 0>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_183::mem_fn)>, type_list<volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_183::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_183::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_183::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_183::mem_fn)> == callable_traits<decltype(&class_183::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_183::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_183::mem_fn)>, class_183>);
+struct class_187 { volatile std::string * const & mem_fn(volatile std::string * const &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_187::mem_fn)>::signature_type, volatile std::string * const &(volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_187::mem_fn)>::result_type, volatile std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_187::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_187::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_187::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_187::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_187::mem_fn)>::arg0_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_187::mem_fn)>::arg_type<0>, volatile std::string * const &>);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_187::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_187::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_187::mem_fn)>::class_type, class_187>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_187::mem_fn)>, volatile std::string * const &(volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_187::mem_fn)>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_187::mem_fn), 0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_187::mem_fn)>, type_list<volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_187::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_187::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_187::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_187::mem_fn)> == callable_traits<decltype(&class_187::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_187::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_187::mem_fn)>, class_187>);
+struct class_191 { volatile std::string * volatile & mem_fn(volatile std::string * volatile &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_191::mem_fn)>::signature_type, volatile std::string * volatile &(volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_191::mem_fn)>::result_type, volatile std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_191::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_191::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_191::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_191::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_191::mem_fn)>::arg0_type, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_191::mem_fn)>::arg_type<0>, volatile std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_191::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_191::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_191::mem_fn)>::class_type, class_191>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_191::mem_fn)>, volatile std::string * volatile &(volatile std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_191::mem_fn)>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_191::mem_fn), 0>, volatile std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_191::mem_fn)>, type_list<volatile std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_191::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_191::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_191::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_191::mem_fn)> == callable_traits<decltype(&class_191::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_191::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_191::mem_fn)>, class_191>);
+struct class_195 { volatile std::string * const volatile & mem_fn(volatile std::string * const volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_195::mem_fn)>::signature_type, volatile std::string * const volatile &(volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_195::mem_fn)>::result_type, volatile std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_195::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_195::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_195::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_195::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_195::mem_fn)>::arg0_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_195::mem_fn)>::arg_type<0>, volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_195::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_195::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_195::mem_fn)>::class_type, class_195>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_195::mem_fn)>, volatile std::string * const volatile &(volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_195::mem_fn)>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_195::mem_fn), 0>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_195::mem_fn)>, type_list<volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_195::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_195::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_195::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_195::mem_fn)> == callable_traits<decltype(&class_195::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_195::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_195::mem_fn)>, class_195>);
+struct class_199 { volatile std::string && mem_fn(volatile std::string &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_199::mem_fn)>::signature_type, volatile std::string &&(volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_199::mem_fn)>::result_type, volatile std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_199::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_199::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_199::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_199::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_199::mem_fn)>::arg0_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_199::mem_fn)>::arg_type<0>, volatile std::string &&>);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_199::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_199::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_199::mem_fn)>::class_type, class_199>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_199::mem_fn)>, volatile std::string &&(volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_199::mem_fn)>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_199::mem_fn), 0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_199::mem_fn)>, type_list<volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_199::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_199::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_199::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_199::mem_fn)> == callable_traits<decltype(&class_199::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_199::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_199::mem_fn)>, class_199>);
+struct class_203 { volatile std::string * && mem_fn(volatile std::string * &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_203::mem_fn)>::signature_type, volatile std::string * &&(volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_203::mem_fn)>::result_type, volatile std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_203::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_203::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_203::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_203::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_203::mem_fn)>::arg0_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_203::mem_fn)>::arg_type<0>, volatile std::string * &&>);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_203::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_203::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_203::mem_fn)>::class_type, class_203>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_203::mem_fn)>, volatile std::string * &&(volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_203::mem_fn)>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_203::mem_fn), 0>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_203::mem_fn)>, type_list<volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_203::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_203::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_203::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_203::mem_fn)> == callable_traits<decltype(&class_203::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_203::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_203::mem_fn)>, class_203>);
+struct class_207 { volatile std::string * const && mem_fn(volatile std::string * const &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_207::mem_fn)>::signature_type, volatile std::string * const &&(volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_207::mem_fn)>::result_type, volatile std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_207::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_207::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_207::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_207::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_207::mem_fn)>::arg0_type, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_207::mem_fn)>::arg_type<0>, volatile std::string * const &&>);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_207::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_207::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_207::mem_fn)>::class_type, class_207>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_207::mem_fn)>, volatile std::string * const &&(volatile std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_207::mem_fn)>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_207::mem_fn), 0>, volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_207::mem_fn)>, type_list<volatile std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_207::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_207::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_207::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_207::mem_fn)> == callable_traits<decltype(&class_207::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_207::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_207::mem_fn)>, class_207>);
+struct class_211 { volatile std::string * volatile && mem_fn(volatile std::string * volatile &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_211::mem_fn)>::signature_type, volatile std::string * volatile &&(volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_211::mem_fn)>::result_type, volatile std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_211::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_211::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_211::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_211::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_211::mem_fn)>::arg0_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_211::mem_fn)>::arg_type<0>, volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_211::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_211::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_211::mem_fn)>::class_type, class_211>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_211::mem_fn)>, volatile std::string * volatile &&(volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_211::mem_fn)>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_211::mem_fn), 0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_211::mem_fn)>, type_list<volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_211::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_211::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_211::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_211::mem_fn)> == callable_traits<decltype(&class_211::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_211::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_211::mem_fn)>, class_211>);
+struct class_215 { volatile std::string * const volatile && mem_fn(volatile std::string * const volatile &&, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_215::mem_fn)>::signature_type, volatile std::string * const volatile &&(volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_215::mem_fn)>::result_type, volatile std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_215::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_215::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_215::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_215::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_215::mem_fn)>::arg0_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_215::mem_fn)>::arg_type<0>, volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_215::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_215::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_215::mem_fn)>::class_type, class_215>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_215::mem_fn)>, volatile std::string * const volatile &&(volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_215::mem_fn)>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_215::mem_fn), 0>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_215::mem_fn)>, type_list<volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_215::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_215::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_215::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_215::mem_fn)> == callable_traits<decltype(&class_215::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_215::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_215::mem_fn)>, class_215>);
+struct class_219 { const void * mem_fn(void * &, const void * &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::signature_type, const void *(void * &, const void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::result_type, const void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_219::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_219::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_219::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_219::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::arg0_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::arg_type<0>, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::arg1_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::arg_type<1>, const void * &>);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_219::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_219::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_219::mem_fn)>::class_type, class_219>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_219::mem_fn)>, const void *(void * &, const void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_219::mem_fn)>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_219::mem_fn), 0>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_219::mem_fn), 1>, const void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_219::mem_fn)>, type_list<void * &, const void * &>>);
+static_assert(callable_arity_v<decltype(&class_219::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_219::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_219::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_219::mem_fn)> == callable_traits<decltype(&class_219::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_219::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_219::mem_fn)>, class_219>);
+struct class_223 { const void * & mem_fn(void * volatile &, const void * volatile &, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::signature_type, const void * &(void * volatile &, const void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::result_type, const void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_223::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_223::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_223::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_223::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::arg0_type, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::arg_type<0>, void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::arg1_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::arg_type<1>, const void * volatile &>);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_223::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_223::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_223::mem_fn)>::class_type, class_223>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_223::mem_fn)>, const void * &(void * volatile &, const void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_223::mem_fn)>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_223::mem_fn), 0>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_223::mem_fn), 1>, const void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_223::mem_fn)>, type_list<void * volatile &, const void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_223::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_223::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_223::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_223::mem_fn)> == callable_traits<decltype(&class_223::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_223::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_223::mem_fn)>, class_223>);
+struct class_227 { const void * const & mem_fn(void * &&, const void * &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::signature_type, const void * const &(void * &&, const void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::result_type, const void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_227::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_227::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_227::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_227::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::arg0_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::arg_type<0>, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::arg1_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::arg_type<1>, const void * &&>);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_227::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_227::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_227::mem_fn)>::class_type, class_227>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_227::mem_fn)>, const void * const &(void * &&, const void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_227::mem_fn)>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_227::mem_fn), 0>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_227::mem_fn), 1>, const void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_227::mem_fn)>, type_list<void * &&, const void * &&>>);
+static_assert(callable_arity_v<decltype(&class_227::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_227::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_227::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_227::mem_fn)> == callable_traits<decltype(&class_227::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_227::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_227::mem_fn)>, class_227>);
+struct class_231 { const void * volatile & mem_fn(void * volatile &&, const void * volatile &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::signature_type, const void * volatile &(void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::result_type, const void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_231::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_231::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_231::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_231::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::arg0_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::arg_type<0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::arg1_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::arg_type<1>, const void * volatile &&>);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_231::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_231::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_231::mem_fn)>::class_type, class_231>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_231::mem_fn)>, const void * volatile &(void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_231::mem_fn)>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_231::mem_fn), 0>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_231::mem_fn), 1>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_231::mem_fn)>, type_list<void * volatile &&, const void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_231::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_231::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_231::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_231::mem_fn)> == callable_traits<decltype(&class_231::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_231::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_231::mem_fn)>, class_231>);
+struct class_235 { const void * const volatile & mem_fn(bool, bool *, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::signature_type, const void * const volatile &(bool, bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::result_type, const void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_235::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_235::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_235::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_235::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::arg_type<0>, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::arg1_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::arg_type<1>, bool *>);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_235::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_235::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_235::mem_fn)>::class_type, class_235>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_235::mem_fn)>, const void * const volatile &(bool, bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_235::mem_fn)>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_235::mem_fn), 0>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_235::mem_fn), 1>, bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_235::mem_fn)>, type_list<bool, bool *>>);
+static_assert(callable_arity_v<decltype(&class_235::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_235::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_235::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_235::mem_fn)> == callable_traits<decltype(&class_235::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_235::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_235::mem_fn)>, class_235>);
+struct class_239 { const void * && mem_fn(const volatile bool &, bool * &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::signature_type, const void * &&(const volatile bool &, bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::result_type, const void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_239::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_239::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_239::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_239::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::arg0_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::arg_type<0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::arg1_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::arg_type<1>, bool * &>);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_239::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_239::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_239::mem_fn)>::class_type, class_239>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_239::mem_fn)>, const void * &&(const volatile bool &, bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_239::mem_fn)>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_239::mem_fn), 0>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_239::mem_fn), 1>, bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_239::mem_fn)>, type_list<const volatile bool &, bool * &>>);
+static_assert(callable_arity_v<decltype(&class_239::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_239::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_239::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_239::mem_fn)> == callable_traits<decltype(&class_239::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_239::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_239::mem_fn)>, class_239>);
+struct class_243 { const void * const && mem_fn(const volatile bool * const &, bool * volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::signature_type, const void * const &&(const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::result_type, const void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_243::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_243::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_243::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_243::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::arg0_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::arg_type<0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::arg1_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::arg_type<1>, bool * volatile &>);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_243::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_243::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_243::mem_fn)>::class_type, class_243>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_243::mem_fn)>, const void * const &&(const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_243::mem_fn)>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_243::mem_fn), 0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_243::mem_fn), 1>, bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_243::mem_fn)>, type_list<const volatile bool * const &, bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_243::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_243::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_243::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_243::mem_fn)> == callable_traits<decltype(&class_243::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_243::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_243::mem_fn)>, class_243>);
+struct class_247 { const void * volatile && mem_fn(const volatile bool * const volatile &, bool &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::signature_type, const void * volatile &&(const volatile bool * const volatile &, bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::result_type, const void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_247::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_247::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_247::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_247::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::arg0_type, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::arg_type<0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::arg1_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::arg_type<1>, bool &&>);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_247::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_247::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_247::mem_fn)>::class_type, class_247>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_247::mem_fn)>, const void * volatile &&(const volatile bool * const volatile &, bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_247::mem_fn)>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_247::mem_fn), 0>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_247::mem_fn), 1>, bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_247::mem_fn)>, type_list<const volatile bool * const volatile &, bool &&>>);
+static_assert(callable_arity_v<decltype(&class_247::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_247::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_247::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_247::mem_fn)> == callable_traits<decltype(&class_247::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_247::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_247::mem_fn)>, class_247>);
+struct class_251 { const void * const volatile && mem_fn(const volatile bool * &&, bool * const &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::signature_type, const void * const volatile &&(const volatile bool * &&, bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::result_type, const void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_251::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_251::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_251::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_251::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::arg0_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::arg_type<0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::arg1_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::arg_type<1>, bool * const &&>);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_251::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_251::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_251::mem_fn)>::class_type, class_251>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_251::mem_fn)>, const void * const volatile &&(const volatile bool * &&, bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_251::mem_fn)>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_251::mem_fn), 0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_251::mem_fn), 1>, bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_251::mem_fn)>, type_list<const volatile bool * &&, bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_251::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_251::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_251::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_251::mem_fn)> == callable_traits<decltype(&class_251::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_251::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_251::mem_fn)>, class_251>);
+struct class_255 { bool * mem_fn(const volatile bool * volatile &&, bool * const volatile &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::signature_type, bool *(const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::result_type, bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_255::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_255::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_255::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_255::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::arg0_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::arg_type<0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::arg1_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::arg_type<1>, bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_255::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_255::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_255::mem_fn)>::class_type, class_255>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_255::mem_fn)>, bool *(const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_255::mem_fn)>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_255::mem_fn), 0>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_255::mem_fn), 1>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_255::mem_fn)>, type_list<const volatile bool * volatile &&, bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_255::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_255::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_255::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_255::mem_fn)> == callable_traits<decltype(&class_255::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_255::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_255::mem_fn)>, class_255>);
+struct class_259 { bool & mem_fn(volatile int *, const volatile int *, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::signature_type, bool &(volatile int *, const volatile int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::result_type, bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_259::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_259::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_259::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_259::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::arg_type<0>, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::arg1_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::arg_type<1>, const volatile int *>);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_259::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_259::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_259::mem_fn)>::class_type, class_259>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_259::mem_fn)>, bool &(volatile int *, const volatile int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_259::mem_fn)>, bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_259::mem_fn), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_259::mem_fn), 1>, const volatile int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_259::mem_fn)>, type_list<volatile int *, const volatile int *>>);
+static_assert(callable_arity_v<decltype(&class_259::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_259::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_259::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_259::mem_fn)> == callable_traits<decltype(&class_259::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_259::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_259::mem_fn)>, class_259>);
+struct class_263 { bool * & mem_fn(volatile int * &, const volatile int * &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::signature_type, bool * &(volatile int * &, const volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::result_type, bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_263::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_263::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_263::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_263::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::arg0_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::arg_type<0>, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::arg1_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::arg_type<1>, const volatile int * &>);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_263::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_263::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_263::mem_fn)>::class_type, class_263>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_263::mem_fn)>, bool * &(volatile int * &, const volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_263::mem_fn)>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_263::mem_fn), 0>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_263::mem_fn), 1>, const volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_263::mem_fn)>, type_list<volatile int * &, const volatile int * &>>);
+static_assert(callable_arity_v<decltype(&class_263::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_263::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_263::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_263::mem_fn)> == callable_traits<decltype(&class_263::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_263::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_263::mem_fn)>, class_263>);
+struct class_267 { bool * const & mem_fn(volatile int * volatile &, const volatile int * volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::signature_type, bool * const &(volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::result_type, bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_267::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_267::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_267::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_267::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::arg0_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::arg_type<0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::arg1_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::arg_type<1>, const volatile int * volatile &>);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_267::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_267::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_267::mem_fn)>::class_type, class_267>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_267::mem_fn)>, bool * const &(volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_267::mem_fn)>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_267::mem_fn), 0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_267::mem_fn), 1>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_267::mem_fn)>, type_list<volatile int * volatile &, const volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_267::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_267::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_267::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_267::mem_fn)> == callable_traits<decltype(&class_267::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_267::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_267::mem_fn)>, class_267>);
+struct class_271 { bool * volatile & mem_fn(volatile int &&, const volatile int &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::signature_type, bool * volatile &(volatile int &&, const volatile int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::result_type, bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_271::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_271::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_271::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_271::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::arg0_type, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::arg_type<0>, volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::arg1_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::arg_type<1>, const volatile int &&>);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_271::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_271::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_271::mem_fn)>::class_type, class_271>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_271::mem_fn)>, bool * volatile &(volatile int &&, const volatile int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_271::mem_fn)>, bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_271::mem_fn), 0>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_271::mem_fn), 1>, const volatile int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_271::mem_fn)>, type_list<volatile int &&, const volatile int &&>>);
+static_assert(callable_arity_v<decltype(&class_271::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_271::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_271::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_271::mem_fn)> == callable_traits<decltype(&class_271::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_271::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_271::mem_fn)>, class_271>);
+struct class_275 { bool * const volatile & mem_fn(volatile int * const &&, const volatile int * const &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::signature_type, bool * const volatile &(volatile int * const &&, const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::result_type, bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_275::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_275::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_275::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_275::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::arg0_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::arg_type<0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::arg1_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::arg_type<1>, const volatile int * const &&>);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_275::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_275::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_275::mem_fn)>::class_type, class_275>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_275::mem_fn)>, bool * const volatile &(volatile int * const &&, const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_275::mem_fn)>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_275::mem_fn), 0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_275::mem_fn), 1>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_275::mem_fn)>, type_list<volatile int * const &&, const volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_275::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_275::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_275::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_275::mem_fn)> == callable_traits<decltype(&class_275::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_275::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_275::mem_fn)>, class_275>);
+struct class_279 { bool && mem_fn(volatile int * const volatile &&, const volatile int * const volatile &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::signature_type, bool &&(volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::result_type, bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_279::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_279::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_279::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_279::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::arg0_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::arg_type<0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::arg1_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::arg_type<1>, const volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_279::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_279::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_279::mem_fn)>::class_type, class_279>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_279::mem_fn)>, bool &&(volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_279::mem_fn)>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_279::mem_fn), 0>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_279::mem_fn), 1>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_279::mem_fn)>, type_list<volatile int * const volatile &&, const volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_279::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_279::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_279::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_279::mem_fn)> == callable_traits<decltype(&class_279::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_279::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_279::mem_fn)>, class_279>);
+struct class_283 { bool * && mem_fn(const float &, volatile float &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::signature_type, bool * &&(const float &, volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::result_type, bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_283::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_283::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_283::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_283::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::arg_type<0>, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::arg1_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::arg_type<1>, volatile float &>);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_283::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_283::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_283::mem_fn)>::class_type, class_283>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_283::mem_fn)>, bool * &&(const float &, volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_283::mem_fn)>, bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_283::mem_fn), 0>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_283::mem_fn), 1>, volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_283::mem_fn)>, type_list<const float &, volatile float &>>);
+static_assert(callable_arity_v<decltype(&class_283::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_283::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_283::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_283::mem_fn)> == callable_traits<decltype(&class_283::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_283::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_283::mem_fn)>, class_283>);
+struct class_287 { bool * const && mem_fn(const float * const &, volatile float * const &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::signature_type, bool * const &&(const float * const &, volatile float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::result_type, bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_287::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_287::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_287::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_287::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::arg0_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::arg_type<0>, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::arg1_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::arg_type<1>, volatile float * const &>);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_287::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_287::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_287::mem_fn)>::class_type, class_287>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_287::mem_fn)>, bool * const &&(const float * const &, volatile float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_287::mem_fn)>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_287::mem_fn), 0>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_287::mem_fn), 1>, volatile float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_287::mem_fn)>, type_list<const float * const &, volatile float * const &>>);
+static_assert(callable_arity_v<decltype(&class_287::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_287::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_287::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_287::mem_fn)> == callable_traits<decltype(&class_287::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_287::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_287::mem_fn)>, class_287>);
+struct class_291 { bool * volatile && mem_fn(const float * const volatile &, volatile float * const volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::signature_type, bool * volatile &&(const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::result_type, bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_291::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_291::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_291::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_291::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::arg0_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::arg_type<0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::arg1_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::arg_type<1>, volatile float * const volatile &>);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_291::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_291::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_291::mem_fn)>::class_type, class_291>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_291::mem_fn)>, bool * volatile &&(const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_291::mem_fn)>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_291::mem_fn), 0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_291::mem_fn), 1>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_291::mem_fn)>, type_list<const float * const volatile &, volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_291::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_291::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_291::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_291::mem_fn)> == callable_traits<decltype(&class_291::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_291::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_291::mem_fn)>, class_291>);
+struct class_295 { bool * const volatile && mem_fn(const float * &&, volatile float * &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::signature_type, bool * const volatile &&(const float * &&, volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::result_type, bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_295::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_295::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_295::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_295::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::arg0_type, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::arg_type<0>, const float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::arg1_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::arg_type<1>, volatile float * &&>);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_295::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_295::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_295::mem_fn)>::class_type, class_295>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_295::mem_fn)>, bool * const volatile &&(const float * &&, volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_295::mem_fn)>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_295::mem_fn), 0>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_295::mem_fn), 1>, volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_295::mem_fn)>, type_list<const float * &&, volatile float * &&>>);
+static_assert(callable_arity_v<decltype(&class_295::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_295::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_295::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_295::mem_fn)> == callable_traits<decltype(&class_295::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_295::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_295::mem_fn)>, class_295>);
+struct class_299 { int mem_fn(const float * volatile &&, volatile float * volatile &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::signature_type, int(const float * volatile &&, volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::result_type, int>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_299::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_299::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_299::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_299::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::arg0_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::arg_type<0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::arg1_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::arg_type<1>, volatile float * volatile &&>);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_299::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_299::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_299::mem_fn)>::class_type, class_299>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_299::mem_fn)>, int(const float * volatile &&, volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_299::mem_fn)>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_299::mem_fn), 0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_299::mem_fn), 1>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_299::mem_fn)>, type_list<const float * volatile &&, volatile float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_299::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_299::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_299::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_299::mem_fn)> == callable_traits<decltype(&class_299::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_299::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_299::mem_fn)>, class_299>);
+struct class_303 { const volatile int * mem_fn(std::string *, const std::string *, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::signature_type, const volatile int *(std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::result_type, const volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_303::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_303::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_303::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_303::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::arg0_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::arg_type<0>, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::arg1_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::arg_type<1>, const std::string *>);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_303::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_303::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_303::mem_fn)>::class_type, class_303>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_303::mem_fn)>, const volatile int *(std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_303::mem_fn)>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_303::mem_fn), 0>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_303::mem_fn), 1>, const std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_303::mem_fn)>, type_list<std::string *, const std::string *>>);
+static_assert(callable_arity_v<decltype(&class_303::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_303::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_303::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_303::mem_fn)> == callable_traits<decltype(&class_303::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_303::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_303::mem_fn)>, class_303>);
+struct class_307 { const volatile int & mem_fn(std::string * &, const std::string * &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::signature_type, const volatile int &(std::string * &, const std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::result_type, const volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_307::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_307::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_307::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_307::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::arg_type<0>, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::arg1_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::arg_type<1>, const std::string * &>);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_307::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_307::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_307::mem_fn)>::class_type, class_307>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_307::mem_fn)>, const volatile int &(std::string * &, const std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_307::mem_fn)>, const volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_307::mem_fn), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_307::mem_fn), 1>, const std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_307::mem_fn)>, type_list<std::string * &, const std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_307::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_307::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_307::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_307::mem_fn)> == callable_traits<decltype(&class_307::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_307::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_307::mem_fn)>, class_307>);
+struct class_311 { const volatile int * & mem_fn(std::string * volatile &, const std::string * volatile &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::signature_type, const volatile int * &(std::string * volatile &, const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::result_type, const volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_311::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_311::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_311::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_311::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::arg0_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::arg_type<0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::arg1_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::arg_type<1>, const std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_311::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_311::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_311::mem_fn)>::class_type, class_311>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_311::mem_fn)>, const volatile int * &(std::string * volatile &, const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_311::mem_fn)>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_311::mem_fn), 0>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_311::mem_fn), 1>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_311::mem_fn)>, type_list<std::string * volatile &, const std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_311::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_311::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_311::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_311::mem_fn)> == callable_traits<decltype(&class_311::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_311::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_311::mem_fn)>, class_311>);
+struct class_315 { const volatile int * const & mem_fn(std::string &&, const std::string &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::signature_type, const volatile int * const &(std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::result_type, const volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_315::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_315::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_315::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_315::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::arg0_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::arg_type<0>, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::arg1_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::arg_type<1>, const std::string &&>);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_315::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_315::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_315::mem_fn)>::class_type, class_315>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_315::mem_fn)>, const volatile int * const &(std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_315::mem_fn)>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_315::mem_fn), 0>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_315::mem_fn), 1>, const std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_315::mem_fn)>, type_list<std::string &&, const std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_315::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_315::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_315::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_315::mem_fn)> == callable_traits<decltype(&class_315::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_315::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_315::mem_fn)>, class_315>);
+struct class_319 { const volatile int * volatile & mem_fn(std::string * const &&, const std::string * const &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::signature_type, const volatile int * volatile &(std::string * const &&, const std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::result_type, const volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_319::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_319::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_319::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_319::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::arg0_type, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::arg_type<0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::arg1_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::arg_type<1>, const std::string * const &&>);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_319::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_319::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_319::mem_fn)>::class_type, class_319>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_319::mem_fn)>, const volatile int * volatile &(std::string * const &&, const std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_319::mem_fn)>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_319::mem_fn), 0>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_319::mem_fn), 1>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_319::mem_fn)>, type_list<std::string * const &&, const std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_319::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_319::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_319::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_319::mem_fn)> == callable_traits<decltype(&class_319::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_319::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_319::mem_fn)>, class_319>);
+struct class_323 { const volatile int * const volatile & mem_fn(std::string * const volatile &&, const std::string * const volatile &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::signature_type, const volatile int * const volatile &(std::string * const volatile &&, const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::result_type, const volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_323::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_323::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_323::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_323::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::arg0_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::arg_type<0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::arg1_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::arg_type<1>, const std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_323::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_323::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_323::mem_fn)>::class_type, class_323>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_323::mem_fn)>, const volatile int * const volatile &(std::string * const volatile &&, const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_323::mem_fn)>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_323::mem_fn), 0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_323::mem_fn), 1>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_323::mem_fn)>, type_list<std::string * const volatile &&, const std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_323::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_323::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_323::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_323::mem_fn)> == callable_traits<decltype(&class_323::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_323::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_323::mem_fn)>, class_323>);
+struct class_327 { const volatile int && mem_fn(volatile void * &, const volatile void * &, void * const &, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::signature_type, const volatile int &&(volatile void * &, const volatile void * &, void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::result_type, const volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_327::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_327::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_327::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_327::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::arg0_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::arg_type<0>, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::arg1_type, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::arg_type<1>, const volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::arg2_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::arg_type<2>, void * const &>);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_327::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_327::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_327::mem_fn)>::class_type, class_327>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_327::mem_fn)>, const volatile int &&(volatile void * &, const volatile void * &, void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_327::mem_fn)>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_327::mem_fn), 0>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_327::mem_fn), 1>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_327::mem_fn), 2>, void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_327::mem_fn)>, type_list<volatile void * &, const volatile void * &, void * const &>>);
+static_assert(callable_arity_v<decltype(&class_327::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_327::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_327::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_327::mem_fn)> == callable_traits<decltype(&class_327::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_327::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_327::mem_fn)>, class_327>);
+struct class_331 { const volatile int * && mem_fn(volatile void * const volatile &, const volatile void * const volatile &, void * &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::signature_type, const volatile int * &&(volatile void * const volatile &, const volatile void * const volatile &, void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::result_type, const volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_331::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_331::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_331::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_331::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::arg0_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::arg_type<0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::arg1_type, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::arg_type<1>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::arg2_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::arg_type<2>, void * &&>);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_331::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_331::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_331::mem_fn)>::class_type, class_331>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_331::mem_fn)>, const volatile int * &&(volatile void * const volatile &, const volatile void * const volatile &, void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_331::mem_fn)>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_331::mem_fn), 0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_331::mem_fn), 1>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_331::mem_fn), 2>, void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_331::mem_fn)>, type_list<volatile void * const volatile &, const volatile void * const volatile &, void * &&>>);
+static_assert(callable_arity_v<decltype(&class_331::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_331::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_331::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_331::mem_fn)> == callable_traits<decltype(&class_331::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_331::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_331::mem_fn)>, class_331>);
+struct class_335 { const volatile int * const && mem_fn(volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::signature_type, const volatile int * const &&(volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::result_type, const volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_335::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_335::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_335::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_335::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::arg0_type, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::arg_type<0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::arg1_type, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::arg_type<1>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::arg2_type, void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::arg_type<2>, void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_335::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_335::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_335::mem_fn)>::class_type, class_335>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_335::mem_fn)>, const volatile int * const &&(volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_335::mem_fn)>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_335::mem_fn), 0>, volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_335::mem_fn), 1>, const volatile void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_335::mem_fn), 2>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_335::mem_fn)>, type_list<volatile void * volatile &&, const volatile void * volatile &&, void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_335::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_335::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_335::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_335::mem_fn)> == callable_traits<decltype(&class_335::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_335::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_335::mem_fn)>, class_335>);
+struct class_339 { const volatile int * volatile && mem_fn(const bool &, volatile bool &, const volatile bool &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::signature_type, const volatile int * volatile &&(const bool &, volatile bool &, const volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::result_type, const volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_339::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_339::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_339::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_339::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::arg0_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::arg_type<0>, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::arg1_type, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::arg_type<1>, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::arg2_type, const volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::arg_type<2>, const volatile bool &>);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_339::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_339::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_339::mem_fn)>::class_type, class_339>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_339::mem_fn)>, const volatile int * volatile &&(const bool &, volatile bool &, const volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_339::mem_fn)>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_339::mem_fn), 0>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_339::mem_fn), 1>, volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_339::mem_fn), 2>, const volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_339::mem_fn)>, type_list<const bool &, volatile bool &, const volatile bool &>>);
+static_assert(callable_arity_v<decltype(&class_339::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_339::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_339::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_339::mem_fn)> == callable_traits<decltype(&class_339::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_339::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_339::mem_fn)>, class_339>);
+struct class_343 { const volatile int * const volatile && mem_fn(const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::signature_type, const volatile int * const volatile &&(const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::result_type, const volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_343::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_343::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_343::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_343::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::arg0_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::arg_type<0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::arg1_type, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::arg_type<1>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::arg2_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::arg_type<2>, const volatile bool * volatile &>);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_343::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_343::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_343::mem_fn)>::class_type, class_343>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_343::mem_fn)>, const volatile int * const volatile &&(const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_343::mem_fn)>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_343::mem_fn), 0>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_343::mem_fn), 1>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_343::mem_fn), 2>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_343::mem_fn)>, type_list<const bool * volatile &, volatile bool * volatile &, const volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_343::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_343::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_343::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_343::mem_fn)> == callable_traits<decltype(&class_343::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_343::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_343::mem_fn)>, class_343>);
+struct class_347 { volatile float * mem_fn(const bool * &&, volatile bool * &&, const volatile bool * &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::signature_type, volatile float *(const bool * &&, volatile bool * &&, const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::result_type, volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_347::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_347::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_347::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_347::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::arg0_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::arg_type<0>, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::arg1_type, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::arg_type<1>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::arg2_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::arg_type<2>, const volatile bool * &&>);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_347::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_347::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_347::mem_fn)>::class_type, class_347>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_347::mem_fn)>, volatile float *(const bool * &&, volatile bool * &&, const volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_347::mem_fn)>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_347::mem_fn), 0>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_347::mem_fn), 1>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_347::mem_fn), 2>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_347::mem_fn)>, type_list<const bool * &&, volatile bool * &&, const volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_347::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_347::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_347::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_347::mem_fn)> == callable_traits<decltype(&class_347::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_347::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_347::mem_fn)>, class_347>);
+struct class_351 { volatile float & mem_fn(const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::signature_type, volatile float &(const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::result_type, volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_351::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_351::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_351::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_351::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::arg0_type, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::arg_type<0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::arg1_type, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::arg_type<1>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::arg2_type, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::arg_type<2>, const volatile bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_351::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_351::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_351::mem_fn)>::class_type, class_351>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_351::mem_fn)>, volatile float &(const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_351::mem_fn)>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_351::mem_fn), 0>, const bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_351::mem_fn), 1>, volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_351::mem_fn), 2>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_351::mem_fn)>, type_list<const bool * const volatile &&, volatile bool * const volatile &&, const volatile bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_351::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_351::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_351::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_351::mem_fn)> == callable_traits<decltype(&class_351::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_351::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_351::mem_fn)>, class_351>);
+struct class_355 { volatile float * & mem_fn(int * &, const int * &, volatile int * &, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::signature_type, volatile float * &(int * &, const int * &, volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::result_type, volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_355::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_355::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_355::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_355::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::arg0_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::arg_type<0>, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::arg1_type, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::arg_type<1>, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::arg2_type, volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::arg_type<2>, volatile int * &>);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_355::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_355::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_355::mem_fn)>::class_type, class_355>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_355::mem_fn)>, volatile float * &(int * &, const int * &, volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_355::mem_fn)>, volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_355::mem_fn), 0>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_355::mem_fn), 1>, const int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_355::mem_fn), 2>, volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_355::mem_fn)>, type_list<int * &, const int * &, volatile int * &>>);
+static_assert(callable_arity_v<decltype(&class_355::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_355::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_355::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_355::mem_fn)> == callable_traits<decltype(&class_355::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_355::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_355::mem_fn)>, class_355>);
+struct class_359 { volatile float * const & mem_fn(int * const volatile &, const int * const volatile &, volatile int * const volatile &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::signature_type, volatile float * const &(int * const volatile &, const int * const volatile &, volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::result_type, volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_359::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_359::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_359::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_359::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::arg0_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::arg_type<0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::arg1_type, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::arg_type<1>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::arg2_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::arg_type<2>, volatile int * const volatile &>);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_359::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_359::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_359::mem_fn)>::class_type, class_359>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_359::mem_fn)>, volatile float * const &(int * const volatile &, const int * const volatile &, volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_359::mem_fn)>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_359::mem_fn), 0>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_359::mem_fn), 1>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_359::mem_fn), 2>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_359::mem_fn)>, type_list<int * const volatile &, const int * const volatile &, volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_359::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_359::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_359::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_359::mem_fn)> == callable_traits<decltype(&class_359::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_359::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_359::mem_fn)>, class_359>);
+struct class_363 { volatile float * volatile & mem_fn(int * const &&, const int * const &&, volatile int * const &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::signature_type, volatile float * volatile &(int * const &&, const int * const &&, volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::result_type, volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_363::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_363::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_363::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_363::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::arg0_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::arg_type<0>, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::arg1_type, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::arg_type<1>, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::arg2_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::arg_type<2>, volatile int * const &&>);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_363::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_363::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_363::mem_fn)>::class_type, class_363>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_363::mem_fn)>, volatile float * volatile &(int * const &&, const int * const &&, volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_363::mem_fn)>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_363::mem_fn), 0>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_363::mem_fn), 1>, const int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_363::mem_fn), 2>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_363::mem_fn)>, type_list<int * const &&, const int * const &&, volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_363::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_363::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_363::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_363::mem_fn)> == callable_traits<decltype(&class_363::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_363::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_363::mem_fn)>, class_363>);
+struct class_367 { volatile float * const volatile & mem_fn(float, float *, const float *, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::signature_type, volatile float * const volatile &(float, float *, const float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::result_type, volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_367::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_367::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_367::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_367::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::arg0_type, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::arg_type<0>, float>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::arg1_type, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::arg_type<1>, float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::arg2_type, const float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::arg_type<2>, const float *>);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_367::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_367::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_367::mem_fn)>::class_type, class_367>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_367::mem_fn)>, volatile float * const volatile &(float, float *, const float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_367::mem_fn)>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_367::mem_fn), 0>, float>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_367::mem_fn), 1>, float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_367::mem_fn), 2>, const float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_367::mem_fn)>, type_list<float, float *, const float *>>);
+static_assert(callable_arity_v<decltype(&class_367::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_367::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_367::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_367::mem_fn)> == callable_traits<decltype(&class_367::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_367::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_367::mem_fn)>, class_367>);
+struct class_371 { volatile float && mem_fn(const volatile float * &, float * const &, const float * const &, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::signature_type, volatile float &&(const volatile float * &, float * const &, const float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::result_type, volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_371::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_371::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_371::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_371::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::arg0_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::arg_type<0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::arg1_type, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::arg_type<1>, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::arg2_type, const float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::arg_type<2>, const float * const &>);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_371::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_371::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_371::mem_fn)>::class_type, class_371>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_371::mem_fn)>, volatile float &&(const volatile float * &, float * const &, const float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_371::mem_fn)>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_371::mem_fn), 0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_371::mem_fn), 1>, float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_371::mem_fn), 2>, const float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_371::mem_fn)>, type_list<const volatile float * &, float * const &, const float * const &>>);
+static_assert(callable_arity_v<decltype(&class_371::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_371::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_371::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_371::mem_fn)> == callable_traits<decltype(&class_371::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_371::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_371::mem_fn)>, class_371>);
+struct class_375 { volatile float * && mem_fn(const volatile float * const volatile &, float &&, const float &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::signature_type, volatile float * &&(const volatile float * const volatile &, float &&, const float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::result_type, volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_375::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_375::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_375::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_375::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::arg0_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::arg_type<0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::arg1_type, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::arg_type<1>, float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::arg2_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::arg_type<2>, const float &&>);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_375::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_375::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_375::mem_fn)>::class_type, class_375>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_375::mem_fn)>, volatile float * &&(const volatile float * const volatile &, float &&, const float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_375::mem_fn)>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_375::mem_fn), 0>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_375::mem_fn), 1>, float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_375::mem_fn), 2>, const float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_375::mem_fn)>, type_list<const volatile float * const volatile &, float &&, const float &&>>);
+static_assert(callable_arity_v<decltype(&class_375::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_375::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_375::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_375::mem_fn)> == callable_traits<decltype(&class_375::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_375::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_375::mem_fn)>, class_375>);
+struct class_379 { volatile float * const && mem_fn(const volatile float * const &&, float * volatile &&, const float * volatile &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::signature_type, volatile float * const &&(const volatile float * const &&, float * volatile &&, const float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::result_type, volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_379::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_379::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_379::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_379::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::arg0_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::arg_type<0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::arg1_type, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::arg_type<1>, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::arg2_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::arg_type<2>, const float * volatile &&>);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_379::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_379::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_379::mem_fn)>::class_type, class_379>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_379::mem_fn)>, volatile float * const &&(const volatile float * const &&, float * volatile &&, const float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_379::mem_fn)>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_379::mem_fn), 0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_379::mem_fn), 1>, float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_379::mem_fn), 2>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_379::mem_fn)>, type_list<const volatile float * const &&, float * volatile &&, const float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_379::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_379::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_379::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_379::mem_fn)> == callable_traits<decltype(&class_379::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_379::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_379::mem_fn)>, class_379>);
+struct class_383 { volatile float * volatile && mem_fn(volatile std::string *, const volatile std::string *, std::string &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::signature_type, volatile float * volatile &&(volatile std::string *, const volatile std::string *, std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::result_type, volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_383::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_383::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_383::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_383::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::arg0_type, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::arg_type<0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::arg1_type, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::arg_type<1>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::arg2_type, std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::arg_type<2>, std::string &>);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_383::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_383::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_383::mem_fn)>::class_type, class_383>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_383::mem_fn)>, volatile float * volatile &&(volatile std::string *, const volatile std::string *, std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_383::mem_fn)>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_383::mem_fn), 0>, volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_383::mem_fn), 1>, const volatile std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_383::mem_fn), 2>, std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_383::mem_fn)>, type_list<volatile std::string *, const volatile std::string *, std::string &>>);
+static_assert(callable_arity_v<decltype(&class_383::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_383::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_383::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_383::mem_fn)> == callable_traits<decltype(&class_383::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_383::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_383::mem_fn)>, class_383>);
+struct class_387 { volatile float * const volatile && mem_fn(volatile std::string * const &, const volatile std::string * const &, std::string * volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::signature_type, volatile float * const volatile &&(volatile std::string * const &, const volatile std::string * const &, std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::result_type, volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_387::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_387::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_387::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_387::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::arg0_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::arg_type<0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::arg1_type, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::arg_type<1>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::arg2_type, std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::arg_type<2>, std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_387::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_387::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_387::mem_fn)>::class_type, class_387>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_387::mem_fn)>, volatile float * const volatile &&(volatile std::string * const &, const volatile std::string * const &, std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_387::mem_fn)>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_387::mem_fn), 0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_387::mem_fn), 1>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_387::mem_fn), 2>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_387::mem_fn)>, type_list<volatile std::string * const &, const volatile std::string * const &, std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_387::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_387::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_387::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_387::mem_fn)> == callable_traits<decltype(&class_387::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_387::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_387::mem_fn)>, class_387>);
+struct class_391 { const std::string * mem_fn(volatile std::string &&, const volatile std::string &&, std::string * &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::signature_type, const std::string *(volatile std::string &&, const volatile std::string &&, std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::result_type, const std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_391::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_391::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_391::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_391::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::arg0_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::arg_type<0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::arg1_type, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::arg_type<1>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::arg2_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::arg_type<2>, std::string * &&>);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_391::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_391::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_391::mem_fn)>::class_type, class_391>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_391::mem_fn)>, const std::string *(volatile std::string &&, const volatile std::string &&, std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_391::mem_fn)>, const std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_391::mem_fn), 0>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_391::mem_fn), 1>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_391::mem_fn), 2>, std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_391::mem_fn)>, type_list<volatile std::string &&, const volatile std::string &&, std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_391::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_391::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_391::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_391::mem_fn)> == callable_traits<decltype(&class_391::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_391::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_391::mem_fn)>, class_391>);
+struct class_395 { const std::string & mem_fn(volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::signature_type, const std::string &(volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::result_type, const std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_395::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_395::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_395::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_395::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::arg0_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::arg_type<0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::arg1_type, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::arg_type<1>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::arg2_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::arg_type<2>, std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_395::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_395::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_395::mem_fn)>::class_type, class_395>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_395::mem_fn)>, const std::string &(volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_395::mem_fn)>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_395::mem_fn), 0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_395::mem_fn), 1>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_395::mem_fn), 2>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_395::mem_fn)>, type_list<volatile std::string * volatile &&, const volatile std::string * volatile &&, std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_395::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_395::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_395::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_395::mem_fn)> == callable_traits<decltype(&class_395::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_395::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_395::mem_fn)>, class_395>);
+struct class_399 { const std::string * & mem_fn(void * const &, const void * const &, volatile void * const &, const volatile void * const &, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::signature_type, const std::string * &(void * const &, const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::result_type, const std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_399::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_399::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_399::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_399::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg0_type, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg_type<0>, void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg1_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg_type<1>, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg2_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg_type<2>, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::arg_type<3>, const volatile void * const &>);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_399::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_399::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_399::mem_fn)>::class_type, class_399>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_399::mem_fn)>, const std::string * &(void * const &, const void * const &, volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_399::mem_fn)>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_399::mem_fn), 0>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_399::mem_fn), 1>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_399::mem_fn), 2>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_399::mem_fn), 3>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_399::mem_fn)>, type_list<void * const &, const void * const &, volatile void * const &, const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(&class_399::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_399::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_399::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_399::mem_fn)> == callable_traits<decltype(&class_399::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_399::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_399::mem_fn)>, class_399>);
+struct class_403 { const std::string * const & mem_fn(void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::signature_type, const std::string * const &(void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::result_type, const std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_403::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_403::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_403::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_403::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg0_type, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg_type<0>, void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg1_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg_type<1>, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg2_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg_type<2>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::arg_type<3>, const volatile void * const &&>);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_403::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_403::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_403::mem_fn)>::class_type, class_403>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_403::mem_fn)>, const std::string * const &(void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_403::mem_fn)>, const std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_403::mem_fn), 0>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_403::mem_fn), 1>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_403::mem_fn), 2>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_403::mem_fn), 3>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_403::mem_fn)>, type_list<void * const &&, const void * const &&, volatile void * const &&, const volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_403::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_403::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_403::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_403::mem_fn)> == callable_traits<decltype(&class_403::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_403::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_403::mem_fn)>, class_403>);
+struct class_407 { const std::string * volatile & mem_fn(const volatile bool *, bool &, const bool &, volatile bool &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::signature_type, const std::string * volatile &(const volatile bool *, bool &, const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::result_type, const std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_407::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_407::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_407::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_407::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg0_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg_type<0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg1_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg_type<1>, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg2_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg_type<2>, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::arg_type<3>, volatile bool &>);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_407::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_407::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_407::mem_fn)>::class_type, class_407>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_407::mem_fn)>, const std::string * volatile &(const volatile bool *, bool &, const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_407::mem_fn)>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_407::mem_fn), 0>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_407::mem_fn), 1>, bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_407::mem_fn), 2>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_407::mem_fn), 3>, volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_407::mem_fn)>, type_list<const volatile bool *, bool &, const bool &, volatile bool &>>);
+static_assert(callable_arity_v<decltype(&class_407::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_407::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_407::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_407::mem_fn)> == callable_traits<decltype(&class_407::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_407::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_407::mem_fn)>, class_407>);
+struct class_411 { const std::string * const volatile & mem_fn(const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::signature_type, const std::string * const volatile &(const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::result_type, const std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_411::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_411::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_411::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_411::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg0_type, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg_type<0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg1_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg_type<1>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg2_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg_type<2>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::arg_type<3>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_411::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_411::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_411::mem_fn)>::class_type, class_411>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_411::mem_fn)>, const std::string * const volatile &(const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_411::mem_fn)>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_411::mem_fn), 0>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_411::mem_fn), 1>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_411::mem_fn), 2>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_411::mem_fn), 3>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_411::mem_fn)>, type_list<const volatile bool * volatile &, bool * const volatile &, const bool * const volatile &, volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_411::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_411::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_411::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_411::mem_fn)> == callable_traits<decltype(&class_411::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_411::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_411::mem_fn)>, class_411>);
+struct class_415 { const std::string && mem_fn(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::signature_type, const std::string &&(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::result_type, const std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_415::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_415::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_415::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_415::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg0_type, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg_type<0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg1_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg_type<1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg2_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg_type<2>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::arg_type<3>, volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_415::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_415::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_415::mem_fn)>::class_type, class_415>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_415::mem_fn)>, const std::string &&(const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_415::mem_fn)>, const std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_415::mem_fn), 0>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_415::mem_fn), 1>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_415::mem_fn), 2>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_415::mem_fn), 3>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_415::mem_fn)>, type_list<const volatile bool * const &&, bool * volatile &&, const bool * volatile &&, volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_415::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_415::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_415::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_415::mem_fn)> == callable_traits<decltype(&class_415::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_415::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_415::mem_fn)>, class_415>);
+struct class_419 { const std::string * && mem_fn(volatile int &, const volatile int &, int * &, const int * &, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::signature_type, const std::string * &&(volatile int &, const volatile int &, int * &, const int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::result_type, const std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_419::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_419::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_419::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_419::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg0_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg_type<0>, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg1_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg_type<1>, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg2_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg_type<2>, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::arg_type<3>, const int * &>);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_419::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_419::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_419::mem_fn)>::class_type, class_419>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_419::mem_fn)>, const std::string * &&(volatile int &, const volatile int &, int * &, const int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_419::mem_fn)>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_419::mem_fn), 0>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_419::mem_fn), 1>, const volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_419::mem_fn), 2>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_419::mem_fn), 3>, const int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_419::mem_fn)>, type_list<volatile int &, const volatile int &, int * &, const int * &>>);
+static_assert(callable_arity_v<decltype(&class_419::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_419::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_419::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_419::mem_fn)> == callable_traits<decltype(&class_419::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_419::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_419::mem_fn)>, class_419>);
+struct class_423 { const std::string * const && mem_fn(volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::signature_type, const std::string * const &&(volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::result_type, const std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_423::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_423::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_423::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_423::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg0_type, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg_type<0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg1_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg_type<1>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg2_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg_type<2>, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::arg_type<3>, const int &&>);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_423::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_423::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_423::mem_fn)>::class_type, class_423>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_423::mem_fn)>, const std::string * const &&(volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_423::mem_fn)>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_423::mem_fn), 0>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_423::mem_fn), 1>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_423::mem_fn), 2>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_423::mem_fn), 3>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_423::mem_fn)>, type_list<volatile int * const volatile &, const volatile int * const volatile &, int &&, const int &&>>);
+static_assert(callable_arity_v<decltype(&class_423::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_423::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_423::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_423::mem_fn)> == callable_traits<decltype(&class_423::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_423::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_423::mem_fn)>, class_423>);
+struct class_427 { const std::string * volatile && mem_fn(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&, ...) const volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::signature_type, const std::string * volatile &&(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::result_type, const std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_427::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_427::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_427::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_427::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg0_type, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg_type<0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg1_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg_type<1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg2_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg_type<2>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::arg_type<3>, const int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_427::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_427::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_427::mem_fn)>::class_type, class_427>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_427::mem_fn)>, const std::string * volatile &&(volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_427::mem_fn)>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_427::mem_fn), 0>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_427::mem_fn), 1>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_427::mem_fn), 2>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_427::mem_fn), 3>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_427::mem_fn)>, type_list<volatile int * volatile &&, const volatile int * volatile &&, int * const volatile &&, const int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_427::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_427::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_427::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_427::mem_fn)> == callable_traits<decltype(&class_427::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_427::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_427::mem_fn)>, class_427>);
+struct class_431 { const std::string * const volatile && mem_fn(const float * &, volatile float * &, const volatile float * &, float * const &, ...) const volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::signature_type, const std::string * const volatile &&(const float * &, volatile float * &, const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::result_type, const std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_431::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_431::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_431::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_431::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg0_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg_type<0>, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg1_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg_type<1>, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg2_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg_type<2>, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::arg_type<3>, float * const &>);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_431::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_431::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_431::mem_fn)>::class_type, class_431>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_431::mem_fn)>, const std::string * const volatile &&(const float * &, volatile float * &, const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_431::mem_fn)>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_431::mem_fn), 0>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_431::mem_fn), 1>, volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_431::mem_fn), 2>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_431::mem_fn), 3>, float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_431::mem_fn)>, type_list<const float * &, volatile float * &, const volatile float * &, float * const &>>);
+static_assert(callable_arity_v<decltype(&class_431::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_431::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_431::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_431::mem_fn)> == callable_traits<decltype(&class_431::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_431::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_431::mem_fn)>, class_431>);
+struct class_435 { void * mem_fn(const float &&, volatile float &&, const volatile float &&, float * &&, ...) const volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::signature_type, void *(const float &&, volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::result_type, void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_435::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_435::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_435::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_435::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg0_type, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg_type<0>, const float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg1_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg_type<1>, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg2_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg_type<2>, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::arg_type<3>, float * &&>);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_435::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_435::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_435::mem_fn)>::class_type, class_435>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_435::mem_fn)>, void *(const float &&, volatile float &&, const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_435::mem_fn)>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_435::mem_fn), 0>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_435::mem_fn), 1>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_435::mem_fn), 2>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_435::mem_fn), 3>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_435::mem_fn)>, type_list<const float &&, volatile float &&, const volatile float &&, float * &&>>);
+static_assert(callable_arity_v<decltype(&class_435::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_435::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_435::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_435::mem_fn)> == callable_traits<decltype(&class_435::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_435::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_435::mem_fn)>, class_435>);
+struct class_439 { void * & mem_fn(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string, ...) const volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::signature_type, void * &(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::result_type, void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_439::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_439::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_439::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_439::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg0_type, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg_type<0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg1_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg_type<1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg2_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg_type<2>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::arg_type<3>, std::string>);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_439::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_439::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_439::mem_fn)>::class_type, class_439>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_439::mem_fn)>, void * &(const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_439::mem_fn)>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_439::mem_fn), 0>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_439::mem_fn), 1>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_439::mem_fn), 2>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_439::mem_fn), 3>, std::string>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_439::mem_fn)>, type_list<const float * const volatile &&, volatile float * const volatile &&, const volatile float * const volatile &&, std::string>>);
+static_assert(callable_arity_v<decltype(&class_439::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_439::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_439::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_439::mem_fn)> == callable_traits<decltype(&class_439::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_439::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_439::mem_fn)>, class_439>);
+struct class_443 { void * const & mem_fn(std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &, ...) const volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::signature_type, void * const &(std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::result_type, void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_443::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_443::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_443::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_443::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg0_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg_type<0>, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg1_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg_type<1>, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg2_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg_type<2>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::arg_type<3>, const volatile std::string * const &>);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_443::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_443::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_443::mem_fn)>::class_type, class_443>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_443::mem_fn)>, void * const &(std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_443::mem_fn)>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_443::mem_fn), 0>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_443::mem_fn), 1>, const std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_443::mem_fn), 2>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_443::mem_fn), 3>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_443::mem_fn)>, type_list<std::string * const &, const std::string * const &, volatile std::string * const &, const volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_443::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_443::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_443::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_443::mem_fn)> == callable_traits<decltype(&class_443::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_443::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_443::mem_fn)>, class_443>);
+struct class_447 { void * volatile & mem_fn(std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&, ...) const volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::signature_type, void * volatile &(std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::result_type, void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_447::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_447::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_447::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_447::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg0_type, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg_type<0>, std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg1_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg_type<1>, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg2_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg_type<2>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::arg_type<3>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_variadic == true);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_const == true);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_447::mem_fn)>::specifier_mask == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_447::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_447::mem_fn)>::class_type, class_447>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_447::mem_fn)>, void * volatile &(std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_447::mem_fn)>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_447::mem_fn), 0>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_447::mem_fn), 1>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_447::mem_fn), 2>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_447::mem_fn), 3>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_447::mem_fn)>, type_list<std::string * &&, const std::string * &&, volatile std::string * &&, const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_447::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_447::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_447::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_447::mem_fn)> == callable_traits<decltype(&class_447::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_447::mem_fn)> == (callable_specifier::is_const | callable_specifier::is_volatile | callable_specifier::is_noexcept | callable_specifier::is_variadic));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_447::mem_fn)>, class_447>);
@@ -0,0 +1,3812 @@
+/* This file was auto-generated */
+
+#include <functional>
+#include <string>
+#include <type_traits>
+#include "../../include/callable_traits.hpp"
+#include "../callable_traits_test_helper.hpp"
+
+struct class_2 { const void * mem_fn(const void *) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_2::mem_fn)>::signature_type, const void *(const void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_2::mem_fn)>::result_type, const void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_2::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_2::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_2::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_2::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_2::mem_fn)>::arg0_type, const void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_2::mem_fn)>::arg_type<0>, const void *>);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_2::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_2::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_2::mem_fn)>::class_type, class_2>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_2::mem_fn)>, const void *(const void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_2::mem_fn)>, const void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_2::mem_fn), 0>, const void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_2::mem_fn)>, type_list<const void *>>);
+static_assert(callable_arity_v<decltype(&class_2::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_2::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_2::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_2::mem_fn)> == callable_traits<decltype(&class_2::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_2::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_2::mem_fn)>, class_2>);
+struct class_6 { const void * & mem_fn(const void * &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_6::mem_fn)>::signature_type, const void * &(const void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_6::mem_fn)>::result_type, const void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_6::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_6::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_6::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_6::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_6::mem_fn)>::arg0_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_6::mem_fn)>::arg_type<0>, const void * &>);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_6::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_6::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_6::mem_fn)>::class_type, class_6>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_6::mem_fn)>, const void * &(const void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_6::mem_fn)>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_6::mem_fn), 0>, const void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_6::mem_fn)>, type_list<const void * &>>);
+static_assert(callable_arity_v<decltype(&class_6::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_6::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_6::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_6::mem_fn)> == callable_traits<decltype(&class_6::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_6::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_6::mem_fn)>, class_6>);
+struct class_10 { const void * const & mem_fn(const void * const &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_10::mem_fn)>::signature_type, const void * const &(const void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_10::mem_fn)>::result_type, const void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_10::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_10::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_10::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_10::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_10::mem_fn)>::arg0_type, const void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_10::mem_fn)>::arg_type<0>, const void * const &>);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_10::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_10::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_10::mem_fn)>::class_type, class_10>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_10::mem_fn)>, const void * const &(const void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_10::mem_fn)>, const void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_10::mem_fn), 0>, const void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_10::mem_fn)>, type_list<const void * const &>>);
+static_assert(callable_arity_v<decltype(&class_10::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_10::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_10::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_10::mem_fn)> == callable_traits<decltype(&class_10::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_10::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_10::mem_fn)>, class_10>);
+struct class_14 { const void * volatile & mem_fn(const void * volatile &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_14::mem_fn)>::signature_type, const void * volatile &(const void * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_14::mem_fn)>::result_type, const void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_14::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_14::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_14::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_14::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_14::mem_fn)>::arg0_type, const void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_14::mem_fn)>::arg_type<0>, const void * volatile &>);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_14::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_14::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_14::mem_fn)>::class_type, class_14>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_14::mem_fn)>, const void * volatile &(const void * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_14::mem_fn)>, const void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_14::mem_fn), 0>, const void * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_14::mem_fn)>, type_list<const void * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_14::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_14::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_14::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_14::mem_fn)> == callable_traits<decltype(&class_14::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_14::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_14::mem_fn)>, class_14>);
+struct class_18 { const void * const volatile & mem_fn(const void * const volatile &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_18::mem_fn)>::signature_type, const void * const volatile &(const void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_18::mem_fn)>::result_type, const void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_18::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_18::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_18::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_18::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_18::mem_fn)>::arg0_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_18::mem_fn)>::arg_type<0>, const void * const volatile &>);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_18::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_18::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_18::mem_fn)>::class_type, class_18>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_18::mem_fn)>, const void * const volatile &(const void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_18::mem_fn)>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_18::mem_fn), 0>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_18::mem_fn)>, type_list<const void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_18::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_18::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_18::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_18::mem_fn)> == callable_traits<decltype(&class_18::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_18::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_18::mem_fn)>, class_18>);
+struct class_22 { const void * && mem_fn(const void * &&) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_22::mem_fn)>::signature_type, const void * &&(const void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_22::mem_fn)>::result_type, const void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_22::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_22::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_22::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_22::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_22::mem_fn)>::arg0_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_22::mem_fn)>::arg_type<0>, const void * &&>);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_22::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_22::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_22::mem_fn)>::class_type, class_22>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_22::mem_fn)>, const void * &&(const void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_22::mem_fn)>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_22::mem_fn), 0>, const void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_22::mem_fn)>, type_list<const void * &&>>);
+static_assert(callable_arity_v<decltype(&class_22::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_22::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_22::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_22::mem_fn)> == callable_traits<decltype(&class_22::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_22::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_22::mem_fn)>, class_22>);
+struct class_26 { const void * const && mem_fn(const void * const &&) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_26::mem_fn)>::signature_type, const void * const &&(const void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_26::mem_fn)>::result_type, const void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_26::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_26::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_26::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_26::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_26::mem_fn)>::arg0_type, const void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_26::mem_fn)>::arg_type<0>, const void * const &&>);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_26::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_26::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_26::mem_fn)>::class_type, class_26>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_26::mem_fn)>, const void * const &&(const void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_26::mem_fn)>, const void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_26::mem_fn), 0>, const void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_26::mem_fn)>, type_list<const void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_26::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_26::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_26::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_26::mem_fn)> == callable_traits<decltype(&class_26::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_26::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_26::mem_fn)>, class_26>);
+struct class_30 { const void * volatile && mem_fn(const void * volatile &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_30::mem_fn)>::signature_type, const void * volatile &&(const void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_30::mem_fn)>::result_type, const void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_30::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_30::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_30::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_30::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_30::mem_fn)>::arg0_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_30::mem_fn)>::arg_type<0>, const void * volatile &&>);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_30::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_30::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_30::mem_fn)>::class_type, class_30>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_30::mem_fn)>, const void * volatile &&(const void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_30::mem_fn)>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_30::mem_fn), 0>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_30::mem_fn)>, type_list<const void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_30::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_30::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_30::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_30::mem_fn)> == callable_traits<decltype(&class_30::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_30::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_30::mem_fn)>, class_30>);
+struct class_34 { const void * const volatile && mem_fn(const void * const volatile &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_34::mem_fn)>::signature_type, const void * const volatile &&(const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_34::mem_fn)>::result_type, const void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_34::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_34::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_34::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_34::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_34::mem_fn)>::arg0_type, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_34::mem_fn)>::arg_type<0>, const void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_34::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_34::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_34::mem_fn)>::class_type, class_34>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_34::mem_fn)>, const void * const volatile &&(const void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_34::mem_fn)>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_34::mem_fn), 0>, const void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_34::mem_fn)>, type_list<const void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_34::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_34::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_34::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_34::mem_fn)> == callable_traits<decltype(&class_34::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_34::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_34::mem_fn)>, class_34>);
+struct class_38 { bool * mem_fn(bool *) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_38::mem_fn)>::signature_type, bool *(bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_38::mem_fn)>::result_type, bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_38::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_38::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_38::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_38::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_38::mem_fn)>::arg0_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_38::mem_fn)>::arg_type<0>, bool *>);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_38::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_38::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_38::mem_fn)>::class_type, class_38>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_38::mem_fn)>, bool *(bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_38::mem_fn)>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_38::mem_fn), 0>, bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_38::mem_fn)>, type_list<bool *>>);
+static_assert(callable_arity_v<decltype(&class_38::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_38::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_38::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_38::mem_fn)> == callable_traits<decltype(&class_38::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_38::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_38::mem_fn)>, class_38>);
+struct class_42 { bool & mem_fn(bool &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_42::mem_fn)>::signature_type, bool &(bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_42::mem_fn)>::result_type, bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_42::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_42::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_42::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_42::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_42::mem_fn)>::arg0_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_42::mem_fn)>::arg_type<0>, bool &>);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_42::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_42::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_42::mem_fn)>::class_type, class_42>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_42::mem_fn)>, bool &(bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_42::mem_fn)>, bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_42::mem_fn), 0>, bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_42::mem_fn)>, type_list<bool &>>);
+static_assert(callable_arity_v<decltype(&class_42::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_42::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_42::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_42::mem_fn)> == callable_traits<decltype(&class_42::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_42::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_42::mem_fn)>, class_42>);
+struct class_46 { bool * & mem_fn(bool * &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_46::mem_fn)>::signature_type, bool * &(bool * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_46::mem_fn)>::result_type, bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_46::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_46::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_46::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_46::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_46::mem_fn)>::arg0_type, bool * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_46::mem_fn)>::arg_type<0>, bool * &>);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_46::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_46::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_46::mem_fn)>::class_type, class_46>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_46::mem_fn)>, bool * &(bool * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_46::mem_fn)>, bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_46::mem_fn), 0>, bool * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_46::mem_fn)>, type_list<bool * &>>);
+static_assert(callable_arity_v<decltype(&class_46::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_46::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_46::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_46::mem_fn)> == callable_traits<decltype(&class_46::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_46::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_46::mem_fn)>, class_46>);
+struct class_50 { bool * const & mem_fn(bool * const &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_50::mem_fn)>::signature_type, bool * const &(bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_50::mem_fn)>::result_type, bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_50::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_50::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_50::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_50::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_50::mem_fn)>::arg0_type, bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_50::mem_fn)>::arg_type<0>, bool * const &>);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_50::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_50::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_50::mem_fn)>::class_type, class_50>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_50::mem_fn)>, bool * const &(bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_50::mem_fn)>, bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_50::mem_fn), 0>, bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_50::mem_fn)>, type_list<bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_50::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_50::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_50::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_50::mem_fn)> == callable_traits<decltype(&class_50::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_50::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_50::mem_fn)>, class_50>);
+struct class_54 { bool * volatile & mem_fn(bool * volatile &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_54::mem_fn)>::signature_type, bool * volatile &(bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_54::mem_fn)>::result_type, bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_54::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_54::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_54::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_54::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_54::mem_fn)>::arg0_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_54::mem_fn)>::arg_type<0>, bool * volatile &>);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_54::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_54::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_54::mem_fn)>::class_type, class_54>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_54::mem_fn)>, bool * volatile &(bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_54::mem_fn)>, bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_54::mem_fn), 0>, bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_54::mem_fn)>, type_list<bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_54::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_54::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_54::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_54::mem_fn)> == callable_traits<decltype(&class_54::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_54::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_54::mem_fn)>, class_54>);
+struct class_58 { bool * const volatile & mem_fn(bool * const volatile &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_58::mem_fn)>::signature_type, bool * const volatile &(bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_58::mem_fn)>::result_type, bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_58::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_58::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_58::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_58::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_58::mem_fn)>::arg0_type, bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_58::mem_fn)>::arg_type<0>, bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_58::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_58::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_58::mem_fn)>::class_type, class_58>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_58::mem_fn)>, bool * const volatile &(bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_58::mem_fn)>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_58::mem_fn), 0>, bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_58::mem_fn)>, type_list<bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_58::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_58::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_58::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_58::mem_fn)> == callable_traits<decltype(&class_58::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_58::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_58::mem_fn)>, class_58>);
+struct class_62 { bool && mem_fn(bool &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_62::mem_fn)>::signature_type, bool &&(bool &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_62::mem_fn)>::result_type, bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_62::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_62::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_62::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_62::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_62::mem_fn)>::arg0_type, bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_62::mem_fn)>::arg_type<0>, bool &&>);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_62::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_62::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_62::mem_fn)>::class_type, class_62>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_62::mem_fn)>, bool &&(bool &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_62::mem_fn)>, bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_62::mem_fn), 0>, bool &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_62::mem_fn)>, type_list<bool &&>>);
+static_assert(callable_arity_v<decltype(&class_62::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_62::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_62::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_62::mem_fn)> == callable_traits<decltype(&class_62::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_62::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_62::mem_fn)>, class_62>);
+struct class_66 { bool * && mem_fn(bool * &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_66::mem_fn)>::signature_type, bool * &&(bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_66::mem_fn)>::result_type, bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_66::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_66::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_66::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_66::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_66::mem_fn)>::arg0_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_66::mem_fn)>::arg_type<0>, bool * &&>);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_66::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_66::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_66::mem_fn)>::class_type, class_66>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_66::mem_fn)>, bool * &&(bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_66::mem_fn)>, bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_66::mem_fn), 0>, bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_66::mem_fn)>, type_list<bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_66::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_66::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_66::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_66::mem_fn)> == callable_traits<decltype(&class_66::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_66::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_66::mem_fn)>, class_66>);
+struct class_70 { bool * const && mem_fn(bool * const &&) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_70::mem_fn)>::signature_type, bool * const &&(bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_70::mem_fn)>::result_type, bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_70::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_70::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_70::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_70::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_70::mem_fn)>::arg0_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_70::mem_fn)>::arg_type<0>, bool * const &&>);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_70::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_70::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_70::mem_fn)>::class_type, class_70>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_70::mem_fn)>, bool * const &&(bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_70::mem_fn)>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_70::mem_fn), 0>, bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_70::mem_fn)>, type_list<bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_70::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_70::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_70::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_70::mem_fn)> == callable_traits<decltype(&class_70::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_70::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_70::mem_fn)>, class_70>);
+struct class_74 { bool * volatile && mem_fn(bool * volatile &&) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_74::mem_fn)>::signature_type, bool * volatile &&(bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_74::mem_fn)>::result_type, bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_74::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_74::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_74::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_74::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_74::mem_fn)>::arg0_type, bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_74::mem_fn)>::arg_type<0>, bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_74::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_74::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_74::mem_fn)>::class_type, class_74>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_74::mem_fn)>, bool * volatile &&(bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_74::mem_fn)>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_74::mem_fn), 0>, bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_74::mem_fn)>, type_list<bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_74::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_74::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_74::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_74::mem_fn)> == callable_traits<decltype(&class_74::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_74::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_74::mem_fn)>, class_74>);
+struct class_78 { bool * const volatile && mem_fn(bool * const volatile &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_78::mem_fn)>::signature_type, bool * const volatile &&(bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_78::mem_fn)>::result_type, bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_78::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_78::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_78::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_78::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_78::mem_fn)>::arg0_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_78::mem_fn)>::arg_type<0>, bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_78::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_78::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_78::mem_fn)>::class_type, class_78>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_78::mem_fn)>, bool * const volatile &&(bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_78::mem_fn)>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_78::mem_fn), 0>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_78::mem_fn)>, type_list<bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_78::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_78::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_78::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_78::mem_fn)> == callable_traits<decltype(&class_78::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_78::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_78::mem_fn)>, class_78>);
+struct class_82 { int mem_fn(int) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_82::mem_fn)>::signature_type, int(int)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_82::mem_fn)>::result_type, int>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_82::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_82::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_82::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_82::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_82::mem_fn)>::arg0_type, int>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_82::mem_fn)>::arg_type<0>, int>);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_82::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_82::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_82::mem_fn)>::class_type, class_82>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_82::mem_fn)>, int(int)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_82::mem_fn)>, int>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_82::mem_fn), 0>, int>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_82::mem_fn)>, type_list<int>>);
+static_assert(callable_arity_v<decltype(&class_82::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_82::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_82::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_82::mem_fn)> == callable_traits<decltype(&class_82::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_82::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_82::mem_fn)>, class_82>);
+struct class_86 { const volatile int * mem_fn(const volatile int *) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_86::mem_fn)>::signature_type, const volatile int *(const volatile int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_86::mem_fn)>::result_type, const volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_86::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_86::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_86::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_86::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_86::mem_fn)>::arg0_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_86::mem_fn)>::arg_type<0>, const volatile int *>);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_86::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_86::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_86::mem_fn)>::class_type, class_86>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_86::mem_fn)>, const volatile int *(const volatile int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_86::mem_fn)>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_86::mem_fn), 0>, const volatile int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_86::mem_fn)>, type_list<const volatile int *>>);
+static_assert(callable_arity_v<decltype(&class_86::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_86::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_86::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_86::mem_fn)> == callable_traits<decltype(&class_86::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_86::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_86::mem_fn)>, class_86>);
+struct class_90 { const volatile int & mem_fn(const volatile int &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_90::mem_fn)>::signature_type, const volatile int &(const volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_90::mem_fn)>::result_type, const volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_90::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_90::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_90::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_90::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_90::mem_fn)>::arg0_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_90::mem_fn)>::arg_type<0>, const volatile int &>);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_90::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_90::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_90::mem_fn)>::class_type, class_90>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_90::mem_fn)>, const volatile int &(const volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_90::mem_fn)>, const volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_90::mem_fn), 0>, const volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_90::mem_fn)>, type_list<const volatile int &>>);
+static_assert(callable_arity_v<decltype(&class_90::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_90::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_90::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_90::mem_fn)> == callable_traits<decltype(&class_90::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_90::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_90::mem_fn)>, class_90>);
+struct class_94 { const volatile int * & mem_fn(const volatile int * &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_94::mem_fn)>::signature_type, const volatile int * &(const volatile int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_94::mem_fn)>::result_type, const volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_94::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_94::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_94::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_94::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_94::mem_fn)>::arg0_type, const volatile int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_94::mem_fn)>::arg_type<0>, const volatile int * &>);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_94::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_94::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_94::mem_fn)>::class_type, class_94>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_94::mem_fn)>, const volatile int * &(const volatile int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_94::mem_fn)>, const volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_94::mem_fn), 0>, const volatile int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_94::mem_fn)>, type_list<const volatile int * &>>);
+static_assert(callable_arity_v<decltype(&class_94::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_94::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_94::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_94::mem_fn)> == callable_traits<decltype(&class_94::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_94::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_94::mem_fn)>, class_94>);
+struct class_98 { const volatile int * const & mem_fn(const volatile int * const &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_98::mem_fn)>::signature_type, const volatile int * const &(const volatile int * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_98::mem_fn)>::result_type, const volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_98::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_98::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_98::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_98::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_98::mem_fn)>::arg0_type, const volatile int * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_98::mem_fn)>::arg_type<0>, const volatile int * const &>);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_98::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_98::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_98::mem_fn)>::class_type, class_98>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_98::mem_fn)>, const volatile int * const &(const volatile int * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_98::mem_fn)>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_98::mem_fn), 0>, const volatile int * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_98::mem_fn)>, type_list<const volatile int * const &>>);
+static_assert(callable_arity_v<decltype(&class_98::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_98::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_98::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_98::mem_fn)> == callable_traits<decltype(&class_98::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_98::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_98::mem_fn)>, class_98>);
+struct class_102 { const volatile int * volatile & mem_fn(const volatile int * volatile &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_102::mem_fn)>::signature_type, const volatile int * volatile &(const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_102::mem_fn)>::result_type, const volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_102::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_102::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_102::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_102::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_102::mem_fn)>::arg0_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_102::mem_fn)>::arg_type<0>, const volatile int * volatile &>);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_102::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_102::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_102::mem_fn)>::class_type, class_102>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_102::mem_fn)>, const volatile int * volatile &(const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_102::mem_fn)>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_102::mem_fn), 0>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_102::mem_fn)>, type_list<const volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_102::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_102::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_102::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_102::mem_fn)> == callable_traits<decltype(&class_102::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_102::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_102::mem_fn)>, class_102>);
+struct class_106 { const volatile int * const volatile & mem_fn(const volatile int * const volatile &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_106::mem_fn)>::signature_type, const volatile int * const volatile &(const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_106::mem_fn)>::result_type, const volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_106::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_106::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_106::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_106::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_106::mem_fn)>::arg0_type, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_106::mem_fn)>::arg_type<0>, const volatile int * const volatile &>);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_106::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_106::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_106::mem_fn)>::class_type, class_106>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_106::mem_fn)>, const volatile int * const volatile &(const volatile int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_106::mem_fn)>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_106::mem_fn), 0>, const volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_106::mem_fn)>, type_list<const volatile int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_106::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_106::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_106::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_106::mem_fn)> == callable_traits<decltype(&class_106::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_106::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_106::mem_fn)>, class_106>);
+struct class_110 { const volatile int && mem_fn(const volatile int &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_110::mem_fn)>::signature_type, const volatile int &&(const volatile int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_110::mem_fn)>::result_type, const volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_110::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_110::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_110::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_110::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_110::mem_fn)>::arg0_type, const volatile int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_110::mem_fn)>::arg_type<0>, const volatile int &&>);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_110::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_110::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_110::mem_fn)>::class_type, class_110>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_110::mem_fn)>, const volatile int &&(const volatile int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_110::mem_fn)>, const volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_110::mem_fn), 0>, const volatile int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_110::mem_fn)>, type_list<const volatile int &&>>);
+static_assert(callable_arity_v<decltype(&class_110::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_110::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_110::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_110::mem_fn)> == callable_traits<decltype(&class_110::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_110::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_110::mem_fn)>, class_110>);
+struct class_114 { const volatile int * && mem_fn(const volatile int * &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_114::mem_fn)>::signature_type, const volatile int * &&(const volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_114::mem_fn)>::result_type, const volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_114::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_114::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_114::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_114::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_114::mem_fn)>::arg0_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_114::mem_fn)>::arg_type<0>, const volatile int * &&>);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_114::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_114::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_114::mem_fn)>::class_type, class_114>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_114::mem_fn)>, const volatile int * &&(const volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_114::mem_fn)>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_114::mem_fn), 0>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_114::mem_fn)>, type_list<const volatile int * &&>>);
+static_assert(callable_arity_v<decltype(&class_114::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_114::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_114::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_114::mem_fn)> == callable_traits<decltype(&class_114::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_114::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_114::mem_fn)>, class_114>);
+struct class_118 { const volatile int * const && mem_fn(const volatile int * const &&) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_118::mem_fn)>::signature_type, const volatile int * const &&(const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_118::mem_fn)>::result_type, const volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_118::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_118::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_118::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_118::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_118::mem_fn)>::arg0_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_118::mem_fn)>::arg_type<0>, const volatile int * const &&>);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_118::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_118::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_118::mem_fn)>::class_type, class_118>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_118::mem_fn)>, const volatile int * const &&(const volatile int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_118::mem_fn)>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_118::mem_fn), 0>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_118::mem_fn)>, type_list<const volatile int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_118::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_118::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_118::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_118::mem_fn)> == callable_traits<decltype(&class_118::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_118::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_118::mem_fn)>, class_118>);
+struct class_122 { const volatile int * volatile && mem_fn(const volatile int * volatile &&) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_122::mem_fn)>::signature_type, const volatile int * volatile &&(const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_122::mem_fn)>::result_type, const volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_122::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_122::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_122::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_122::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_122::mem_fn)>::arg0_type, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_122::mem_fn)>::arg_type<0>, const volatile int * volatile &&>);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_122::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_122::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_122::mem_fn)>::class_type, class_122>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_122::mem_fn)>, const volatile int * volatile &&(const volatile int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_122::mem_fn)>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_122::mem_fn), 0>, const volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_122::mem_fn)>, type_list<const volatile int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_122::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_122::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_122::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_122::mem_fn)> == callable_traits<decltype(&class_122::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_122::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_122::mem_fn)>, class_122>);
+struct class_126 { const volatile int * const volatile && mem_fn(const volatile int * const volatile &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_126::mem_fn)>::signature_type, const volatile int * const volatile &&(const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_126::mem_fn)>::result_type, const volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_126::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_126::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_126::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_126::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_126::mem_fn)>::arg0_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_126::mem_fn)>::arg_type<0>, const volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_126::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_126::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_126::mem_fn)>::class_type, class_126>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_126::mem_fn)>, const volatile int * const volatile &&(const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_126::mem_fn)>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_126::mem_fn), 0>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_126::mem_fn)>, type_list<const volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_126::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_126::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_126::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_126::mem_fn)> == callable_traits<decltype(&class_126::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_126::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_126::mem_fn)>, class_126>);
+struct class_130 { volatile float * mem_fn(volatile float *) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_130::mem_fn)>::signature_type, volatile float *(volatile float *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_130::mem_fn)>::result_type, volatile float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_130::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_130::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_130::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_130::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_130::mem_fn)>::arg0_type, volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_130::mem_fn)>::arg_type<0>, volatile float *>);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_130::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_130::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_130::mem_fn)>::class_type, class_130>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_130::mem_fn)>, volatile float *(volatile float *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_130::mem_fn)>, volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_130::mem_fn), 0>, volatile float *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_130::mem_fn)>, type_list<volatile float *>>);
+static_assert(callable_arity_v<decltype(&class_130::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_130::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_130::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_130::mem_fn)> == callable_traits<decltype(&class_130::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_130::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_130::mem_fn)>, class_130>);
+struct class_134 { volatile float & mem_fn(volatile float &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_134::mem_fn)>::signature_type, volatile float &(volatile float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_134::mem_fn)>::result_type, volatile float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_134::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_134::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_134::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_134::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_134::mem_fn)>::arg0_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_134::mem_fn)>::arg_type<0>, volatile float &>);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_134::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_134::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_134::mem_fn)>::class_type, class_134>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_134::mem_fn)>, volatile float &(volatile float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_134::mem_fn)>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_134::mem_fn), 0>, volatile float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_134::mem_fn)>, type_list<volatile float &>>);
+static_assert(callable_arity_v<decltype(&class_134::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_134::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_134::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_134::mem_fn)> == callable_traits<decltype(&class_134::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_134::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_134::mem_fn)>, class_134>);
+struct class_138 { volatile float * & mem_fn(volatile float * &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_138::mem_fn)>::signature_type, volatile float * &(volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_138::mem_fn)>::result_type, volatile float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_138::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_138::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_138::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_138::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_138::mem_fn)>::arg0_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_138::mem_fn)>::arg_type<0>, volatile float * &>);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_138::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_138::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_138::mem_fn)>::class_type, class_138>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_138::mem_fn)>, volatile float * &(volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_138::mem_fn)>, volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_138::mem_fn), 0>, volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_138::mem_fn)>, type_list<volatile float * &>>);
+static_assert(callable_arity_v<decltype(&class_138::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_138::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_138::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_138::mem_fn)> == callable_traits<decltype(&class_138::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_138::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_138::mem_fn)>, class_138>);
+struct class_142 { volatile float * const & mem_fn(volatile float * const &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_142::mem_fn)>::signature_type, volatile float * const &(volatile float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_142::mem_fn)>::result_type, volatile float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_142::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_142::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_142::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_142::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_142::mem_fn)>::arg0_type, volatile float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_142::mem_fn)>::arg_type<0>, volatile float * const &>);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_142::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_142::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_142::mem_fn)>::class_type, class_142>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_142::mem_fn)>, volatile float * const &(volatile float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_142::mem_fn)>, volatile float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_142::mem_fn), 0>, volatile float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_142::mem_fn)>, type_list<volatile float * const &>>);
+static_assert(callable_arity_v<decltype(&class_142::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_142::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_142::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_142::mem_fn)> == callable_traits<decltype(&class_142::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_142::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_142::mem_fn)>, class_142>);
+struct class_146 { volatile float * volatile & mem_fn(volatile float * volatile &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_146::mem_fn)>::signature_type, volatile float * volatile &(volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_146::mem_fn)>::result_type, volatile float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_146::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_146::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_146::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_146::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_146::mem_fn)>::arg0_type, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_146::mem_fn)>::arg_type<0>, volatile float * volatile &>);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_146::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_146::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_146::mem_fn)>::class_type, class_146>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_146::mem_fn)>, volatile float * volatile &(volatile float * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_146::mem_fn)>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_146::mem_fn), 0>, volatile float * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_146::mem_fn)>, type_list<volatile float * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_146::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_146::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_146::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_146::mem_fn)> == callable_traits<decltype(&class_146::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_146::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_146::mem_fn)>, class_146>);
+struct class_150 { volatile float * const volatile & mem_fn(volatile float * const volatile &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_150::mem_fn)>::signature_type, volatile float * const volatile &(volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_150::mem_fn)>::result_type, volatile float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_150::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_150::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_150::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_150::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_150::mem_fn)>::arg0_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_150::mem_fn)>::arg_type<0>, volatile float * const volatile &>);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_150::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_150::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_150::mem_fn)>::class_type, class_150>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_150::mem_fn)>, volatile float * const volatile &(volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_150::mem_fn)>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_150::mem_fn), 0>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_150::mem_fn)>, type_list<volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_150::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_150::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_150::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_150::mem_fn)> == callable_traits<decltype(&class_150::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_150::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_150::mem_fn)>, class_150>);
+struct class_154 { volatile float && mem_fn(volatile float &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_154::mem_fn)>::signature_type, volatile float &&(volatile float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_154::mem_fn)>::result_type, volatile float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_154::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_154::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_154::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_154::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_154::mem_fn)>::arg0_type, volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_154::mem_fn)>::arg_type<0>, volatile float &&>);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_154::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_154::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_154::mem_fn)>::class_type, class_154>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_154::mem_fn)>, volatile float &&(volatile float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_154::mem_fn)>, volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_154::mem_fn), 0>, volatile float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_154::mem_fn)>, type_list<volatile float &&>>);
+static_assert(callable_arity_v<decltype(&class_154::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_154::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_154::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_154::mem_fn)> == callable_traits<decltype(&class_154::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_154::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_154::mem_fn)>, class_154>);
+struct class_158 { volatile float * && mem_fn(volatile float * &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_158::mem_fn)>::signature_type, volatile float * &&(volatile float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_158::mem_fn)>::result_type, volatile float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_158::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_158::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_158::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_158::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_158::mem_fn)>::arg0_type, volatile float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_158::mem_fn)>::arg_type<0>, volatile float * &&>);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_158::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_158::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_158::mem_fn)>::class_type, class_158>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_158::mem_fn)>, volatile float * &&(volatile float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_158::mem_fn)>, volatile float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_158::mem_fn), 0>, volatile float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_158::mem_fn)>, type_list<volatile float * &&>>);
+static_assert(callable_arity_v<decltype(&class_158::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_158::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_158::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_158::mem_fn)> == callable_traits<decltype(&class_158::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_158::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_158::mem_fn)>, class_158>);
+struct class_162 { volatile float * const && mem_fn(volatile float * const &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_162::mem_fn)>::signature_type, volatile float * const &&(volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_162::mem_fn)>::result_type, volatile float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_162::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_162::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_162::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_162::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_162::mem_fn)>::arg0_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_162::mem_fn)>::arg_type<0>, volatile float * const &&>);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_162::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_162::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_162::mem_fn)>::class_type, class_162>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_162::mem_fn)>, volatile float * const &&(volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_162::mem_fn)>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_162::mem_fn), 0>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_162::mem_fn)>, type_list<volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_162::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_162::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_162::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_162::mem_fn)> == callable_traits<decltype(&class_162::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_162::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_162::mem_fn)>, class_162>);
+struct class_166 { volatile float * volatile && mem_fn(volatile float * volatile &&) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_166::mem_fn)>::signature_type, volatile float * volatile &&(volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_166::mem_fn)>::result_type, volatile float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_166::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_166::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_166::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_166::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_166::mem_fn)>::arg0_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_166::mem_fn)>::arg_type<0>, volatile float * volatile &&>);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_166::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_166::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_166::mem_fn)>::class_type, class_166>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_166::mem_fn)>, volatile float * volatile &&(volatile float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_166::mem_fn)>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_166::mem_fn), 0>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_166::mem_fn)>, type_list<volatile float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_166::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_166::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_166::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_166::mem_fn)> == callable_traits<decltype(&class_166::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_166::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_166::mem_fn)>, class_166>);
+struct class_170 { volatile float * const volatile && mem_fn(volatile float * const volatile &&) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_170::mem_fn)>::signature_type, volatile float * const volatile &&(volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_170::mem_fn)>::result_type, volatile float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_170::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_170::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_170::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_170::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_170::mem_fn)>::arg0_type, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_170::mem_fn)>::arg_type<0>, volatile float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_170::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_170::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_170::mem_fn)>::class_type, class_170>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_170::mem_fn)>, volatile float * const volatile &&(volatile float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_170::mem_fn)>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_170::mem_fn), 0>, volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_170::mem_fn)>, type_list<volatile float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_170::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_170::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_170::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_170::mem_fn)> == callable_traits<decltype(&class_170::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_170::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_170::mem_fn)>, class_170>);
+struct class_174 { const std::string * mem_fn(const std::string *) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_174::mem_fn)>::signature_type, const std::string *(const std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_174::mem_fn)>::result_type, const std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_174::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_174::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_174::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_174::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_174::mem_fn)>::arg0_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_174::mem_fn)>::arg_type<0>, const std::string *>);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_174::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_174::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_174::mem_fn)>::class_type, class_174>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_174::mem_fn)>, const std::string *(const std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_174::mem_fn)>, const std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_174::mem_fn), 0>, const std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_174::mem_fn)>, type_list<const std::string *>>);
+static_assert(callable_arity_v<decltype(&class_174::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_174::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_174::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_174::mem_fn)> == callable_traits<decltype(&class_174::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_174::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_174::mem_fn)>, class_174>);
+struct class_178 { const std::string & mem_fn(const std::string &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_178::mem_fn)>::signature_type, const std::string &(const std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_178::mem_fn)>::result_type, const std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_178::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_178::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_178::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_178::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_178::mem_fn)>::arg0_type, const std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_178::mem_fn)>::arg_type<0>, const std::string &>);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_178::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_178::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_178::mem_fn)>::class_type, class_178>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_178::mem_fn)>, const std::string &(const std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_178::mem_fn)>, const std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_178::mem_fn), 0>, const std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_178::mem_fn)>, type_list<const std::string &>>);
+static_assert(callable_arity_v<decltype(&class_178::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_178::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_178::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_178::mem_fn)> == callable_traits<decltype(&class_178::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_178::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_178::mem_fn)>, class_178>);
+struct class_182 { const std::string * & mem_fn(const std::string * &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_182::mem_fn)>::signature_type, const std::string * &(const std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_182::mem_fn)>::result_type, const std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_182::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_182::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_182::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_182::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_182::mem_fn)>::arg0_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_182::mem_fn)>::arg_type<0>, const std::string * &>);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_182::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_182::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_182::mem_fn)>::class_type, class_182>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_182::mem_fn)>, const std::string * &(const std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_182::mem_fn)>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_182::mem_fn), 0>, const std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_182::mem_fn)>, type_list<const std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_182::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_182::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_182::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_182::mem_fn)> == callable_traits<decltype(&class_182::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_182::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_182::mem_fn)>, class_182>);
+struct class_186 { const std::string * const & mem_fn(const std::string * const &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_186::mem_fn)>::signature_type, const std::string * const &(const std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_186::mem_fn)>::result_type, const std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_186::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_186::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_186::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_186::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_186::mem_fn)>::arg0_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_186::mem_fn)>::arg_type<0>, const std::string * const &>);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_186::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_186::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_186::mem_fn)>::class_type, class_186>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_186::mem_fn)>, const std::string * const &(const std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_186::mem_fn)>, const std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_186::mem_fn), 0>, const std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_186::mem_fn)>, type_list<const std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_186::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_186::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_186::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_186::mem_fn)> == callable_traits<decltype(&class_186::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_186::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_186::mem_fn)>, class_186>);
+struct class_190 { const std::string * volatile & mem_fn(const std::string * volatile &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_190::mem_fn)>::signature_type, const std::string * volatile &(const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_190::mem_fn)>::result_type, const std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_190::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_190::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_190::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_190::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_190::mem_fn)>::arg0_type, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_190::mem_fn)>::arg_type<0>, const std::string * volatile &>);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_190::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_190::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_190::mem_fn)>::class_type, class_190>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_190::mem_fn)>, const std::string * volatile &(const std::string * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_190::mem_fn)>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_190::mem_fn), 0>, const std::string * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_190::mem_fn)>, type_list<const std::string * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_190::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_190::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_190::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_190::mem_fn)> == callable_traits<decltype(&class_190::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_190::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_190::mem_fn)>, class_190>);
+struct class_194 { const std::string * const volatile & mem_fn(const std::string * const volatile &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_194::mem_fn)>::signature_type, const std::string * const volatile &(const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_194::mem_fn)>::result_type, const std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_194::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_194::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_194::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_194::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_194::mem_fn)>::arg0_type, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_194::mem_fn)>::arg_type<0>, const std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_194::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_194::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_194::mem_fn)>::class_type, class_194>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_194::mem_fn)>, const std::string * const volatile &(const std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_194::mem_fn)>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_194::mem_fn), 0>, const std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_194::mem_fn)>, type_list<const std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_194::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_194::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_194::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_194::mem_fn)> == callable_traits<decltype(&class_194::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_194::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_194::mem_fn)>, class_194>);
+struct class_198 { const std::string && mem_fn(const std::string &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_198::mem_fn)>::signature_type, const std::string &&(const std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_198::mem_fn)>::result_type, const std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_198::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_198::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_198::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_198::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_198::mem_fn)>::arg0_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_198::mem_fn)>::arg_type<0>, const std::string &&>);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_198::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_198::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_198::mem_fn)>::class_type, class_198>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_198::mem_fn)>, const std::string &&(const std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_198::mem_fn)>, const std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_198::mem_fn), 0>, const std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_198::mem_fn)>, type_list<const std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_198::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_198::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_198::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_198::mem_fn)> == callable_traits<decltype(&class_198::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_198::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_198::mem_fn)>, class_198>);
+struct class_202 { const std::string * && mem_fn(const std::string * &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_202::mem_fn)>::signature_type, const std::string * &&(const std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_202::mem_fn)>::result_type, const std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_202::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_202::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_202::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_202::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_202::mem_fn)>::arg0_type, const std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_202::mem_fn)>::arg_type<0>, const std::string * &&>);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_202::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_202::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_202::mem_fn)>::class_type, class_202>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_202::mem_fn)>, const std::string * &&(const std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_202::mem_fn)>, const std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_202::mem_fn), 0>, const std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_202::mem_fn)>, type_list<const std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_202::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_202::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_202::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_202::mem_fn)> == callable_traits<decltype(&class_202::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_202::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_202::mem_fn)>, class_202>);
+struct class_206 { const std::string * const && mem_fn(const std::string * const &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_206::mem_fn)>::signature_type, const std::string * const &&(const std::string * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_206::mem_fn)>::result_type, const std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_206::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_206::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_206::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_206::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_206::mem_fn)>::arg0_type, const std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_206::mem_fn)>::arg_type<0>, const std::string * const &&>);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_206::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_206::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_206::mem_fn)>::class_type, class_206>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_206::mem_fn)>, const std::string * const &&(const std::string * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_206::mem_fn)>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_206::mem_fn), 0>, const std::string * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_206::mem_fn)>, type_list<const std::string * const &&>>);
+static_assert(callable_arity_v<decltype(&class_206::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_206::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_206::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_206::mem_fn)> == callable_traits<decltype(&class_206::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_206::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_206::mem_fn)>, class_206>);
+struct class_210 { const std::string * volatile && mem_fn(const std::string * volatile &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_210::mem_fn)>::signature_type, const std::string * volatile &&(const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_210::mem_fn)>::result_type, const std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_210::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_210::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_210::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_210::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_210::mem_fn)>::arg0_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_210::mem_fn)>::arg_type<0>, const std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_210::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_210::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_210::mem_fn)>::class_type, class_210>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_210::mem_fn)>, const std::string * volatile &&(const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_210::mem_fn)>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_210::mem_fn), 0>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_210::mem_fn)>, type_list<const std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_210::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_210::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_210::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_210::mem_fn)> == callable_traits<decltype(&class_210::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_210::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_210::mem_fn)>, class_210>);
+struct class_214 { const std::string * const volatile && mem_fn(const std::string * const volatile &&) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_214::mem_fn)>::signature_type, const std::string * const volatile &&(const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_214::mem_fn)>::result_type, const std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_214::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_214::mem_fn)>> == false);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_214::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_214::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_214::mem_fn)>::arg0_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_214::mem_fn)>::arg_type<0>, const std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::arity == 1);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_214::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_214::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_214::mem_fn)>::class_type, class_214>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_214::mem_fn)>, const std::string * const volatile &&(const std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_214::mem_fn)>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_214::mem_fn), 0>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_214::mem_fn)>, type_list<const std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_214::mem_fn)> == 1);
+static_assert(callable_is_functor_v<decltype(&class_214::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_214::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_214::mem_fn)> == callable_traits<decltype(&class_214::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_214::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_214::mem_fn)>, class_214>);
+struct class_218 { void * mem_fn(volatile void *, const volatile void *) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::signature_type, void *(volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::result_type, void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_218::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_218::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_218::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_218::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::arg0_type, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::arg_type<0>, volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::arg1_type, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::arg_type<1>, const volatile void *>);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_218::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_218::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_218::mem_fn)>::class_type, class_218>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_218::mem_fn)>, void *(volatile void *, const volatile void *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_218::mem_fn)>, void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_218::mem_fn), 0>, volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_218::mem_fn), 1>, const volatile void *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_218::mem_fn)>, type_list<volatile void *, const volatile void *>>);
+static_assert(callable_arity_v<decltype(&class_218::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_218::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_218::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_218::mem_fn)> == callable_traits<decltype(&class_218::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_218::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_218::mem_fn)>, class_218>);
+struct class_222 { void * & mem_fn(volatile void * const &, const volatile void * const &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::signature_type, void * &(volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::result_type, void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_222::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_222::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_222::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_222::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::arg0_type, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::arg_type<0>, volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::arg1_type, const volatile void * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::arg_type<1>, const volatile void * const &>);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_222::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_222::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_222::mem_fn)>::class_type, class_222>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_222::mem_fn)>, void * &(volatile void * const &, const volatile void * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_222::mem_fn)>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_222::mem_fn), 0>, volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_222::mem_fn), 1>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_222::mem_fn)>, type_list<volatile void * const &, const volatile void * const &>>);
+static_assert(callable_arity_v<decltype(&class_222::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_222::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_222::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_222::mem_fn)> == callable_traits<decltype(&class_222::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_222::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_222::mem_fn)>, class_222>);
+struct class_226 { void * const & mem_fn(volatile void * const volatile &, const volatile void * const volatile &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::signature_type, void * const &(volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::result_type, void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_226::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_226::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_226::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_226::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::arg0_type, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::arg_type<0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::arg1_type, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::arg_type<1>, const volatile void * const volatile &>);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_226::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_226::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_226::mem_fn)>::class_type, class_226>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_226::mem_fn)>, void * const &(volatile void * const volatile &, const volatile void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_226::mem_fn)>, void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_226::mem_fn), 0>, volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_226::mem_fn), 1>, const volatile void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_226::mem_fn)>, type_list<volatile void * const volatile &, const volatile void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_226::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_226::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_226::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_226::mem_fn)> == callable_traits<decltype(&class_226::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_226::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_226::mem_fn)>, class_226>);
+struct class_230 { void * volatile & mem_fn(volatile void * const &&, const volatile void * const &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::signature_type, void * volatile &(volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::result_type, void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_230::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_230::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_230::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_230::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::arg0_type, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::arg_type<0>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::arg1_type, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::arg_type<1>, const volatile void * const &&>);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_230::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_230::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_230::mem_fn)>::class_type, class_230>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_230::mem_fn)>, void * volatile &(volatile void * const &&, const volatile void * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_230::mem_fn)>, void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_230::mem_fn), 0>, volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_230::mem_fn), 1>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_230::mem_fn)>, type_list<volatile void * const &&, const volatile void * const &&>>);
+static_assert(callable_arity_v<decltype(&class_230::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_230::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_230::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_230::mem_fn)> == callable_traits<decltype(&class_230::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_230::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_230::mem_fn)>, class_230>);
+struct class_234 { void * const volatile & mem_fn(volatile void * const volatile &&, const volatile void * const volatile &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::signature_type, void * const volatile &(volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::result_type, void * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_234::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_234::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_234::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_234::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::arg0_type, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::arg_type<0>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::arg1_type, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::arg_type<1>, const volatile void * const volatile &&>);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_234::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_234::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_234::mem_fn)>::class_type, class_234>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_234::mem_fn)>, void * const volatile &(volatile void * const volatile &&, const volatile void * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_234::mem_fn)>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_234::mem_fn), 0>, volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_234::mem_fn), 1>, const volatile void * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_234::mem_fn)>, type_list<volatile void * const volatile &&, const volatile void * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_234::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_234::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_234::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_234::mem_fn)> == callable_traits<decltype(&class_234::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_234::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_234::mem_fn)>, class_234>);
+struct class_238 { void * && mem_fn(const bool &, volatile bool &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::signature_type, void * &&(const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::result_type, void * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_238::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_238::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_238::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_238::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::arg0_type, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::arg_type<0>, const bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::arg1_type, volatile bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::arg_type<1>, volatile bool &>);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_238::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_238::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_238::mem_fn)>::class_type, class_238>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_238::mem_fn)>, void * &&(const bool &, volatile bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_238::mem_fn)>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_238::mem_fn), 0>, const bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_238::mem_fn), 1>, volatile bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_238::mem_fn)>, type_list<const bool &, volatile bool &>>);
+static_assert(callable_arity_v<decltype(&class_238::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_238::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_238::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_238::mem_fn)> == callable_traits<decltype(&class_238::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_238::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_238::mem_fn)>, class_238>);
+struct class_242 { void * const && mem_fn(const bool * const &, volatile bool * const &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::signature_type, void * const &&(const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::result_type, void * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_242::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_242::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_242::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_242::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::arg0_type, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::arg_type<0>, const bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::arg1_type, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::arg_type<1>, volatile bool * const &>);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_242::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_242::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_242::mem_fn)>::class_type, class_242>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_242::mem_fn)>, void * const &&(const bool * const &, volatile bool * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_242::mem_fn)>, void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_242::mem_fn), 0>, const bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_242::mem_fn), 1>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_242::mem_fn)>, type_list<const bool * const &, volatile bool * const &>>);
+static_assert(callable_arity_v<decltype(&class_242::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_242::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_242::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_242::mem_fn)> == callable_traits<decltype(&class_242::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_242::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_242::mem_fn)>, class_242>);
+struct class_246 { void * volatile && mem_fn(const bool * const volatile &, volatile bool * const volatile &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::signature_type, void * volatile &&(const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::result_type, void * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_246::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_246::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_246::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_246::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::arg0_type, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::arg_type<0>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::arg1_type, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::arg_type<1>, volatile bool * const volatile &>);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_246::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_246::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_246::mem_fn)>::class_type, class_246>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_246::mem_fn)>, void * volatile &&(const bool * const volatile &, volatile bool * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_246::mem_fn)>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_246::mem_fn), 0>, const bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_246::mem_fn), 1>, volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_246::mem_fn)>, type_list<const bool * const volatile &, volatile bool * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_246::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_246::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_246::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_246::mem_fn)> == callable_traits<decltype(&class_246::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_246::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_246::mem_fn)>, class_246>);
+struct class_250 { void * const volatile && mem_fn(const bool * &&, volatile bool * &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::signature_type, void * const volatile &&(const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::result_type, void * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_250::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_250::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_250::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_250::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::arg0_type, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::arg_type<0>, const bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::arg1_type, volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::arg_type<1>, volatile bool * &&>);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_250::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_250::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_250::mem_fn)>::class_type, class_250>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_250::mem_fn)>, void * const volatile &&(const bool * &&, volatile bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_250::mem_fn)>, void * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_250::mem_fn), 0>, const bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_250::mem_fn), 1>, volatile bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_250::mem_fn)>, type_list<const bool * &&, volatile bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_250::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_250::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_250::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_250::mem_fn)> == callable_traits<decltype(&class_250::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_250::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_250::mem_fn)>, class_250>);
+struct class_254 { bool mem_fn(const bool * volatile &&, volatile bool * volatile &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::signature_type, bool(const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::result_type, bool>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_254::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_254::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_254::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_254::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::arg0_type, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::arg_type<0>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::arg1_type, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::arg_type<1>, volatile bool * volatile &&>);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_254::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_254::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_254::mem_fn)>::class_type, class_254>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_254::mem_fn)>, bool(const bool * volatile &&, volatile bool * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_254::mem_fn)>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_254::mem_fn), 0>, const bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_254::mem_fn), 1>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_254::mem_fn)>, type_list<const bool * volatile &&, volatile bool * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_254::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_254::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_254::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_254::mem_fn)> == callable_traits<decltype(&class_254::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_254::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_254::mem_fn)>, class_254>);
+struct class_258 { const volatile bool * mem_fn(int *, const int *) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::signature_type, const volatile bool *(int *, const int *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::result_type, const volatile bool *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_258::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_258::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_258::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_258::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::arg0_type, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::arg_type<0>, int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::arg1_type, const int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::arg_type<1>, const int *>);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_258::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_258::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_258::mem_fn)>::class_type, class_258>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_258::mem_fn)>, const volatile bool *(int *, const int *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_258::mem_fn)>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_258::mem_fn), 0>, int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_258::mem_fn), 1>, const int *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_258::mem_fn)>, type_list<int *, const int *>>);
+static_assert(callable_arity_v<decltype(&class_258::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_258::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_258::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_258::mem_fn)> == callable_traits<decltype(&class_258::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_258::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_258::mem_fn)>, class_258>);
+struct class_262 { const volatile bool & mem_fn(int * &, const int * &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::signature_type, const volatile bool &(int * &, const int * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::result_type, const volatile bool &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_262::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_262::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_262::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_262::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::arg0_type, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::arg_type<0>, int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::arg1_type, const int * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::arg_type<1>, const int * &>);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_262::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_262::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_262::mem_fn)>::class_type, class_262>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_262::mem_fn)>, const volatile bool &(int * &, const int * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_262::mem_fn)>, const volatile bool &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_262::mem_fn), 0>, int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_262::mem_fn), 1>, const int * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_262::mem_fn)>, type_list<int * &, const int * &>>);
+static_assert(callable_arity_v<decltype(&class_262::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_262::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_262::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_262::mem_fn)> == callable_traits<decltype(&class_262::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_262::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_262::mem_fn)>, class_262>);
+struct class_266 { const volatile bool * & mem_fn(int * volatile &, const int * volatile &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::signature_type, const volatile bool * &(int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::result_type, const volatile bool * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_266::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_266::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_266::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_266::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::arg0_type, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::arg_type<0>, int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::arg1_type, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::arg_type<1>, const int * volatile &>);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_266::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_266::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_266::mem_fn)>::class_type, class_266>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_266::mem_fn)>, const volatile bool * &(int * volatile &, const int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_266::mem_fn)>, const volatile bool * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_266::mem_fn), 0>, int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_266::mem_fn), 1>, const int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_266::mem_fn)>, type_list<int * volatile &, const int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_266::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_266::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_266::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_266::mem_fn)> == callable_traits<decltype(&class_266::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_266::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_266::mem_fn)>, class_266>);
+struct class_270 { const volatile bool * const & mem_fn(int &&, const int &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::signature_type, const volatile bool * const &(int &&, const int &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::result_type, const volatile bool * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_270::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_270::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_270::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_270::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::arg0_type, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::arg_type<0>, int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::arg1_type, const int &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::arg_type<1>, const int &&>);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_270::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_270::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_270::mem_fn)>::class_type, class_270>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_270::mem_fn)>, const volatile bool * const &(int &&, const int &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_270::mem_fn)>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_270::mem_fn), 0>, int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_270::mem_fn), 1>, const int &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_270::mem_fn)>, type_list<int &&, const int &&>>);
+static_assert(callable_arity_v<decltype(&class_270::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_270::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_270::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_270::mem_fn)> == callable_traits<decltype(&class_270::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_270::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_270::mem_fn)>, class_270>);
+struct class_274 { const volatile bool * volatile & mem_fn(int * const &&, const int * const &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::signature_type, const volatile bool * volatile &(int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::result_type, const volatile bool * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_274::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_274::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_274::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_274::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::arg0_type, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::arg_type<0>, int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::arg1_type, const int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::arg_type<1>, const int * const &&>);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_274::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_274::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_274::mem_fn)>::class_type, class_274>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_274::mem_fn)>, const volatile bool * volatile &(int * const &&, const int * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_274::mem_fn)>, const volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_274::mem_fn), 0>, int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_274::mem_fn), 1>, const int * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_274::mem_fn)>, type_list<int * const &&, const int * const &&>>);
+static_assert(callable_arity_v<decltype(&class_274::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_274::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_274::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_274::mem_fn)> == callable_traits<decltype(&class_274::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_274::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_274::mem_fn)>, class_274>);
+struct class_278 { const volatile bool * const volatile & mem_fn(int * const volatile &&, const int * const volatile &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::signature_type, const volatile bool * const volatile &(int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::result_type, const volatile bool * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_278::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_278::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_278::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_278::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::arg0_type, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::arg_type<0>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::arg1_type, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::arg_type<1>, const int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_278::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_278::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_278::mem_fn)>::class_type, class_278>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_278::mem_fn)>, const volatile bool * const volatile &(int * const volatile &&, const int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_278::mem_fn)>, const volatile bool * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_278::mem_fn), 0>, int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_278::mem_fn), 1>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_278::mem_fn)>, type_list<int * const volatile &&, const int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_278::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_278::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_278::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_278::mem_fn)> == callable_traits<decltype(&class_278::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_278::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_278::mem_fn)>, class_278>);
+struct class_282 { const volatile bool && mem_fn(const volatile float *, float &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::signature_type, const volatile bool &&(const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::result_type, const volatile bool &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_282::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_282::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_282::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_282::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::arg0_type, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::arg_type<0>, const volatile float *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::arg1_type, float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::arg_type<1>, float &>);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_282::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_282::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_282::mem_fn)>::class_type, class_282>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_282::mem_fn)>, const volatile bool &&(const volatile float *, float &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_282::mem_fn)>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_282::mem_fn), 0>, const volatile float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_282::mem_fn), 1>, float &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_282::mem_fn)>, type_list<const volatile float *, float &>>);
+static_assert(callable_arity_v<decltype(&class_282::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_282::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_282::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_282::mem_fn)> == callable_traits<decltype(&class_282::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_282::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_282::mem_fn)>, class_282>);
+struct class_286 { const volatile bool * && mem_fn(const volatile float * &, float * const &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::signature_type, const volatile bool * &&(const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::result_type, const volatile bool * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_286::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_286::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_286::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_286::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::arg0_type, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::arg_type<0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::arg1_type, float * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::arg_type<1>, float * const &>);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_286::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_286::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_286::mem_fn)>::class_type, class_286>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_286::mem_fn)>, const volatile bool * &&(const volatile float * &, float * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_286::mem_fn)>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_286::mem_fn), 0>, const volatile float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_286::mem_fn), 1>, float * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_286::mem_fn)>, type_list<const volatile float * &, float * const &>>);
+static_assert(callable_arity_v<decltype(&class_286::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_286::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_286::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_286::mem_fn)> == callable_traits<decltype(&class_286::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_286::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_286::mem_fn)>, class_286>);
+struct class_290 { const volatile bool * const && mem_fn(const volatile float * volatile &, float * const volatile &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::signature_type, const volatile bool * const &&(const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::result_type, const volatile bool * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_290::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_290::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_290::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_290::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::arg0_type, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::arg_type<0>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::arg1_type, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::arg_type<1>, float * const volatile &>);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_290::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_290::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_290::mem_fn)>::class_type, class_290>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_290::mem_fn)>, const volatile bool * const &&(const volatile float * volatile &, float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_290::mem_fn)>, const volatile bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_290::mem_fn), 0>, const volatile float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_290::mem_fn), 1>, float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_290::mem_fn)>, type_list<const volatile float * volatile &, float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_290::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_290::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_290::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_290::mem_fn)> == callable_traits<decltype(&class_290::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_290::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_290::mem_fn)>, class_290>);
+struct class_294 { const volatile bool * volatile && mem_fn(const volatile float &&, float * &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::signature_type, const volatile bool * volatile &&(const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::result_type, const volatile bool * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_294::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_294::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_294::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_294::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::arg0_type, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::arg_type<0>, const volatile float &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::arg1_type, float * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::arg_type<1>, float * &&>);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_294::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_294::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_294::mem_fn)>::class_type, class_294>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_294::mem_fn)>, const volatile bool * volatile &&(const volatile float &&, float * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_294::mem_fn)>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_294::mem_fn), 0>, const volatile float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_294::mem_fn), 1>, float * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_294::mem_fn)>, type_list<const volatile float &&, float * &&>>);
+static_assert(callable_arity_v<decltype(&class_294::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_294::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_294::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_294::mem_fn)> == callable_traits<decltype(&class_294::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_294::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_294::mem_fn)>, class_294>);
+struct class_298 { const volatile bool * const volatile && mem_fn(const volatile float * const &&, float * volatile &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::signature_type, const volatile bool * const volatile &&(const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::result_type, const volatile bool * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_298::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_298::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_298::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_298::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::arg0_type, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::arg_type<0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::arg1_type, float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::arg_type<1>, float * volatile &&>);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_298::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_298::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_298::mem_fn)>::class_type, class_298>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_298::mem_fn)>, const volatile bool * const volatile &&(const volatile float * const &&, float * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_298::mem_fn)>, const volatile bool * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_298::mem_fn), 0>, const volatile float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_298::mem_fn), 1>, float * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_298::mem_fn)>, type_list<const volatile float * const &&, float * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_298::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_298::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_298::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_298::mem_fn)> == callable_traits<decltype(&class_298::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_298::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_298::mem_fn)>, class_298>);
+struct class_302 { volatile int * mem_fn(const volatile float * const volatile &&, std::string) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::signature_type, volatile int *(const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::result_type, volatile int *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_302::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_302::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_302::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_302::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::arg0_type, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::arg_type<0>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::arg1_type, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::arg_type<1>, std::string>);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_302::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_302::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_302::mem_fn)>::class_type, class_302>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_302::mem_fn)>, volatile int *(const volatile float * const volatile &&, std::string)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_302::mem_fn)>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_302::mem_fn), 0>, const volatile float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_302::mem_fn), 1>, std::string>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_302::mem_fn)>, type_list<const volatile float * const volatile &&, std::string>>);
+static_assert(callable_arity_v<decltype(&class_302::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_302::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_302::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_302::mem_fn)> == callable_traits<decltype(&class_302::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_302::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_302::mem_fn)>, class_302>);
+struct class_306 { volatile int & mem_fn(volatile std::string &, const volatile std::string &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::signature_type, volatile int &(volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::result_type, volatile int &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_306::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_306::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_306::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_306::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::arg0_type, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::arg_type<0>, volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::arg1_type, const volatile std::string &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::arg_type<1>, const volatile std::string &>);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_306::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_306::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_306::mem_fn)>::class_type, class_306>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_306::mem_fn)>, volatile int &(volatile std::string &, const volatile std::string &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_306::mem_fn)>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_306::mem_fn), 0>, volatile std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_306::mem_fn), 1>, const volatile std::string &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_306::mem_fn)>, type_list<volatile std::string &, const volatile std::string &>>);
+static_assert(callable_arity_v<decltype(&class_306::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_306::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_306::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_306::mem_fn)> == callable_traits<decltype(&class_306::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_306::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_306::mem_fn)>, class_306>);
+struct class_310 { volatile int * & mem_fn(volatile std::string * const &, const volatile std::string * const &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::signature_type, volatile int * &(volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::result_type, volatile int * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_310::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_310::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_310::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_310::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::arg0_type, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::arg_type<0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::arg1_type, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::arg_type<1>, const volatile std::string * const &>);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_310::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_310::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_310::mem_fn)>::class_type, class_310>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_310::mem_fn)>, volatile int * &(volatile std::string * const &, const volatile std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_310::mem_fn)>, volatile int * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_310::mem_fn), 0>, volatile std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_310::mem_fn), 1>, const volatile std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_310::mem_fn)>, type_list<volatile std::string * const &, const volatile std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_310::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_310::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_310::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_310::mem_fn)> == callable_traits<decltype(&class_310::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_310::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_310::mem_fn)>, class_310>);
+struct class_314 { volatile int * const & mem_fn(volatile std::string * const volatile &, const volatile std::string * const volatile &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::signature_type, volatile int * const &(volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::result_type, volatile int * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_314::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_314::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_314::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_314::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::arg0_type, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::arg_type<0>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::arg1_type, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::arg_type<1>, const volatile std::string * const volatile &>);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_314::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_314::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_314::mem_fn)>::class_type, class_314>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_314::mem_fn)>, volatile int * const &(volatile std::string * const volatile &, const volatile std::string * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_314::mem_fn)>, volatile int * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_314::mem_fn), 0>, volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_314::mem_fn), 1>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_314::mem_fn)>, type_list<volatile std::string * const volatile &, const volatile std::string * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_314::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_314::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_314::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_314::mem_fn)> == callable_traits<decltype(&class_314::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_314::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_314::mem_fn)>, class_314>);
+struct class_318 { volatile int * volatile & mem_fn(volatile std::string * &&, const volatile std::string * &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::signature_type, volatile int * volatile &(volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::result_type, volatile int * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_318::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_318::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_318::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_318::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::arg0_type, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::arg_type<0>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::arg1_type, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::arg_type<1>, const volatile std::string * &&>);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_318::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_318::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_318::mem_fn)>::class_type, class_318>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_318::mem_fn)>, volatile int * volatile &(volatile std::string * &&, const volatile std::string * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_318::mem_fn)>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_318::mem_fn), 0>, volatile std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_318::mem_fn), 1>, const volatile std::string * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_318::mem_fn)>, type_list<volatile std::string * &&, const volatile std::string * &&>>);
+static_assert(callable_arity_v<decltype(&class_318::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_318::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_318::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_318::mem_fn)> == callable_traits<decltype(&class_318::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_318::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_318::mem_fn)>, class_318>);
+struct class_322 { volatile int * const volatile & mem_fn(volatile std::string * volatile &&, const volatile std::string * volatile &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::signature_type, volatile int * const volatile &(volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::result_type, volatile int * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_322::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_322::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_322::mem_fn)>> == false);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_322::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::arg0_type, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::arg_type<0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::arg1_type, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::arg_type<1>, const volatile std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::arity == 2);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_322::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_322::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_322::mem_fn)>::class_type, class_322>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_322::mem_fn)>, volatile int * const volatile &(volatile std::string * volatile &&, const volatile std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_322::mem_fn)>, volatile int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_322::mem_fn), 0>, volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_322::mem_fn), 1>, const volatile std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_322::mem_fn)>, type_list<volatile std::string * volatile &&, const volatile std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_322::mem_fn)> == 2);
+static_assert(callable_is_functor_v<decltype(&class_322::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_322::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_322::mem_fn)> == callable_traits<decltype(&class_322::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_322::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_322::mem_fn)>, class_322>);
+struct class_326 { volatile int && mem_fn(const volatile void *, void * &, const void * &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::signature_type, volatile int &&(const volatile void *, void * &, const void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::result_type, volatile int &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_326::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_326::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_326::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_326::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::arg0_type, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::arg_type<0>, const volatile void *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::arg1_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::arg_type<1>, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::arg2_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::arg_type<2>, const void * &>);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_326::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_326::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_326::mem_fn)>::class_type, class_326>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_326::mem_fn)>, volatile int &&(const volatile void *, void * &, const void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_326::mem_fn)>, volatile int &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_326::mem_fn), 0>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_326::mem_fn), 1>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_326::mem_fn), 2>, const void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_326::mem_fn)>, type_list<const volatile void *, void * &, const void * &>>);
+static_assert(callable_arity_v<decltype(&class_326::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_326::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_326::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_326::mem_fn)> == callable_traits<decltype(&class_326::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_326::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_326::mem_fn)>, class_326>);
+struct class_330 { volatile int * && mem_fn(const volatile void * volatile &, void * const volatile &, const void * const volatile &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::signature_type, volatile int * &&(const volatile void * volatile &, void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::result_type, volatile int * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_330::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_330::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_330::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_330::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::arg0_type, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::arg_type<0>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::arg1_type, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::arg_type<1>, void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::arg2_type, const void * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::arg_type<2>, const void * const volatile &>);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_330::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_330::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_330::mem_fn)>::class_type, class_330>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_330::mem_fn)>, volatile int * &&(const volatile void * volatile &, void * const volatile &, const void * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_330::mem_fn)>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_330::mem_fn), 0>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_330::mem_fn), 1>, void * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_330::mem_fn), 2>, const void * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_330::mem_fn)>, type_list<const volatile void * volatile &, void * const volatile &, const void * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_330::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_330::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_330::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_330::mem_fn)> == callable_traits<decltype(&class_330::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_330::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_330::mem_fn)>, class_330>);
+struct class_334 { volatile int * const && mem_fn(const volatile void * const &&, void * volatile &&, const void * volatile &&) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::signature_type, volatile int * const &&(const volatile void * const &&, void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::result_type, volatile int * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_334::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_334::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_334::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_334::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::arg0_type, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::arg_type<0>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::arg1_type, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::arg_type<1>, void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::arg2_type, const void * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::arg_type<2>, const void * volatile &&>);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_334::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_334::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_334::mem_fn)>::class_type, class_334>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_334::mem_fn)>, volatile int * const &&(const volatile void * const &&, void * volatile &&, const void * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_334::mem_fn)>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_334::mem_fn), 0>, const volatile void * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_334::mem_fn), 1>, void * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_334::mem_fn), 2>, const void * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_334::mem_fn)>, type_list<const volatile void * const &&, void * volatile &&, const void * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_334::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_334::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_334::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_334::mem_fn)> == callable_traits<decltype(&class_334::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_334::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_334::mem_fn)>, class_334>);
+struct class_338 { volatile int * volatile && mem_fn(volatile bool *, const volatile bool *, bool &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::signature_type, volatile int * volatile &&(volatile bool *, const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::result_type, volatile int * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_338::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_338::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_338::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_338::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::arg0_type, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::arg_type<0>, volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::arg1_type, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::arg_type<1>, const volatile bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::arg2_type, bool &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::arg_type<2>, bool &>);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_338::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_338::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_338::mem_fn)>::class_type, class_338>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_338::mem_fn)>, volatile int * volatile &&(volatile bool *, const volatile bool *, bool &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_338::mem_fn)>, volatile int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_338::mem_fn), 0>, volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_338::mem_fn), 1>, const volatile bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_338::mem_fn), 2>, bool &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_338::mem_fn)>, type_list<volatile bool *, const volatile bool *, bool &>>);
+static_assert(callable_arity_v<decltype(&class_338::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_338::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_338::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_338::mem_fn)> == callable_traits<decltype(&class_338::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_338::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_338::mem_fn)>, class_338>);
+struct class_342 { volatile int * const volatile && mem_fn(volatile bool * const &, const volatile bool * const &, bool * volatile &) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::signature_type, volatile int * const volatile &&(volatile bool * const &, const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::result_type, volatile int * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_342::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_342::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_342::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_342::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::arg0_type, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::arg_type<0>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::arg1_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::arg_type<1>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::arg2_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::arg_type<2>, bool * volatile &>);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_342::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_342::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_342::mem_fn)>::class_type, class_342>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_342::mem_fn)>, volatile int * const volatile &&(volatile bool * const &, const volatile bool * const &, bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_342::mem_fn)>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_342::mem_fn), 0>, volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_342::mem_fn), 1>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_342::mem_fn), 2>, bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_342::mem_fn)>, type_list<volatile bool * const &, const volatile bool * const &, bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_342::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_342::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_342::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_342::mem_fn)> == callable_traits<decltype(&class_342::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_342::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_342::mem_fn)>, class_342>);
+struct class_346 { const float * mem_fn(volatile bool &&, const volatile bool &&, bool * &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::signature_type, const float *(volatile bool &&, const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::result_type, const float *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_346::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_346::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_346::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_346::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::arg0_type, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::arg_type<0>, volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::arg1_type, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::arg_type<1>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::arg2_type, bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::arg_type<2>, bool * &&>);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_346::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_346::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_346::mem_fn)>::class_type, class_346>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_346::mem_fn)>, const float *(volatile bool &&, const volatile bool &&, bool * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_346::mem_fn)>, const float *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_346::mem_fn), 0>, volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_346::mem_fn), 1>, const volatile bool &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_346::mem_fn), 2>, bool * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_346::mem_fn)>, type_list<volatile bool &&, const volatile bool &&, bool * &&>>);
+static_assert(callable_arity_v<decltype(&class_346::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_346::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_346::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_346::mem_fn)> == callable_traits<decltype(&class_346::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_346::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_346::mem_fn)>, class_346>);
+struct class_350 { const float & mem_fn(volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::signature_type, const float &(volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::result_type, const float &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_350::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_350::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_350::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_350::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::arg0_type, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::arg_type<0>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::arg1_type, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::arg_type<1>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::arg2_type, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::arg_type<2>, bool * const volatile &&>);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_350::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_350::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_350::mem_fn)>::class_type, class_350>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_350::mem_fn)>, const float &(volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_350::mem_fn)>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_350::mem_fn), 0>, volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_350::mem_fn), 1>, const volatile bool * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_350::mem_fn), 2>, bool * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_350::mem_fn)>, type_list<volatile bool * volatile &&, const volatile bool * volatile &&, bool * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_350::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_350::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_350::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_350::mem_fn)> == callable_traits<decltype(&class_350::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_350::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_350::mem_fn)>, class_350>);
+struct class_354 { const float * & mem_fn(const int &, volatile int &, const volatile int &) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::signature_type, const float * &(const int &, volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::result_type, const float * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_354::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_354::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_354::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_354::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::arg0_type, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::arg_type<0>, const int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::arg1_type, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::arg_type<1>, volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::arg2_type, const volatile int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::arg_type<2>, const volatile int &>);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_354::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_354::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_354::mem_fn)>::class_type, class_354>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_354::mem_fn)>, const float * &(const int &, volatile int &, const volatile int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_354::mem_fn)>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_354::mem_fn), 0>, const int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_354::mem_fn), 1>, volatile int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_354::mem_fn), 2>, const volatile int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_354::mem_fn)>, type_list<const int &, volatile int &, const volatile int &>>);
+static_assert(callable_arity_v<decltype(&class_354::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_354::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_354::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_354::mem_fn)> == callable_traits<decltype(&class_354::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_354::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_354::mem_fn)>, class_354>);
+struct class_358 { const float * const & mem_fn(const int * volatile &, volatile int * volatile &, const volatile int * volatile &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::signature_type, const float * const &(const int * volatile &, volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::result_type, const float * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_358::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_358::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_358::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_358::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::arg0_type, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::arg_type<0>, const int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::arg1_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::arg_type<1>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::arg2_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::arg_type<2>, const volatile int * volatile &>);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_358::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_358::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_358::mem_fn)>::class_type, class_358>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_358::mem_fn)>, const float * const &(const int * volatile &, volatile int * volatile &, const volatile int * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_358::mem_fn)>, const float * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_358::mem_fn), 0>, const int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_358::mem_fn), 1>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_358::mem_fn), 2>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_358::mem_fn)>, type_list<const int * volatile &, volatile int * volatile &, const volatile int * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_358::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_358::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_358::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_358::mem_fn)> == callable_traits<decltype(&class_358::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_358::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_358::mem_fn)>, class_358>);
+struct class_362 { const float * volatile & mem_fn(const int * &&, volatile int * &&, const volatile int * &&) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::signature_type, const float * volatile &(const int * &&, volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::result_type, const float * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_362::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_362::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_362::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_362::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::arg0_type, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::arg_type<0>, const int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::arg1_type, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::arg_type<1>, volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::arg2_type, const volatile int * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::arg_type<2>, const volatile int * &&>);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_362::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_362::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_362::mem_fn)>::class_type, class_362>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_362::mem_fn)>, const float * volatile &(const int * &&, volatile int * &&, const volatile int * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_362::mem_fn)>, const float * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_362::mem_fn), 0>, const int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_362::mem_fn), 1>, volatile int * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_362::mem_fn), 2>, const volatile int * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_362::mem_fn)>, type_list<const int * &&, volatile int * &&, const volatile int * &&>>);
+static_assert(callable_arity_v<decltype(&class_362::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_362::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_362::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_362::mem_fn)> == callable_traits<decltype(&class_362::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_362::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_362::mem_fn)>, class_362>);
+struct class_366 { const float * const volatile & mem_fn(const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::signature_type, const float * const volatile &(const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::result_type, const float * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_366::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_366::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_366::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_366::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::arg0_type, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::arg_type<0>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::arg1_type, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::arg_type<1>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::arg2_type, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::arg_type<2>, const volatile int * const volatile &&>);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_366::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_366::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_366::mem_fn)>::class_type, class_366>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_366::mem_fn)>, const float * const volatile &(const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_366::mem_fn)>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_366::mem_fn), 0>, const int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_366::mem_fn), 1>, volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_366::mem_fn), 2>, const volatile int * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_366::mem_fn)>, type_list<const int * const volatile &&, volatile int * const volatile &&, const volatile int * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_366::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_366::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_366::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_366::mem_fn)> == callable_traits<decltype(&class_366::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_366::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_366::mem_fn)>, class_366>);
+struct class_370 { const float && mem_fn(float * &, const float * &, volatile float * &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::signature_type, const float &&(float * &, const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::result_type, const float &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_370::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_370::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_370::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_370::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::arg0_type, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::arg_type<0>, float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::arg1_type, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::arg_type<1>, const float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::arg2_type, volatile float * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::arg_type<2>, volatile float * &>);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_370::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_370::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_370::mem_fn)>::class_type, class_370>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_370::mem_fn)>, const float &&(float * &, const float * &, volatile float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_370::mem_fn)>, const float &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_370::mem_fn), 0>, float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_370::mem_fn), 1>, const float * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_370::mem_fn), 2>, volatile float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_370::mem_fn)>, type_list<float * &, const float * &, volatile float * &>>);
+static_assert(callable_arity_v<decltype(&class_370::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_370::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_370::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_370::mem_fn)> == callable_traits<decltype(&class_370::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_370::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_370::mem_fn)>, class_370>);
+struct class_374 { const float * && mem_fn(float * const volatile &, const float * const volatile &, volatile float * const volatile &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::signature_type, const float * &&(float * const volatile &, const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::result_type, const float * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_374::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_374::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_374::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_374::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::arg0_type, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::arg_type<0>, float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::arg1_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::arg_type<1>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::arg2_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::arg_type<2>, volatile float * const volatile &>);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_374::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_374::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_374::mem_fn)>::class_type, class_374>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_374::mem_fn)>, const float * &&(float * const volatile &, const float * const volatile &, volatile float * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_374::mem_fn)>, const float * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_374::mem_fn), 0>, float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_374::mem_fn), 1>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_374::mem_fn), 2>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_374::mem_fn)>, type_list<float * const volatile &, const float * const volatile &, volatile float * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_374::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_374::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_374::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_374::mem_fn)> == callable_traits<decltype(&class_374::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_374::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_374::mem_fn)>, class_374>);
+struct class_378 { const float * const && mem_fn(float * const &&, const float * const &&, volatile float * const &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::signature_type, const float * const &&(float * const &&, const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::result_type, const float * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_378::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_378::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_378::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_378::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::arg0_type, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::arg_type<0>, float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::arg1_type, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::arg_type<1>, const float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::arg2_type, volatile float * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::arg_type<2>, volatile float * const &&>);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_378::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_378::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_378::mem_fn)>::class_type, class_378>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_378::mem_fn)>, const float * const &&(float * const &&, const float * const &&, volatile float * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_378::mem_fn)>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_378::mem_fn), 0>, float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_378::mem_fn), 1>, const float * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_378::mem_fn), 2>, volatile float * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_378::mem_fn)>, type_list<float * const &&, const float * const &&, volatile float * const &&>>);
+static_assert(callable_arity_v<decltype(&class_378::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_378::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_378::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_378::mem_fn)> == callable_traits<decltype(&class_378::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_378::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_378::mem_fn)>, class_378>);
+struct class_382 { const float * volatile && mem_fn(std::string, std::string *, const std::string *) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::signature_type, const float * volatile &&(std::string, std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::result_type, const float * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_382::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_382::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_382::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_382::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::arg0_type, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::arg_type<0>, std::string>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::arg1_type, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::arg_type<1>, std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::arg2_type, const std::string *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::arg_type<2>, const std::string *>);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_382::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_382::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_382::mem_fn)>::class_type, class_382>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_382::mem_fn)>, const float * volatile &&(std::string, std::string *, const std::string *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_382::mem_fn)>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_382::mem_fn), 0>, std::string>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_382::mem_fn), 1>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_382::mem_fn), 2>, const std::string *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_382::mem_fn)>, type_list<std::string, std::string *, const std::string *>>);
+static_assert(callable_arity_v<decltype(&class_382::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_382::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_382::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_382::mem_fn)> == callable_traits<decltype(&class_382::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_382::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_382::mem_fn)>, class_382>);
+struct class_386 { const float * const volatile && mem_fn(const volatile std::string * &, std::string * const &, const std::string * const &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::signature_type, const float * const volatile &&(const volatile std::string * &, std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::result_type, const float * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_386::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_386::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_386::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_386::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::arg0_type, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::arg_type<0>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::arg1_type, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::arg_type<1>, std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::arg2_type, const std::string * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::arg_type<2>, const std::string * const &>);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_386::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_386::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_386::mem_fn)>::class_type, class_386>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_386::mem_fn)>, const float * const volatile &&(const volatile std::string * &, std::string * const &, const std::string * const &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_386::mem_fn)>, const float * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_386::mem_fn), 0>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_386::mem_fn), 1>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_386::mem_fn), 2>, const std::string * const &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_386::mem_fn)>, type_list<const volatile std::string * &, std::string * const &, const std::string * const &>>);
+static_assert(callable_arity_v<decltype(&class_386::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_386::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_386::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_386::mem_fn)> == callable_traits<decltype(&class_386::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_386::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_386::mem_fn)>, class_386>);
+struct class_390 { std::string * mem_fn(const volatile std::string * const volatile &, std::string &&, const std::string &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::signature_type, std::string *(const volatile std::string * const volatile &, std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::result_type, std::string *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_390::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_390::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_390::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_390::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::arg0_type, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::arg_type<0>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::arg1_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::arg_type<1>, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::arg2_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::arg_type<2>, const std::string &&>);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_390::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_390::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_390::mem_fn)>::class_type, class_390>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_390::mem_fn)>, std::string *(const volatile std::string * const volatile &, std::string &&, const std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_390::mem_fn)>, std::string *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_390::mem_fn), 0>, const volatile std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_390::mem_fn), 1>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_390::mem_fn), 2>, const std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_390::mem_fn)>, type_list<const volatile std::string * const volatile &, std::string &&, const std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_390::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_390::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_390::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_390::mem_fn)> == callable_traits<decltype(&class_390::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_390::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_390::mem_fn)>, class_390>);
+struct class_394 { std::string & mem_fn(const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::signature_type, std::string &(const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::result_type, std::string &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_394::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_394::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_394::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_394::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::arg0_type, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::arg_type<0>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::arg1_type, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::arg_type<1>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::arg2_type, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::arg_type<2>, const std::string * volatile &&>);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::arity == 3);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_394::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_394::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_394::mem_fn)>::class_type, class_394>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_394::mem_fn)>, std::string &(const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_394::mem_fn)>, std::string &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_394::mem_fn), 0>, const volatile std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_394::mem_fn), 1>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_394::mem_fn), 2>, const std::string * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_394::mem_fn)>, type_list<const volatile std::string * const &&, std::string * volatile &&, const std::string * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_394::mem_fn)> == 3);
+static_assert(callable_is_functor_v<decltype(&class_394::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_394::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_394::mem_fn)> == callable_traits<decltype(&class_394::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_394::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_394::mem_fn)>, class_394>);
+struct class_398 { std::string * & mem_fn(void * &, const void * &, volatile void * &, const volatile void * &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::signature_type, std::string * &(void * &, const void * &, volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::result_type, std::string * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_398::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_398::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_398::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_398::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg0_type, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg_type<0>, void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg1_type, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg_type<1>, const void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg2_type, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg_type<2>, volatile void * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::arg_type<3>, const volatile void * &>);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_398::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_398::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_398::mem_fn)>::class_type, class_398>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_398::mem_fn)>, std::string * &(void * &, const void * &, volatile void * &, const volatile void * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_398::mem_fn)>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_398::mem_fn), 0>, void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_398::mem_fn), 1>, const void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_398::mem_fn), 2>, volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_398::mem_fn), 3>, const volatile void * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_398::mem_fn)>, type_list<void * &, const void * &, volatile void * &, const volatile void * &>>);
+static_assert(callable_arity_v<decltype(&class_398::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_398::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_398::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_398::mem_fn)> == callable_traits<decltype(&class_398::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_398::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_398::mem_fn)>, class_398>);
+struct class_402 { std::string * const & mem_fn(void * &&, const void * &&, volatile void * &&, const volatile void * &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::signature_type, std::string * const &(void * &&, const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::result_type, std::string * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_402::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_402::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_402::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_402::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg0_type, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg_type<0>, void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg1_type, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg_type<1>, const void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg2_type, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg_type<2>, volatile void * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::arg_type<3>, const volatile void * &&>);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_402::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_402::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_402::mem_fn)>::class_type, class_402>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_402::mem_fn)>, std::string * const &(void * &&, const void * &&, volatile void * &&, const volatile void * &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_402::mem_fn)>, std::string * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_402::mem_fn), 0>, void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_402::mem_fn), 1>, const void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_402::mem_fn), 2>, volatile void * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_402::mem_fn), 3>, const volatile void * &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_402::mem_fn)>, type_list<void * &&, const void * &&, volatile void * &&, const volatile void * &&>>);
+static_assert(callable_arity_v<decltype(&class_402::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_402::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_402::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_402::mem_fn)> == callable_traits<decltype(&class_402::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_402::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_402::mem_fn)>, class_402>);
+struct class_406 { std::string * volatile & mem_fn(bool, bool *, const bool *, volatile bool *) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::signature_type, std::string * volatile &(bool, bool *, const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::result_type, std::string * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_406::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_406::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_406::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_406::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg0_type, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg_type<0>, bool>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg1_type, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg_type<1>, bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg2_type, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg_type<2>, const bool *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::arg_type<3>, volatile bool *>);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_406::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_406::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_406::mem_fn)>::class_type, class_406>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_406::mem_fn)>, std::string * volatile &(bool, bool *, const bool *, volatile bool *)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_406::mem_fn)>, std::string * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_406::mem_fn), 0>, bool>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_406::mem_fn), 1>, bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_406::mem_fn), 2>, const bool *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_406::mem_fn), 3>, volatile bool *>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_406::mem_fn)>, type_list<bool, bool *, const bool *, volatile bool *>>);
+static_assert(callable_arity_v<decltype(&class_406::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_406::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_406::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_406::mem_fn)> == callable_traits<decltype(&class_406::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_406::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_406::mem_fn)>, class_406>);
+struct class_410 { std::string * const volatile & mem_fn(const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::signature_type, std::string * const volatile &(const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::result_type, std::string * const volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_410::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_410::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_410::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_410::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg0_type, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg_type<0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg1_type, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg_type<1>, bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg2_type, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg_type<2>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::arg_type<3>, volatile bool * volatile &>);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_410::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_410::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_410::mem_fn)>::class_type, class_410>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_410::mem_fn)>, std::string * const volatile &(const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_410::mem_fn)>, std::string * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_410::mem_fn), 0>, const volatile bool * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_410::mem_fn), 1>, bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_410::mem_fn), 2>, const bool * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_410::mem_fn), 3>, volatile bool * volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_410::mem_fn)>, type_list<const volatile bool * const &, bool * volatile &, const bool * volatile &, volatile bool * volatile &>>);
+static_assert(callable_arity_v<decltype(&class_410::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_410::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_410::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_410::mem_fn)> == callable_traits<decltype(&class_410::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_410::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_410::mem_fn)>, class_410>);
+struct class_414 { std::string && mem_fn(const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::signature_type, std::string &&(const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::result_type, std::string &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_414::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_414::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_414::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_414::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg0_type, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg_type<0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg1_type, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg_type<1>, bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg2_type, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg_type<2>, const bool * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::arg_type<3>, volatile bool * const &&>);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_414::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_414::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_414::mem_fn)>::class_type, class_414>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_414::mem_fn)>, std::string &&(const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_414::mem_fn)>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_414::mem_fn), 0>, const volatile bool * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_414::mem_fn), 1>, bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_414::mem_fn), 2>, const bool * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_414::mem_fn), 3>, volatile bool * const &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_414::mem_fn)>, type_list<const volatile bool * &&, bool * const &&, const bool * const &&, volatile bool * const &&>>);
+static_assert(callable_arity_v<decltype(&class_414::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_414::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_414::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_414::mem_fn)> == callable_traits<decltype(&class_414::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_414::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_414::mem_fn)>, class_414>);
+struct class_418 { std::string * && mem_fn(volatile int *, const volatile int *, int &, const int &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::signature_type, std::string * &&(volatile int *, const volatile int *, int &, const int &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::result_type, std::string * &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_418::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_418::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_418::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_418::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg0_type, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg_type<0>, volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg1_type, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg_type<1>, const volatile int *>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg2_type, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg_type<2>, int &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::arg_type<3>, const int &>);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_418::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_418::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_418::mem_fn)>::class_type, class_418>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_418::mem_fn)>, std::string * &&(volatile int *, const volatile int *, int &, const int &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_418::mem_fn)>, std::string * &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_418::mem_fn), 0>, volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_418::mem_fn), 1>, const volatile int *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_418::mem_fn), 2>, int &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_418::mem_fn), 3>, const int &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_418::mem_fn)>, type_list<volatile int *, const volatile int *, int &, const int &>>);
+static_assert(callable_arity_v<decltype(&class_418::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_418::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_418::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_418::mem_fn)> == callable_traits<decltype(&class_418::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_418::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_418::mem_fn)>, class_418>);
+struct class_422 { std::string * const && mem_fn(volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::signature_type, std::string * const &&(volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::result_type, std::string * const &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_422::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_422::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_422::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_422::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg0_type, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg_type<0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg1_type, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg_type<1>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg2_type, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg_type<2>, int * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::arg_type<3>, const int * const volatile &>);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_422::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_422::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_422::mem_fn)>::class_type, class_422>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_422::mem_fn)>, std::string * const &&(volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_422::mem_fn)>, std::string * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_422::mem_fn), 0>, volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_422::mem_fn), 1>, const volatile int * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_422::mem_fn), 2>, int * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_422::mem_fn), 3>, const int * const volatile &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_422::mem_fn)>, type_list<volatile int * volatile &, const volatile int * volatile &, int * const volatile &, const int * const volatile &>>);
+static_assert(callable_arity_v<decltype(&class_422::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_422::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_422::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_422::mem_fn)> == callable_traits<decltype(&class_422::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_422::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_422::mem_fn)>, class_422>);
+struct class_426 { std::string * volatile && mem_fn(volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::signature_type, std::string * volatile &&(volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::result_type, std::string * volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_426::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_426::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_426::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_426::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg0_type, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg_type<0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg1_type, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg_type<1>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg2_type, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg_type<2>, int * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::arg_type<3>, const int * volatile &&>);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_426::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_426::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_426::mem_fn)>::class_type, class_426>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_426::mem_fn)>, std::string * volatile &&(volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_426::mem_fn)>, std::string * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_426::mem_fn), 0>, volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_426::mem_fn), 1>, const volatile int * const &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_426::mem_fn), 2>, int * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_426::mem_fn), 3>, const int * volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_426::mem_fn)>, type_list<volatile int * const &&, const volatile int * const &&, int * volatile &&, const int * volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_426::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_426::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_426::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_426::mem_fn)> == callable_traits<decltype(&class_426::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_426::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_426::mem_fn)>, class_426>);
+struct class_430 { std::string * const volatile && mem_fn(const float &, volatile float &, const volatile float &, float * &) volatile && noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::signature_type, std::string * const volatile &&(const float &, volatile float &, const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::result_type, std::string * const volatile &&>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_430::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_430::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_430::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_430::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg0_type, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg_type<0>, const float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg1_type, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg_type<1>, volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg2_type, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg_type<2>, const volatile float &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::arg_type<3>, float * &>);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_430::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_430::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_430::mem_fn)>::class_type, class_430>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_430::mem_fn)>, std::string * const volatile &&(const float &, volatile float &, const volatile float &, float * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_430::mem_fn)>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_430::mem_fn), 0>, const float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_430::mem_fn), 1>, volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_430::mem_fn), 2>, const volatile float &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_430::mem_fn), 3>, float * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_430::mem_fn)>, type_list<const float &, volatile float &, const volatile float &, float * &>>);
+static_assert(callable_arity_v<decltype(&class_430::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_430::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_430::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_430::mem_fn)> == callable_traits<decltype(&class_430::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_430::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_430::mem_fn)>, class_430>);
+struct class_434 { void mem_fn(const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&) volatile; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::signature_type, void(const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::result_type, void>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_434::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_434::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_434::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_434::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg0_type, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg_type<0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg1_type, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg_type<1>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg2_type, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg_type<2>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::arg_type<3>, float &&>);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_434::mem_fn)>::specifier_mask == (callable_specifier::is_volatile));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_434::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_434::mem_fn)>::class_type, class_434>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_434::mem_fn)>, void(const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_434::mem_fn)>, void>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_434::mem_fn), 0>, const float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_434::mem_fn), 1>, volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_434::mem_fn), 2>, const volatile float * const volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_434::mem_fn), 3>, float &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_434::mem_fn)>, type_list<const float * const volatile &, volatile float * const volatile &, const volatile float * const volatile &, float &&>>);
+static_assert(callable_arity_v<decltype(&class_434::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_434::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_434::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_434::mem_fn)> == callable_traits<decltype(&class_434::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_434::mem_fn)> == (callable_specifier::is_volatile));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_434::mem_fn)>, class_434>);
+struct class_438 { const volatile void * mem_fn(const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&) volatile &; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::signature_type, const volatile void *(const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::result_type, const volatile void *>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_438::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_438::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_438::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_438::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg0_type, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg_type<0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg1_type, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg_type<1>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg2_type, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg_type<2>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::arg_type<3>, float * const volatile &&>);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_438::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_438::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_438::mem_fn)>::class_type, class_438>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_438::mem_fn)>, const volatile void *(const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_438::mem_fn)>, const volatile void *>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_438::mem_fn), 0>, const float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_438::mem_fn), 1>, volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_438::mem_fn), 2>, const volatile float * volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_438::mem_fn), 3>, float * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_438::mem_fn)>, type_list<const float * volatile &&, volatile float * volatile &&, const volatile float * volatile &&, float * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_438::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_438::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_438::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_438::mem_fn)> == callable_traits<decltype(&class_438::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_438::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_438::mem_fn)>, class_438>);
+struct class_442 { const volatile void * & mem_fn(std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &) volatile &&; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::signature_type, const volatile void * &(std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::result_type, const volatile void * &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_442::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_442::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_442::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_442::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg0_type, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg_type<0>, std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg1_type, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg_type<1>, const std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg2_type, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg_type<2>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::arg_type<3>, const volatile std::string * &>);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_noexcept == false);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::is_rvalue_reference == true);
+static_assert(callable_traits<decltype(&class_442::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_442::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_442::mem_fn)>::class_type, class_442>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_442::mem_fn)>, const volatile void * &(std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_442::mem_fn)>, const volatile void * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_442::mem_fn), 0>, std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_442::mem_fn), 1>, const std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_442::mem_fn), 2>, volatile std::string * &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_442::mem_fn), 3>, const volatile std::string * &>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_442::mem_fn)>, type_list<std::string * &, const std::string * &, volatile std::string * &, const volatile std::string * &>>);
+static_assert(callable_arity_v<decltype(&class_442::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_442::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_442::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_442::mem_fn)> == callable_traits<decltype(&class_442::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_442::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_rvalue_reference));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_442::mem_fn)>, class_442>);
+struct class_446 { const volatile void * const & mem_fn(std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&) volatile noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::signature_type, const volatile void * const &(std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::result_type, const volatile void * const &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_446::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_446::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_446::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_446::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg0_type, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg_type<0>, std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg1_type, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg_type<1>, const std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg2_type, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg_type<2>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::arg_type<3>, const volatile std::string &&>);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_lvalue_reference == false);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_446::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_446::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_446::mem_fn)>::class_type, class_446>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_446::mem_fn)>, const volatile void * const &(std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_446::mem_fn)>, const volatile void * const &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_446::mem_fn), 0>, std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_446::mem_fn), 1>, const std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_446::mem_fn), 2>, volatile std::string &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_446::mem_fn), 3>, const volatile std::string &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_446::mem_fn)>, type_list<std::string &&, const std::string &&, volatile std::string &&, const volatile std::string &&>>);
+static_assert(callable_arity_v<decltype(&class_446::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_446::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_446::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_446::mem_fn)> == callable_traits<decltype(&class_446::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_446::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_446::mem_fn)>, class_446>);
+struct class_450 { const volatile void * volatile & mem_fn(std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&) volatile & noexcept; };
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::signature_type, const volatile void * volatile &(std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::result_type, const volatile void * volatile &>);
+static_assert(helper::has_arg0_type_v<callable_traits<decltype(&class_450::mem_fn)>> == true);
+static_assert(helper::has_arg1_type_v<callable_traits<decltype(&class_450::mem_fn)>> == true);
+static_assert(helper::has_arg2_type_v<callable_traits<decltype(&class_450::mem_fn)>> == true);
+static_assert(helper::has_arg3_type_v<callable_traits<decltype(&class_450::mem_fn)>> == false);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg0_type, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg_type<0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg1_type, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg_type<1>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg2_type, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg_type<2>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::arg_type<3>, const volatile std::string * const volatile &&>);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::arity == 4);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_functor == false);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_member_function == true);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_variadic == false);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_noexcept == true);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_const == false);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_volatile == true);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_lvalue_reference == true);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::is_rvalue_reference == false);
+static_assert(callable_traits<decltype(&class_450::mem_fn)>::specifier_mask == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(helper::has_class_type_v<callable_traits<decltype(&class_450::mem_fn)>> == true);
+static_assert(std::is_same_v<callable_traits<decltype(&class_450::mem_fn)>::class_type, class_450>);
+static_assert(std::is_same_v<callable_signature_t<decltype(&class_450::mem_fn)>, const volatile void * volatile &(std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&)>);
+static_assert(std::is_same_v<callable_result_t<decltype(&class_450::mem_fn)>, const volatile void * volatile &>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_450::mem_fn), 0>, std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_450::mem_fn), 1>, const std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_450::mem_fn), 2>, volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_arg_t<decltype(&class_450::mem_fn), 3>, const volatile std::string * const volatile &&>);
+static_assert(std::is_same_v<callable_args_t<decltype(&class_450::mem_fn)>, type_list<std::string * const volatile &&, const std::string * const volatile &&, volatile std::string * const volatile &&, const volatile std::string * const volatile &&>>);
+static_assert(callable_arity_v<decltype(&class_450::mem_fn)> == 4);
+static_assert(callable_is_functor_v<decltype(&class_450::mem_fn)> == false);
+static_assert(callable_is_member_function_v<decltype(&class_450::mem_fn)> == true);
+static_assert(callable_is_noexcept_v<decltype(&class_450::mem_fn)> == callable_traits<decltype(&class_450::mem_fn)>::is_noexcept);
+static_assert(callable_specifier_mask_v<decltype(&class_450::mem_fn)> == (callable_specifier::is_volatile | callable_specifier::is_lvalue_reference | callable_specifier::is_noexcept));
+static_assert(std::is_same_v<callable_class_t<decltype(&class_450::mem_fn)>, class_450>);
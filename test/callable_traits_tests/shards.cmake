@@ -0,0 +1,13 @@
+# This file was auto-generated
+
+set(CALLABLE_TRAITS_TEST_MAIN "${CMAKE_CURRENT_LIST_DIR}/main.cpp")
+set(CALLABLE_TRAITS_TEST_SHARDS
+	"${CMAKE_CURRENT_LIST_DIR}/functions.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/functions_noexcept.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/member_functions.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/member_functions_const.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/member_functions_volatile.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/member_functions_const_volatile.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/lambdas.cpp"
+	"${CMAKE_CURRENT_LIST_DIR}/lambdas_mutable.cpp"
+)
@@ -0,0 +1,93 @@
+#!/usr/bin/python3
+
+"""Compile-time budget check for the conformance test shards.
+
+Compiles every given shard, counts the template instantiations the front end performed and fails when any of them
+exceeds the baseline recorded for the compiler in compile_budget.json. Instantiation counts, unlike compile times,
+are deterministic for a given compiler, so they can be checked on any machine.
+"""
+
+import argparse
+import json
+import shlex
+import sys
+import tempfile
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent / 'benchmark'))
+from compile_benchmarks import count_instantiations, instantiation_flags, run_compiler  # noqa: E402
+
+# Reported to CTest as a skipped test, e.g. when no baseline exists for the compiler.
+SKIP = 77
+
+
+def measure_instantiations(args: argparse.Namespace, shard: Path, dump_dir: Path) -> int:
+    flags = [f'-std={args.std}', '-fsyntax-only'] + shlex.split(args.flags)
+    flags += instantiation_flags(args.compiler_id, dump_dir, shard)
+    run_compiler(shlex.split(args.compiler) + flags + [str(shard.resolve())], dump_dir)
+    instantiations = count_instantiations(args.compiler_id, dump_dir, shard)
+    if instantiations is None:
+        raise RuntimeError(f'No instantiation dump was written for {shard}')
+    return instantiations
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('shards', nargs='*', type=Path,
+                        help='conformance test shards to compile (default: all shards next to the budget file)')
+    parser.add_argument('--compiler', default='c++', help='compiler command line used to compile each shard')
+    parser.add_argument('--compiler-id', default='GNU', help='CMake compiler id, selects the instantiation dump')
+    parser.add_argument('--compiler-version', required=True, help='compiler version, only the major one is used')
+    parser.add_argument('--std', default='c++17')
+    parser.add_argument('--flags', default='', help='additional compiler flags')
+    parser.add_argument('--budget', type=Path, default=Path(__file__).resolve().parent / 'callable_traits_tests' /
+                        'compile_budget.json', help='file with the recorded instantiation counts per compiler')
+    parser.add_argument('--tolerance', type=float, default=0.01,
+                        help='relative growth over the baseline that is still accepted')
+    parser.add_argument('--update', action='store_true', help='record the current counts as new baseline')
+    args = parser.parse_args()
+
+    if not instantiation_flags(args.compiler_id, Path(), Path('shard.cpp')):
+        print(f'Instantiations cannot be counted with {args.compiler_id}, skipping.')
+        return SKIP
+    if not args.shards:
+        args.shards = sorted(s for s in args.budget.parent.glob('*.cpp') if s.name != 'main.cpp')
+    compiler = f'{args.compiler_id} {args.compiler_version.split(".")[0]}'
+    budget = json.loads(args.budget.read_text(encoding='utf-8')) if args.budget.exists() else {}
+    baseline = budget.get(compiler)
+    if baseline is None and not args.update:
+        print(f'No baseline recorded for {compiler} in {args.budget}, skipping. Record one with --update.')
+        return SKIP
+
+    # Every shard gets its own dump directory, so they can be compiled in parallel.
+    with tempfile.TemporaryDirectory() as temp_dir:
+        dump_dirs = [Path(temp_dir) / str(i) for i in range(len(args.shards))]
+        for dump_dir in dump_dirs:
+            dump_dir.mkdir()
+        with ThreadPoolExecutor() as executor:
+            counts = dict(zip((s.name for s in args.shards),
+                              executor.map(lambda s, d: measure_instantiations(args, s, d), args.shards, dump_dirs)))
+
+    if args.update:
+        budget[compiler] = dict(sorted(counts.items()))
+        args.budget.write_text(json.dumps(budget, indent=2, sort_keys=True) + '\n', encoding='utf-8')
+        print(f'Recorded the instantiation counts for {compiler} in {args.budget}.')
+        return 0
+
+    failed = False
+    print(f'{"shard":<40} {"instantiations":>16} {"baseline":>16}')
+    for shard, count in counts.items():
+        limit = baseline.get(shard)
+        exceeded = limit is not None and count > limit * (1 + args.tolerance)
+        failed |= exceeded
+        status = ' over budget' if exceeded else ' no baseline' if limit is None else ''
+        print(f'{shard:<40} {count:>16} {limit if limit is not None else "n/a":>16}{status}')
+    if failed:
+        print(f'Instantiation counts grew by more than {args.tolerance:.0%}. If that is intended, record a new '
+              f'baseline with --update.')
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/closure_traits.hpp"
+#include "../include/callable_traits/function_ref.hpp"
+#include "../include/callable_traits/inplace_function.hpp"
+#include "callable_traits_test_helper.hpp"
+
+[[maybe_unused]] const auto stateless = [](int value) { return value + 1; };
+[[maybe_unused]] const auto stateless_noexcept = [](const std::string& s) noexcept { return s.size(); };
+[[maybe_unused]] const auto stateless_mutable = [](int value) mutable { return value; };
+[[maybe_unused]] const auto capturing = [value = 1](int other) { return value + other; };
+[[maybe_unused]] const auto owning = [value = std::make_unique<int>(1)] { return *value; };
+[[maybe_unused]] const auto generic = [](auto value) { return value; };
+
+struct empty_functor {
+	int operator()(int value) const { return 2 * value; }
+};
+
+struct empty_noexcept_functor {
+	int operator()(int value) const noexcept { return 3 * value; }
+};
+
+// Constructing it has side effects, so it is not replaced by a thunk constructing it on each call.
+struct counting_functor {
+	static inline int instances = 0;
+	counting_functor() { ++instances; }
+	void operator()() const {}
+};
+
+// Only callable as rvalue, so a thunk cannot call it as the lvalue it constructs.
+struct rvalue_functor {
+	int operator()(int value) && { return value; }
+};
+
+struct non_default_constructible_functor {
+	explicit non_default_constructible_functor(int) {}
+	void operator()() const {}
+};
+
+int fn(int value) { return value; }
+
+static_assert(is_stateless_v<decltype(stateless)>);
+static_assert(is_stateless_v<decltype(stateless_noexcept)>);
+static_assert(is_stateless_v<decltype(stateless_mutable)>);
+static_assert(is_stateless_v<const empty_functor&>);
+static_assert(!is_stateless_v<decltype(capturing)>);
+static_assert(!is_stateless_v<decltype(owning)>);
+static_assert(!is_stateless_v<decltype(generic)>);
+static_assert(!is_stateless_v<counting_functor>);
+static_assert(!is_stateless_v<non_default_constructible_functor>);
+static_assert(!is_stateless_v<rvalue_functor>);
+static_assert(!is_stateless_v<decltype(&fn)>);
+static_assert(!is_stateless_v<int>);
+
+static_assert(closure_size_v<decltype(stateless)> == 0);
+static_assert(closure_size_v<decltype(capturing)> == sizeof(int));
+static_assert(closure_size_v<decltype(owning)> == sizeof(std::unique_ptr<int>));
+
+static_assert(is_trivially_relocatable_closure_v<decltype(stateless)>);
+static_assert(is_trivially_relocatable_closure_v<decltype(capturing)>);
+static_assert(!is_trivially_relocatable_closure_v<decltype(owning)>);
+static_assert(!is_trivially_relocatable_closure_v<decltype(&fn)>);
+
+// noexcept is kept, and lambdas convert at compile time.
+static_assert(std::is_same_v<decltype(to_function_pointer(stateless)), int (*)(int)>);
+static_assert(std::is_same_v<decltype(to_function_pointer(stateless_noexcept)),
+                             std::size_t (*)(const std::string&) noexcept>);
+static_assert(to_function_pointer(stateless)(1) == 2);
+
+template <typename F, typename = void>
+struct has_function_pointer : std::false_type {};
+template <typename F>
+struct has_function_pointer<F, std::void_t<decltype(to_function_pointer(std::declval<F>()))>> : std::true_type {};
+
+static_assert(has_function_pointer<empty_functor>::value);
+static_assert(std::is_same_v<decltype(to_function_pointer(empty_functor{})), int (*)(int)>);
+static_assert(std::is_same_v<decltype(to_function_pointer(empty_noexcept_functor{})), int (*)(int) noexcept>);
+static_assert(!has_function_pointer<decltype(capturing)>::value);
+static_assert(!has_function_pointer<rvalue_functor>::value);
+
+int main()
+{
+	helper::check(to_function_pointer(empty_functor{})(3) == 6);
+	helper::check(to_function_pointer(empty_noexcept_functor{})(3) == 9);
+	helper::check(to_function_pointer(stateless_mutable)(4) == 4);
+	helper::check(to_function_pointer(stateless_noexcept)("four") == 4);
+
+	// Referencing temporary stateless closures does not dangle, as the function pointer is stored.
+	function_ref<int(int)> increment = [](int value) { return value + 1; };
+	helper::check(increment(1) == 2);
+
+	// Stateless closures share the storage and vtable of function pointers.
+	unique_function<int(int)> a = stateless;
+	unique_function<int(int)> b = empty_functor{};
+	unique_function<int(int)> c = &fn;
+	helper::check(a(1) == 2 && b(1) == 2 && c(1) == 1);
+
+	return helper::failures;
+}
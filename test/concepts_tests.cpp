@@ -0,0 +1,75 @@
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/std_call_wrappers.hpp"
+
+static_assert(CALLABLE_TRAITS_USE_CONCEPTS == 1);
+
+#if defined(CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE)
+#error "CALLABLE_TRAITS_REQUIRES_FUNCTION_TYPE is internal to callable_traits.hpp"
+#endif
+
+struct functor {
+	int operator()(float, std::string&) const noexcept;
+};
+
+struct overloaded {
+	void operator()(int);
+	void operator()(float);
+};
+
+struct generic {
+	template <typename T>
+	void operator()(T);
+};
+
+struct foo {
+	void mem_fn(int) &&;
+	int data;
+};
+
+[[maybe_unused]] const auto lambda = [](bool) mutable {};
+
+void fn(int, ...);
+
+static_assert(detail::callable_object<functor>);
+static_assert(detail::callable_object<decltype(lambda)>);
+static_assert(!detail::callable_object<overloaded>);
+static_assert(!detail::callable_object<generic>);
+static_assert(!detail::callable_object<int>);
+
+static_assert(detail::free_function<decltype(fn)>);
+static_assert(!detail::free_function<decltype(&fn)>);
+static_assert(!detail::free_function<functor>);
+
+// Call wrappers are detected through their get_call_operator specialization, not their call operator.
+static_assert(detail::has_call_operator<std::function<void(int)>>);
+static_assert(detail::has_call_operator<functor>);
+static_assert(!detail::has_call_operator<generic>);
+
+template <typename Callable>
+concept has_arity = requires { callable_arity_v<Callable>; };
+
+template <typename Callable>
+concept has_result = requires { typename callable_result_t<Callable>; };
+
+// The standalone queries are only available if the function type of the callable is known.
+static_assert(has_arity<functor> && has_result<functor>);
+static_assert(has_arity<decltype(lambda)> && has_result<decltype(lambda)>);
+static_assert(has_arity<decltype(fn)> && has_result<decltype(&fn)>);
+static_assert(has_arity<decltype(&foo::mem_fn)> && has_result<decltype(&foo::mem_fn)>);
+static_assert(has_arity<std::function<void(int)>> && has_result<std::function<void(int)>>);
+static_assert(!has_arity<overloaded> && !has_result<overloaded>);
+static_assert(!has_arity<generic> && !has_result<generic>);
+static_assert(!has_arity<int> && !has_result<int>);
+static_assert(!has_arity<decltype(&foo::data)> && !has_result<decltype(&foo::data)>);
+
+static_assert(callable_is_functor_v<generic> == false);
+static_assert(callable_is_member_function_v<decltype(&foo::mem_fn)> == true);
+static_assert(callable_is_rvalue_reference_v<decltype(&foo::mem_fn)> == true);
+static_assert(std::is_same_v<callable_signature_t<functor>, int(float, std::string&)>);
+static_assert(callable_is_noexcept_v<functor> == true);
+static_assert(callable_is_variadic_v<decltype(fn)> == true);
+
+int main() { return 0; }
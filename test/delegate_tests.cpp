@@ -0,0 +1,69 @@
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/delegate.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct widget {
+	int add(int value) noexcept { return total += value; }
+	int get() const { return total; }
+	int get_volatile() volatile { return total; }
+	std::string describe(const char* prefix) const& { return prefix + std::to_string(total); }
+	void reset() && { total = 0; }
+	int total = 0;
+};
+
+struct derived_widget : widget {};
+
+// The object type carries the cv specifiers of the member function.
+static_assert(std::is_same_v<delegate<decltype(&widget::add)>::object_type, widget>);
+static_assert(std::is_same_v<delegate<decltype(&widget::get)>::object_type, const widget>);
+static_assert(std::is_same_v<delegate<decltype(&widget::get_volatile)>::object_type, volatile widget>);
+static_assert(std::is_same_v<delegate<decltype(&widget::describe)>::object_type, const widget>);
+static_assert(std::is_same_v<delegate<constant_arg_t<&widget::get>>::class_type, widget>);
+
+static_assert(std::is_constructible_v<delegate<decltype(&widget::add)>, widget*, decltype(&widget::add)>);
+static_assert(std::is_constructible_v<delegate<decltype(&widget::add)>, derived_widget*, decltype(&widget::add)>);
+static_assert(!std::is_constructible_v<delegate<decltype(&widget::add)>, const widget*, decltype(&widget::add)>);
+static_assert(std::is_constructible_v<delegate<decltype(&widget::get)>, const widget*, decltype(&widget::get)>);
+static_assert(std::is_constructible_v<delegate<decltype(&widget::get)>, widget*, decltype(&widget::get)>);
+static_assert(!std::is_constructible_v<delegate<constant_arg_t<&widget::add>>, const widget*>);
+static_assert(!std::is_constructible_v<delegate<constant_arg_t<&widget::get>>, volatile widget*>);
+static_assert(std::is_constructible_v<delegate<constant_arg_t<&widget::get_volatile>>, volatile widget*>);
+
+// noexcept is kept, and only the delegates of compile-time member functions are as small as a pointer.
+static_assert(std::is_nothrow_invocable_v<delegate<decltype(&widget::add)>, int>);
+static_assert(!std::is_nothrow_invocable_v<delegate<decltype(&widget::get)>>);
+static_assert(sizeof(delegate<constant_arg_t<&widget::add>>) == sizeof(widget*));
+static_assert(sizeof(delegate<decltype(&widget::add)>) == sizeof(widget*) + sizeof(&widget::add));
+static_assert(std::is_trivially_copyable_v<delegate<decltype(&widget::add)>>);
+static_assert(std::is_trivially_copyable_v<delegate<constant_arg_t<&widget::add>>>);
+
+int main()
+{
+	widget w;
+	delegate add(&w, &widget::add);
+	static_assert(std::is_same_v<decltype(add), delegate<decltype(&widget::add)>>);
+	add(2);
+	helper::check(add(3) == 5 && w.total == 5);
+	helper::check(add.object() == &w);
+
+	const widget& cw = w;
+	delegate get(&cw, &widget::get);
+	helper::check(get() == 5);
+
+	delegate describe(constant_arg<&widget::describe>, &cw);
+	static_assert(std::is_same_v<decltype(describe), delegate<constant_arg_t<&widget::describe>>>);
+	helper::check(describe("total ") == "total 5");
+
+	derived_widget d;
+	delegate<constant_arg_t<&widget::add>> add_derived(&d);
+	add_derived(7);
+	helper::check(d.total == 7);
+
+	volatile widget vw;
+	delegate get_volatile(&vw, &widget::get_volatile);
+	helper::check(get_volatile() == 0);
+
+	return helper::failures;
+}
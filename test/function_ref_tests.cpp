@@ -0,0 +1,91 @@
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/function_ref.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct counter {
+	int add(int value) noexcept { return count += value; }
+	int get() const { return count; }
+	int count = 0;
+};
+
+struct functor {
+	std::string operator()(const std::string& s, int n) const { return s + std::to_string(n); }
+};
+
+int twice(int value) { return 2 * value; }
+int negate(int value) noexcept { return -value; }
+int sum(int count, ...) { return count; }
+const int& identity(const int& value) noexcept { return value; }
+
+// The signature is deduced, including noexcept.
+static_assert(std::is_same_v<decltype(function_ref(twice)), function_ref<int(int)>>);
+static_assert(std::is_same_v<decltype(function_ref(&negate)), function_ref<int(int) noexcept>>);
+static_assert(std::is_same_v<decltype(function_ref(sum)), function_ref<int(int)>>);
+static_assert(std::is_same_v<decltype(function_ref(std::declval<functor&>())),
+                             function_ref<std::string(const std::string&, int)>>);
+static_assert(std::is_same_v<decltype(function_ref(constant_arg<&counter::add>, std::declval<counter&>())),
+                             function_ref<int(int) noexcept>>);
+static_assert(std::is_same_v<decltype(function_ref(constant_arg<twice>)), function_ref<int(int)>>);
+
+static_assert(sizeof(function_ref<void()>) == 2 * sizeof(void*));
+static_assert(std::is_trivially_copyable_v<function_ref<void()>>);
+static_assert(std::is_nothrow_invocable_v<function_ref<int(int) noexcept>, int>);
+static_assert(!std::is_nothrow_invocable_v<function_ref<int(int)>, int>);
+
+// Only callables matching the signature are accepted, noexcept ones only by noexcept signatures.
+static_assert(std::is_constructible_v<function_ref<int(int)>, decltype(negate)&>);
+static_assert(std::is_constructible_v<function_ref<long(short)>, decltype(twice)&>);
+static_assert(!std::is_constructible_v<function_ref<int(int) noexcept>, decltype(twice)&>);
+static_assert(!std::is_constructible_v<function_ref<int(std::string)>, decltype(twice)&>);
+static_assert(!std::is_constructible_v<function_ref<int(int)>, int>);
+static_assert(!std::is_constructible_v<function_ref<int(int)>, decltype(&counter::add)>);
+
+int call(function_ref<int(int)> f, int value) { return f(value); }
+
+int main()
+{
+	helper::check(call(twice, 3) == 6);
+	helper::check(call(&negate, 3) == -3);
+	helper::check(call(constant_arg<twice>, 4) == 8);
+
+	int offset = 10;
+	auto add_offset = [&offset](int value) { return value + offset; };
+	helper::check(call(add_offset, 1) == 11);
+	offset = 20;
+	helper::check(call(add_offset, 1) == 21);
+
+	auto mutable_lambda = [calls = 0](int) mutable { return ++calls; };
+	function_ref<int(int)> calls = mutable_lambda;
+	calls(0);
+	helper::check(calls(0) == 2);
+
+	const functor f;
+	function_ref append = f;
+	helper::check(append("x", 1) == "x1");
+
+	counter c;
+	function_ref add = {constant_arg<&counter::add>, c};
+	add(2);
+	add(3);
+	helper::check(c.count == 5);
+	helper::check(function_ref(constant_arg<&counter::get>, std::as_const(c))() == 5);
+
+	// Copies reference the same callable.
+	function_ref add_copy = add;
+	add_copy(1);
+	helper::check(c.count == 6);
+
+	std::function<int(int)> wrapped = twice;
+	helper::check(call(wrapped, 5) == 10);
+
+	// Arguments taken by reference reach the callable as the object of the caller, not as a copy.
+	const int value = 7;
+	helper::check(&function_ref(identity)(value) == &value);
+	const auto same_object = [&value](const int& argument) { return &argument == &value; };
+	helper::check(function_ref(same_object)(value));
+
+	return helper::failures;
+}
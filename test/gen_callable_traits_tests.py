@@ -1,8 +1,16 @@
 #!/usr/bin/python3
 
+"""Generates the conformance tests of callable_traits.
+
+The tests are split into shards, one per callable category and specifier group, which are compiled as separate
+translation units of the callable_traits_tests target. The shards are listed in shards.cmake next to them.
+"""
+
+import argparse
 from dataclasses import dataclass
 from enum import Enum
 from itertools import cycle, chain
+from pathlib import Path
 from typing import Optional, Union
 
 
@@ -230,6 +238,15 @@ def is_valid_parameter_type(full_type: FullType) -> bool:
     return not (is_void_value_or_reference or is_cv_qualified_value_or_pointer(full_type))
 
 
+def format_specifier_mask(**specifiers: bool) -> str:
+    flags = [f'callable_specifier::{name}' for name, value in specifiers.items() if value]
+    return ' | '.join(flags) if flags else 'callable_specifier::none'
+
+
+def format_signature(fn: Function) -> str:
+    return f'{str(fn.return_type)}({", ".join(str(p) for p in fn.parameters)})'
+
+
 def gen_functions(return_types: list[FullType], parameters: list[list[FullType]], specifiers: list[Optional[Specifier]]) -> list[Function]:
     counter = 0
     functions = []
@@ -260,18 +277,39 @@ def gen_lambda_functions(return_types: list[FullType], parameters: list[list[Ful
     return functions
 
 
+def gen_query_tests(callable: str, fn: Function, is_member_function: bool, is_functor: bool, specifier_mask: str) -> list[StaticAssert]:
+    tests = [StaticAssert(f'std::is_same_v<callable_signature_t<{callable}>, {format_signature(fn)}>')]
+    tests += [StaticAssert(f'std::is_same_v<callable_result_t<{callable}>, {str(fn.return_type)}>')]
+    for idx, parameter in enumerate(fn.parameters):
+        tests += [StaticAssert(f'std::is_same_v<callable_arg_t<{callable}, {idx}>, {str(parameter)}>')]
+    tests += [StaticAssert(
+        f'std::is_same_v<callable_args_t<{callable}>, type_list<{", ".join(str(p) for p in fn.parameters)}>>')]
+    tests += [StaticAssert(f'callable_arity_v<{callable}> == {len(fn.parameters)}')]
+    tests += [StaticAssert(f'callable_is_functor_v<{callable}> == {"true" if is_functor else "false"}')]
+    tests += [StaticAssert(
+        f'callable_is_member_function_v<{callable}> == {"true" if is_member_function else "false"}')]
+    tests += [StaticAssert(f'callable_is_noexcept_v<{callable}> == callable_traits<{callable}>::is_noexcept')]
+    tests += [StaticAssert(f'callable_specifier_mask_v<{callable}> == ({specifier_mask})')]
+    return tests
+
+
 def gen_function_tests(functions: list[Function], function_types: list[tuple[Optional[Qualifier], Optional[Pointer], Optional[Reference]]]) -> list[list[StaticAssert]]:
     trait_idx = 0
 
-    def traits(fn: Function):
+    def callable(fn: Function):
         nonlocal trait_idx
         fn_type = make_function_type(fn.name, function_types[trait_idx])
         trait_idx = (trait_idx + 1) % len(function_types)
-        return f'callable_traits<{fn_type}>'
+        return fn_type
+
+    def traits(fn: Function):
+        return f'callable_traits<{callable(fn)}>'
 
     tests = []
     for fn in functions:
         fn_tests = []
+        fn_tests += [StaticAssert(
+            f'std::is_same_v<{traits(fn)}::signature_type, {format_signature(fn)}>')]
         fn_tests += [StaticAssert(
             f'std::is_same_v<{traits(fn)}::result_type, {str(fn.return_type)}>')]
         for idx in range(0, 4):
@@ -294,8 +332,12 @@ def gen_function_tests(functions: list[Function], function_types: list[tuple[Opt
         fn_tests += [StaticAssert(f'{traits(fn)}::is_volatile == false')]
         fn_tests += [StaticAssert(f'{traits(fn)}::is_lvalue_reference == false')]
         fn_tests += [StaticAssert(f'{traits(fn)}::is_rvalue_reference == false')]
+        specifier_mask = format_specifier_mask(is_noexcept=fn.specifier == Specifier.NOEXCEPT,
+                                               is_variadic=fn.is_variadic)
+        fn_tests += [StaticAssert(f'{traits(fn)}::specifier_mask == ({specifier_mask})')]
         fn_tests += [StaticAssert(
             f'helper::has_class_type_v<{traits(fn)}> == false')]
+        fn_tests += gen_query_tests(callable(fn), fn, False, False, specifier_mask)
         tests += [fn_tests]
     return tests
 
@@ -305,6 +347,8 @@ def gen_member_function_tests(functions: list[MemberFunction]) -> list[list[Stat
     for fn in functions:
         traits = f'callable_traits<decltype(&{fn.class_type}::mem_fn)>'
         fn_tests = []
+        fn_tests += [StaticAssert(
+            f'std::is_same_v<{traits}::signature_type, {format_signature(fn)}>')]
         fn_tests += [StaticAssert(
             f'std::is_same_v<{traits}::result_type, {str(fn.return_type)}>')]
         for idx in range(0, 4):
@@ -329,10 +373,21 @@ def gen_member_function_tests(functions: list[MemberFunction]) -> list[list[Stat
             f'{traits}::is_lvalue_reference == {"true" if fn.member_specifier.reference == Reference.LVALUE_REFERENCE else "false"}')]
         fn_tests += [StaticAssert(
             f'{traits}::is_rvalue_reference == {"true" if fn.member_specifier.reference == Reference.RVALUE_REFERENCE else "false"}')]
+        specifier_mask = format_specifier_mask(
+            is_const=fn.member_specifier.qualifier in (Qualifier.CONST, Qualifier.CONST_VOLATILE),
+            is_volatile=fn.member_specifier.qualifier in (Qualifier.VOLATILE, Qualifier.CONST_VOLATILE),
+            is_lvalue_reference=fn.member_specifier.reference == Reference.LVALUE_REFERENCE,
+            is_rvalue_reference=fn.member_specifier.reference == Reference.RVALUE_REFERENCE,
+            is_noexcept=fn.member_specifier.specifier == Specifier.NOEXCEPT,
+            is_variadic=fn.is_variadic)
+        fn_tests += [StaticAssert(f'{traits}::specifier_mask == ({specifier_mask})')]
         fn_tests += [StaticAssert(
             f'helper::has_class_type_v<{traits}> == true')]
         fn_tests += [StaticAssert(
             f'std::is_same_v<{traits}::class_type, {fn.class_type}>')]
+        fn_tests += gen_query_tests(f'decltype(&{fn.class_type}::mem_fn)', fn, True, False, specifier_mask)
+        fn_tests += [StaticAssert(
+            f'std::is_same_v<callable_class_t<decltype(&{fn.class_type}::mem_fn)>, {fn.class_type}>')]
         tests += [fn_tests]
     return tests
 
@@ -342,6 +397,8 @@ def gen_lambda_function_tests(functions: list[LambdaFunction]) -> list[list[Stat
     for fn in functions:
         traits = f'callable_traits<decltype({fn.lambda_name})>'
         fn_tests = []
+        fn_tests += [StaticAssert(
+            f'std::is_same_v<{traits}::signature_type, {format_signature(fn)}>')]
         fn_tests += [StaticAssert(
             f'std::is_same_v<{traits}::result_type, {str(fn.return_type)}>')]
         for idx in range(0, 4):
@@ -365,10 +422,17 @@ def gen_lambda_function_tests(functions: list[LambdaFunction]) -> list[list[Stat
         fn_tests += [StaticAssert(f'{traits}::is_volatile == false')]
         fn_tests += [StaticAssert(f'{traits}::is_lvalue_reference == false')]
         fn_tests += [StaticAssert(f'{traits}::is_rvalue_reference == false')]
+        specifier_mask = format_specifier_mask(is_const=fn.lambda_specifier.mutable != Mutable.MUTABLE,
+                                               is_noexcept=fn.lambda_specifier.specifier == Specifier.NOEXCEPT,
+                                               is_variadic=fn.is_variadic)
+        fn_tests += [StaticAssert(f'{traits}::specifier_mask == ({specifier_mask})')]
         fn_tests += [StaticAssert(
             f'helper::has_class_type_v<{traits}> == true')]
         fn_tests += [StaticAssert(
             f'std::is_same_v<{traits}::class_type, std::remove_const_t<decltype({fn.lambda_name})>>')]
+        fn_tests += gen_query_tests(f'decltype({fn.lambda_name})', fn, False, True, specifier_mask)
+        fn_tests += [StaticAssert(
+            f'std::is_same_v<callable_class_t<decltype({fn.lambda_name})>, std::remove_const_t<decltype({fn.lambda_name})>>')]
         tests += [fn_tests]
     return tests
 
@@ -395,9 +459,29 @@ def append_main(source: str) -> str:
     return source + 'int main() { return 0; }'
 
 
+def gen_shard(functions: Union[list[Function], list[MemberFunction], list[LambdaFunction]], assertions: list[list[StaticAssert]]) -> str:
+    source = '/* This file was auto-generated */\n\n'
+    source = append_headers(source, headers)
+    return append_tests(source, functions, assertions)
+
+
+def partition(functions: list, assertions: list[list[StaticAssert]], group) -> dict[str, tuple[list, list[list[StaticAssert]]]]:
+    """Splits the functions and their tests by the shard name returned by `group`, keeping their order."""
+    shards = {}
+    for fn, tests in zip(functions, assertions):
+        shard_functions, shard_tests = shards.setdefault(group(fn), ([], []))
+        shard_functions.append(fn)
+        shard_tests.append(tests)
+    return shards
+
+
+def format_group(prefix: str, *names: Optional[Enum]) -> str:
+    return '_'.join([prefix] + [n.name.lower() for n in names if n])
+
+
 headers = [Header(h, True) for h in ['functional', 'string', 'type_traits']]
-headers += [Header(h, False) for h in ['../include/callable_traits.hpp',
-                                       'callable_traits_test_helper.hpp']]
+headers += [Header(h, False) for h in ['../../include/callable_traits.hpp',
+                                       '../callable_traits_test_helper.hpp']]
 
 all_qualifiers = [None] + [q for q in Qualifier]
 all_types = [t for t in Type]
@@ -437,11 +521,26 @@ lambda_functions = gen_lambda_functions(
     all_return_types, all_parameters, all_lambda_specifiers)
 lambda_function_tests = gen_lambda_function_tests(lambda_functions)
 
-source = '/* This file was auto-generated */\n\n'
-source = append_headers(source, headers)
-source = append_tests(source, functions, function_tests)
-source = append_tests(source, member_functions, member_function_tests)
-source = append_tests(source, lambda_functions, lambda_function_tests)
-source = append_main(source)
-
-print(source)
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument('--output-dir', type=Path, default=Path(__file__).resolve().parent / 'callable_traits_tests',
+                    help='directory the shards are written to')
+args = parser.parse_args()
+
+shards = {}
+shards.update(partition(functions, function_tests,
+                        lambda fn: format_group('functions', fn.specifier)))
+shards.update(partition(member_functions, member_function_tests,
+                        lambda fn: format_group('member_functions', fn.member_specifier.qualifier)))
+shards.update(partition(lambda_functions, lambda_function_tests,
+                        lambda fn: format_group('lambdas', fn.lambda_specifier.mutable)))
+
+args.output_dir.mkdir(parents=True, exist_ok=True)
+for name, (shard_functions, shard_tests) in shards.items():
+    (args.output_dir / f'{name}.cpp').write_text(gen_shard(shard_functions, shard_tests), encoding='utf-8')
+(args.output_dir / 'main.cpp').write_text(append_main('/* This file was auto-generated */\n\n') + '\n', encoding='utf-8')
+
+sources = ''.join(f'\t"${{CMAKE_CURRENT_LIST_DIR}}/{name}.cpp"\n' for name in shards)
+(args.output_dir / 'shards.cmake').write_text(
+    '# This file was auto-generated\n\n'
+    'set(CALLABLE_TRAITS_TEST_MAIN "${CMAKE_CURRENT_LIST_DIR}/main.cpp")\n'
+    f'set(CALLABLE_TRAITS_TEST_SHARDS\n{sources})\n', encoding='utf-8')
@@ -0,0 +1,42 @@
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../include/callable_traits.hpp"
+
+// Built with a small template depth limit, so argument access that recurses over the arguments fails to compile.
+
+template <std::size_t I>
+using arg = std::integral_constant<std::size_t, I>;
+
+template <std::size_t... I>
+auto make_function(std::index_sequence<I...>) -> void (*)(arg<I>...);
+
+template <std::size_t Arity>
+using function_t = decltype(make_function(std::make_index_sequence<Arity>{}));
+
+template <typename Function, std::size_t... I>
+constexpr bool check_arg_types(std::index_sequence<I...>)
+{
+	using traits = callable_traits<Function>;
+	return (std::is_same_v<typename traits::template arg_type<I>, arg<I>> && ...)
+	       && (std::is_same_v<callable_arg_t<Function, I>, arg<I>> && ...);
+}
+
+template <std::size_t Arity>
+constexpr bool check_arity()
+{
+	using function = function_t<Arity>;
+	return callable_traits<function>::arity == Arity && callable_arity_v<function> == Arity
+	       && check_arg_types<function>(std::make_index_sequence<Arity>{});
+}
+
+static_assert(check_arity<0>());
+static_assert(check_arity<1>());
+static_assert(check_arity<4>());
+static_assert(check_arity<64>());
+static_assert(check_arity<128>());
+static_assert(check_arity<255>());
+static_assert(check_arity<256>());
+
+int main() { return 0; }
@@ -0,0 +1,124 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/callable_traits/inplace_function.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct counter {
+	int add(int value) { return count += value; }
+	int count = 0;
+};
+
+int twice(int value) { return 2 * value; }
+int negate(int value) noexcept { return -value; }
+const int& identity(const int& value) noexcept { return value; }
+
+// Counts the live instances, to check that every stored callable is destroyed exactly once.
+struct tracked {
+	static inline int instances = 0;
+	tracked() { ++instances; }
+	tracked(const tracked&) { ++instances; }
+	tracked(tracked&&) noexcept { ++instances; }
+	~tracked() { --instances; }
+	int operator()(int value) const { return value; }
+};
+
+struct relocatable {
+	std::unique_ptr<int> value;
+	int operator()() const { return *value; }
+};
+
+template <>
+struct is_trivially_relocatable<relocatable> : std::true_type {};
+
+[[maybe_unused]] const auto lambda = [](const std::string&) { return 1.0; };
+
+// The signature is deduced, including noexcept.
+static_assert(std::is_same_v<decltype(inplace_function(twice)), inplace_function<int(int)>>);
+static_assert(std::is_same_v<decltype(inplace_function(negate)), inplace_function<int(int) noexcept>>);
+static_assert(std::is_same_v<decltype(inplace_function(lambda)), inplace_function<double(const std::string&)>>);
+static_assert(std::is_same_v<unique_function<void()>, inplace_function<void(), inplace_function_default_capacity>>);
+
+static_assert(sizeof(inplace_function<void(), 64, 8>) == 64 + sizeof(void*));
+static_assert(alignof(inplace_function<void(), 64, 64>) == 64);
+static_assert(std::is_nothrow_move_constructible_v<unique_function<void()>>);
+static_assert(std::is_nothrow_move_assignable_v<unique_function<void()>>);
+static_assert(!std::is_copy_constructible_v<unique_function<void()>>);
+static_assert(std::is_nothrow_invocable_v<unique_function<int(int) noexcept>&, int>);
+static_assert(!std::is_nothrow_invocable_v<unique_function<int(int)>&, int>);
+
+static_assert(std::is_constructible_v<unique_function<long(short)>, decltype(&twice)>);
+static_assert(!std::is_constructible_v<unique_function<int(int) noexcept>, decltype(&twice)>);
+static_assert(!std::is_constructible_v<unique_function<int(std::string)>, decltype(&twice)>);
+static_assert(!std::is_constructible_v<unique_function<int(int)>, int>);
+
+static_assert(is_trivially_relocatable_v<int (*)(int)>);
+static_assert(!is_trivially_relocatable_v<std::string>);
+static_assert(is_trivially_relocatable_v<relocatable>);
+
+int main()
+{
+	unique_function<int(int)> empty;
+	helper::check(!empty);
+	helper::check(!unique_function<int(int)>(nullptr));
+	helper::check(!unique_function<int(int)>(static_cast<int (*)(int)>(nullptr)));
+
+	unique_function<int(int)> f = twice;
+	helper::check(f && f(3) == 6);
+	f = negate;
+	helper::check(f(3) == -3);
+
+	counter c;
+	unique_function<int(counter&, int)> add = &counter::add;
+	add(c, 2);
+	helper::check(c.count == 2);
+
+	int offset = 10;
+	unique_function<int(int)> add_offset = [offset, calls = 0](int value) mutable { return value + offset + ++calls; };
+	helper::check(add_offset(1) == 12);
+	unique_function<int(int)> moved = std::move(add_offset);
+	helper::check(!add_offset && moved(1) == 13);
+
+	unique_function<int()> owning = relocatable{std::make_unique<int>(5)};
+	unique_function<int()> relocated = std::move(owning);
+	helper::check(!owning && relocated() == 5);
+
+	{
+		unique_function<int(int)> a = tracked{};
+		helper::check(tracked::instances == 1);
+		unique_function<int(int)> b = std::move(a);
+		helper::check(tracked::instances == 1 && b(4) == 4);
+		b = nullptr;
+		helper::check(tracked::instances == 0);
+		a = tracked{};
+		b = std::move(a);
+		helper::check(tracked::instances == 1);
+	}
+	helper::check(tracked::instances == 0);
+
+	std::vector<unique_function<int()>> tasks;
+	for (int i = 0; i < 100; ++i)
+		tasks.emplace_back([i] { return i; });
+	int sum = 0;
+	for (auto& task : tasks)
+		sum += task();
+	helper::check(sum == 4950);
+
+	// Stateless closures fit into less capacity than a function pointer, as the empty closure is stored then.
+	inplace_function<int(int), 1, 1> tiny = [](int value) { return value + 1; };
+	helper::check(tiny(1) == 2);
+	inplace_function<int(int), 1, 1> moved_tiny = std::move(tiny);
+	helper::check(!tiny && moved_tiny(2) == 3);
+
+	// Arguments taken by reference reach the callable as the object of the caller, not as a copy.
+	const int value = 7;
+	unique_function<const int&(const int&) noexcept> forward = identity;
+	helper::check(&forward(value) == &value);
+	unique_function<bool(const int&)> same_object = [&value](const int& argument) { return &argument == &value; };
+	helper::check(same_object(value));
+
+	return helper::failures;
+}
@@ -0,0 +1,62 @@
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../include/callable_traits/member_function_thunk.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct widget {
+	int add(int value) noexcept { return total += value; }
+	int subtract(int value) noexcept { return total -= value; }
+	int multiply(int value) { return total *= value; }
+	int get() const { return total; }
+	int get_volatile() const volatile noexcept { return total; }
+	std::string take() && { return std::to_string(total); }
+	virtual int scaled(int factor) const { return total * factor; }
+	virtual ~widget() = default;
+	int total = 0;
+};
+
+struct scaled_widget : widget {
+	int scaled(int factor) const override { return 2 * total * factor; }
+};
+
+// The object parameter has the cv and reference specifiers of the member function, noexcept is kept.
+static_assert(std::is_same_v<member_function_thunk_t<&widget::add>, int (*)(widget&, int) noexcept>);
+static_assert(std::is_same_v<member_function_thunk_t<&widget::get>, int (*)(const widget&)>);
+static_assert(std::is_same_v<member_function_thunk_t<&widget::get_volatile>, int (*)(const volatile widget&) noexcept>);
+static_assert(std::is_same_v<member_function_thunk_t<&widget::take>, std::string (*)(widget&&)>);
+static_assert(sizeof(member_function_thunk_v<&widget::add>) == sizeof(void*));
+
+using table = member_function_table<&widget::add, &widget::subtract>;
+static_assert(std::is_same_v<table::pointer, int (*)(widget&, int) noexcept>);
+static_assert(sizeof(table::thunks) == 2 * sizeof(void*));
+
+using mixed_table = member_function_table<&widget::add, &widget::subtract, &widget::multiply>;
+static_assert(std::is_same_v<mixed_table::pointer, int (*)(widget&, int)>);
+static_assert(mixed_table::size == 3);
+
+int main()
+{
+	widget w;
+	member_function_thunk_v<&widget::add>(w, 5);
+	helper::check(member_function_thunk_v<&widget::get>(w) == 5);
+	helper::check(member_function_thunk_v<&widget::get_volatile>(w) == 5);
+	helper::check(member_function_thunk_v<&widget::take>(std::move(w)) == "5");
+
+	// Virtual member functions are still dispatched on the dynamic type.
+	scaled_widget s;
+	s.total = 1;
+	helper::check(member_function_thunk_v<&widget::scaled>(s, 3) == 6);
+
+	mixed_table::call(0, w, 3);
+	mixed_table::call(2, w, 4);
+	mixed_table::call(1, w, 2);
+	helper::check(w.total == 30);
+
+	constexpr auto thunks = table::thunks;
+	thunks[1](w, 10);
+	helper::check(w.total == 20);
+
+	return helper::failures;
+}
@@ -0,0 +1,59 @@
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/method_ref.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct widget {
+	void on_tick(int ticks) noexcept { total += ticks; }
+	std::string name(const char* prefix) const { return prefix + std::to_string(total); }
+	int total = 0;
+};
+
+int twice(int value) { return 2 * value; }
+void log_line(const char*) noexcept {}
+
+using on_tick_ref = method_ref<&widget::on_tick>;
+static_assert(std::is_same_v<on_tick_ref::class_type, widget>);
+static_assert(std::is_same_v<on_tick_ref::object_type, widget>);
+static_assert(std::is_same_v<on_tick_ref::result_type, void>);
+static_assert(std::is_same_v<on_tick_ref::args, type_list<int>>);
+static_assert(on_tick_ref::is_noexcept);
+static_assert(std::is_same_v<method_ref<&widget::name>::object_type, const widget>);
+static_assert(!method_ref<&widget::name>::is_noexcept);
+static_assert(sizeof(on_tick_ref) == sizeof(widget*));
+static_assert(!std::is_constructible_v<on_tick_ref, const widget*>);
+
+static_assert(std::is_same_v<fn_ref<&twice>::result_type, int>);
+static_assert(std::is_same_v<fn_ref<twice>::args, type_list<int>>);
+static_assert(!fn_ref<&twice>::is_noexcept);
+static_assert(fn_ref<&log_line>::is_noexcept);
+static_assert(std::is_nothrow_invocable_v<fn_ref<&log_line>, const char*>);
+static_assert(std::is_empty_v<fn_ref<&twice>>);
+static_assert(std::is_trivially_copyable_v<fn_ref<&twice>>);
+
+// Empty base optimization compresses stateless callbacks to zero bytes.
+template <typename Callback>
+struct counter : private Callback {
+	int count;
+};
+
+static_assert(sizeof(counter<fn_ref<&twice>>) == sizeof(int));
+
+int main()
+{
+	widget w;
+	on_tick_ref on_tick(&w);
+	on_tick(2);
+	on_tick(3);
+	helper::check(w.total == 5);
+
+	const method_ref<&widget::name> name(&w);
+	helper::check(name("total ") == "total 5");
+
+	constexpr fn_ref<&twice> twice_ref{};
+	helper::check(twice_ref(4) == 8);
+	fn_ref<log_line>{}("line");
+
+	return helper::failures;
+}
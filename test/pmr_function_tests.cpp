@@ -0,0 +1,133 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/callable_traits/pmr_function.hpp"
+#include "callable_traits_test_helper.hpp"
+
+// Counts the allocations and deallocations it forwards to the new_delete_resource.
+class counting_resource : public std::pmr::memory_resource {
+public:
+	int allocations = 0;
+	int deallocations = 0;
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+	{
+		++deallocations;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Counts the live instances, to check that every stored callable is destroyed exactly once.
+struct tracked {
+	static inline int instances = 0;
+	tracked() { ++instances; }
+	tracked(const tracked&) { ++instances; }
+	tracked(tracked&&) noexcept { ++instances; }
+	~tracked() { --instances; }
+	int operator()(int value) const { return value + padding[0]; }
+	std::array<int, 16> padding = {};
+};
+
+int twice(int value) { return 2 * value; }
+int negate(int value) noexcept { return -value; }
+const int& identity(const int& value) noexcept { return value; }
+
+[[maybe_unused]] const auto lambda = [](const std::string&) { return 1.0; };
+
+// The signature is deduced, including noexcept.
+static_assert(std::is_same_v<decltype(pmr_function(twice)), pmr_function<int(int)>>);
+static_assert(std::is_same_v<decltype(pmr_function(negate)), pmr_function<int(int) noexcept>>);
+static_assert(std::is_same_v<decltype(pmr_function(lambda, std::pmr::get_default_resource())),
+                             pmr_function<double(const std::string&)>>);
+
+static_assert(sizeof(pmr_function<void()>) == 4 * sizeof(void*));
+static_assert(std::is_nothrow_move_constructible_v<pmr_function<void()>>);
+static_assert(!std::is_copy_constructible_v<pmr_function<void()>>);
+static_assert(std::uses_allocator_v<pmr_function<void()>, std::pmr::polymorphic_allocator<std::byte>>);
+static_assert(std::is_nothrow_invocable_v<pmr_function<int(int) noexcept>&, int>);
+static_assert(!std::is_constructible_v<pmr_function<int(int) noexcept>, decltype(&twice)>);
+static_assert(!std::is_constructible_v<pmr_function<int(int)>, int>);
+
+int main()
+{
+	counting_resource resource;
+
+	pmr_function<int(int)> empty(&resource);
+	helper::check(!empty && empty.get_allocator().resource() == &resource);
+	helper::check(!pmr_function<int(int)>(static_cast<int (*)(int)>(nullptr)));
+
+	// Small callables are stored inline, larger ones are allocated from the memory resource.
+	pmr_function<int(int)> small([offset = 1](int value) { return value + offset; }, &resource);
+	helper::check(small(1) == 2 && resource.allocations == 0);
+	{
+		pmr_function<int(int)> large(tracked{}, &resource);
+		helper::check(large(3) == 3 && resource.allocations == 1 && tracked::instances == 1);
+
+		// Moving takes the memory resource along, so the allocation is handed over.
+		pmr_function<int(int)> moved = std::move(large);
+		helper::check(!large && moved(4) == 4 && resource.allocations == 1 && tracked::instances == 1);
+		helper::check(moved.get_allocator().resource() == &resource);
+	}
+	helper::check(resource.deallocations == 1 && tracked::instances == 0);
+
+	// Move assignment keeps the memory resource of the assigned function, so the callable is moved to it.
+	counting_resource other_resource;
+	{
+		pmr_function<int(int)> a(tracked{}, &resource);
+		pmr_function<int(int)> b(&other_resource);
+		b = std::move(a);
+		helper::check(!a && b(5) == 5 && tracked::instances == 1);
+		helper::check(other_resource.allocations == 1 && resource.deallocations == 2);
+	}
+	helper::check(other_resource.deallocations == 1 && tracked::instances == 0);
+
+	// Containers using the memory resource pass it to the functions they hold.
+	{
+		std::pmr::vector<pmr_function<int(int)>> callbacks(&resource);
+		callbacks.emplace_back(tracked{});
+		callbacks.emplace_back(twice);
+		helper::check(callbacks[0].get_allocator().resource() == &resource);
+		helper::check(callbacks[0](6) == 6 && callbacks[1](6) == 12);
+	}
+	helper::check(resource.allocations == resource.deallocations && tracked::instances == 0);
+
+	// An arena releases every callable at once, after they are destroyed.
+	std::array<std::byte, 1024> buffer;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), &resource);
+	{
+		std::pmr::vector<pmr_function<int()>> tasks(&arena);
+		for (int i = 0; i < 8; ++i)
+			tasks.emplace_back([i, data = std::array<int, 8>{}] { return i + data[0]; });
+		int sum = 0;
+		for (auto& task : tasks)
+			sum += task();
+		helper::check(sum == 28);
+	}
+	arena.release();
+	helper::check(resource.allocations == resource.deallocations);
+
+	// Arguments taken by reference reach the callable as the object of the caller, not as a copy.
+	const int value = 7;
+	pmr_function<const int&(const int&) noexcept> forward(identity, &resource);
+	helper::check(&forward(value) == &value);
+	const auto is_value = [&value](const int& argument) { return &argument == &value; };
+	pmr_function<bool(const int&)> same_object(is_value, &resource);
+	helper::check(same_object(value));
+
+	return helper::failures;
+}
@@ -0,0 +1,106 @@
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/callable_traits/arg_pass.hpp"
+#include "../include/callable_traits/bind_front.hpp"
+#include "../include/callable_traits/function_ref.hpp"
+#include "../include/callable_traits/inplace_function.hpp"
+#include "../include/callable_traits/pmr_function.hpp"
+#include "../include/callable_traits/run_task.hpp"
+#include "callable_traits_test_helper.hpp"
+
+// Move constructor which may throw, as in classes written without noexcept.
+struct throwing_move {
+	throwing_move() = default;
+	throwing_move(const throwing_move&) = default;
+	throwing_move(throwing_move&&) {}
+};
+
+[[maybe_unused]] const auto nothrow_task = [text = std::string()]() noexcept { return text.size(); };
+[[maybe_unused]] const auto throwing_task = [text = std::string()] { return text.size(); };
+[[maybe_unused]] const auto throwing_move_task = [member = throwing_move()]() noexcept { static_cast<void>(member); };
+
+using nothrow_type = std::remove_const_t<decltype(nothrow_task)>;
+using throwing_type = std::remove_const_t<decltype(throwing_task)>;
+using throwing_move_type = std::remove_const_t<decltype(throwing_move_task)>;
+
+// The call operators of the wrappers are noexcept exactly if the one of the wrapped callable is.
+static_assert(std::is_nothrow_invocable_v<decltype(inplace_function(nothrow_task))&>);
+static_assert(!std::is_nothrow_invocable_v<decltype(inplace_function(throwing_task))&>);
+static_assert(std::is_nothrow_invocable_v<decltype(pmr_function(nothrow_task))&>);
+static_assert(!std::is_nothrow_invocable_v<decltype(pmr_function(throwing_task))&>);
+static_assert(std::is_nothrow_invocable_v<decltype(function_ref(nothrow_task))>);
+static_assert(!std::is_nothrow_invocable_v<decltype(function_ref(throwing_task))>);
+static_assert(std::is_nothrow_invocable_v<decltype(bind_front(nothrow_task))>);
+static_assert(!std::is_nothrow_invocable_v<decltype(bind_front(throwing_task))>);
+static_assert(std::is_nothrow_invocable_v<invoke_adaptor<nothrow_type>>);
+static_assert(!std::is_nothrow_invocable_v<invoke_adaptor<throwing_type>>);
+
+// Their move constructors and destructors are noexcept if the ones of the callable are, the type-erased ones always.
+static_assert(std::is_nothrow_move_constructible_v<decltype(bind_front(nothrow_task))>);
+static_assert(!std::is_nothrow_move_constructible_v<decltype(bind_front(throwing_move_task))>);
+static_assert(std::is_nothrow_move_constructible_v<invoke_adaptor<nothrow_type>>);
+static_assert(!std::is_nothrow_move_constructible_v<invoke_adaptor<throwing_move_type>>);
+static_assert(std::is_nothrow_move_constructible_v<decltype(curry(std::declval<int (*)(int, int) noexcept>()))>);
+static_assert(std::is_nothrow_move_constructible_v<unique_function<void()>>);
+static_assert(std::is_nothrow_move_constructible_v<pmr_function<void()>>);
+static_assert(std::is_nothrow_destructible_v<decltype(bind_front(nothrow_task))>);
+static_assert(std::is_nothrow_destructible_v<unique_function<void()>>);
+
+// Storing a callable is noexcept if it cannot throw, which pmr_function only knows for callables stored inline.
+static_assert(std::is_nothrow_constructible_v<unique_function<std::size_t()>, nothrow_type>);
+static_assert(!std::is_nothrow_constructible_v<unique_function<void()>, throwing_move_type>);
+static_assert(std::is_nothrow_constructible_v<pmr_function<int(int)>, int (*)(int)>);
+static_assert(!std::is_nothrow_constructible_v<pmr_function<std::size_t()>, nothrow_type>);
+
+static_assert(is_noexcept_task_v<decltype(nothrow_task)>);
+static_assert(is_noexcept_task_v<unique_function<void() noexcept>&>);
+static_assert(!is_noexcept_task_v<decltype(throwing_task)>);
+static_assert(!is_noexcept_task_v<unique_function<void()>>);
+
+// Tasks without a deducible signature fall back to whether calling them can throw.
+[[maybe_unused]] const auto generic_task = [](auto... values) noexcept { return sizeof...(values); };
+[[maybe_unused]] const auto throwing_generic_task = [](auto... values) { return sizeof...(values); };
+static_assert(is_noexcept_task_v<decltype(generic_task)>);
+static_assert(!is_noexcept_task_v<decltype(throwing_generic_task)>);
+static_assert(!is_noexcept_task_v<decltype(std::bind(&std::string::size, std::string()))>);
+
+int main()
+{
+	int runs = 0;
+	helper::check(run_task([&runs]() noexcept { ++runs; }) == nullptr);
+	helper::check(run_task([&runs](int step) { runs += step; }, 2) == nullptr);
+	helper::check(runs == 3);
+
+	const std::exception_ptr error = run_task([] { throw std::runtime_error("failed"); });
+	helper::check(error != nullptr);
+	try {
+		std::rethrow_exception(error);
+	} catch (const std::runtime_error& e) {
+		helper::check(std::string(e.what()) == "failed");
+	}
+
+	helper::check(run_task(generic_task, 1, 2) == nullptr);
+
+	// Converting the arguments may throw even for noexcept tasks, so these run inside a try block.
+	std::string received;
+	helper::check(run_task([&received](std::string text) noexcept { received = std::move(text); }, "hello") == nullptr);
+	helper::check(received == "hello");
+	helper::check(run_task([&runs](auto step) { runs += step; }, 1) == nullptr && runs == 4);
+	helper::check(run_task(std::bind([](int value) { throw value; }, 3)) != nullptr);
+
+	// Queues of noexcept tasks run every task without try blocks.
+	std::vector<unique_function<void() noexcept>> tasks;
+	for (int i = 0; i < 10; ++i)
+		tasks.emplace_back([&runs, i]() noexcept { runs += i; });
+	for (auto& task : tasks)
+		helper::check(run_task(task) == nullptr);
+	helper::check(runs == 49);
+
+	return helper::failures;
+}
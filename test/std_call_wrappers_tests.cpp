@@ -0,0 +1,90 @@
+#include <functional>
+#include <future>
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/std_call_wrappers.hpp"
+#include "callable_traits_test_helper.hpp"
+
+struct functor {
+	int operator()(float, std::string&) const noexcept;
+};
+
+int fn(const char*, ...);
+
+using function_t = std::function<int(float, std::string&)>;
+static_assert(std::is_same_v<callable_traits<function_t>::result_type, int>);
+static_assert(std::is_same_v<callable_traits<function_t>::arg_type<0>, float>);
+static_assert(std::is_same_v<callable_traits<function_t>::arg_type<1>, std::string&>);
+#if !defined(_MSVC_STL_VERSION)
+static_assert(std::is_same_v<callable_traits<function_t>::class_type, function_t>);
+#endif
+static_assert(callable_traits<function_t>::arity == 2);
+static_assert(callable_traits<function_t>::is_functor == true);
+static_assert(callable_traits<function_t>::is_member_function == false);
+static_assert(callable_traits<function_t>::specifier_mask == callable_specifier::is_const);
+static_assert(callable_traits<const function_t&>::specifier_mask == callable_specifier::is_const);
+static_assert(std::is_same_v<callable_signature_t<function_t>, int(float, std::string&)>);
+static_assert(std::is_same_v<callable_result_t<function_t>, int>);
+static_assert(std::is_same_v<callable_arg_t<function_t, 1>, std::string&>);
+#if !defined(_MSVC_STL_VERSION)
+static_assert(std::is_same_v<callable_class_t<function_t>, function_t>);
+#endif
+static_assert(callable_arity_v<function_t> == 2);
+static_assert(callable_is_functor_v<function_t> == true);
+static_assert(callable_specifier_mask_v<function_t> == callable_specifier::is_const);
+
+using void_function_t = std::function<void()>;
+static_assert(std::is_same_v<callable_traits<void_function_t>::result_type, void>);
+static_assert(callable_traits<void_function_t>::arity == 0);
+static_assert(helper::has_arg0_type_v<callable_traits<void_function_t>> == false);
+
+using packaged_task_t = std::packaged_task<std::string(int, bool)>;
+static_assert(std::is_same_v<callable_traits<packaged_task_t>::result_type, void>);
+static_assert(std::is_same_v<callable_traits<packaged_task_t>::arg_type<0>, int>);
+static_assert(std::is_same_v<callable_traits<packaged_task_t>::arg_type<1>, bool>);
+static_assert(std::is_same_v<callable_traits<packaged_task_t>::class_type, packaged_task_t>);
+static_assert(callable_traits<packaged_task_t>::arity == 2);
+static_assert(callable_traits<packaged_task_t>::is_functor == true);
+static_assert(callable_traits<packaged_task_t>::specifier_mask == callable_specifier::none);
+static_assert(std::is_same_v<callable_signature_t<packaged_task_t>, void(int, bool)>);
+static_assert(std::is_same_v<callable_result_t<packaged_task_t>, void>);
+static_assert(callable_arity_v<packaged_task_t> == 2);
+
+#if defined(__cpp_lib_move_only_function)
+using move_only_function_t = std::move_only_function<bool(int) const & noexcept>;
+static_assert(std::is_same_v<callable_traits<move_only_function_t>::result_type, bool>);
+static_assert(std::is_same_v<callable_traits<move_only_function_t>::arg_type<0>, int>);
+static_assert(std::is_same_v<callable_traits<move_only_function_t>::class_type, move_only_function_t>);
+static_assert(callable_traits<move_only_function_t>::is_functor == true);
+static_assert(callable_traits<move_only_function_t>::specifier_mask
+              == (callable_specifier::is_const | callable_specifier::is_lvalue_reference
+                  | callable_specifier::is_noexcept));
+static_assert(callable_is_noexcept_v<move_only_function_t> == true);
+
+using rvalue_move_only_function_t = std::move_only_function<void(int&&) &&>;
+static_assert(callable_traits<rvalue_move_only_function_t>::specifier_mask == callable_specifier::is_rvalue_reference);
+static_assert(std::is_same_v<callable_arg_t<rvalue_move_only_function_t, 0>, int&&>);
+#endif
+
+using functor_reference_t = std::reference_wrapper<const functor>;
+static_assert(std::is_same_v<callable_traits<functor_reference_t>::result_type, int>);
+static_assert(std::is_same_v<callable_traits<functor_reference_t>::class_type, functor>);
+static_assert(callable_traits<functor_reference_t>::arity == 2);
+static_assert(callable_traits<functor_reference_t>::is_functor == true);
+static_assert(callable_traits<functor_reference_t>::is_noexcept == true);
+static_assert(std::is_same_v<callable_result_t<functor_reference_t>, int>);
+static_assert(std::is_same_v<callable_class_t<functor_reference_t>, functor>);
+static_assert(callable_is_noexcept_v<functor_reference_t> == true);
+
+using function_reference_t = std::reference_wrapper<decltype(fn)>;
+static_assert(std::is_same_v<callable_traits<function_reference_t>::result_type, int>);
+static_assert(std::is_same_v<callable_traits<function_reference_t>::arg_type<0>, const char*>);
+static_assert(callable_traits<function_reference_t>::arity == 1);
+static_assert(callable_traits<function_reference_t>::is_functor == false);
+static_assert(callable_traits<function_reference_t>::is_variadic == true);
+static_assert(helper::has_class_type_v<callable_traits<function_reference_t>> == false);
+static_assert(callable_arity_v<function_reference_t> == 1);
+static_assert(callable_is_variadic_v<function_reference_t> == true);
+
+int main() { return 0; }
@@ -0,0 +1,64 @@
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/trampoline.hpp"
+#include "callable_traits_test_helper.hpp"
+
+// A C library calling back with the user data first or last.
+extern "C" {
+typedef int (*visit_first_t)(void* user_data, int value);
+typedef int (*visit_last_t)(int value, void* user_data);
+
+static int visit_range_first(int count, visit_first_t visit, void* user_data)
+{
+	int result = 0;
+	for (int i = 0; i < count; ++i)
+		result += visit(user_data, i);
+	return result;
+}
+
+static int visit_range_last(int count, visit_last_t visit, void* user_data)
+{
+	int result = 0;
+	for (int i = 0; i < count; ++i)
+		result += visit(i, user_data);
+	return result;
+}
+}
+
+struct functor {
+	std::string operator()(const char* s) const noexcept { return s; }
+};
+
+static_assert(std::is_same_v<decltype(trampoline_v<functor>), std::string (*const)(void*, const char*) noexcept>);
+static_assert(std::is_same_v<decltype(trampoline_last_v<functor>), std::string (*const)(const char*, void*) noexcept>);
+
+int main()
+{
+	int calls = 0;
+	auto square = [&calls](int value) {
+		++calls;
+		return value * value;
+	};
+	static_assert(std::is_same_v<decltype(trampoline_v<decltype(square)>), int (*const)(void*, int)>);
+	static_assert(std::is_convertible_v<decltype(trampoline_v<decltype(square)>), visit_first_t>);
+	static_assert(std::is_convertible_v<decltype(trampoline_last_v<decltype(square)>), visit_last_t>);
+
+	helper::check(visit_range_first(4, trampoline_v<decltype(square)>, &square) == 14);
+	helper::check(calls == 4);
+
+	auto [visit, user_data] = make_trampoline_last(square);
+	helper::check(visit_range_last(3, visit, user_data) == 5);
+	helper::check(calls == 7);
+
+	// Const callables work through the same trampolines.
+	int offset = 10;
+	const auto add_offset = [offset](int value) { return value + offset; };
+	auto callback = make_trampoline(add_offset);
+	helper::check(visit_range_first(2, callback.function, callback.user_data) == 21);
+
+	functor f;
+	helper::check(trampoline_v<functor>(&f, "text") == "text");
+
+	return helper::failures;
+}
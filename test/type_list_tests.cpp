@@ -0,0 +1,64 @@
+#include <string>
+#include <type_traits>
+
+#include "../include/callable_traits/type_list.hpp"
+
+template <typename T>
+struct is_non_const_lvalue_reference
+    : std::bool_constant<std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>> {};
+
+struct foo {
+	void mem_fn(int, const std::string&, float*, std::string&, int, const char*) const;
+};
+
+[[maybe_unused]] const auto lambda = [](bool, double&&) {};
+
+void fn(int, ...);
+void no_args();
+
+using args = callable_args_t<decltype(&foo::mem_fn)>;
+
+static_assert(std::is_same_v<args, type_list<int, const std::string&, float*, std::string&, int, const char*>>);
+static_assert(std::is_same_v<callable_traits<decltype(&foo::mem_fn)>::args, args>);
+static_assert(std::is_same_v<callable_traits<decltype(lambda)>::args, type_list<bool, double&&>>);
+static_assert(std::is_same_v<callable_args_t<decltype(fn)>, type_list<int>>);
+static_assert(std::is_same_v<callable_args_t<decltype(no_args)>, type_list<>>);
+static_assert(args::size == 6);
+static_assert(type_list<>::size == 0);
+
+static_assert(std::is_same_v<type_list_at_t<args, 0>, int>);
+static_assert(std::is_same_v<type_list_at_t<args, 5>, const char*>);
+
+static_assert(std::is_same_v<type_list_transform_t<args, std::decay>,
+                             type_list<int, std::string, float*, std::string, int, const char*>>);
+static_assert(std::is_same_v<type_list_transform_t<type_list<>, std::decay>, type_list<>>);
+
+static_assert(std::is_same_v<type_list_filter_t<args, std::is_pointer>, type_list<float*, const char*>>);
+static_assert(std::is_same_v<type_list_filter_t<args, std::is_reference>, type_list<const std::string&, std::string&>>);
+static_assert(std::is_same_v<type_list_filter_t<args, std::is_void>, type_list<>>);
+static_assert(std::is_same_v<type_list_filter_t<type_list<>, std::is_pointer>, type_list<>>);
+
+static_assert(type_list_find_if_v<args, is_non_const_lvalue_reference> == 3);
+static_assert(type_list_find_if_v<args, std::is_pointer> == 2);
+static_assert(type_list_find_if_v<args, std::is_void> == args::size);
+static_assert(type_list_find_if_v<type_list<>, std::is_pointer> == 0);
+
+static_assert(type_list_count_if_v<args, std::is_pointer> == 2);
+static_assert(type_list_count_if_v<args, std::is_integral> == 2);
+static_assert(type_list_count_if_v<args, std::is_void> == 0);
+static_assert(type_list_count_if_v<type_list<>, std::is_pointer> == 0);
+
+static_assert(type_list_index_of_v<args, int> == 0);
+static_assert(type_list_index_of_v<args, std::string&> == 3);
+static_assert(type_list_index_of_v<args, std::string> == args::size);
+
+static_assert(std::is_same_v<type_list_unique_t<args>,
+                             type_list<int, const std::string&, float*, std::string&, const char*>>);
+static_assert(std::is_same_v<type_list_unique_t<type_list<int, int, int>>, type_list<int>>);
+static_assert(std::is_same_v<type_list_unique_t<type_list<>>, type_list<>>);
+
+// Algorithms compose, e.g. the distinct decayed argument types.
+static_assert(std::is_same_v<type_list_unique_t<type_list_transform_t<args, std::decay>>,
+                             type_list<int, std::string, float*, const char*>>);
+
+int main() { return 0; }